@@ -0,0 +1,35 @@
+#include <stdio.h>  // 系统头文件
+#include <string>   // 系统头文件
+
+#include "renderer/core/managers/config_manager.h"  // 项目头文件（管理器）
+#include "renderer/core/managers/headless_benchmark.h"  // 项目头文件（管理器）
+#include "renderer/core/utils/frame_tracer.h"  // 项目头文件（工具）
+#include "renderer/vulkan/vulkan_renderer_factory.h"  // 项目头文件（实现）
+
+// 控制台入口（shader_bench）- 只运行 headless 基准测试，不依赖 Windows API
+// Windows 上作为控制台程序构建，命令行会等待退出代码；其他平台没有窗口实现，这是唯一的入口
+int main(int argc, char* argv[]) {
+    // 拼接为与 WinMain 的 lpCmdLine 相同格式的命令行（始终是 headless 模式，含空格的路径值加引号）
+    std::string cmdLine = "--headless";
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        size_t valuePos = arg.find('=');
+        if (valuePos != std::string::npos && arg.find(' ') != std::string::npos) {
+            arg = arg.substr(0, valuePos + 1) + "\"" + arg.substr(valuePos + 1) + "\"";
+        }
+        cmdLine += " " + arg;
+    }
+    
+    ConfigManager launchConfig;
+    launchConfig.Initialize(cmdLine.c_str());
+    
+    // --trace：记录CPU帧阶段，基准测试结束后写出
+    if (launchConfig.IsFrameTraceEnabled()) {
+        FrameTracer::Enable(launchConfig.GetFrameTracePath());
+        FrameTracer::SetThreadName("Main");
+    }
+    
+    // 创建渲染器工厂（实现依赖倒置）
+    VulkanRendererFactory rendererFactory;
+    return HeadlessBenchmark::RunUnattended(&rendererFactory, &launchConfig);
+}
@@ -2,16 +2,50 @@
 #define WIN32_LEAN_AND_MEAN
 #define NOMINMAX
 
+#include <stdio.h>    // 系统头文件
 #include <windows.h>  // 系统头文件
 
 #include "renderer/core/interfaces/irenderer_factory.h"  // 项目头文件（接口）
 #include "renderer/core/managers/application.h"  // 项目头文件（管理器）
+#include "renderer/core/managers/config_manager.h"  // 项目头文件（管理器）
+#include "renderer/core/managers/headless_benchmark.h"  // 项目头文件（管理器）
+#include "renderer/core/utils/frame_tracer.h"  // 项目头文件（工具）
 #include "renderer/vulkan/vulkan_renderer_factory.h"  // 项目头文件（实现）
 
+namespace {
+
+// GUI 子系统程序启动时没有控制台：附加到启动它的命令行窗口（没有时新建一个），使统计结果和错误可见
+// 命令行不会等待 GUI 程序退出，CI 应使用控制台入口 shader_bench.exe（见 headless_main.cpp）
+void AttachHeadlessConsole() {
+    if (!AttachConsole(ATTACH_PARENT_PROCESS) && !AllocConsole()) {
+        return;
+    }
+    FILE* stream = nullptr;
+    freopen_s(&stream, "CONOUT$", "w", stdout);
+    freopen_s(&stream, "CONOUT$", "w", stderr);
+}
+
+} // namespace
+
 int WINAPI WinMain(HINSTANCE hInstance, HINSTANCE hPrevInstance, LPSTR lpCmdLine, int nCmdShow) {
     // 创建渲染器工厂（实现依赖倒置）
     VulkanRendererFactory rendererFactory;
     
+    // --headless：不创建窗口，在离屏目标上测量各场景帧耗时
+    ConfigManager launchConfig;
+    launchConfig.Initialize(lpCmdLine);
+    
+    // --trace：记录CPU帧阶段，窗口模式按 F9 写出，headless 模式在基准测试结束后写出
+    if (launchConfig.IsFrameTraceEnabled()) {
+        FrameTracer::Enable(launchConfig.GetFrameTracePath());
+        FrameTracer::SetThreadName("Main");
+    }
+    
+    if (launchConfig.IsHeadless()) {
+        AttachHeadlessConsole();
+        return HeadlessBenchmark::RunUnattended(&rendererFactory, &launchConfig);
+    }
+    
     // 使用Application类管理整个应用
     Application app;
     
@@ -23,6 +23,54 @@ enum class BackgroundStretchMode {
     Scaled       // 缩放模式：保持宽高比，填充整个窗口无间隙（最小覆盖尺寸）
 };
 
+/**
+ * 帧节奏模式
+ * 控制交换链呈现模式以及主循环在帧之间如何等待
+ */
+enum class FramePacingMode {
+    VSync,       // 垂直同步（FIFO），根据实测呈现间隔推迟帧开始时间以降低输入延迟
+    LowLatency,  // 低延迟（MAILBOX），不等待，呈现引擎总是显示最新完成的帧
+    Capped       // 限帧（优先 IMMEDIATE），使用高精度等待把帧率限制在目标值
+};
+
+/**
+ * loading_cubes 渲染方式
+ * 各路径使用同一份逐立方体动画数据，运行时可切换以比较各设备上的性能
+ */
+enum class CubeRenderMode {
+    RayCast,     // 全屏片段着色器逐像素光线投射（3x3 超采样，配合屏幕分块剔除）
+    Raster,      // 实例化立方体几何体光栅化（深度测试 + 4 倍多重采样）
+    Temporal     // 逐像素光线投射，每帧一个抖动采样，重投影到历史缓冲区累积（时间抗锯齿）
+};
+
+/**
+ * 全屏场景（shader.frag / loading_cubes.frag）的执行路径
+ * 计算路径由计算着色器写入存储图像，再在主渲染通道中合成，运行时可切换以比较各设备上的性能
+ */
+enum class SceneExecutionPath {
+    Graphics,    // 图形管线绘制全屏四边形，逐片段执行
+    Compute      // 计算着色器按工作组执行（可使用组共享内存），结果合成到交换链图像
+};
+
+/**
+ * GPU 计时阶段
+ * GPU 时间戳分析器按阶段统计耗时，Frame 为整个命令缓冲区，其余为帧内的逻辑渲染阶段
+ */
+enum class GpuProfilerPass {
+    Frame,             // 整帧（命令缓冲区开始到结束）
+    Scene,             // 场景绘制（shader.frag / loading_cubes.frag，或光栅化立方体的渲染通道）
+    CubeCulling,       // loading_cubes 的屏幕分块剔除（计算着色器）
+    Upscale,           // 动态分辨率：把降低分辨率渲染的场景放大到交换链图像
+    Composite,         // 计算着色器场景路径 / 时间抗锯齿：把离屏结果合成到交换链图像
+    TemporalResolve,   // 时间抗锯齿：当前帧与重投影的历史混合，并更新历史缓冲区
+    Background,        // 背景纹理
+    LoadingAnimation,  // 加载动画
+    Buttons,           // 按钮
+    Sliders,           // 滑块
+    TextBatch,         // 文本批次（按钮文本、FPS 和分析器叠加文本）
+    Count              // 阶段数量（不是有效阶段）
+};
+
 /**
  * 应用状态
  * 表示应用程序当前所处的状态阶段
@@ -16,5 +16,123 @@ constexpr double PI = 3.14159265358979323846;
  */
 const int MAX_FRAMES_IN_FLIGHT = 2;
 
+/**
+ * Headless 基准测试常量：每个场景默认渲染的帧数，以及计时前丢弃的预热帧数
+ */
+const int HEADLESS_DEFAULT_FRAME_COUNT = 300;
+const int HEADLESS_WARMUP_FRAME_COUNT = 10;
+
+/**
+ * 设备内存分配器常量：内存块大小，以及超过该大小即单独分配的资源阈值
+ */
+const unsigned long long MEMORY_BLOCK_SIZE = 4ull * 1024ull * 1024ull;
+const unsigned long long MEMORY_DEDICATED_THRESHOLD = MEMORY_BLOCK_SIZE / 2;
+
+/**
+ * 管线缓存常量：持久化管线缓存文件路径（相对工作目录）
+ */
+const char* const PIPELINE_CACHE_FILE_PATH = "pipeline_cache.bin";
+
+/**
+ * 帧节奏常量：限帧模式默认目标帧率，垂直同步模式为呈现预留的安全余量，
+ * 以及高精度等待中最后自旋阶段的初始时长（之后按实测睡眠误差自适应）
+ */
+const int FRAME_PACER_DEFAULT_TARGET_FPS = 60;
+const double FRAME_PACER_VSYNC_SAFETY_MARGIN_MS = 2.0;
+const double FRAME_PACER_INITIAL_SPIN_MS = 1.0;
+
+/**
+ * 交换链重建常量：交换链变为 SUBOPTIMAL 后，窗口尺寸保持不变达到该时长（毫秒）才重建，
+ * 避免拖动调整窗口大小时每个尺寸事件都重建一次
+ */
+const unsigned int SWAPCHAIN_RESIZE_DEBOUNCE_MS = 50;
+
+/**
+ * 并行录制常量：加载界面录制二级命令缓冲区的最大工作线程数
+ * （渲染阶段只有背景、加载动画、按钮和滑块、文本四个，调用线程负责其中一个）
+ */
+const unsigned int PARALLEL_RECORD_MAX_WORKERS = 3;
+
+/**
+ * GPU 时间戳分析器常量：叠加文本每隔多少个已读回的帧刷新一次（刷新会使场景的录制结果失效），
+ * 以及每帧耗时的指数平滑系数
+ */
+const int GPU_PROFILER_OVERLAY_REFRESH_FRAMES = 30;
+const double GPU_PROFILER_SMOOTHING = 0.1;
+
+/**
+ * 动态分辨率常量：场景渲染比例的下限和调整步长，两次调整之间至少读回的帧数（等待新比例的耗时生效），
+ * GPU 帧耗时低于预算的该比例时才提高一档（避免在预算附近来回切换），帧耗时的指数平滑系数，
+ * 以及未指定预算时 GPU 帧预算占目标帧间隔的比例
+ */
+const float DYNAMIC_RESOLUTION_MIN_SCALE = 0.5f;
+const float DYNAMIC_RESOLUTION_SCALE_STEP = 0.05f;
+const int DYNAMIC_RESOLUTION_ADJUST_INTERVAL_FRAMES = 20;
+const double DYNAMIC_RESOLUTION_UPSCALE_THRESHOLD = 0.75;
+const double DYNAMIC_RESOLUTION_SMOOTHING = 0.2;
+const double DYNAMIC_RESOLUTION_BUDGET_FRACTION = 0.9;
+
+/**
+ * 计算着色器场景路径常量：shader.comp 和 loading_cubes.comp 的工作组尺寸（以特化常量传入）。
+ * shader.comp 每个像素的计算量小且互不相关，使用较大的 16x8 工作组提高占用率；
+ * loading_cubes.comp 的工作组共享一份按组覆盖的屏幕矩形剔除后的立方体列表，
+ * 使用 8x8 工作组使列表更紧凑（线程数不低于立方体数量时每个线程只测试一个立方体）
+ */
+const unsigned int COMPUTE_SCENE_SHADER_GROUP_WIDTH = 16;
+const unsigned int COMPUTE_SCENE_SHADER_GROUP_HEIGHT = 8;
+const unsigned int COMPUTE_SCENE_CUBES_GROUP_WIDTH = 8;
+const unsigned int COMPUTE_SCENE_CUBES_GROUP_HEIGHT = 8;
+
+/**
+ * loading_cubes 时间抗锯齿常量：子像素抖动序列的长度（Halton 2,3），历史在混合结果中的权重
+ * （稳定后约等于最近 1 / (1 - 权重) 帧的平均），合成到交换链时补偿累积模糊的锐化强度，
+ * 以及判定为镜头切换（丢弃历史）的每帧相机旋转角度（弧度）和移动距离
+ */
+const unsigned int TEMPORAL_AA_JITTER_SAMPLES = 8;
+const float TEMPORAL_AA_HISTORY_WEIGHT = 0.9f;
+const float TEMPORAL_AA_SHARPNESS = 0.25f;
+const float TEMPORAL_AA_CAMERA_CUT_ANGLE = 0.2f;
+const float TEMPORAL_AA_CAMERA_CUT_DISTANCE = 0.25f;
+
+/**
+ * 文字图集常量：每页（图集纹理的一个数组层）的边长（像素，单通道），初始页数和最大页数
+ * （所有页写满时每帧最多增加一页，达到最大页数后淘汰最久未使用的字形），
+ * 以及每个上传槽位暂存缓冲区的初始大小（字节，一帧新增的字形超过该大小时按需增长）
+ */
+const unsigned int TEXT_ATLAS_PAGE_SIZE = 1024;
+const unsigned int TEXT_ATLAS_PAGE_COUNT = 1;
+const unsigned int TEXT_ATLAS_MAX_PAGE_COUNT = 4;
+const unsigned int TEXT_ATLAS_UPLOAD_BUFFER_SIZE = 256 * 1024;
+
+/**
+ * 文字有向距离场常量：字形按基准字号（像素）光栅化一次并转换为距离场，任意字号都由着色器从同一图集缩放绘制；
+ * 距离场在字形轮廓内外各覆盖的范围（基准字号下的像素，同时作为单元四周的留白）
+ */
+const unsigned int TEXT_SDF_REFERENCE_SIZE = 48;
+const unsigned int TEXT_SDF_SPREAD = 6;
+
+/**
+ * 文字顶点环形缓冲区的初始容量（字形实例数，每个字符一个实例）；不到 MAX_FRAMES_IN_FLIGHT 帧就写满时容量翻倍
+ */
+const unsigned int TEXT_GLYPH_RING_INITIAL_INSTANCES = 4096;
+
+/**
+ * 文字排版缓存的条目上限：超过时在帧边界丢弃本帧未使用的排版
+ */
+const unsigned int TEXT_LAYOUT_CACHE_SIZE = 256;
+
+/**
+ * 文字字形并行光栅化常量：工作线程数上限（含调用线程，不超过硬件线程数），
+ * 以及一批新字形达到多少个时才启用工作线程（更少时线程创建开销大于收益）
+ */
+const unsigned int TEXT_RASTER_WORKER_COUNT = 4;
+const unsigned int TEXT_RASTER_PARALLEL_MIN_GLYPHS = 16;
+
+/**
+ * CPU 帧阶段追踪常量：每个线程环形缓冲区可保存的阶段数，以及默认的 Chrome trace 输出路径
+ */
+const unsigned int FRAME_TRACER_EVENTS_PER_THREAD = 16384;
+const char* const FRAME_TRACER_DEFAULT_FILE_PATH = "frame_trace.json";
+
 } // namespace config
 
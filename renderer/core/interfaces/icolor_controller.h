@@ -7,6 +7,8 @@
 
 // 前向声明
 class IButton;
+class IMemoryAllocator;
+class IPipelineRegistry;
 class ISlider;
 class ITextRenderer;
 
@@ -47,6 +49,27 @@ public:
                            const ColorControllerConfig& config,
                            ITextRenderer* textRenderer = nullptr) = 0;
     
+    /**
+     * 设置共享内存分配器（需在 Initialize 之前调用，为 nullptr 时各组件独立分配内存）
+     * 
+     * @param memoryAllocator 内存分配器（不拥有所有权）
+     */
+    virtual void SetMemoryAllocator(IMemoryAllocator* memoryAllocator) = 0;
+    
+    /**
+     * 设置共享管线缓存（需在 Initialize 之前调用，为 nullptr 时不使用缓存）
+     * 
+     * @param pipelineCache 管线缓存句柄（不拥有所有权）
+     */
+    virtual void SetPipelineCache(PipelineCacheHandle pipelineCache) = 0;
+    
+    /**
+     * 设置共享管线注册表（需在 Initialize 之前调用，为 nullptr 时滑块和按钮独立创建管线）
+     * 
+     * @param pipelineRegistry 管线注册表（不拥有所有权）
+     */
+    virtual void SetPipelineRegistry(IPipelineRegistry* pipelineRegistry) = 0;
+    
     /**
      * 清理资源
      */
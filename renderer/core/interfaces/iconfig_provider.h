@@ -43,5 +43,32 @@ public:
     
     // 日志路径
     virtual std::string GetLogPath() const = 0;
+    
+    // 无窗口（headless）基准测试模式
+    virtual bool IsHeadless() const = 0;
+    virtual int GetHeadlessFrameCount() const = 0;
+    virtual std::string GetHeadlessOutputPath() const = 0;
+    
+    // 帧节奏
+    virtual FramePacingMode GetFramePacingMode() const = 0;
+    virtual int GetTargetFrameRate() const = 0;
+    
+    // loading_cubes 渲染方式
+    virtual CubeRenderMode GetCubeRenderMode() const = 0;
+    
+    // 全屏场景执行路径
+    virtual SceneExecutionPath GetSceneExecutionPath() const = 0;
+    
+    // GPU 时间戳分析器
+    virtual bool IsGpuProfilerEnabled() const = 0;
+    virtual std::string GetGpuProfilerCsvPath() const = 0;
+    
+    // 动态分辨率
+    virtual bool IsDynamicResolutionEnabled() const = 0;
+    virtual double GetGpuFrameBudgetMs() const = 0;
+    
+    // CPU 帧阶段追踪
+    virtual bool IsFrameTraceEnabled() const = 0;
+    virtual std::string GetFrameTracePath() const = 0;
 };
 
@@ -0,0 +1,71 @@
+#pragma once
+
+#include <cstdint>  // 2. 系统头文件
+#include <string>   // 2. 系统头文件
+#include <vector>   // 2. 系统头文件
+
+/**
+ * 字体度量（光栅化字号下的像素）
+ */
+struct FontMetrics {
+    float ascent = 0.0f;      // 基线以上的高度
+    float lineHeight = 0.0f;  // 行高（上升高度 + 下降高度）
+};
+
+/**
+ * 单个字符的光栅化结果
+ * 
+ * 位图左边缘在笔位置左侧 padding 像素处，顶边在字符单元顶部（基线以上 ascent）上方 padding 像素处，
+ * 即字符从 (padding, padding) 开始绘制；超出 maxWidth/maxHeight 的部分被裁剪
+ */
+struct GlyphBitmap {
+    uint32_t charCode = 0;
+    float advanceX = 0.0f;          // 水平前进距离（像素）
+    uint32_t width = 0;             // 位图尺寸（像素，含留白）
+    uint32_t height = 0;
+    std::vector<uint8_t> pixels;    // 单通道覆盖率（0-255），行优先、无行间填充
+};
+
+/**
+ * 字体光栅化接口 - 把字符光栅化为单通道覆盖率位图，与具体平台字体 API 解耦
+ * 
+ * 职责：加载字体、提供字体度量、光栅化单个字符
+ * 设计：RasterizeGlyph 只读取已加载的字体数据，可在多个工作线程上同时调用，
+ *       便于文字渲染器并行生成一批字形；LoadFont 必须在没有光栅化进行时调用
+ * 
+ * 使用方式：
+ * 1. 调用 LoadFont() 按字体名称（或字体文件路径）和像素字号加载字体
+ * 2. 通过 GetMetrics() 获取行高和上升高度
+ * 3. 调用 RasterizeGlyph() 获取字符位图（可并行）
+ */
+class IFontRasterizer {
+public:
+    virtual ~IFontRasterizer() = default;
+    
+    /**
+     * 加载字体
+     * 
+     * @param fontName 字体族名称或字体文件路径
+     * @param pixelSize 字号（像素，等于 em 方框高度）
+     * @return bool 成功返回 true，失败返回 false
+     */
+    virtual bool LoadFont(const std::string& fontName, int pixelSize) = 0;
+    
+    /**
+     * 获取当前字体的度量
+     */
+    virtual FontMetrics GetMetrics() const = 0;
+    
+    /**
+     * 光栅化一个字符（线程安全）
+     * 
+     * @param charCode Unicode 码位
+     * @param padding 位图四周的留白（像素）
+     * @param maxWidth 位图最大宽度（像素，超出部分裁剪）
+     * @param maxHeight 位图最大高度（像素，超出部分裁剪）
+     * @param bitmap 输出位图（字体中没有该字符时输出缺字形状）
+     * @return bool 未加载字体时返回 false
+     */
+    virtual bool RasterizeGlyph(uint32_t charCode, uint32_t padding, uint32_t maxWidth, uint32_t maxHeight,
+                                GlyphBitmap& bitmap) const = 0;
+};
@@ -0,0 +1,87 @@
+#pragma once
+
+#include <cstdint>  // 2. 系统头文件
+#include "core/types/render_types.h"  // 4. 项目头文件（类型）
+
+/**
+ * 内存分配结果 - 描述一次子分配在设备内存块中的位置
+ * 
+ * 多个资源可以共享同一个 memory，通过 offset 区分；
+ * 主机可见内存由分配器持久映射，mappedData 已加上 offset，可直接写入
+ */
+struct MemoryAllocation {
+    DeviceMemoryHandle memory = nullptr;  // 所属设备内存（块或独立分配）
+    uint64_t offset = 0;                  // 在 memory 中的字节偏移
+    uint64_t size = 0;                    // 分配大小（字节，已按对齐要求调整）
+    void* mappedData = nullptr;           // 持久映射地址（非主机可见内存或未经分配器分配时为 nullptr）
+    void* blockHandle = nullptr;          // 分配器内部块标识（未经分配器分配时为 nullptr）
+    
+    bool IsValid() const { return memory != nullptr; }
+};
+
+/**
+ * 内存分配器统计信息
+ */
+struct MemoryAllocatorStats {
+    uint32_t blockCount = 0;             // 共享内存块数量
+    uint32_t dedicatedCount = 0;         // 独立分配数量（大资源）
+    uint32_t allocationCount = 0;        // 活动子分配数量
+    uint64_t reservedBytes = 0;          // 向驱动申请的总字节数
+    uint64_t usedBytes = 0;              // 已被资源占用的字节数
+};
+
+/**
+ * 设备内存分配器接口 - 以少量大块设备内存承载大量小资源
+ * 
+ * 职责：按内存类型维护内存块池，为缓冲区和图像进行子分配并完成绑定
+ * 设计：使用抽象句柄，不暴露具体渲染后端类型；由渲染设备拥有，通过 IRenderDevice/IRenderContext 获取
+ * 
+ * 使用方式：
+ * 1. 创建缓冲区或图像后调用 AllocateBufferMemory/AllocateImageMemory（内部完成内存绑定）
+ * 2. 主机可见内存直接写入 MemoryAllocation::mappedData，无需映射/解除映射
+ * 3. 销毁资源后调用 Free() 归还内存
+ * 4. 空闲时调用 TrimEmptyBlocks() 释放多余的空内存块
+ */
+class IMemoryAllocator {
+public:
+    virtual ~IMemoryAllocator() = default;
+    
+    /**
+     * 为缓冲区分配内存并绑定
+     * 
+     * @param buffer 缓冲区句柄
+     * @param properties 所需内存属性
+     * @param allocation 输出分配结果
+     * @return bool 成功返回 true，失败返回 false
+     */
+    virtual bool AllocateBufferMemory(BufferHandle buffer, MemoryPropertyFlag properties, MemoryAllocation& allocation) = 0;
+    
+    /**
+     * 为图像分配内存并绑定
+     * 
+     * @param image 图像句柄
+     * @param properties 所需内存属性
+     * @param allocation 输出分配结果
+     * @return bool 成功返回 true，失败返回 false
+     */
+    virtual bool AllocateImageMemory(ImageHandle image, MemoryPropertyFlag properties, MemoryAllocation& allocation) = 0;
+    
+    /**
+     * 归还分配（调用前必须确保资源已销毁且GPU不再使用），调用后 allocation 被重置
+     * 
+     * @param allocation 要释放的分配
+     */
+    virtual void Free(MemoryAllocation& allocation) = 0;
+    
+    /**
+     * 空闲回收：释放多余的空内存块（每个内存池保留一个），不移动已有分配
+     */
+    virtual void TrimEmptyBlocks() = 0;
+    
+    /**
+     * 获取统计信息
+     * 
+     * @return MemoryAllocatorStats 当前统计
+     */
+    virtual MemoryAllocatorStats GetStats() const = 0;
+};
@@ -2,6 +2,20 @@
 
 #include <string>  // 2. 系统头文件
 
+// 场景管线类型（全屏场景使用的管线）
+enum class ScenePipelineType {
+    Shader,         // Shader 场景的全屏管线
+    LoadingCubes    // LoadingCubes 场景的全屏管线
+};
+
+// 场景管线状态（可从渲染线程每帧查询）
+enum class ScenePipelineState {
+    NotStarted,     // 尚未开始创建
+    Compiling,      // 正在工作线程上编译
+    Ready,          // 已创建，切换场景时直接绑定
+    Failed          // 创建失败
+};
+
 /**
  * 管线管理器接口 - 负责图形管线的创建和管理
  * 
@@ -11,16 +25,54 @@
  * 使用方式：
  * 1. 通过 IRenderer::GetPipelineManager() 获取接口指针
  * 2. 使用接口指针创建和管理管线，无需了解具体实现
+ * 3. 启动时调用 PrecompileScenePipelines() 在后台编译场景管线，通过 GetScenePipelineState() 查询是否就绪
+ *    （场景管线只通过预编译创建，没有单独的同步创建入口）
  */
 class IPipelineManager {
 public:
     virtual ~IPipelineManager() = default;
     
-    // 创建图形管线
-    virtual bool CreateGraphicsPipeline(const std::string& vertShaderPath, const std::string& fragShaderPath) = 0;
+    /**
+     * 在工作线程上预编译所有场景管线（Shader 和 LoadingCubes）
+     * 
+     * 在加载界面期间调用，立即返回；编译完成后切换场景只需绑定已创建的管线。
+     * 重复调用时不会再次编译。
+     * 
+     * @param shaderVertPath Shader 场景顶点shader路径
+     * @param shaderFragPath Shader 场景片段shader路径
+     * @param loadingCubesVertPath LoadingCubes 场景顶点shader路径
+     * @param loadingCubesFragPath LoadingCubes 场景片段shader路径
+     * @return 成功启动（或已启动）返回 true，否则返回 false
+     */
+    virtual bool PrecompileScenePipelines(const std::string& shaderVertPath, const std::string& shaderFragPath,
+                                          const std::string& loadingCubesVertPath, const std::string& loadingCubesFragPath) = 0;
+    
+    /**
+     * 获取场景管线状态（非阻塞）
+     * 
+     * @param type 场景管线类型
+     * @return ScenePipelineState 管线当前状态
+     */
+    virtual ScenePipelineState GetScenePipelineState(ScenePipelineType type) const = 0;
+    
+    /**
+     * 创建全屏场景的计算着色器变体（写入存储图像，再合成到渲染通道）
+     * 
+     * PrecompileScenePipelines() 在发布对应场景管线就绪之前自动调用；失败时该场景只使用图形管线
+     * 
+     * @param type 场景管线类型
+     * @param compShaderPath 计算着色器路径（.spv 或 GLSL 源文件）
+     * @return 成功返回 true，否则返回 false
+     */
+    virtual bool CreateComputeScenePipeline(ScenePipelineType type, const std::string& compShaderPath) = 0;
     
-    // 创建加载立方体管线
-    virtual bool CreateLoadingCubesPipeline(const std::string& vertShaderPath, const std::string& fragShaderPath) = 0;
+    /**
+     * 场景的计算着色器变体是否可用（在 GetScenePipelineState() 返回 Ready 之后查询）
+     * 
+     * @param type 场景管线类型
+     * @return 计算管线已创建返回 true
+     */
+    virtual bool IsComputeScenePipelineAvailable(ScenePipelineType type) const = 0;
     
     // 光线追踪支持
     virtual bool IsRayTracingSupported() const = 0;
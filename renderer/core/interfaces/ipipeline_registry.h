@@ -0,0 +1,114 @@
+#pragma once
+
+#include <cstdint>  // 2. 系统头文件
+#include <string>  // 2. 系统头文件
+#include <vector>  // 2. 系统头文件
+#include "core/types/render_types.h"  // 4. 项目头文件（类型）
+
+/**
+ * 顶点属性格式（替代 VkFormat 中的顶点格式子集）
+ */
+enum class VertexAttributeFormat : uint32_t {
+    Float2 = 0,  // vec2
+    Float3 = 1,  // vec3
+    Float4 = 2,  // vec4
+};
+
+/**
+ * 顶点属性描述（逐顶点属性位于绑定 0，逐实例属性位于绑定 1）
+ */
+struct VertexAttributeDesc {
+    uint32_t location = 0;
+    VertexAttributeFormat format = VertexAttributeFormat::Float2;
+    uint32_t offset = 0;
+};
+
+/**
+ * 管线混合模式
+ */
+enum class PipelineBlendMode : uint32_t {
+    Opaque = 0,      // 不混合
+    AlphaBlend = 1,  // 颜色按源 alpha 混合，目标 alpha = srcA + dstA * (1 - srcA)
+};
+
+/**
+ * 图形管线描述 - 注册表的查找键
+ * 
+ * 着色器路径、顶点布局、混合状态、推送常量、纹理采样器数量和渲染通道完全相同的描述共享同一条管线。
+ * 视口和裁剪区域固定为动态状态，图元固定为三角形列表，不启用深度测试。
+ */
+struct GraphicsPipelineDesc {
+    std::string vertShaderPath;                       // 顶点着色器 SPIR-V 路径
+    std::string fragShaderPath;                       // 片段着色器 SPIR-V 路径
+    uint32_t vertexStride = 0;                        // 绑定 0 的顶点步长（字节，0 表示无逐顶点输入）
+    std::vector<VertexAttributeDesc> vertexAttributes;
+    uint32_t instanceStride = 0;                      // 绑定 1 的实例步长（字节，0 表示无逐实例输入）
+    std::vector<VertexAttributeDesc> instanceAttributes;
+    PipelineBlendMode blendMode = PipelineBlendMode::AlphaBlend;
+    uint32_t pushConstantStages = 0;                  // ShaderStage 位组合
+    uint32_t pushConstantSize = 0;                    // 推送常量字节数（0 表示不使用）
+    uint32_t textureSamplerCount = 0;                 // 描述符集 0 中片段阶段组合图像采样器数量（0 表示无描述符集）
+    RenderPassHandle renderPass = nullptr;
+};
+
+/**
+ * 共享管线 - 注册表返回的管线、布局和描述符集布局
+ * 
+ * 所有句柄由注册表拥有，调用方只能使用不能销毁，不再需要时通过 Release() 归还
+ */
+struct SharedPipeline {
+    PipelineHandle pipeline = nullptr;
+    PipelineLayoutHandle layout = nullptr;
+    DescriptorSetLayoutHandle descriptorSetLayout = nullptr;  // textureSamplerCount 为 0 时为 nullptr
+    void* entryHandle = nullptr;                              // 注册表内部条目标识（未经注册表创建时为 nullptr）
+    
+    bool IsValid() const { return pipeline != nullptr; }
+};
+
+/**
+ * 管线注册表统计信息
+ */
+struct PipelineRegistryStats {
+    uint32_t pipelineCount = 0;   // 当前存活的管线数量
+    uint32_t referenceCount = 0;  // 所有管线的引用总数
+    uint32_t cacheHits = 0;       // 命中已有管线的获取次数
+};
+
+/**
+ * 管线注册表接口 - 让同类控件共享同一条图形管线
+ * 
+ * 职责：按 GraphicsPipelineDesc 查找或创建管线，引用计数归零且在途帧不再使用后销毁
+ * 设计：使用抽象句柄，不暴露具体渲染后端类型；由渲染设备拥有，通过 IRenderDevice/IRenderContext 获取
+ * 
+ * 使用方式：
+ * 1. 控件初始化时用描述调用 Acquire()，相同描述直接返回已有管线
+ * 2. 渲染时使用 SharedPipeline 中的句柄绑定管线和推送常量
+ * 3. 控件清理时调用 Release() 归还引用
+ */
+class IPipelineRegistry {
+public:
+    virtual ~IPipelineRegistry() = default;
+    
+    /**
+     * 获取与描述匹配的共享管线（不存在时创建）
+     * 
+     * @param desc 管线描述
+     * @param pipeline 输出共享管线
+     * @return bool 成功返回 true，失败返回 false
+     */
+    virtual bool Acquire(const GraphicsPipelineDesc& desc, SharedPipeline& pipeline) = 0;
+    
+    /**
+     * 归还引用（最后一个引用归还后，管线在引用它的提交完成时销毁），调用后 pipeline 被重置
+     * 
+     * @param pipeline 要归还的共享管线
+     */
+    virtual void Release(SharedPipeline& pipeline) = 0;
+    
+    /**
+     * 获取统计信息
+     * 
+     * @return PipelineRegistryStats 当前统计
+     */
+    virtual PipelineRegistryStats GetStats() const = 0;
+};
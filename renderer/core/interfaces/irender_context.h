@@ -3,6 +3,10 @@
 #include <cstdint>  // 2. 系统头文件
 #include "core/types/render_types.h"  // 4. 项目头文件
 
+// 前向声明
+class IMemoryAllocator;
+class IPipelineRegistry;
+
 /**
  * 渲染上下文接口 - 抽象层，用于解耦UI组件与底层渲染API
  * 
@@ -57,5 +61,26 @@ public:
      * @note 调用者必须检查返回值，UINT32_MAX 表示查找失败
      */
     virtual uint32_t FindMemoryType(uint32_t typeFilter, MemoryPropertyFlag properties) const = 0;
+    
+    /**
+     * 获取共享设备内存分配器
+     * 
+     * @return 分配器指针（[BORROW] 由渲染设备拥有），为 nullptr 时组件应退回到独立分配
+     */
+    virtual IMemoryAllocator* GetMemoryAllocator() const = 0;
+    
+    /**
+     * 获取共享管线缓存
+     * 
+     * @return 管线缓存句柄（[BORROW] 由渲染设备拥有），可能为 nullptr（此时不使用缓存）
+     */
+    virtual PipelineCacheHandle GetPipelineCache() const = 0;
+    
+    /**
+     * 获取共享管线注册表
+     * 
+     * @return 注册表指针（[BORROW] 由渲染设备拥有），为 nullptr 时组件应退回到独立创建管线
+     */
+    virtual IPipelineRegistry* GetPipelineRegistry() const = 0;
 };
 
@@ -23,6 +23,9 @@ public:
      * @param graphicsQueue 图形队列句柄（抽象类型）
      * @param renderPass 渲染通道句柄（抽象类型）
      * @param swapchainExtent 交换链尺寸（抽象类型）
+     * @param memoryAllocator 共享设备内存分配器（[BORROW] 可为 nullptr）
+     * @param pipelineCache 共享管线缓存（[BORROW] 可为 nullptr）
+     * @param pipelineRegistry 共享管线注册表（[BORROW] 可为 nullptr）
      * @return std::unique_ptr<IRenderContext> 渲染上下文接口指针，调用者获得所有权
      */
     virtual std::unique_ptr<IRenderContext> CreateRenderContext(
@@ -31,6 +34,9 @@ public:
         CommandPoolHandle commandPool,
         QueueHandle graphicsQueue,
         RenderPassHandle renderPass,
-        Extent2D swapchainExtent) = 0;
+        Extent2D swapchainExtent,
+        IMemoryAllocator* memoryAllocator,
+        PipelineCacheHandle pipelineCache,
+        IPipelineRegistry* pipelineRegistry) = 0;
 };
 
@@ -2,6 +2,10 @@
 
 #include "core/types/render_types.h"  // 4. 项目头文件（类型）
 
+// 前向声明
+class IMemoryAllocator;
+class IPipelineRegistry;
+
 /**
  * 渲染设备接口 - 提供渲染所需的底层设备资源，不暴露具体渲染后端类型
  * 
@@ -29,5 +33,14 @@ public:
     virtual Extent2D GetSwapchainExtent() const = 0;
     virtual ImageFormat GetSwapchainFormat() const = 0;
     virtual uint32_t GetSwapchainImageCount() const = 0;
+    
+    // 获取共享设备内存分配器（所有权归渲染设备，调用方不得释放）
+    virtual IMemoryAllocator* GetMemoryAllocator() const = 0;
+    
+    // 获取共享管线缓存（所有管线创建点共用，可能为 nullptr）
+    virtual PipelineCacheHandle GetPipelineCache() const = 0;
+    
+    // 获取共享管线注册表（相同描述的控件共用一条管线，所有权归渲染设备，可能为 nullptr）
+    virtual IPipelineRegistry* GetPipelineRegistry() const = 0;
 };
 
@@ -1,6 +1,5 @@
 #pragma once
 
-#include <windows.h>  // 2. 系统头文件
 #include <string>     // 2. 系统头文件
 #include <vector>     // 2. 系统头文件
 #include "core/config/constants.h"  // 4. 项目头文件（配置）
@@ -8,6 +7,12 @@
 #include "core/types/render_types.h"  // 4. 项目头文件（类型）
 #include "core/interfaces/irender_command.h"  // 4. 项目头文件（接口）
 
+// 窗口句柄的前向声明（与 windows.h 的 STRICT 定义一致），接口本身不依赖 Windows 头文件
+struct HWND__;
+struct HINSTANCE__;
+typedef HWND__* HWND;
+typedef HINSTANCE__* HINSTANCE;
+
 // 前向声明（遵循接口隔离原则，不直接继承其他接口）
 class ITextRenderer;
 class Button;
@@ -51,6 +56,25 @@ public:
     virtual bool Initialize(HWND hwnd, HINSTANCE hInstance) = 0;
     virtual void Cleanup() = 0;
     
+    /**
+     * 以无窗口（headless）模式初始化渲染器
+     * 
+     * 不创建窗口表面和交换链，渲染到渲染器自有的离屏图像，
+     * 用于无显示设备的环境（如软件 Vulkan ICD）中测量帧耗时
+     * 
+     * @param width 离屏渲染目标宽度（像素）
+     * @param height 离屏渲染目标高度（像素）
+     * @return bool 成功返回 true，失败返回 false
+     */
+    virtual bool InitializeHeadless(uint32_t width, uint32_t height) = 0;
+    
+    /**
+     * 检查渲染器是否运行在无窗口（headless）模式
+     * 
+     * @return bool headless 模式返回 true，否则返回 false
+     */
+    virtual bool IsHeadless() const = 0;
+    
     // 渲染相关
     virtual bool DrawFrame(float time, bool useLoadingCubes = false, 
                           ITextRenderer* textRenderer = nullptr, float fps = 0.0f) = 0;
@@ -60,6 +84,72 @@ public:
     virtual void SetStretchMode(StretchMode mode) = 0;
     virtual void SetBackgroundStretchMode(BackgroundStretchMode mode) = 0;
     
+    /**
+     * 设置帧节奏模式（决定交换链呈现模式）
+     * 
+     * 在创建交换链时生效，应在 Initialize() 之前调用；之后调用在下次重建交换链时生效
+     * 
+     * @param mode 帧节奏模式
+     */
+    virtual void SetFramePacingMode(FramePacingMode mode) = 0;
+    
+    /**
+     * 获取上一帧在 CPU 上阻塞等待 GPU 和交换链的时长
+     * 
+     * 帧节奏器从帧耗时中扣除该时长，得到真正的帧工作量
+     * 
+     * @return double 阻塞时长（毫秒）
+     */
+    virtual double GetLastFrameWaitMs() const = 0;
+    
+    /**
+     * 设置GPU时间戳分析器选项（按阶段统计GPU耗时，显示在FPS文本下方）
+     * 
+     * 在初始化时创建分析器，必须在 Initialize()/InitializeHeadless() 之前调用
+     * 
+     * @param enabled 是否启用
+     * @param csvPath 每帧结果的CSV输出路径（为空时不输出）
+     */
+    virtual void SetGpuProfilerOptions(bool enabled, const std::string& csvPath) = 0;
+    
+    /**
+     * 设置动态分辨率选项（全屏场景按实测GPU帧耗时降低渲染分辨率，再放大到交换链图像，UI保持原生分辨率）
+     * 
+     * 在初始化时创建离屏目标和放大管线，必须在 Initialize()/InitializeHeadless() 之前调用
+     * 
+     * @param enabled 是否启用
+     * @param gpuBudgetMs GPU帧耗时预算（毫秒）
+     */
+    virtual void SetDynamicResolutionOptions(bool enabled, double gpuBudgetMs) = 0;
+    
+    /**
+     * 设置 loading_cubes 场景的渲染方式（光线投射、实例化光栅化或时间抗锯齿）
+     * 
+     * 可在运行时随时调用，下一帧生效；所选路径的管线或渲染目标不可用时退回到光线投射
+     * 
+     * @param mode 渲染方式
+     */
+    virtual void SetCubeRenderMode(CubeRenderMode mode) = 0;
+    
+    /**
+     * 获取 loading_cubes 场景当前选择的渲染方式
+     */
+    virtual CubeRenderMode GetCubeRenderMode() const = 0;
+    
+    /**
+     * 设置全屏场景的执行路径（图形管线或计算着色器）
+     * 
+     * 可在运行时随时调用，下一帧生效；计算管线或存储图像不可用时退回到图形管线
+     * 
+     * @param path 执行路径
+     */
+    virtual void SetSceneExecutionPath(SceneExecutionPath path) = 0;
+    
+    /**
+     * 获取全屏场景当前选择的执行路径
+     */
+    virtual SceneExecutionPath GetSceneExecutionPath() const = 0;
+    
     // 获取尺寸信息
     virtual Extent2D GetUIBaseSize() const = 0;
     
@@ -26,7 +26,8 @@ public:
     // 切换到Loading状态（用于ESC键返回）
     virtual void SwitchToLoading() = 0;
     
-    // 检查pipeline是否已创建（用于渲染判断）
+    // 检查pipeline是否已创建（用于渲染判断，管线在后台编译完成前返回 false）
     virtual bool IsLoadingCubesPipelineCreated() const = 0;
+    virtual bool IsShaderPipelineCreated() const = 0;
 };
 
@@ -3,6 +3,9 @@
 #include <string>  // 2. 系统头文件
 #include "core/types/render_types.h"  // 4. 项目头文件（类型）
 
+// 前向声明
+class IMemoryAllocator;
+
 /**
  * 文字渲染器接口 - 用于解耦文字渲染与UI管理，不依赖具体渲染后端
  * 
@@ -23,6 +26,12 @@ public:
                            CommandPoolHandle commandPool, QueueHandle graphicsQueue,
                            RenderPassHandle renderPass) = 0;
     
+    // 设置共享内存分配器（需在 Initialize 之前调用，为 nullptr 时各资源独立分配内存）
+    virtual void SetMemoryAllocator(IMemoryAllocator* memoryAllocator) = 0;
+    
+    // 设置共享管线缓存（需在 Initialize 之前调用，为 nullptr 时不使用缓存）
+    virtual void SetPipelineCache(PipelineCacheHandle pipelineCache) = 0;
+    
     // 清理资源
     virtual void Cleanup() = 0;
     
@@ -71,5 +80,14 @@ public:
     
     // 获取字体大小
     virtual int GetFontSize() const = 0;
+    
+    // 把上次调用以来新光栅化的字形上传到图集纹理（每帧提交引用本帧文本的命令缓冲区之前调用一次，同时标记帧边界）
+    virtual void FlushGlyphUploads() = 0;
+    
+    // 图集版本：字形被淘汰或字体改变后递增，此前录制的文本顶点中的纹理坐标失效，需要重新录制
+    virtual uint64_t GetAtlasVersion() const = 0;
+    
+    // 顶点缓冲区版本：顶点环形缓冲区写满换用另一个缓冲区时递增，此前录制的文本绘制命令引用的顶点将被覆盖，需要重新录制
+    virtual uint64_t GetVertexBufferVersion() const = 0;
 };
 
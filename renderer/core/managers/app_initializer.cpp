@@ -127,6 +127,9 @@ bool AppInitializer::Initialize(const AppInitializationConfig& config) {
     }
     initializedSteps = 6;
     
+    // 在后台编译场景管线，与UI初始化和加载界面并行，切换场景时只需绑定
+    m_sceneManager->PrecompileScenePipelines(m_renderer.get(), m_configProvider);
+    
     // 7. 初始化UI（依赖渲染器和窗口）
     InitializationResult uiResult = InitializeUI();
     if (!uiResult.success) {
@@ -222,6 +225,15 @@ InitializationResult AppInitializer::InitializeRenderer(IRendererFactory* render
         return InitializationResult::Failure("Failed to create renderer from factory");
     }
     
+    // 呈现模式在创建交换链时确定、GPU分析器在初始化时创建，必须在 Initialize() 之前设置
+    if (m_configProvider) {
+        m_renderer->SetFramePacingMode(m_configProvider->GetFramePacingMode());
+        m_renderer->SetGpuProfilerOptions(m_configProvider->IsGpuProfilerEnabled(), m_configProvider->GetGpuProfilerCsvPath());
+        m_renderer->SetCubeRenderMode(m_configProvider->GetCubeRenderMode());
+        m_renderer->SetSceneExecutionPath(m_configProvider->GetSceneExecutionPath());
+        m_renderer->SetDynamicResolutionOptions(m_configProvider->IsDynamicResolutionEnabled(), m_configProvider->GetGpuFrameBudgetMs());
+    }
+    
     if (!m_renderer->Initialize(m_windowManager->GetWindow()->GetHandle(), hInstance)) {
         m_renderer.reset();  // unique_ptr 自动清理
         return InitializationResult::Failure("Failed to initialize renderer");
@@ -331,6 +343,8 @@ InitializationResult AppInitializer::InitializeUI() {
         return InitializationResult::Failure("Renderer does not provide IRenderDevice interface");
     }
     
+    m_textRenderer->SetMemoryAllocator(renderDevice->GetMemoryAllocator());
+    m_textRenderer->SetPipelineCache(renderDevice->GetPipelineCache());
     if (!m_textRenderer->Initialize(
             renderDevice->GetDevice(),
             renderDevice->GetPhysicalDevice(),
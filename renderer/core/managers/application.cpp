@@ -5,6 +5,9 @@
 
 #include "core/interfaces/irenderer_factory.h"  // 4. 项目头文件（接口）
 #include "core/interfaces/iconfig_provider.h"  // 4. 项目头文件（接口）
+#include "core/interfaces/imemory_allocator.h"  // 4. 项目头文件（接口）
+#include "core/interfaces/irender_device.h"  // 4. 项目头文件（接口）
+#include "core/interfaces/irenderer.h"  // 4. 项目头文件（接口）
 #include "core/managers/app_initializer.h"  // 4. 项目头文件（管理器）
 #include "core/managers/app_initialization_config.h"  // 4. 项目头文件（配置）
 #include "core/managers/window_manager.h"  // 4. 项目头文件（管理器）
@@ -12,6 +15,8 @@
 #include "core/managers/render_scheduler.h"  // 4. 项目头文件（管理器）
 #include "core/managers/config_manager.h"  // 4. 项目头文件（管理器）
 #include "core/utils/fps_monitor.h"  // 4. 项目头文件（工具）
+#include "core/utils/frame_pacer.h"  // 4. 项目头文件（工具）
+#include "core/utils/frame_tracer.h"  // 4. 项目头文件（工具）
 #include "core/utils/logger.h"  // 4. 项目头文件（工具）
 #include "core/utils/event_bus.h"  // 4. 项目头文件（工具）
 #include "core/factories/window_factory.h"  // 4. 项目头文件（工厂）
@@ -66,6 +71,10 @@ bool Application::Initialize(IRendererFactory* rendererFactory, HINSTANCE hInsta
         return false;
     }
     
+    // 创建帧节奏器（模式和目标帧率来自配置，渲染器已按同一模式选择呈现模式）
+    m_framePacer = std::make_unique<FramePacer>();
+    m_framePacer->Initialize(m_configManager->GetFramePacingMode(), m_configManager->GetTargetFrameRate());
+    
     m_initialized = true;
     return true;
 }
@@ -81,7 +90,8 @@ void Application::Cleanup() {
         m_initializer.reset();
     }
     
-    // 清理FPS监控器
+    // 清理帧节奏器和FPS监控器
+    m_framePacer.reset();
     m_fpsMonitor.reset();
     
     // 清理依赖对象（按逆序清理）
@@ -95,7 +105,7 @@ void Application::Cleanup() {
 }
 
 int Application::Run() {
-    if (!m_initialized || !m_initializer || !m_fpsMonitor) {
+    if (!m_initialized || !m_initializer || !m_fpsMonitor || !m_framePacer) {
         return 1;
     }
     
@@ -110,6 +120,13 @@ int Application::Run() {
     
     // 主循环（固定时间步 + 可变渲染插值）
     while (windowManager->IsRunning()) {
+        TraceScope frameScope("Frame");
+        
+        // 等待到下一帧的开始时间（在处理输入之前，使输入采样尽量晚）
+        TraceScope waitScope("WaitForNextFrame");
+        m_framePacer->WaitForNextFrame();
+        waitScope.End();
+        
         // 使用事件管理器统一处理所有消息
         if (eventManager && !eventManager->ProcessMessages(configProvider->GetStretchMode())) {
             // 收到退出消息
@@ -119,8 +136,15 @@ int Application::Run() {
         if (windowManager->IsRunning()) {
             // 由WindowManager处理窗口最小化
             if (windowManager->HandleMinimized()) {
+                // 最小化期间不渲染，借空闲时机回收一次设备内存（每次最小化只执行一次）
+                if (!m_idleTrimDone) {
+                    TrimDeviceMemory();
+                    m_idleTrimDone = true;
+                }
+                m_framePacer->Reset();  // 恢复后重新测量，不把最小化时间当作掉帧
                 continue;  // 窗口最小化，跳过渲染
             }
+            m_idleTrimDone = false;
             
             // 更新FPS监控器（获取可变帧时间）
             m_fpsMonitor->Update();
@@ -151,8 +175,9 @@ int Application::Run() {
             // 可变时间步渲染（带插值因子）
             RenderFrame(time, deltaTime, fps);
             
-            // 控制帧率
-            Sleep(1);
+            // 记录呈现时刻（用于测量呈现间隔）和本帧阻塞等待的时长（用于测量帧工作量）
+            IRenderer* renderer = m_initializer->GetRenderer();
+            m_framePacer->FramePresented(renderer ? renderer->GetLastFrameWaitMs() : 0.0);
         }
     }
     
@@ -169,3 +194,15 @@ void Application::RenderFrame(float time, float deltaTime, float fps) {
     }
 }
 
+void Application::TrimDeviceMemory() {
+    IRenderer* renderer = m_initializer ? m_initializer->GetRenderer() : nullptr;
+    if (!renderer) {
+        return;
+    }
+    
+    IRenderDevice* renderDevice = renderer->GetRenderDevice();
+    IMemoryAllocator* memoryAllocator = renderDevice ? renderDevice->GetMemoryAllocator() : nullptr;
+    if (memoryAllocator) {
+        memoryAllocator->TrimEmptyBlocks();
+    }
+}
@@ -11,6 +11,7 @@ class EventManager;
 class RenderScheduler;
 class Window;
 class FPSMonitor;
+class FramePacer;
 class IConfigProvider;
 class ConfigManager;
 class Logger;
@@ -79,12 +80,22 @@ private:
      */
     void RenderFrame(float time, float deltaTime, float fps);
     
+    /**
+     * 空闲时回收设备内存
+     * 
+     * 窗口最小化时调用，释放多余的空内存块
+     */
+    void TrimDeviceMemory();
+    
     // 初始化器（管理所有组件的初始化，拥有所有权）
     std::unique_ptr<AppInitializer> m_initializer;
     
     // FPS监控器（拥有所有权，用于时间管理和帧率计算）
     std::unique_ptr<FPSMonitor> m_fpsMonitor;
     
+    // 帧节奏器（拥有所有权，控制帧之间的等待和呈现模式对应的节奏）
+    std::unique_ptr<FramePacer> m_framePacer;
+    
     // 依赖对象（拥有所有权，确保生命周期足够长）
     std::unique_ptr<ConfigManager> m_configManager;  // 配置管理器
     std::unique_ptr<Logger> m_logger;  // 日志器
@@ -101,6 +112,8 @@ private:
     float m_accumulator = 0.0f;  // 时间累积器，用于处理可变帧时间
     float m_alpha = 0.0f;  // 插值因子（0.0 - 1.0），用于渲染插值
     
+    bool m_idleTrimDone = false;  // 本次最小化期间是否已回收过设备内存
+    
     bool m_initialized = false;  // 初始化状态标志，防止重复初始化
 };
 
@@ -2,8 +2,34 @@
 
 #include <algorithm>  // 2. 系统头文件
 #include <cctype>  // 2. 系统头文件
+#include <cstdlib>  // 2. 系统头文件
 #include <cstring>  // 2. 系统头文件
 
+namespace {
+
+// 解析路径参数（如 --option=PATH）：保留原始大小写，到下一个空格为止，可用引号包围；未出现时返回空字符串
+std::string ParsePathOption(const std::string& cmdLine, const std::string& cmdLineLower, const std::string& option) {
+    size_t optionPos = cmdLineLower.find(option);
+    if (optionPos == std::string::npos) {
+        return std::string();
+    }
+    
+    size_t pathStart = optionPos + option.size();
+    size_t pathEnd;
+    if (pathStart < cmdLine.size() && cmdLine[pathStart] == '"') {
+        pathStart++;
+        pathEnd = cmdLine.find('"', pathStart);
+    } else {
+        pathEnd = cmdLine.find(' ', pathStart);
+    }
+    if (pathEnd == std::string::npos) {
+        pathEnd = cmdLine.size();
+    }
+    return cmdLine.substr(pathStart, pathEnd - pathStart);
+}
+
+} // namespace
+
 void ConfigManager::Initialize(const char* lpCmdLine) {
     ParseCommandLine(lpCmdLine);
 }
@@ -12,6 +38,19 @@ void ConfigManager::ParseCommandLine(const char* lpCmdLine) {
     // 重置为默认值
     m_stretchMode = StretchMode::Fit;
     m_backgroundMode = BackgroundStretchMode::Fit;
+    m_headless = false;
+    m_headlessFrameCount = config::HEADLESS_DEFAULT_FRAME_COUNT;
+    m_headlessOutputPath.clear();
+    m_framePacingMode = FramePacingMode::VSync;
+    m_targetFrameRate = config::FRAME_PACER_DEFAULT_TARGET_FPS;
+    m_cubeRenderMode = CubeRenderMode::RayCast;
+    m_sceneExecutionPath = SceneExecutionPath::Graphics;
+    m_dynamicResolutionEnabled = false;
+    m_gpuFrameBudgetMs = 0.0;
+    m_gpuProfilerEnabled = false;
+    m_gpuProfilerCsvPath.clear();
+    m_frameTraceEnabled = false;
+    m_frameTracePath = config::FRAME_TRACER_DEFAULT_FILE_PATH;
     
     if (!lpCmdLine || strlen(lpCmdLine) == 0) {
         return;
@@ -38,6 +77,92 @@ void ConfigManager::ParseCommandLine(const char* lpCmdLine) {
     } else if (cmdLineLower.find("--background=scaled") != std::string::npos || cmdLineLower.find("-b scaled") != std::string::npos) {
         m_backgroundMode = BackgroundStretchMode::Scaled;
     }
+    
+    // 解析headless基准测试模式
+    if (cmdLineLower.find("--headless") != std::string::npos) {
+        m_headless = true;
+    }
+    
+    const std::string framesOption = "--headless-frames=";
+    size_t framesPos = cmdLineLower.find(framesOption);
+    if (framesPos != std::string::npos) {
+        int frameCount = atoi(cmdLineLower.c_str() + framesPos + framesOption.size());
+        if (frameCount > 0) {
+            m_headlessFrameCount = frameCount;
+        }
+    }
+    m_headlessOutputPath = ParsePathOption(cmdLine, cmdLineLower, "--headless-output=");
+    
+    // 解析帧节奏模式
+    if (cmdLineLower.find("--pacing=mailbox") != std::string::npos || cmdLineLower.find("--pacing=low-latency") != std::string::npos) {
+        m_framePacingMode = FramePacingMode::LowLatency;
+    } else if (cmdLineLower.find("--pacing=capped") != std::string::npos) {
+        m_framePacingMode = FramePacingMode::Capped;
+    } else if (cmdLineLower.find("--pacing=vsync") != std::string::npos) {
+        m_framePacingMode = FramePacingMode::VSync;
+    }
+    
+    const std::string fpsCapOption = "--fps-cap=";
+    size_t fpsCapPos = cmdLineLower.find(fpsCapOption);
+    if (fpsCapPos != std::string::npos) {
+        int targetFrameRate = atoi(cmdLineLower.c_str() + fpsCapPos + fpsCapOption.size());
+        if (targetFrameRate > 0) {
+            m_targetFrameRate = targetFrameRate;
+        }
+    }
+    
+    // 解析loading_cubes渲染方式
+    if (cmdLineLower.find("--cubes=raster") != std::string::npos) {
+        m_cubeRenderMode = CubeRenderMode::Raster;
+    } else if (cmdLineLower.find("--cubes=taa") != std::string::npos) {
+        m_cubeRenderMode = CubeRenderMode::Temporal;
+    } else if (cmdLineLower.find("--cubes=raycast") != std::string::npos) {
+        m_cubeRenderMode = CubeRenderMode::RayCast;
+    }
+    
+    // 解析全屏场景执行路径
+    if (cmdLineLower.find("--scene=compute") != std::string::npos) {
+        m_sceneExecutionPath = SceneExecutionPath::Compute;
+    } else if (cmdLineLower.find("--scene=graphics") != std::string::npos) {
+        m_sceneExecutionPath = SceneExecutionPath::Graphics;
+    }
+    
+    // 解析动态分辨率
+    if (cmdLineLower.find("--dynamic-res") != std::string::npos) {
+        m_dynamicResolutionEnabled = true;
+    }
+    
+    const std::string budgetOption = "--gpu-budget=";
+    size_t budgetPos = cmdLineLower.find(budgetOption);
+    if (budgetPos != std::string::npos) {
+        double budgetMs = atof(cmdLineLower.c_str() + budgetPos + budgetOption.size());
+        if (budgetMs > 0.0) {
+            m_gpuFrameBudgetMs = budgetMs;
+        }
+    }
+    
+    // 解析GPU时间戳分析器
+    if (cmdLineLower.find("--gpu-profile") != std::string::npos) {
+        m_gpuProfilerEnabled = true;
+    }
+    m_gpuProfilerCsvPath = ParsePathOption(cmdLine, cmdLineLower, "--gpu-profile-csv=");
+    
+    // 解析CPU帧阶段追踪
+    if (cmdLineLower.find("--trace") != std::string::npos) {
+        m_frameTraceEnabled = true;
+    }
+    std::string tracePath = ParsePathOption(cmdLine, cmdLineLower, "--trace-file=");
+    if (!tracePath.empty()) {
+        m_frameTracePath = tracePath;
+    }
+}
+
+double ConfigManager::GetGpuFrameBudgetMs() const {
+    if (m_gpuFrameBudgetMs > 0.0) {
+        return m_gpuFrameBudgetMs;
+    }
+    // 为CPU和呈现留出余量
+    return 1000.0 / (double)m_targetFrameRate * config::DYNAMIC_RESOLUTION_BUDGET_FRACTION;
 }
 
 std::string ConfigManager::GetShaderVertexPath() const {
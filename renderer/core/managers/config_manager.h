@@ -123,6 +123,97 @@ public:
      */
     std::string GetLogPath() const override { return m_logPath; }
     
+    /**
+     * 是否以无窗口（headless）模式运行
+     * 
+     * @return bool 命令行包含 --headless 时返回 true
+     */
+    bool IsHeadless() const override { return m_headless; }
+    
+    /**
+     * 获取headless模式下每个场景渲染的帧数
+     * 
+     * @return int 帧数（--headless-frames=N，默认 config::HEADLESS_DEFAULT_FRAME_COUNT）
+     */
+    int GetHeadlessFrameCount() const override { return m_headlessFrameCount; }
+    
+    /**
+     * 获取headless基准测试结果文件路径（CSV，供CI读取）
+     * 
+     * @return std::string 输出路径（--headless-output=PATH，为空时只打印到标准输出）
+     */
+    std::string GetHeadlessOutputPath() const override { return m_headlessOutputPath; }
+    
+    /**
+     * 获取帧节奏模式
+     * 
+     * @return FramePacingMode 帧节奏模式（--pacing=vsync|mailbox|capped，默认垂直同步）
+     */
+    FramePacingMode GetFramePacingMode() const override { return m_framePacingMode; }
+    
+    /**
+     * 获取限帧模式的目标帧率
+     * 
+     * @return int 目标帧率（--fps-cap=N，默认 config::FRAME_PACER_DEFAULT_TARGET_FPS）
+     */
+    int GetTargetFrameRate() const override { return m_targetFrameRate; }
+    
+    /**
+     * 获取 loading_cubes 场景的初始渲染方式
+     * 
+     * @return CubeRenderMode 渲染方式（--cubes=raycast|raster|taa，默认光线投射；运行时按 F8 切换）
+     */
+    CubeRenderMode GetCubeRenderMode() const override { return m_cubeRenderMode; }
+    
+    /**
+     * 获取全屏场景的初始执行路径
+     * 
+     * @return SceneExecutionPath 执行路径（--scene=graphics|compute，默认图形管线；运行时按 F7 切换）
+     */
+    SceneExecutionPath GetSceneExecutionPath() const override { return m_sceneExecutionPath; }
+    
+    /**
+     * 是否启用动态分辨率
+     * 
+     * @return bool 命令行包含 --dynamic-res 时返回 true
+     */
+    bool IsDynamicResolutionEnabled() const override { return m_dynamicResolutionEnabled; }
+    
+    /**
+     * 获取动态分辨率的GPU帧耗时预算
+     * 
+     * @return double 预算（毫秒，--gpu-budget=MS；未指定时为目标帧间隔的 config::DYNAMIC_RESOLUTION_BUDGET_FRACTION）
+     */
+    double GetGpuFrameBudgetMs() const override;
+    
+    /**
+     * 是否启用GPU时间戳分析器
+     * 
+     * @return bool 命令行包含 --gpu-profile 或 --gpu-profile-csv=PATH 时返回 true
+     */
+    bool IsGpuProfilerEnabled() const override { return m_gpuProfilerEnabled; }
+    
+    /**
+     * 获取GPU时间戳分析器的CSV输出路径
+     * 
+     * @return std::string CSV文件路径（--gpu-profile-csv=PATH，为空时不输出）
+     */
+    std::string GetGpuProfilerCsvPath() const override { return m_gpuProfilerCsvPath; }
+    
+    /**
+     * 是否启用CPU帧阶段追踪
+     * 
+     * @return bool 命令行包含 --trace 或 --trace-file=PATH 时返回 true
+     */
+    bool IsFrameTraceEnabled() const override { return m_frameTraceEnabled; }
+    
+    /**
+     * 获取Chrome trace JSON的输出路径
+     * 
+     * @return std::string 输出路径（--trace-file=PATH，默认 config::FRAME_TRACER_DEFAULT_FILE_PATH）
+     */
+    std::string GetFrameTracePath() const override { return m_frameTracePath; }
+    
     // 设置资源路径（扩展方法，不在接口中）
     /**
      * 设置Shader顶点着色器路径
@@ -186,6 +277,67 @@ public:
      * @param path 日志文件路径
      */
     void SetLogPath(const std::string& path) { m_logPath = path; }
+    
+    /**
+     * 设置帧节奏模式
+     * 
+     * @param mode 帧节奏模式
+     */
+    void SetFramePacingMode(FramePacingMode mode) { m_framePacingMode = mode; }
+    
+    /**
+     * 设置限帧模式的目标帧率
+     * 
+     * @param fps 目标帧率（必须大于0）
+     */
+    void SetTargetFrameRate(int fps) { if (fps > 0) m_targetFrameRate = fps; }
+    
+    /**
+     * 设置 loading_cubes 场景的初始渲染方式
+     * 
+     * @param mode 渲染方式
+     */
+    void SetCubeRenderMode(CubeRenderMode mode) { m_cubeRenderMode = mode; }
+    
+    /**
+     * 设置全屏场景的初始执行路径
+     * 
+     * @param path 执行路径
+     */
+    void SetSceneExecutionPath(SceneExecutionPath path) { m_sceneExecutionPath = path; }
+    
+    /**
+     * 设置GPU时间戳分析器选项
+     * 
+     * @param enabled 是否启用
+     * @param csvPath CSV输出路径（为空时不输出）
+     */
+    void SetGpuProfilerOptions(bool enabled, const std::string& csvPath) {
+        m_gpuProfilerEnabled = enabled;
+        m_gpuProfilerCsvPath = csvPath;
+    }
+    
+    /**
+     * 设置动态分辨率选项
+     * 
+     * @param enabled 是否启用
+     * @param gpuBudgetMs GPU帧耗时预算（毫秒，不大于0时按目标帧率计算）
+     */
+    void SetDynamicResolutionOptions(bool enabled, double gpuBudgetMs) {
+        m_dynamicResolutionEnabled = enabled;
+        m_gpuFrameBudgetMs = gpuBudgetMs;
+    }
+    
+    /**
+     * 设置CPU帧阶段追踪选项
+     * 
+     * @param enabled 是否启用
+     * @param path Chrome trace JSON的输出路径
+     */
+    void SetFrameTraceOptions(bool enabled, const std::string& path) {
+        m_frameTraceEnabled = enabled;
+        m_frameTracePath = path;
+    }
 
 private:
     // 禁止拷贝和赋值
@@ -219,5 +371,32 @@ private:
     
     // 日志路径
     std::string m_logPath = "shader_app.log";  // 日志文件路径
+    
+    // headless 基准测试配置
+    bool m_headless = false;  // 是否以无窗口模式运行
+    int m_headlessFrameCount = config::HEADLESS_DEFAULT_FRAME_COUNT;  // 每个场景渲染的帧数
+    std::string m_headlessOutputPath;  // 基准测试结果CSV路径（为空时不输出）
+    
+    // 帧节奏配置
+    FramePacingMode m_framePacingMode = FramePacingMode::VSync;  // 帧节奏模式
+    int m_targetFrameRate = config::FRAME_PACER_DEFAULT_TARGET_FPS;  // 限帧模式目标帧率
+    
+    // loading_cubes 渲染方式
+    CubeRenderMode m_cubeRenderMode = CubeRenderMode::RayCast;
+    
+    // 全屏场景执行路径
+    SceneExecutionPath m_sceneExecutionPath = SceneExecutionPath::Graphics;
+    
+    // 动态分辨率配置
+    bool m_dynamicResolutionEnabled = false;  // 是否启用
+    double m_gpuFrameBudgetMs = 0.0;  // GPU帧耗时预算（毫秒，0 表示按目标帧率计算）
+    
+    // GPU 时间戳分析器配置
+    bool m_gpuProfilerEnabled = false;  // 是否启用
+    std::string m_gpuProfilerCsvPath;  // CSV输出路径（为空时不输出）
+    
+    // CPU 帧阶段追踪配置
+    bool m_frameTraceEnabled = false;  // 是否启用
+    std::string m_frameTracePath = config::FRAME_TRACER_DEFAULT_FILE_PATH;  // Chrome trace JSON输出路径
 };
 
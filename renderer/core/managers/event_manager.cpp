@@ -1,5 +1,6 @@
 #include "core/managers/event_manager.h"  // 1. 对应头文件
 
+#include <stdio.h>  // 2. 系统头文件
 #include <windows.h>  // 2. 系统头文件
 
 #include "core/interfaces/iconfig_provider.h"  // 4. 项目头文件（接口）
@@ -7,6 +8,7 @@
 #include "core/interfaces/iscene_provider.h"  // 4. 项目头文件（接口）
 #include "core/managers/scene_manager.h"  // 4. 项目头文件（管理器）
 #include "core/utils/event_bus.h"  // 4. 项目头文件（工具）
+#include "core/utils/frame_tracer.h"  // 4. 项目头文件（工具）
 #include "core/utils/logger.h"  // 4. 项目头文件（工具）
 #include "window/window.h"  // 4. 项目头文件（窗口）
 
@@ -100,6 +102,8 @@ bool EventManager::ProcessMessages(StretchMode stretchMode) {
         return false;
     }
     
+    TraceScope traceScope("ProcessMessages");
+    
     MSG msg = {};
     while (PeekMessage(&msg, NULL, 0, 0, PM_REMOVE)) {
         if (!ProcessMessage(msg, stretchMode)) {
@@ -159,8 +163,43 @@ bool EventManager::HandleMouseMessage(const MSG& msg, StretchMode stretchMode) {
 }
 
 bool EventManager::HandleKeyboardMessage(const MSG& msg) {
-    // 可以在这里处理键盘消息
-    // 目前主要处理在RenderScheduler中
+    // F9：写出CPU帧阶段追踪（--trace 启用时）
+    if (msg.message == WM_KEYDOWN && msg.wParam == VK_F9 && FrameTracer::IsEnabled()) {
+        FrameTracer::WriteTrace();
+        return true;
+    }
+    
+    // F8：依次切换loading_cubes的渲染方式（光线投射 / 实例化光栅化 / 时间抗锯齿），用于在同一设备上比较各路径
+    if (msg.message == WM_KEYDOWN && msg.wParam == VK_F8 && m_renderer) {
+        CubeRenderMode mode = CubeRenderMode::RayCast;
+        const char* name = "raycast";
+        switch (m_renderer->GetCubeRenderMode()) {
+        case CubeRenderMode::RayCast:
+            mode = CubeRenderMode::Raster;
+            name = "raster";
+            break;
+        case CubeRenderMode::Raster:
+            mode = CubeRenderMode::Temporal;
+            name = "taa";
+            break;
+        case CubeRenderMode::Temporal:
+            break;
+        }
+        m_renderer->SetCubeRenderMode(mode);
+        printf("[RENDER] Loading cubes render mode: %s\n", name);
+        return true;
+    }
+    
+    // F7：切换全屏场景的执行路径（图形管线 / 计算着色器），用于在同一设备上比较两条路径
+    if (msg.message == WM_KEYDOWN && msg.wParam == VK_F7 && m_renderer) {
+        SceneExecutionPath path = m_renderer->GetSceneExecutionPath() == SceneExecutionPath::Graphics ? SceneExecutionPath::Compute
+                                                                                                      : SceneExecutionPath::Graphics;
+        m_renderer->SetSceneExecutionPath(path);
+        printf("[RENDER] Scene execution path: %s\n", path == SceneExecutionPath::Compute ? "compute" : "graphics");
+        return true;
+    }
+    
+    // 其余键盘输入目前主要在RenderScheduler中处理
     return true;
 }
 
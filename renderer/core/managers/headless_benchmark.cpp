@@ -0,0 +1,250 @@
+#include "core/managers/headless_benchmark.h"  // 1. 对应头文件
+
+#include <algorithm>  // 2. 系统头文件
+#include <chrono>  // 2. 系统头文件
+#include <stdio.h>  // 2. 系统头文件
+#include <thread>  // 2. 系统头文件
+#include <vector>  // 2. 系统头文件
+
+#include "core/config/render_constants.h"  // 4. 项目头文件（配置）
+#include "core/interfaces/iconfig_provider.h"  // 4. 项目头文件（接口）
+#include "core/interfaces/ipipeline_manager.h"  // 4. 项目头文件（接口）
+#include "core/interfaces/irenderer.h"  // 4. 项目头文件（接口）
+#include "core/interfaces/irenderer_factory.h"  // 4. 项目头文件（接口）
+#include "core/utils/frame_tracer.h"  // 4. 项目头文件（工具）
+#include "window/window.h"  // 4. 项目头文件（错误报告）
+
+HeadlessBenchmark::HeadlessBenchmark() {
+}
+
+HeadlessBenchmark::~HeadlessBenchmark() {
+    Cleanup();
+}
+
+bool HeadlessBenchmark::Initialize(IRendererFactory* rendererFactory, IConfigProvider* configProvider) {
+    if (m_initialized) {
+        return true;
+    }
+    
+    if (!rendererFactory || !configProvider) {
+        fprintf(stderr, "[HEADLESS] Renderer factory or config provider is null\n");
+        return false;
+    }
+    
+    m_configProvider = configProvider;
+    m_renderer = rendererFactory->CreateRenderer();
+    if (!m_renderer) {
+        fprintf(stderr, "[HEADLESS] Failed to create renderer\n");
+        return false;
+    }
+    
+    // GPU分析器在初始化时创建，CSV可用于离线分析基准测试各阶段的GPU耗时
+    m_renderer->SetGpuProfilerOptions(configProvider->IsGpuProfilerEnabled(), configProvider->GetGpuProfilerCsvPath());
+    m_renderer->SetCubeRenderMode(configProvider->GetCubeRenderMode());
+    m_renderer->SetSceneExecutionPath(configProvider->GetSceneExecutionPath());
+    m_renderer->SetDynamicResolutionOptions(configProvider->IsDynamicResolutionEnabled(), configProvider->GetGpuFrameBudgetMs());
+    
+    uint32_t width = (uint32_t)configProvider->GetWindowWidth();
+    uint32_t height = (uint32_t)configProvider->GetWindowHeight();
+    if (!m_renderer->InitializeHeadless(width, height)) {
+        fprintf(stderr, "[HEADLESS] Failed to initialize renderer in headless mode\n");
+        m_renderer.reset();
+        return false;
+    }
+    
+    m_renderer->SetStretchMode(configProvider->GetStretchMode());
+    m_renderer->SetBackgroundStretchMode(configProvider->GetBackgroundStretchMode());
+    
+    // 背景纹理只影响Loading场景，加载失败时仍可测量其余部分
+    if (!m_renderer->LoadBackgroundTexture(configProvider->GetBackgroundTexturePath())) {
+        printf("[HEADLESS] Background texture not loaded: %s\n", configProvider->GetBackgroundTexturePath().c_str());
+    }
+    
+    // 与窗口模式相同，场景管线在预编译工作线程上创建；测量前等待编译结束
+    IPipelineManager* pipelineManager = m_renderer->GetPipelineManager();
+    if (pipelineManager && pipelineManager->PrecompileScenePipelines(
+            configProvider->GetShaderVertexPath(), configProvider->GetShaderFragmentPath(),
+            configProvider->GetLoadingCubesVertexPath(), configProvider->GetLoadingCubesFragmentPath())) {
+        m_shaderPipelineReady = WaitForScenePipeline(pipelineManager, ScenePipelineType::Shader);
+        m_loadingCubesPipelineReady = WaitForScenePipeline(pipelineManager, ScenePipelineType::LoadingCubes);
+    }
+    
+    m_initialized = true;
+    return true;
+}
+
+void HeadlessBenchmark::Cleanup() {
+    if (!m_initialized) {
+        return;
+    }
+    
+    if (m_renderer) {
+        m_renderer->Cleanup();
+        m_renderer.reset();
+    }
+    
+    m_configProvider = nullptr;
+    m_results.clear();
+    m_shaderPipelineReady = false;
+    m_loadingCubesPipelineReady = false;
+    m_initialized = false;
+}
+
+int HeadlessBenchmark::RunUnattended(IRendererFactory* rendererFactory, IConfigProvider* configProvider) {
+    // 无人值守运行：错误写入 stderr 而不是弹出对话框，出现过错误时以非零代码退出
+    Window::SetErrorDialogsEnabled(false);
+    
+    HeadlessBenchmark benchmark;
+    if (!benchmark.Initialize(rendererFactory, configProvider)) {
+        return 1;
+    }
+    int result = benchmark.Run();
+    benchmark.Cleanup();
+    FrameTracer::WriteTrace();
+    if (result == 0 && Window::HasReportedErrors()) {
+        result = 1;
+    }
+    return result;
+}
+
+int HeadlessBenchmark::Run() {
+    if (!m_initialized || !m_renderer || !m_configProvider) {
+        return 1;
+    }
+    
+    int frameCount = m_configProvider->GetHeadlessFrameCount();
+    Extent2D extent = m_renderer->GetSwapchainExtent();
+    printf("[HEADLESS] Benchmark: %d frames per scene at %ux%u\n", frameCount, extent.width, extent.height);
+    m_results.clear();
+    
+    bool success = true;
+    if (m_shaderPipelineReady) {
+        success = MeasureScene("Shader", 0, frameCount) && success;
+    } else {
+        printf("[HEADLESS] Shader pipeline unavailable, scene skipped\n");
+    }
+    
+    if (m_loadingCubesPipelineReady) {
+        success = MeasureScene("LoadingCubes", 1, frameCount) && success;
+    } else {
+        printf("[HEADLESS] LoadingCubes pipeline unavailable, scene skipped\n");
+    }
+    
+    success = MeasureScene("Loading", 2, frameCount) && success;
+    
+    std::string outputPath = m_configProvider->GetHeadlessOutputPath();
+    if (!outputPath.empty() && !WriteResults(outputPath)) {
+        success = false;
+    }
+    
+    return success ? 0 : 1;
+}
+
+bool HeadlessBenchmark::MeasureScene(const std::string& sceneName, int sceneIndex, int frameCount) {
+    // 动画时间按60Hz推进，使每次运行的渲染内容一致，结果可直接对比
+    const float frameTime = 1.0f / 60.0f;
+    float time = 0.0f;
+    
+    // 预热帧：排除管线首次使用、驱动内部缓存等一次性开销
+    for (int i = 0; i < config::HEADLESS_WARMUP_FRAME_COUNT; i++) {
+        if (!DrawScene(sceneIndex, time)) {
+            printf("[HEADLESS] %s: warmup frame %d failed\n", sceneName.c_str(), i);
+            return false;
+        }
+        time += frameTime;
+    }
+    
+    std::vector<double> frameMilliseconds;
+    frameMilliseconds.reserve(frameCount);
+    
+    auto sceneStart = std::chrono::steady_clock::now();
+    for (int i = 0; i < frameCount; i++) {
+        auto frameStart = std::chrono::steady_clock::now();
+        if (!DrawScene(sceneIndex, time)) {
+            printf("[HEADLESS] %s: frame %d failed\n", sceneName.c_str(), i);
+            return false;
+        }
+        auto frameEnd = std::chrono::steady_clock::now();
+        frameMilliseconds.push_back(std::chrono::duration<double, std::milli>(frameEnd - frameStart).count());
+        time += frameTime;
+    }
+    double totalMilliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - sceneStart).count();
+    
+    if (frameMilliseconds.empty()) {
+        return true;
+    }
+    
+    // 单帧耗时包含等待前一轮同槽位帧的栅栏，稳态下反映GPU/CPU中较慢一方的吞吐
+    std::sort(frameMilliseconds.begin(), frameMilliseconds.end());
+    double average = totalMilliseconds / (double)frameMilliseconds.size();
+    double median = frameMilliseconds[frameMilliseconds.size() / 2];
+    double p95 = frameMilliseconds[(frameMilliseconds.size() * 95) / 100];
+    
+    SceneResult result;
+    result.sceneName = sceneName;
+    result.frameCount = (int)frameMilliseconds.size();
+    result.averageMs = average;
+    result.medianMs = median;
+    result.p95Ms = p95;
+    result.minMs = frameMilliseconds.front();
+    result.maxMs = frameMilliseconds.back();
+    m_results.push_back(result);
+    
+    printf("[HEADLESS] %-12s avg %.3f ms  median %.3f ms  p95 %.3f ms  min %.3f ms  max %.3f ms  (%.1f FPS)\n",
+           sceneName.c_str(), average, median, p95, result.minMs, result.maxMs,
+           average > 0.0 ? 1000.0 / average : 0.0);
+    
+    return true;
+}
+
+bool HeadlessBenchmark::WriteResults(const std::string& path) const {
+    FILE* file = fopen(path.c_str(), "w");
+    if (!file) {
+        fprintf(stderr, "[HEADLESS] Failed to open results file: %s\n", path.c_str());
+        return false;
+    }
+    
+    // 每个测量完成的场景一行；跳过或失败的场景不写入（退出代码非零）
+    fprintf(file, "scene,frames,avg_ms,median_ms,p95_ms,min_ms,max_ms\n");
+    for (const SceneResult& result : m_results) {
+        fprintf(file, "%s,%d,%.4f,%.4f,%.4f,%.4f,%.4f\n", result.sceneName.c_str(), result.frameCount,
+                result.averageMs, result.medianMs, result.p95Ms, result.minMs, result.maxMs);
+    }
+    
+    bool written = ferror(file) == 0;
+    if (fclose(file) != 0 || !written) {
+        fprintf(stderr, "[HEADLESS] Failed to write results file: %s\n", path.c_str());
+        return false;
+    }
+    printf("[HEADLESS] Results written to %s\n", path.c_str());
+    return true;
+}
+
+bool HeadlessBenchmark::WaitForScenePipeline(IPipelineManager* pipelineManager, ScenePipelineType type) {
+    auto compileStart = std::chrono::steady_clock::now();
+    ScenePipelineState state = pipelineManager->GetScenePipelineState(type);
+    while (state == ScenePipelineState::Compiling) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        state = pipelineManager->GetScenePipelineState(type);
+    }
+    
+    // 两个场景管线在同一个工作线程上依次编译，第二个的等待时间只包含它自己的编译
+    printf("[HEADLESS] %s pipeline %s after %.1f ms\n", type == ScenePipelineType::Shader ? "Shader" : "LoadingCubes",
+           state == ScenePipelineState::Ready ? "ready" : "failed",
+           std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - compileStart).count());
+    return state == ScenePipelineState::Ready;
+}
+
+bool HeadlessBenchmark::DrawScene(int sceneIndex, float time) {
+    switch (sceneIndex) {
+        case 0:
+            return m_renderer->DrawFrame(time, false);
+        case 1:
+            return m_renderer->DrawFrame(time, true);
+        default: {
+            DrawFrameWithLoadingParams params;
+            params.time = time;
+            return m_renderer->DrawFrameWithLoading(params);
+        }
+    }
+}
@@ -0,0 +1,123 @@
+#pragma once
+
+#include <memory>  // 2. 系统头文件
+#include <string>  // 2. 系统头文件
+#include <vector>  // 2. 系统头文件
+
+// 前向声明
+class IRendererFactory;
+class IRenderer;
+class IConfigProvider;
+class IPipelineManager;
+enum class ScenePipelineType;
+
+/**
+ * 无窗口基准测试 - 在headless渲染器上循环绘制各场景并统计帧耗时
+ * 
+ * 职责：不创建窗口和UI，直接驱动 IRenderer 的 DrawFrame/DrawFrameWithLoading，输出每个场景的帧耗时统计
+ * 设计：通过依赖注入获取渲染器工厂和配置，可在无显示设备的环境（软件 Vulkan ICD）中运行，用于发现性能回退
+ * 
+ * 使用方式：
+ * 1. 创建 HeadlessBenchmark 实例
+ * 2. 调用 Initialize() 创建并以headless模式初始化渲染器
+ * 3. 调用 Run() 执行测量并打印结果（--headless-output=PATH 时同时写入CSV结果文件）
+ * 4. 调用 Cleanup() 清理资源（析构函数自动调用）
+ */
+class HeadlessBenchmark {
+public:
+    HeadlessBenchmark();
+    ~HeadlessBenchmark();
+    
+    /**
+     * 初始化基准测试
+     * 
+     * 通过工厂创建渲染器，以配置中的窗口尺寸作为离屏目标尺寸初始化，并预编译场景管线（等待编译结束）
+     * 
+     * @param rendererFactory 渲染器工厂（不拥有所有权，由外部管理生命周期）
+     * @param configProvider 配置提供者（不拥有所有权，由外部管理生命周期）
+     * @return true 如果初始化成功，false 如果失败
+     */
+    bool Initialize(IRendererFactory* rendererFactory, IConfigProvider* configProvider);
+    
+    /**
+     * 运行基准测试
+     * 
+     * 依次测量 Shader、LoadingCubes、Loading 三个场景，每个场景先渲染预热帧，再计时指定帧数
+     * 
+     * @return 退出代码（0表示全部场景成功完成且结果文件写入成功）
+     */
+    int Run();
+    
+    /**
+     * 清理资源
+     */
+    void Cleanup();
+    
+    /**
+     * 无人值守运行完整的基准测试（WinMain 的 --headless 分支和控制台入口共用）
+     * 
+     * 关闭错误对话框（错误写入 stderr），依次初始化、测量、清理，并写出启用的帧追踪
+     * 
+     * @param rendererFactory 渲染器工厂（不拥有所有权）
+     * @param configProvider 配置提供者（不拥有所有权）
+     * @return 退出代码（初始化失败、场景失败或运行期间报告过错误时非零）
+     */
+    static int RunUnattended(IRendererFactory* rendererFactory, IConfigProvider* configProvider);
+
+private:
+    /**
+     * 测量单个场景的帧耗时
+     * 
+     * @param sceneName 场景名称（用于输出）
+     * @param sceneIndex 场景索引（0=Shader，1=LoadingCubes，2=Loading）
+     * @param frameCount 计时帧数
+     * @return true 如果所有帧均绘制成功，false 如果出现失败
+     */
+    bool MeasureScene(const std::string& sceneName, int sceneIndex, int frameCount);
+    
+    /**
+     * 等待场景管线在预编译工作线程上编译结束
+     * 
+     * @param pipelineManager 管线管理器
+     * @param type 场景管线类型
+     * @return true 如果管线已就绪，false 如果编译失败
+     */
+    bool WaitForScenePipeline(IPipelineManager* pipelineManager, ScenePipelineType type);
+    
+    /**
+     * 把已测量场景的统计写入CSV结果文件
+     * 
+     * @param path 结果文件路径
+     * @return true 如果写入成功，false 如果无法打开或写入
+     */
+    bool WriteResults(const std::string& path) const;
+    
+    /**
+     * 绘制指定场景的一帧
+     * 
+     * @param sceneIndex 场景索引
+     * @param time 动画时间（秒）
+     * @return true 如果绘制成功，false 如果失败
+     */
+    bool DrawScene(int sceneIndex, float time);
+    
+    // 单个场景的帧耗时统计（毫秒）
+    struct SceneResult {
+        std::string sceneName;
+        int frameCount = 0;
+        double averageMs = 0.0;
+        double medianMs = 0.0;
+        double p95Ms = 0.0;
+        double minMs = 0.0;
+        double maxMs = 0.0;
+    };
+    
+    std::unique_ptr<IRenderer> m_renderer;  // 渲染器（拥有所有权）
+    IConfigProvider* m_configProvider = nullptr;  // [BORROW] 配置提供者，由外部管理生命周期
+    std::vector<SceneResult> m_results;  // 已测量场景的统计（按测量顺序）
+    
+    bool m_shaderPipelineReady = false;  // Shader场景管线是否创建成功
+    bool m_loadingCubesPipelineReady = false;  // LoadingCubes场景管线是否创建成功
+    
+    bool m_initialized = false;  // 初始化状态标志，防止重复初始化
+};
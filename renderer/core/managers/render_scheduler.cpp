@@ -5,11 +5,13 @@
 
 #include "core/interfaces/icamera_controller.h"  // 4. 项目头文件（接口）
 #include "core/interfaces/iinput_provider.h"  // 4. 项目头文件（接口）
+#include "core/interfaces/ipipeline_manager.h"  // 4. 项目头文件（接口）
 #include "core/interfaces/irenderer.h"  // 4. 项目头文件（接口）
 #include "core/interfaces/iscene_provider.h"  // 4. 项目头文件（接口）
 #include "core/interfaces/itext_renderer.h"  // 4. 项目头文件（接口）
 #include "core/interfaces/iuirender_provider.h"  // 4. 项目头文件（接口）
 #include "core/interfaces/iwindow.h"  // 4. 项目头文件（接口）
+#include "core/utils/frame_tracer.h"  // 4. 项目头文件（工具）
 #include "loading/loading_animation.h"  // 4. 项目头文件（加载动画）
 #include "text/text_renderer.h"  // 4. 项目头文件（文字渲染器）
 #include "ui/button/button.h"  // 4. 项目头文件（UI组件）
@@ -42,8 +44,16 @@ void RenderScheduler::RenderFrame(float time, float deltaTime, float& fps) {
         return;
     }
     
+    TraceScope traceScope("RenderFrame");
+    
     AppState currentState = m_sceneProvider->GetState();
     
+    // 场景管线在后台编译完成前继续渲染加载界面，切换场景不会卡顿
+    if (currentState != AppState::Loading && !IsScenePipelineReady(currentState)) {
+        RenderLoading(time, fps);
+        return;
+    }
+    
     switch (currentState) {
         case AppState::LoadingCubes:
             RenderLoadingCubes(time, deltaTime, fps);
@@ -57,6 +67,22 @@ void RenderScheduler::RenderFrame(float time, float deltaTime, float& fps) {
     }
 }
 
+bool RenderScheduler::IsScenePipelineReady(AppState state) {
+    bool isLoadingCubes = (state == AppState::LoadingCubes);
+    if (isLoadingCubes ? m_sceneProvider->IsLoadingCubesPipelineCreated() : m_sceneProvider->IsShaderPipelineCreated()) {
+        return true;
+    }
+    
+    // 预编译失败时返回Loading状态，避免一直停留在等待中
+    IPipelineManager* pipelineManager = m_renderer->GetPipelineManager();
+    ScenePipelineType type = isLoadingCubes ? ScenePipelineType::LoadingCubes : ScenePipelineType::Shader;
+    if (pipelineManager && pipelineManager->GetScenePipelineState(type) == ScenePipelineState::Failed) {
+        printf("[ERROR] Scene pipeline precompilation failed, returning to Loading state\n");
+        m_sceneProvider->SwitchToLoading();
+    }
+    return false;
+}
+
 void RenderScheduler::RenderLoadingCubes(float time, float deltaTime, float& fps) {
     if (!m_inputProvider || !m_sceneProvider || !m_renderer) return;
     
@@ -59,6 +59,16 @@ public:
     void RenderFrame(float time, float deltaTime, float& fps);
     
 private:
+    /**
+     * 检查场景管线是否已就绪
+     * 
+     * 管线在后台编译期间返回 false；编译失败时切换回Loading状态
+     * 
+     * @param state 要渲染的场景状态（Shader 或 LoadingCubes）
+     * @return bool 管线已就绪返回 true，否则返回 false
+     */
+    bool IsScenePipelineReady(AppState state);
+    
     /**
      * 渲染LoadingCubes场景
      * 
@@ -17,81 +17,66 @@ bool SceneManager::ShouldHandleInput() const {
     return m_appState == AppState::Loading;
 }
 
-bool SceneManager::SwitchToShader(IRenderer* renderer, IConfigProvider* configProvider) {
+void SceneManager::PrecompileScenePipelines(IRenderer* renderer, IConfigProvider* configProvider) {
     if (!renderer || !configProvider) {
-        return false;
+        return;
     }
     
-    m_appState = AppState::Shader;
-    
-    if (!m_shaderPipelineCreated) {
-        std::string vertPath = configProvider->GetShaderVertexPath();
-        std::string fragPath = configProvider->GetShaderFragmentPath();
-        
-        // 通过 IPipelineManager 接口创建图形管线（遵循接口隔离原则）
-        IPipelineManager* pipelineManager = renderer->GetPipelineManager();
-        if (!pipelineManager) {
-            Window::ShowError("Renderer does not provide IPipelineManager interface!");
-            m_appState = AppState::Loading;
-            return false;
-        }
-        
-        if (!pipelineManager->CreateGraphicsPipeline(vertPath.c_str(), fragPath.c_str())) {
-            Window::ShowError("Failed to create shader pipeline!");
-            m_appState = AppState::Loading;
-            return false;
-        } else {
-            m_shaderPipelineCreated = true;
-        }
+    // 通过 IPipelineManager 接口在后台编译场景管线（遵循接口隔离原则）
+    m_pipelineManager = renderer->GetPipelineManager();
+    if (!m_pipelineManager) {
+        return;
     }
     
-    return true;
+    if (!m_pipelineManager->PrecompileScenePipelines(configProvider->GetShaderVertexPath(),
+                                                     configProvider->GetShaderFragmentPath(),
+                                                     configProvider->GetLoadingCubesVertexPath(),
+                                                     configProvider->GetLoadingCubesFragmentPath())) {
+        printf("[WARNING] Failed to start scene pipeline precompilation\n");
+    }
 }
 
-bool SceneManager::SwitchToLoadingCubes(IRenderer* renderer, IConfigProvider* configProvider) {
+bool SceneManager::IsLoadingCubesPipelineCreated() const {
+    return m_pipelineManager &&
+           m_pipelineManager->GetScenePipelineState(ScenePipelineType::LoadingCubes) == ScenePipelineState::Ready;
+}
+
+bool SceneManager::IsShaderPipelineCreated() const {
+    return m_pipelineManager &&
+           m_pipelineManager->GetScenePipelineState(ScenePipelineType::Shader) == ScenePipelineState::Ready;
+}
+
+bool SceneManager::SwitchToScene(IRenderer* renderer, IConfigProvider* configProvider,
+                                 AppState state, ScenePipelineType pipelineType) {
     if (!renderer || !configProvider) {
         return false;
     }
     
-    m_appState = AppState::LoadingCubes;
+    // 预编译尚未启动时（如初始化顺序不同）在此启动，切换本身不创建管线
+    if (!m_pipelineManager) {
+        PrecompileScenePipelines(renderer, configProvider);
+    }
+    if (!m_pipelineManager) {
+        Window::ShowError("Renderer does not provide IPipelineManager interface!");
+        return false;
+    }
     
-    if (!m_loadingCubesPipelineCreated) {
-        std::string vertPath = configProvider->GetLoadingCubesVertexPath();
-        std::string fragPath = configProvider->GetLoadingCubesFragmentPath();
-        
-        // 通过 IPipelineManager 接口创建加载立方体管线（遵循接口隔离原则）
-        IPipelineManager* pipelineManager = renderer->GetPipelineManager();
-        if (!pipelineManager) {
-            Window::ShowError("Renderer does not provide IPipelineManager interface!");
-            m_appState = AppState::Loading;
-            return false;
-        }
-        
-        // 先尝试 .spv 路径
-        if (!pipelineManager->CreateLoadingCubesPipeline(vertPath.c_str(), fragPath.c_str())) {
-            // 如果失败，尝试不带 .spv 扩展名的路径（用于调试）
-            std::string vertPathNoSpv = vertPath;
-            std::string fragPathNoSpv = fragPath;
-            if (vertPathNoSpv.size() > 4 && vertPathNoSpv.substr(vertPathNoSpv.size() - 4) == ".spv") {
-                vertPathNoSpv = vertPathNoSpv.substr(0, vertPathNoSpv.size() - 4);
-            }
-            if (fragPathNoSpv.size() > 4 && fragPathNoSpv.substr(fragPathNoSpv.size() - 4) == ".spv") {
-                fragPathNoSpv = fragPathNoSpv.substr(0, fragPathNoSpv.size() - 4);
-            }
-            
-            if (!pipelineManager->CreateLoadingCubesPipeline(vertPathNoSpv.c_str(), fragPathNoSpv.c_str())) {
-                printf("[ERROR] Failed to create loading cubes pipeline!\n");
-                Window::ShowError("Failed to create loading cubes pipeline!");
-                m_appState = AppState::Loading;
-                return false;
-            } else {
-                m_loadingCubesPipelineCreated = true;
-            }
-        } else {
-            m_loadingCubesPipelineCreated = true;
-        }
+    if (m_pipelineManager->GetScenePipelineState(pipelineType) == ScenePipelineState::Failed) {
+        Window::ShowError(pipelineType == ScenePipelineType::Shader ? "Failed to create shader pipeline!"
+                                                                    : "Failed to create loading cubes pipeline!");
+        m_appState = AppState::Loading;
+        return false;
     }
     
+    // 管线仍在编译时 RenderScheduler 继续渲染加载界面，编译完成后直接绑定
+    m_appState = state;
     return true;
 }
 
+bool SceneManager::SwitchToShader(IRenderer* renderer, IConfigProvider* configProvider) {
+    return SwitchToScene(renderer, configProvider, AppState::Shader, ScenePipelineType::Shader);
+}
+
+bool SceneManager::SwitchToLoadingCubes(IRenderer* renderer, IConfigProvider* configProvider) {
+    return SwitchToScene(renderer, configProvider, AppState::LoadingCubes, ScenePipelineType::LoadingCubes);
+}
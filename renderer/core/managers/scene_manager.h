@@ -1,6 +1,7 @@
 #pragma once
 
 #include "core/config/constants.h"  // 4. 项目头文件（配置）
+#include "core/interfaces/ipipeline_manager.h"  // 4. 项目头文件（接口）
 #include "core/interfaces/irenderer.h"  // 4. 项目头文件（接口）
 #include "core/interfaces/iscene_provider.h"  // 4. 项目头文件（接口）
 
@@ -11,13 +12,14 @@ class IConfigProvider;
 /**
  * 场景管理器 - 负责场景状态管理和切换
  * 
- * 职责：实现 ISceneProvider 接口，管理应用场景状态和管线创建
+ * 职责：实现 ISceneProvider 接口，管理应用场景状态和场景管线预编译
  * 设计：通过接口访问渲染器和配置，遵循接口隔离原则
  * 
  * 使用方式：
  * 1. 创建 SceneManager 实例
- * 2. 通过 ISceneProvider 接口访问场景状态
- * 3. 使用 SwitchToShader()、SwitchToLoadingCubes() 切换场景
+ * 2. 加载界面期间调用 PrecompileScenePipelines() 在后台编译场景管线
+ * 3. 通过 ISceneProvider 接口访问场景状态
+ * 4. 使用 SwitchToShader()、SwitchToLoadingCubes() 切换场景（只切换状态，不创建管线）
  */
 class SceneManager : public ISceneProvider {
 public:
@@ -47,11 +49,18 @@ public:
     void SwitchToLoading() override { m_appState = AppState::Loading; }
     
     /**
-     * 检查LoadingCubes管线是否已创建
+     * 检查LoadingCubes管线是否已创建（后台编译已完成）
      * 
      * @return bool 如果管线已创建返回 true，否则返回 false
      */
-    bool IsLoadingCubesPipelineCreated() const override { return m_loadingCubesPipelineCreated; }
+    bool IsLoadingCubesPipelineCreated() const override;
+    
+    /**
+     * 检查Shader管线是否已创建（后台编译已完成）
+     * 
+     * @return bool 如果管线已创建返回 true，否则返回 false
+     */
+    bool IsShaderPipelineCreated() const override;
     
     /**
      * 设置应用状态
@@ -60,10 +69,20 @@ public:
      */
     void SetState(AppState state) { m_appState = state; }
     
+    /**
+     * 在后台预编译所有场景管线（使用接口）
+     * 
+     * 应在加载界面期间调用，立即返回；管线编译完成前 RenderScheduler 继续渲染加载界面
+     * 
+     * @param renderer 渲染器（不拥有所有权，用于创建管线）
+     * @param configProvider 配置提供者（不拥有所有权，用于获取shader路径）
+     */
+    void PrecompileScenePipelines(IRenderer* renderer, IConfigProvider* configProvider);
+    
     /**
      * 切换到Shader场景（使用接口）
      * 
-     * 创建Shader管线（如果尚未创建）并切换到Shader状态
+     * 切换到Shader状态，管线由 PrecompileScenePipelines() 预先创建，预编译失败时保持Loading状态
      * 
      * @param renderer 渲染器（不拥有所有权，用于创建管线）
      * @param configProvider 配置提供者（不拥有所有权，用于获取shader路径）
@@ -74,24 +93,20 @@ public:
     /**
      * 切换到LoadingCubes场景（使用接口）
      * 
-     * 创建LoadingCubes管线（如果尚未创建）并切换到LoadingCubes状态
+     * 切换到LoadingCubes状态，管线由 PrecompileScenePipelines() 预先创建，预编译失败时保持Loading状态
      * 
      * @param renderer 渲染器（不拥有所有权，用于创建管线）
      * @param configProvider 配置提供者（不拥有所有权，用于获取shader路径）
      * @return bool 如果切换成功返回 true，否则返回 false
      */
     bool SwitchToLoadingCubes(IRenderer* renderer, IConfigProvider* configProvider);
-    
-    /**
-     * 检查Shader管线是否已创建
-     * 
-     * @return bool 如果管线已创建返回 true，否则返回 false
-     */
-    bool IsShaderPipelineCreated() const { return m_shaderPipelineCreated; }
 
 private:
+    // 切换到指定场景（预编译失败时显示错误并保持Loading状态）
+    bool SwitchToScene(IRenderer* renderer, IConfigProvider* configProvider,
+                       AppState state, ScenePipelineType pipelineType);
+    
     AppState m_appState = AppState::Loading;  // 当前应用状态
-    bool m_shaderPipelineCreated = false;  // Shader管线是否已创建
-    bool m_loadingCubesPipelineCreated = false;  // LoadingCubes管线是否已创建
+    IPipelineManager* m_pipelineManager = nullptr;  // [BORROW] 由渲染器拥有，用于查询场景管线状态
 };
 
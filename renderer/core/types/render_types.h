@@ -136,6 +136,20 @@ using BufferHandle = void*;
  */
 using DeviceMemoryHandle = void*;
 
+/**
+ * 图像句柄（不透明指针，替代 VkImage）
+ * 
+ * 用于表示GPU图像，如纹理和离屏渲染目标
+ */
+using ImageHandle = void*;
+
+/**
+ * 管线缓存句柄（不透明指针，替代 VkPipelineCache）
+ * 
+ * 用于在多个管线创建之间共享已编译的着色器数据，可为空
+ */
+using PipelineCacheHandle = void*;
+
 /**
  * 管线句柄（不透明指针，替代 VkPipeline）
  * 
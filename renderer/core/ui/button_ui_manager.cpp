@@ -55,7 +55,10 @@ bool ButtonUIManager::Initialize(const IRenderContext& renderContext,
         renderContext.GetCommandPool(),
         renderContext.GetGraphicsQueue(),
         renderContext.GetRenderPass(),
-        extent
+        extent,
+        renderContext.GetMemoryAllocator(),
+        renderContext.GetPipelineCache(),
+        renderContext.GetPipelineRegistry()
     ));
     IRenderContext& nonConstContext = *nonConstContextPtr;
     
@@ -50,7 +50,10 @@ bool ColorUIManager::Initialize(IRenderer* renderer,
         renderContext.GetCommandPool(),
         renderContext.GetGraphicsQueue(),
         renderContext.GetRenderPass(),
-        extent
+        extent,
+        renderContext.GetMemoryAllocator(),
+        renderContext.GetPipelineCache(),
+        renderContext.GetPipelineRegistry()
     ));
     IRenderContext& nonConstContext = *nonConstContextPtr;
     
@@ -157,6 +160,9 @@ bool ColorUIManager::InitializeColorController(IRenderer* renderer, IRenderConte
         return false;
     }
     
+    m_colorController->SetMemoryAllocator(renderDevice->GetMemoryAllocator());
+    m_colorController->SetPipelineCache(renderDevice->GetPipelineCache());
+    m_colorController->SetPipelineRegistry(renderDevice->GetPipelineRegistry());
     if (m_colorController->Initialize(
             renderDevice->GetDevice(),
             renderDevice->GetPhysicalDevice(),
@@ -236,6 +242,9 @@ bool ColorUIManager::InitializeBoxColorControllers(IRenderer* renderer, IRenderC
             continue;
         }
         
+        m_boxColorControllers[i]->SetMemoryAllocator(renderDevice->GetMemoryAllocator());
+        m_boxColorControllers[i]->SetPipelineCache(renderDevice->GetPipelineCache());
+        m_boxColorControllers[i]->SetPipelineRegistry(renderDevice->GetPipelineRegistry());
         if (m_boxColorControllers[i]->Initialize(
                 renderDevice->GetDevice(),
                 renderDevice->GetPhysicalDevice(),
@@ -29,7 +29,10 @@ bool SliderUIManager::Initialize(const IRenderContext& renderContext, IWindow* w
         renderContext.GetCommandPool(),
         renderContext.GetGraphicsQueue(),
         renderContext.GetRenderPass(),
-        extent
+        extent,
+        renderContext.GetMemoryAllocator(),
+        renderContext.GetPipelineCache(),
+        renderContext.GetPipelineRegistry()
     ));
     IRenderContext& nonConstContext = *nonConstContextPtr;
     return InitializeOrangeSlider(nonConstContext, stretchMode);
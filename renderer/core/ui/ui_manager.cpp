@@ -71,7 +71,10 @@ bool UIManager::Initialize(IRenderer* renderer,
         renderDevice->GetCommandPool(),
         renderDevice->GetGraphicsQueue(),
         renderDevice->GetRenderPass(),
-        uiExtent
+        uiExtent,
+        renderDevice->GetMemoryAllocator(),
+        renderDevice->GetPipelineCache(),
+        renderDevice->GetPipelineRegistry()
     ));
     
     if (!InitializeLoadingAnimation(m_renderer, *renderContext, stretchMode, screenWidth, screenHeight)) {
@@ -226,6 +229,8 @@ bool UIManager::InitializeLoadingAnimation(IRenderer* renderer, const IRenderCon
     }
     
     m_loadingAnim = std::make_unique<LoadingAnimation>();
+    m_loadingAnim->SetMemoryAllocator(renderDevice->GetMemoryAllocator());
+    m_loadingAnim->SetPipelineCache(renderDevice->GetPipelineCache());
     // 使用抽象类型（LoadingAnimation接口已改为使用抽象类型）
     if (m_loadingAnim->Initialize(
             renderDevice->GetDevice(),
@@ -0,0 +1,70 @@
+#include "core/utils/dynamic_resolution.h"  // 1. 对应头文件
+
+#include <algorithm>  // 2. 系统头文件
+#include <cmath>  // 2. 系统头文件
+
+#include "core/config/render_constants.h"  // 4. 项目头文件（配置）
+
+DynamicResolutionController::DynamicResolutionController() {
+}
+
+DynamicResolutionController::~DynamicResolutionController() {
+}
+
+void DynamicResolutionController::Initialize(double gpuBudgetMs) {
+    m_budgetMs = gpuBudgetMs;
+    m_level = MaxLevel();
+    m_smoothedMs = 0.0;
+    m_samplesSinceChange = 0;
+}
+
+int DynamicResolutionController::MinLevel() const {
+    return (int)std::ceil(config::DYNAMIC_RESOLUTION_MIN_SCALE / config::DYNAMIC_RESOLUTION_SCALE_STEP - 0.001f);
+}
+
+int DynamicResolutionController::MaxLevel() const {
+    return (int)std::floor(1.0f / config::DYNAMIC_RESOLUTION_SCALE_STEP + 0.001f);
+}
+
+float DynamicResolutionController::GetScale() const {
+    if (m_level >= MaxLevel()) {
+        return 1.0f;
+    }
+    return (float)m_level * config::DYNAMIC_RESOLUTION_SCALE_STEP;
+}
+
+bool DynamicResolutionController::Update(double gpuFrameMs) {
+    if (gpuFrameMs <= 0.0 || m_budgetMs <= 0.0) {
+        return false;
+    }
+    
+    if (m_smoothedMs <= 0.0) {
+        m_smoothedMs = gpuFrameMs;
+    } else {
+        m_smoothedMs += (gpuFrameMs - m_smoothedMs) * config::DYNAMIC_RESOLUTION_SMOOTHING;
+    }
+    
+    m_samplesSinceChange++;
+    if (m_samplesSinceChange < config::DYNAMIC_RESOLUTION_ADJUST_INTERVAL_FRAMES) {
+        return false;
+    }
+    
+    int newLevel = m_level;
+    if (m_smoothedMs > m_budgetMs) {
+        // 像素数与比例的平方成正比，按耗时比估算目标比例；至少降一档
+        double target = (double)GetScale() * std::sqrt(m_budgetMs / m_smoothedMs);
+        int targetLevel = (int)std::floor(target / config::DYNAMIC_RESOLUTION_SCALE_STEP);
+        newLevel = std::max(MinLevel(), std::min(m_level - 1, targetLevel));
+    } else if (m_smoothedMs < m_budgetMs * config::DYNAMIC_RESOLUTION_UPSCALE_THRESHOLD) {
+        newLevel = std::min(MaxLevel(), m_level + 1);
+    }
+    
+    if (newLevel == m_level) {
+        return false;
+    }
+    
+    m_level = newLevel;
+    m_smoothedMs = 0.0;
+    m_samplesSinceChange = 0;
+    return true;
+}
@@ -0,0 +1,67 @@
+#pragma once
+
+/**
+ * 动态分辨率控制器 - 根据实测 GPU 帧耗时选择全屏场景的渲染比例
+ * 
+ * 职责：对 GPU 时间戳读回的帧耗时做指数平滑，与预算比较后按固定步长调整渲染比例
+ * 设计：比例以整数档位保存（比例 = 档位 × config::DYNAMIC_RESOLUTION_SCALE_STEP），
+ * 范围为 [config::DYNAMIC_RESOLUTION_MIN_SCALE, 1]。超出预算时按像素数与耗时成正比估算
+ * 目标比例（比例 × sqrt(预算 / 耗时)）直接降到对应档位；低于预算的
+ * config::DYNAMIC_RESOLUTION_UPSCALE_THRESHOLD 时每次只提高一档，避免在预算附近振荡。
+ * 时间戳结果滞后若干帧，每次调整后清空平滑值并至少等待
+ * config::DYNAMIC_RESOLUTION_ADJUST_INTERVAL_FRAMES 个读回，使判断基于新比例下的耗时。
+ * 控制器只做 CPU 端计算，独立于渲染系统
+ * 
+ * 使用方式：
+ * 1. 调用 Initialize() 设置预算
+ * 2. 每次读回 GPU 帧耗时后调用 Update()，返回 true 时比例已改变
+ * 3. 录制场景时使用 GetScale()
+ */
+class DynamicResolutionController {
+public:
+    DynamicResolutionController();
+    ~DynamicResolutionController();
+    
+    /**
+     * 初始化控制器（比例重置为 1）
+     * 
+     * @param gpuBudgetMs GPU 帧耗时预算（毫秒，必须大于0）
+     */
+    void Initialize(double gpuBudgetMs);
+    
+    /**
+     * 提交一帧的 GPU 耗时并按需调整比例
+     * 
+     * @param gpuFrameMs 该帧的 GPU 耗时（毫秒，不大于0时忽略）
+     * @return 比例改变时返回 true
+     */
+    bool Update(double gpuFrameMs);
+    
+    /**
+     * 获取当前渲染比例（宽高各自乘以该比例）
+     */
+    float GetScale() const;
+    
+    /**
+     * 获取平滑后的 GPU 帧耗时（毫秒，尚无样本时为 0）
+     */
+    double GetSmoothedMs() const { return m_smoothedMs; }
+    
+    /**
+     * 获取 GPU 帧耗时预算（毫秒）
+     */
+    double GetBudgetMs() const { return m_budgetMs; }
+
+private:
+    // 禁止拷贝和赋值
+    DynamicResolutionController(const DynamicResolutionController&) = delete;
+    DynamicResolutionController& operator=(const DynamicResolutionController&) = delete;
+    
+    int MinLevel() const;
+    int MaxLevel() const;
+    
+    double m_budgetMs = 0.0;
+    int m_level = 0;              // 当前档位
+    double m_smoothedMs = 0.0;    // 平滑后的 GPU 帧耗时（0 表示尚无样本）
+    int m_samplesSinceChange = 0; // 上次调整后的样本数
+};
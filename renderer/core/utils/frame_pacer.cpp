@@ -0,0 +1,218 @@
+#include "core/utils/frame_pacer.h"  // 1. 对应头文件
+
+#include <algorithm>  // 2. 系统头文件
+#include <windows.h>  // 2. 系统头文件
+
+#include "core/config/render_constants.h"  // 4. 项目头文件（配置）
+
+// 旧版 SDK 未定义高精度定时器标志（Windows 10 1803 起支持）
+#ifndef CREATE_WAITABLE_TIMER_HIGH_RESOLUTION
+#define CREATE_WAITABLE_TIMER_HIGH_RESOLUTION 0x00000002
+#endif
+
+namespace {
+
+// 垂直同步模式每个准时帧增加的推迟时长（毫秒）
+const double VSYNC_DELAY_STEP_MS = 0.1;
+
+// 呈现间隔超过刷新间隔的该倍数时视为掉帧
+const double MISSED_FRAME_RATIO = 1.25;
+
+// 刷新间隔估计使用的最近呈现间隔数（取中位数，奇数避免取两个样本的平均）
+const int PRESENT_INTERVAL_WINDOW = 31;
+
+// 帧工作量估计使用的最近帧数和百分位（偶发的慢帧也计入，推迟量不会把它们挤到下一个刷新周期）
+const int FRAME_WORK_WINDOW = 64;
+const double FRAME_WORK_PERCENTILE = 0.95;
+
+// 自旋时长的范围（毫秒），以及在实测睡眠误差之外额外保留的余量
+const double MIN_SPIN_MS = 0.1;
+const double MAX_SPIN_MS = 4.0;
+const double SPIN_MARGIN_MS = 0.25;
+
+} // namespace
+
+FramePacer::FramePacer() {
+}
+
+FramePacer::~FramePacer() {
+    Cleanup();
+}
+
+void FramePacer::Initialize(FramePacingMode mode, int targetFrameRate) {
+    if (m_initialized) {
+        return;
+    }
+    
+    m_mode = mode;
+    QueryPerformanceFrequency(&m_frequency);
+    
+    // 优先使用高精度定时器，不支持时退回到普通定时器（精度受系统时钟分辨率限制，由自旋补偿）
+    m_timer = CreateWaitableTimerExW(nullptr, nullptr, CREATE_WAITABLE_TIMER_HIGH_RESOLUTION, TIMER_ALL_ACCESS);
+    if (!m_timer) {
+        m_timer = CreateWaitableTimerExW(nullptr, nullptr, 0, TIMER_ALL_ACCESS);
+    }
+    
+    m_targetInterval = targetFrameRate > 0 ? m_frequency.QuadPart / targetFrameRate : 0;
+    m_spinDuration = MsToTicks(config::FRAME_PACER_INITIAL_SPIN_MS);
+    Reset();
+    
+    m_initialized = true;
+}
+
+void FramePacer::Cleanup() {
+    if (!m_initialized) {
+        return;
+    }
+    
+    if (m_timer) {
+        CloseHandle(m_timer);
+        m_timer = nullptr;
+    }
+    
+    m_initialized = false;
+}
+
+void FramePacer::Reset() {
+    m_nextFrameStart = 0;
+    m_lastPresent = 0;
+    m_frameStart = 0;
+    m_presentInterval = 0;
+    m_frameWork = 0;
+    m_frameDelay = 0;
+    m_intervalSamples.Clear();
+    m_workSamples.Clear();
+}
+
+LONGLONG FramePacer::Now() const {
+    LARGE_INTEGER counter;
+    QueryPerformanceCounter(&counter);
+    return counter.QuadPart;
+}
+
+void FramePacer::WaitForNextFrame() {
+    if (!m_initialized) {
+        return;
+    }
+    
+    switch (m_mode) {
+        case FramePacingMode::Capped: {
+            if (m_targetInterval <= 0) {
+                break;
+            }
+            
+            LONGLONG now = Now();
+            if (m_nextFrameStart == 0 || now - m_nextFrameStart > m_targetInterval) {
+                // 首帧或落后超过一帧时重新对齐，不追赶已经错过的帧
+                m_nextFrameStart = now;
+            } else if (now < m_nextFrameStart) {
+                WaitUntil(m_nextFrameStart);
+            }
+            m_nextFrameStart += m_targetInterval;
+            break;
+        }
+        case FramePacingMode::VSync: {
+            // 推迟开始时间，让输入采样更接近下一次垂直同步
+            if (m_lastPresent != 0 && m_frameDelay > 0) {
+                WaitUntil(m_lastPresent + m_frameDelay);
+            }
+            break;
+        }
+        case FramePacingMode::LowLatency:
+            // MAILBOX 总是显示最新完成的帧，不需要等待
+            break;
+    }
+    
+    m_frameStart = Now();
+}
+
+void FramePacer::FramePresented(double waitMs) {
+    if (!m_initialized) {
+        return;
+    }
+    
+    LONGLONG now = Now();
+    if (m_frameStart != 0) {
+        // 帧工作量：从帧开始到呈现返回，扣除阻塞等待栅栏、交换链图像和呈现的时间
+        LONGLONG work = now - m_frameStart - MsToTicks(waitMs);
+        m_workSamples.Add(work > 0 ? work : 0, FRAME_WORK_WINDOW);
+        m_frameWork = m_workSamples.Percentile(FRAME_WORK_PERCENTILE);
+    }
+    
+    if (m_lastPresent != 0) {
+        LONGLONG interval = now - m_lastPresent;
+        
+        // 刷新间隔取最近呈现间隔的中位数：FIFO 下追赶呈现的短间隔和掉帧的长间隔都是少数，不会拉偏估计；
+        // 刷新率改变时在半个窗口内跟随
+        m_intervalSamples.Add(interval, PRESENT_INTERVAL_WINDOW);
+        m_presentInterval = m_intervalSamples.Percentile(0.5);
+        
+        if (m_mode == FramePacingMode::VSync) {
+            if ((double)interval > (double)m_presentInterval * MISSED_FRAME_RATIO) {
+                // 掉帧：推迟量减半，快速退回到安全区域
+                m_frameDelay /= 2;
+            } else {
+                m_frameDelay += MsToTicks(VSYNC_DELAY_STEP_MS);
+            }
+            
+            // 推迟后留出的时间必须够完成一帧（工作量的高百分位）加上安全余量；帧变慢时立即收回推迟量
+            LONGLONG maxDelay = m_presentInterval - m_frameWork - MsToTicks(config::FRAME_PACER_VSYNC_SAFETY_MARGIN_MS);
+            if (m_frameDelay > maxDelay) {
+                m_frameDelay = maxDelay > 0 ? maxDelay : 0;
+            }
+        }
+    }
+    m_lastPresent = now;
+}
+
+void FramePacer::SampleWindow::Add(LONGLONG sample, int windowSize) {
+    if (windowSize > CAPACITY) {
+        windowSize = CAPACITY;
+    }
+    samples[next] = sample;
+    next = (next + 1) % windowSize;
+    if (count < windowSize) {
+        count++;
+    }
+}
+
+LONGLONG FramePacer::SampleWindow::Percentile(double fraction) const {
+    if (count == 0) {
+        return 0;
+    }
+    
+    LONGLONG sorted[CAPACITY];
+    std::copy(samples, samples + count, sorted);
+    int index = (int)(fraction * (double)(count - 1) + 0.5);
+    std::nth_element(sorted, sorted + index, sorted + count);
+    return sorted[index];
+}
+
+void FramePacer::WaitUntil(LONGLONG deadline) {
+    LONGLONG now = Now();
+    LONGLONG sleepUntil = deadline - m_spinDuration;
+    
+    // 先用定时器睡眠到截止时间前的自旋阶段，不占用CPU
+    if (m_timer && sleepUntil > now) {
+        LARGE_INTEGER dueTime;
+        dueTime.QuadPart = -(LONGLONG)(TicksToMs(sleepUntil - now) * 10000.0);  // 相对时间，单位100纳秒
+        if (dueTime.QuadPart < 0 && SetWaitableTimer(m_timer, &dueTime, 0, nullptr, nullptr, FALSE)) {
+            WaitForSingleObject(m_timer, INFINITE);
+            
+            // 按实测睡眠误差调整自旋时长
+            LONGLONG oversleep = Now() - sleepUntil;
+            LONGLONG targetSpin = oversleep + MsToTicks(SPIN_MARGIN_MS);
+            m_spinDuration += (targetSpin - m_spinDuration) / 8;
+            if (m_spinDuration < MsToTicks(MIN_SPIN_MS)) {
+                m_spinDuration = MsToTicks(MIN_SPIN_MS);
+            } else if (m_spinDuration > MsToTicks(MAX_SPIN_MS)) {
+                m_spinDuration = MsToTicks(MAX_SPIN_MS);
+            }
+        }
+    }
+    
+    // 最后一小段自旋，精确命中截止时间
+    while (Now() < deadline) {
+        YieldProcessor();
+    }
+}
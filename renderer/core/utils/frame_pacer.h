@@ -0,0 +1,111 @@
+#pragma once
+
+#include <windows.h>  // 2. 系统头文件
+
+#include "core/config/enums.h"  // 4. 项目头文件（配置）
+
+/**
+ * 帧节奏器 - 控制主循环在帧之间的等待，替代固定的 Sleep(1)
+ * 
+ * 职责：测量呈现到呈现的间隔，并按帧节奏模式决定下一帧何时开始
+ * 设计：使用Windows高精度计时器和高精度可等待定时器，独立于渲染系统
+ * 
+ * 各模式的等待策略：
+ * - VSync：FIFO 呈现本身按刷新率阻塞。节奏器根据实测刷新间隔逐步推迟下一帧的开始时间，
+ *   使输入采样尽量靠近垂直同步；推迟量不超过刷新间隔减去帧工作量的高百分位和安全余量，
+ *   一旦出现掉帧立即减半推迟量（加性增、乘性减）。刷新间隔取最近呈现间隔的中位数，
+ *   追赶呈现产生的短间隔和掉帧产生的长间隔都不会拉偏估计
+ * - LowLatency：MAILBOX 呈现不阻塞，节奏器不等待
+ * - Capped：在目标帧间隔的截止时间前先睡眠再短暂自旋，自旋时长按实测睡眠误差自适应，
+ *   既能精确命中截止时间又不会占满一个CPU核心
+ * 
+ * 使用方式：
+ * 1. 调用 Initialize() 设置模式和目标帧率
+ * 2. 每帧处理输入之前调用 WaitForNextFrame()
+ * 3. 每帧呈现之后调用 FramePresented()
+ */
+class FramePacer {
+public:
+    FramePacer();
+    ~FramePacer();
+    
+    /**
+     * 初始化帧节奏器
+     * 
+     * @param mode 帧节奏模式
+     * @param targetFrameRate 限帧模式的目标帧率（仅 Capped 模式使用）
+     */
+    void Initialize(FramePacingMode mode, int targetFrameRate);
+    
+    /**
+     * 清理资源（关闭可等待定时器）
+     */
+    void Cleanup();
+    
+    /**
+     * 等待到下一帧的开始时间（在处理输入之前调用）
+     */
+    void WaitForNextFrame();
+    
+    /**
+     * 记录一帧已呈现（在 RenderFrame 返回之后调用）
+     * 
+     * @param waitMs 本帧阻塞等待 GPU 和交换链的时长（毫秒），从帧耗时中扣除后作为帧工作量
+     */
+    void FramePresented(double waitMs);
+    
+    /**
+     * 重置测量数据（如窗口最小化恢复后，避免把暂停时间当作掉帧）
+     */
+    void Reset();
+    
+    /**
+     * 获取平滑后的呈现间隔
+     * 
+     * @return double 最近呈现间隔的中位数（毫秒），尚无测量时返回 0
+     */
+    double GetPresentIntervalMs() const { return TicksToMs(m_presentInterval); }
+
+private:
+    // 禁止拷贝和赋值
+    FramePacer(const FramePacer&) = delete;
+    FramePacer& operator=(const FramePacer&) = delete;
+    
+    // 高精度等待到指定时刻（睡眠后自旋）
+    void WaitUntil(LONGLONG deadline);
+    
+    LONGLONG Now() const;
+    
+    // 环形缓冲区中最近若干个样本
+    struct SampleWindow {
+        static const int CAPACITY = 64;
+        LONGLONG samples[CAPACITY] = {};
+        int count = 0;
+        int next = 0;
+        
+        void Add(LONGLONG sample, int windowSize);
+        LONGLONG Percentile(double fraction) const;  // fraction 为 0-1，样本为空时返回 0
+        void Clear() { count = 0; next = 0; }
+    };
+    LONGLONG MsToTicks(double ms) const { return (LONGLONG)(ms * (double)m_frequency.QuadPart / 1000.0); }
+    double TicksToMs(LONGLONG ticks) const { return m_frequency.QuadPart ? (double)ticks * 1000.0 / (double)m_frequency.QuadPart : 0.0; }
+    
+    FramePacingMode m_mode = FramePacingMode::VSync;
+    LARGE_INTEGER m_frequency = {};
+    HANDLE m_timer = nullptr;  // 高精度可等待定时器（不支持时为普通定时器）
+    
+    LONGLONG m_targetInterval = 0;   // 限帧模式的目标帧间隔
+    LONGLONG m_nextFrameStart = 0;   // 限帧模式下一帧的截止时间
+    
+    LONGLONG m_lastPresent = 0;      // 上一次呈现完成的时刻
+    LONGLONG m_frameStart = 0;       // 本帧开始（等待结束）的时刻
+    LONGLONG m_presentInterval = 0;  // 最近呈现间隔的中位数（垂直同步模式下即刷新间隔）
+    LONGLONG m_frameWork = 0;        // 最近帧工作量（不含阻塞等待）的高百分位
+    LONGLONG m_frameDelay = 0;       // 垂直同步模式下呈现后推迟开始下一帧的时长
+    SampleWindow m_intervalSamples;
+    SampleWindow m_workSamples;
+    
+    LONGLONG m_spinDuration = 0;     // 睡眠后的自旋时长（按实测睡眠误差自适应）
+    
+    bool m_initialized = false;
+};
@@ -0,0 +1,186 @@
+#include "core/utils/frame_tracer.h"  // 1. 对应头文件
+
+#include <atomic>  // 2. 系统头文件
+#include <cstdint>  // 2. 系统头文件
+#include <chrono>  // 2. 系统头文件
+#include <fstream>  // 2. 系统头文件
+#include <memory>  // 2. 系统头文件
+#include <mutex>  // 2. 系统头文件
+#include <stdio.h>  // 2. 系统头文件
+#include <vector>  // 2. 系统头文件
+
+#include "core/config/render_constants.h"  // 4. 项目头文件（配置）
+
+namespace {
+
+// 一个已结束的阶段
+struct TraceEvent {
+    const char* name = nullptr;
+    long long begin = 0;  // 纳秒
+    long long end = 0;    // 纳秒
+};
+
+// 线程的环形缓冲区（由该线程写入，写出时由调用线程读取）
+struct ThreadBuffer {
+    std::mutex mutex;
+    std::vector<TraceEvent> events;
+    size_t next = 0;    // 下一个写入位置
+    size_t count = 0;   // 有效事件数（不超过容量）
+    uint32_t threadId = 0;  // 追踪文件中的线程编号（按首次记录的顺序分配）
+    std::string threadName;
+};
+
+std::atomic<bool> g_enabled{false};
+std::atomic<uint32_t> g_nextThreadId{1};
+std::chrono::steady_clock::time_point g_origin;
+
+// 所有线程的缓冲区（线程退出后仍保留，以便写出其事件）
+std::mutex g_registryMutex;
+std::vector<std::shared_ptr<ThreadBuffer>> g_buffers;
+std::string g_outputPath;
+
+ThreadBuffer& GetThreadBuffer() {
+    thread_local std::shared_ptr<ThreadBuffer> buffer;
+    if (!buffer) {
+        buffer = std::make_shared<ThreadBuffer>();
+        buffer->events.resize(config::FRAME_TRACER_EVENTS_PER_THREAD);
+        buffer->threadId = g_nextThreadId.fetch_add(1);
+        
+        std::lock_guard<std::mutex> lock(g_registryMutex);
+        g_buffers.push_back(buffer);
+    }
+    return *buffer;
+}
+
+} // namespace
+
+void FrameTracer::Enable(const std::string& outputPath) {
+    {
+        std::lock_guard<std::mutex> lock(g_registryMutex);
+        g_outputPath = outputPath;
+    }
+    
+    if (!g_enabled.load(std::memory_order_relaxed)) {
+        g_origin = std::chrono::steady_clock::now();
+        g_enabled.store(true, std::memory_order_release);
+    }
+    
+    printf("[TRACE] Frame tracing enabled, trace will be written to %s\n", outputPath.c_str());
+}
+
+bool FrameTracer::IsEnabled() {
+    return g_enabled.load(std::memory_order_acquire);
+}
+
+void FrameTracer::SetThreadName(const std::string& name) {
+    if (!IsEnabled()) {
+        return;
+    }
+    
+    ThreadBuffer& buffer = GetThreadBuffer();
+    std::lock_guard<std::mutex> lock(buffer.mutex);
+    buffer.threadName = name;
+}
+
+long long FrameTracer::Now() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - g_origin).count();
+}
+
+void FrameTracer::Record(const char* name, long long begin, long long end) {
+    ThreadBuffer& buffer = GetThreadBuffer();
+    std::lock_guard<std::mutex> lock(buffer.mutex);
+    
+    TraceEvent& event = buffer.events[buffer.next];
+    event.name = name;
+    event.begin = begin;
+    event.end = end;
+    
+    buffer.next = (buffer.next + 1) % buffer.events.size();
+    if (buffer.count < buffer.events.size()) {
+        buffer.count++;
+    }
+}
+
+bool FrameTracer::WriteTrace() {
+    if (!IsEnabled()) {
+        return false;
+    }
+    
+    std::vector<std::shared_ptr<ThreadBuffer>> buffers;
+    std::string outputPath;
+    {
+        std::lock_guard<std::mutex> lock(g_registryMutex);
+        buffers = g_buffers;
+        outputPath = g_outputPath;
+    }
+    
+    std::ofstream file(outputPath, std::ios::out | std::ios::trunc);
+    if (!file.is_open()) {
+        printf("[TRACE] Failed to open trace file: %s\n", outputPath.c_str());
+        return false;
+    }
+    
+    // 每个阶段一个完整事件（ph:"X"），时间单位为微秒；线程名称作为元数据事件
+    file << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+    bool first = true;
+    size_t eventCount = 0;
+    char line[256];
+    
+    for (const std::shared_ptr<ThreadBuffer>& buffer : buffers) {
+        // 只在复制期间持有该线程的锁，格式化和写文件不阻塞被追踪的线程
+        std::vector<TraceEvent> events;
+        std::string threadName;
+        uint32_t threadId = 0;
+        {
+            std::lock_guard<std::mutex> lock(buffer->mutex);
+            size_t capacity = buffer->events.size();
+            size_t start = (buffer->next + capacity - buffer->count) % capacity;
+            events.reserve(buffer->count);
+            for (size_t i = 0; i < buffer->count; i++) {
+                events.push_back(buffer->events[(start + i) % capacity]);
+            }
+            threadName = buffer->threadName;
+            threadId = buffer->threadId;
+        }
+        
+        if (!threadName.empty()) {
+            snprintf(line, sizeof(line), "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%lu,\"args\":{\"name\":\"%s\"}}",
+                     first ? "" : ",\n", (unsigned long)threadId, threadName.c_str());
+            file << line;
+            first = false;
+        }
+        
+        for (const TraceEvent& event : events) {
+            snprintf(line, sizeof(line), "%s{\"name\":\"%s\",\"cat\":\"cpu\",\"ph\":\"X\",\"pid\":1,\"tid\":%lu,\"ts\":%.3f,\"dur\":%.3f}",
+                     first ? "" : ",\n", event.name, (unsigned long)threadId,
+                     (double)event.begin / 1000.0, (double)(event.end - event.begin) / 1000.0);
+            file << line;
+            first = false;
+        }
+        eventCount += events.size();
+    }
+    
+    file << "\n]}\n";
+    file.close();
+    
+    printf("[TRACE] Wrote %zu events from %zu threads to %s\n", eventCount, buffers.size(), outputPath.c_str());
+    return true;
+}
+
+TraceScope::TraceScope(const char* name) {
+    if (FrameTracer::IsEnabled()) {
+        m_name = name;
+        m_begin = FrameTracer::Now();
+    }
+}
+
+TraceScope::~TraceScope() {
+    End();
+}
+
+void TraceScope::End() {
+    if (m_name) {
+        FrameTracer::Record(m_name, m_begin, FrameTracer::Now());
+        m_name = nullptr;
+    }
+}
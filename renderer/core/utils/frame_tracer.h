@@ -0,0 +1,81 @@
+#pragma once
+
+#include <string>  // 2. 系统头文件
+
+/**
+ * CPU 帧阶段追踪器 - 记录主循环和渲染各阶段的 CPU 耗时，输出 Chrome trace JSON
+ * 
+ * 职责：按作用域记录阶段的开始和结束时刻，按需写出 chrome://tracing / Perfetto 可读取的 JSON
+ * 设计：每个线程一个固定容量的环形缓冲区（线程局部，写入时只锁本线程缓冲区的互斥量，
+ * 只有写出期间才会发生争用），时间取自单调时钟。缓冲区写满后覆盖最旧的事件，
+ * 写出的是每个线程最近 config::FRAME_TRACER_EVENTS_PER_THREAD 个阶段。
+ * 线程局部缓冲区本身就是进程级状态，因此追踪器通过静态方法访问，不经过依赖注入；
+ * 未启用时 TraceScope 只读取一个原子标志。
+ * 
+ * 使用方式：
+ * 1. 启动时调用 FrameTracer::Enable()（命令行 --trace）
+ * 2. 在需要测量的作用域中声明 TraceScope（名称必须是字符串字面量，只保存指针）
+ * 3. 调用 FrameTracer::WriteTrace() 写出 JSON（窗口模式按 F9，headless 基准测试结束时自动写出）
+ */
+class FrameTracer {
+public:
+    /**
+     * 启用追踪（之后创建的 TraceScope 开始记录）
+     * 
+     * @param outputPath WriteTrace() 的输出路径
+     */
+    static void Enable(const std::string& outputPath);
+    
+    /**
+     * 是否已启用追踪
+     */
+    static bool IsEnabled();
+    
+    /**
+     * 设置当前线程在追踪视图中显示的名称
+     * 
+     * @param name 线程名称（会被复制）
+     */
+    static void SetThreadName(const std::string& name);
+    
+    /**
+     * 把所有线程缓冲区中的事件写出为 Chrome trace JSON（可在记录过程中调用）
+     * 
+     * @return 成功返回 true，未启用或写入失败返回 false
+     */
+    static bool WriteTrace();
+
+private:
+    friend class TraceScope;
+    
+    // 单调时钟的当前时刻（纳秒，相对 Enable() 的调用时刻）
+    static long long Now();
+    
+    // 把一个已结束的阶段写入当前线程的缓冲区
+    static void Record(const char* name, long long begin, long long end);
+};
+
+/**
+ * 作用域追踪 - 构造时记录开始时刻，析构或 End() 时记录一个完整阶段
+ */
+class TraceScope {
+public:
+    /**
+     * @param name 阶段名称（必须是字符串字面量或生命周期覆盖整个进程的字符串）
+     */
+    explicit TraceScope(const char* name);
+    ~TraceScope();
+    
+    /**
+     * 提前结束阶段（之后析构不再记录）
+     */
+    void End();
+
+private:
+    // 禁止拷贝和赋值
+    TraceScope(const TraceScope&) = delete;
+    TraceScope& operator=(const TraceScope&) = delete;
+    
+    const char* m_name = nullptr;  // 为 nullptr 表示未启用或已结束
+    long long m_begin = 0;
+};
@@ -1,12 +1,16 @@
 #include "image/image_loader.h"  // 1. 对应头文件
 
-#define WIN32_LEAN_AND_MEAN
-#define NOMINMAX
 #include <algorithm>  // 2. 系统头文件
 #include <cctype>     // 2. 系统头文件
+#include <cstring>    // 2. 系统头文件
 #include <fstream>    // 2. 系统头文件
-#include <objidl.h>   // 2. 系统头文件（提供IStream等COM接口定义，GDI+需要）
 #include <vector>     // 2. 系统头文件
+
+// PNG 和内存图像在 Windows 上使用 GDI+ 解码，其他平台使用 stb_image
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <objidl.h>   // 2. 系统头文件（提供IStream等COM接口定义，GDI+需要）
 #include <windows.h>  // 2. 系统头文件
 
 #ifdef LoadImage
@@ -14,6 +18,7 @@
 #endif
 #include <gdiplus.h>  // 3. 第三方库头文件
 #pragma comment(lib, "gdiplus.lib")
+#endif
 
 // WebP支持（使用stb_image单头文件库）
 // 需要下载stb_image.h到项目的renderer/thirdparty/目录并定义USE_STB_IMAGE宏
@@ -28,6 +33,28 @@
 // 未来可考虑创建IErrorHandler接口以符合依赖注入原则
 #include "window/window.h"  // 4. 项目头文件
 
+#ifdef USE_STB_IMAGE
+// 把 stb_image 解码出的 RGBA 像素复制到 ImageData 并释放（data 为空时返回空图像）
+static renderer::image::ImageData TakeStbPixels(unsigned char* data, int width, int height) {
+    renderer::image::ImageData result;
+    if (data == nullptr) {
+        return result;
+    }
+    
+    result.width = static_cast<uint32_t>(width);
+    result.height = static_cast<uint32_t>(height);
+    result.channels = 4;  // RGBA
+    
+    // 分配并复制像素数据
+    result.pixels.resize(result.width * result.height * result.channels);
+    memcpy(result.pixels.data(), data, result.width * result.height * result.channels);
+    
+    stbi_image_free(data);
+    return result;
+}
+#endif
+
+#ifdef _WIN32
 // GDI+初始化辅助类
 class GdiplusInitializer {
 public:
@@ -51,10 +78,13 @@ static GdiplusInitializer& GetGdiplusInit() {
     static GdiplusInitializer g_gdiplusInit;
     return g_gdiplusInit;
 }
+#endif
 
 renderer::image::ImageData renderer::image::ImageLoader::LoadImage(const std::string& filepath) {
+#ifdef _WIN32
     // 确保 GDI+ 已初始化（通过调用函数触发静态变量初始化）
     GetGdiplusInit();
+#endif
     // 检查文件扩展名
     size_t dotPos = filepath.find_last_of('.');
     if (dotPos != std::string::npos) {
@@ -73,6 +103,7 @@ renderer::image::ImageData renderer::image::ImageLoader::LoadImage(const std::st
     return ImageLoader::LoadPNG(filepath);
 }
 
+#ifdef _WIN32
 renderer::image::ImageData renderer::image::ImageLoader::LoadPNG(const std::string& filepath) {
     // 确保 GDI+ 已初始化
     GetGdiplusInit();
@@ -198,6 +229,39 @@ renderer::image::ImageData renderer::image::ImageLoader::LoadImageFromMemory(con
     GlobalFree(hMem);
     return result;
 }
+#else
+renderer::image::ImageData renderer::image::ImageLoader::LoadPNG(const std::string& filepath) {
+    ImageData result;
+    
+#ifdef USE_STB_IMAGE
+    int width, height, channels;
+    unsigned char* data = stbi_load(filepath.c_str(), &width, &height, &channels, 4);  // 强制RGBA
+    result = TakeStbPixels(data, width, height);
+    if (result.pixels.empty()) {
+        Window::ShowError("Failed to load image: " + filepath);
+    }
+#else
+    Window::ShowError("Image loading requires stb_image on this platform (define USE_STB_IMAGE): " + filepath);
+#endif
+    
+    return result;
+}
+
+renderer::image::ImageData renderer::image::ImageLoader::LoadImageFromMemory(const uint8_t* data, size_t size) {
+    ImageData result;
+    
+#ifdef USE_STB_IMAGE
+    int width, height, channels;
+    unsigned char* pixels = stbi_load_from_memory(data, (int)size, &width, &height, &channels, 4);  // 强制RGBA
+    result = TakeStbPixels(pixels, width, height);
+#else
+    (void)data;
+    (void)size;
+#endif
+    
+    return result;
+}
+#endif
 
 renderer::image::ImageData renderer::image::ImageLoader::LoadWebP(const std::string& filepath) {
     ImageData result;
@@ -206,22 +270,11 @@ renderer::image::ImageData renderer::image::ImageLoader::LoadWebP(const std::str
     // 使用stb_image加载WebP（stb_image会自动检测WebP格式）
     int width, height, channels;
     unsigned char* data = stbi_load(filepath.c_str(), &width, &height, &channels, 4); // 强制RGBA
-    
-    if (data == nullptr) {
+    result = TakeStbPixels(data, width, height);
+    if (result.pixels.empty()) {
         Window::ShowError("Failed to load WebP file: " + filepath + " (stb_image error)");
-        return result;
     }
     
-    result.width = static_cast<uint32_t>(width);
-    result.height = static_cast<uint32_t>(height);
-    result.channels = 4;  // RGBA
-    
-    // 分配并复制像素数据
-    result.pixels.resize(result.width * result.height * result.channels);
-    memcpy(result.pixels.data(), data, result.width * result.height * result.channels);
-    
-    stbi_image_free(data);
-    
 #else
     // 如果没有stb_image，显示错误信息
     Window::ShowError("WebP support not compiled. Please download stb_image.h from https://github.com/nothings/stb and place it in renderer/thirdparty/, then define USE_STB_IMAGE in SConstruct.");
@@ -35,7 +35,7 @@ struct ImageData {
 
 // 图像加载器 - 从文件或内存加载图像数据
 // 职责：提供统一的图像加载接口，支持PNG、WebP等格式
-// 设计：使用静态方法提供加载功能，支持Windows GDI+和stb_image库
+// 设计：使用静态方法提供加载功能，支持Windows GDI+和stb_image库（其他平台只使用stb_image）
 class ImageLoader {
 public:
     // 从文件加载图像（支持PNG、WebP等）
@@ -47,7 +47,7 @@ public:
     static ImageData LoadImageFromMemory(const uint8_t* data, size_t size);
     
 private:
-    // PNG加载实现（使用Windows GDI+）
+    // PNG加载实现（Windows使用GDI+，其他平台使用stb_image）
     // 将BGRA格式转换为RGBA格式，确保跨平台一致性
     static ImageData LoadPNG(const std::string& filepath);
     
@@ -3,8 +3,7 @@
 #include <algorithm>  // 2. 系统头文件
 #include <cmath>      // 2. 系统头文件
 #include <cstdio>     // 2. 系统头文件
-#include <fstream>    // 2. 系统头文件
-#include <windows.h>  // 2. 系统头文件
+#include <cstring>    // 2. 系统头文件
 
 #include <vulkan/vulkan.h>  // 3. 第三方库头文件
 
@@ -12,6 +11,7 @@
 // 根据开发标准第15.1节，应优先使用接口或前向声明，但静态方法需要完整定义
 // 未来可考虑创建IShaderLoader接口和IErrorHandler接口以符合依赖注入原则
 #include "shader/shader_loader.h"  // 4. 项目头文件
+#include "vulkan/vulkan_memory_allocator.h"  // 4. 项目头文件
 #include "window/window.h"         // 4. 项目头文件
 
 LoadingAnimation::LoadingAnimation() {
@@ -67,13 +67,10 @@ void LoadingAnimation::Cleanup() {
             vkDestroyBuffer(vkDevice, static_cast<VkBuffer>(m_vertexBuffers[i]), nullptr);
             m_vertexBuffers[i] = nullptr;
         }
-        if (m_vertexBufferMemories[i] != nullptr) {
-            vkFreeMemory(vkDevice, static_cast<VkDeviceMemory>(m_vertexBufferMemories[i]), nullptr);
-            m_vertexBufferMemories[i] = nullptr;
-        }
+        VulkanMemoryAllocator::Release(m_memoryAllocator, vkDevice, m_vertexBufferAllocations[i]);
     }
     m_vertexBuffers.clear();
-    m_vertexBufferMemories.clear();
+    m_vertexBufferAllocations.clear();
     
     m_initialized = false;
 }
@@ -295,7 +292,7 @@ bool LoadingAnimation::CreateBuffers() {
     
     // 为每个方块创建缓冲区
     m_vertexBuffers.resize(BOX_COUNT);
-    m_vertexBufferMemories.resize(BOX_COUNT);
+    m_vertexBufferAllocations.assign(BOX_COUNT, MemoryAllocation());
     
     for (int i = 0; i < BOX_COUNT; i++) {
         // 创建缓冲区
@@ -311,50 +308,28 @@ bool LoadingAnimation::CreateBuffers() {
             // 清理已创建的缓冲区
             for (int j = 0; j < i; j++) {
                 vkDestroyBuffer(vkDevice, static_cast<VkBuffer>(m_vertexBuffers[j]), nullptr);
-                vkFreeMemory(vkDevice, static_cast<VkDeviceMemory>(m_vertexBufferMemories[j]), nullptr);
+                m_vertexBuffers[j] = nullptr;
+                VulkanMemoryAllocator::Release(m_memoryAllocator, vkDevice, m_vertexBufferAllocations[j]);
             }
             return false;
         }
         m_vertexBuffers[i] = vkBuffer;
         
-        // 分配内存
-        VkMemoryRequirements memRequirements;
-        vkGetBufferMemoryRequirements(vkDevice, vkBuffer, &memRequirements);
-        
-        VkMemoryAllocateInfo allocInfo = {};
-        allocInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
-        allocInfo.allocationSize = memRequirements.size;
-        // 将抽象类型转换为Vulkan类型
+        // 从共享分配器子分配内存（9个小缓冲区共用一个内存块，未注入分配器时独立分配）
         MemoryPropertyFlag properties = MemoryPropertyFlag::HostVisible | MemoryPropertyFlag::HostCoherent;
-        uint32_t memoryTypeIndex = FindMemoryType(memRequirements.memoryTypeBits, properties);
-        
-        // 检查内存类型查找是否成功
-        if (memoryTypeIndex == UINT32_MAX) {
-            Window::ShowError("Failed to find suitable memory type for loading animation!");
-            vkDestroyBuffer(vkDevice, vkBuffer, nullptr);
-            // 清理已创建的缓冲区
-            for (int j = 0; j < i; j++) {
-                vkDestroyBuffer(vkDevice, static_cast<VkBuffer>(m_vertexBuffers[j]), nullptr);
-                vkFreeMemory(vkDevice, static_cast<VkDeviceMemory>(m_vertexBufferMemories[j]), nullptr);
-            }
-            return false;
-        }
-        
-        allocInfo.memoryTypeIndex = memoryTypeIndex;
-        VkDeviceMemory vkMemory;
-        if (vkAllocateMemory(vkDevice, &allocInfo, nullptr, &vkMemory) != VK_SUCCESS) {
+        if (!VulkanMemoryAllocator::AllocateBuffer(m_memoryAllocator, vkDevice, static_cast<VkPhysicalDevice>(m_physicalDevice),
+                                                   vkBuffer, properties, m_vertexBufferAllocations[i])) {
             Window::ShowError("Failed to allocate vertex buffer memory for loading animation!");
             // 清理已创建的缓冲区
             vkDestroyBuffer(vkDevice, vkBuffer, nullptr);
+            m_vertexBuffers[i] = nullptr;
             for (int j = 0; j < i; j++) {
                 vkDestroyBuffer(vkDevice, static_cast<VkBuffer>(m_vertexBuffers[j]), nullptr);
-                vkFreeMemory(vkDevice, static_cast<VkDeviceMemory>(m_vertexBufferMemories[j]), nullptr);
+                m_vertexBuffers[j] = nullptr;
+                VulkanMemoryAllocator::Release(m_memoryAllocator, vkDevice, m_vertexBufferAllocations[j]);
             }
             return false;
         }
-        m_vertexBufferMemories[i] = vkMemory;
-        
-        vkBindBufferMemory(vkDevice, vkBuffer, vkMemory, 0);
         
         // 使用当前方块的颜色填充数据
         Vertex vertices[6];
@@ -367,72 +342,19 @@ bool LoadingAnimation::CreateBuffers() {
         }
         
         // 填充数据
-        void* data;
-        vkMapMemory(vkDevice, vkMemory, 0, bufferSize, 0, &data);
-        memcpy(data, vertices, (size_t)bufferSize);
-        vkUnmapMemory(vkDevice, vkMemory);
+        VulkanMemoryAllocator::Write(vkDevice, m_vertexBufferAllocations[i], vertices, bufferSize);
     }
     
     return true;
 }
 
-uint32_t LoadingAnimation::FindMemoryType(uint32_t typeFilter, MemoryPropertyFlag properties) {
-    // 将抽象句柄转换为Vulkan类型
-    VkPhysicalDevice vkPhysicalDevice = static_cast<VkPhysicalDevice>(m_physicalDevice);
-    
-    // 将抽象类型转换为Vulkan类型
-    VkMemoryPropertyFlags vkProperties = 0;
-    if ((properties & MemoryPropertyFlag::DeviceLocal) != MemoryPropertyFlag::None) {
-        vkProperties |= VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT;
-    }
-    if ((properties & MemoryPropertyFlag::HostVisible) != MemoryPropertyFlag::None) {
-        vkProperties |= VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT;
-    }
-    if ((properties & MemoryPropertyFlag::HostCoherent) != MemoryPropertyFlag::None) {
-        vkProperties |= VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
-    }
-    if ((properties & MemoryPropertyFlag::HostCached) != MemoryPropertyFlag::None) {
-        vkProperties |= VK_MEMORY_PROPERTY_HOST_CACHED_BIT;
-    }
-    
-    VkPhysicalDeviceMemoryProperties memProperties;
-    vkGetPhysicalDeviceMemoryProperties(vkPhysicalDevice, &memProperties);
-    
-    for (uint32_t i = 0; i < memProperties.memoryTypeCount; i++) {
-        if ((typeFilter & (1 << i)) && 
-            (memProperties.memoryTypes[i].propertyFlags & vkProperties) == vkProperties) {
-            return i;
-        }
-    }
-    
-    // 未找到匹配的内存类型
-    Window::ShowError("Failed to find suitable memory type for loading animation!");
-    // 返回无效值，调用者应该检查此值
-    return UINT32_MAX;
-}
-
 bool LoadingAnimation::CreatePipeline(RenderPassHandle renderPass) {
     // 将抽象句柄转换为Vulkan类型
     VkDevice vkDevice = static_cast<VkDevice>(m_device);
     VkRenderPass vkRenderPass = static_cast<VkRenderPass>(renderPass);
-    // 加载shader
-    std::vector<char> vertCode = renderer::shader::ShaderLoader::LoadSPIRV("renderer/loading/loading.vert.spv");
-    std::vector<char> fragCode = renderer::shader::ShaderLoader::LoadSPIRV("renderer/loading/loading.frag.spv");
-    
-    if (vertCode.empty() || fragCode.empty()) {
-        // 如果SPIR-V文件不存在，尝试从源码编译
-        #ifdef USE_SHADERC
-        std::ifstream vertFile("renderer/loading/loading.vert");
-        std::ifstream fragFile("renderer/loading/loading.frag");
-        if (vertFile.is_open() && fragFile.is_open()) {
-            std::string vertSource((std::istreambuf_iterator<char>(vertFile)), std::istreambuf_iterator<char>());
-            std::string fragSource((std::istreambuf_iterator<char>(fragFile)), std::istreambuf_iterator<char>());
-            // 将抽象类型传递给ShaderLoader
-            vertCode = renderer::shader::ShaderLoader::CompileGLSLFromSource(vertSource, ShaderStage::Vertex, "loading.vert");
-            fragCode = renderer::shader::ShaderLoader::CompileGLSLFromSource(fragSource, ShaderStage::Fragment, "loading.frag");
-        }
-        #endif
-    }
+    // 加载shader（SPIR-V文件不存在时由ShaderLoader编译同名GLSL源码）
+    std::vector<char> vertCode = renderer::shader::ShaderLoader::LoadShaderCode("renderer/loading/loading.vert.spv", ShaderStage::Vertex);
+    std::vector<char> fragCode = renderer::shader::ShaderLoader::LoadShaderCode("renderer/loading/loading.frag.spv", ShaderStage::Fragment);
     
     if (vertCode.empty() || fragCode.empty()) {
         Window::ShowError("Failed to load shaders for loading animation!");
@@ -589,7 +511,7 @@ bool LoadingAnimation::CreatePipeline(RenderPassHandle renderPass) {
     pipelineInfo.subpass = 0;
     
     VkPipeline vkGraphicsPipeline;
-    VkResult result = vkCreateGraphicsPipelines(vkDevice, VK_NULL_HANDLE, 1, &pipelineInfo, nullptr, &vkGraphicsPipeline);
+    VkResult result = vkCreateGraphicsPipelines(vkDevice, static_cast<VkPipelineCache>(m_pipelineCache), 1, &pipelineInfo, nullptr, &vkGraphicsPipeline);
     
     vkDestroyShaderModule(vkDevice, vertShaderModule, nullptr);
     vkDestroyShaderModule(vkDevice, fragShaderModule, nullptr);
@@ -674,11 +596,10 @@ void LoadingAnimation::UpdateBoxColorBuffer() {
 
 void LoadingAnimation::UpdateBoxColorBuffer(int boxIndex) {
     if (!m_initialized || boxIndex < 0 || boxIndex >= BOX_COUNT) return;
-    if (m_vertexBufferMemories[boxIndex] == nullptr) return;
+    if (!m_vertexBufferAllocations[boxIndex].IsValid()) return;
     
     // 将抽象句柄转换为Vulkan类型
     VkDevice vkDevice = static_cast<VkDevice>(m_device);
-    VkDeviceMemory vkMemory = static_cast<VkDeviceMemory>(m_vertexBufferMemories[boxIndex]);
     
     struct Vertex {
         float x, y;
@@ -699,10 +620,7 @@ void LoadingAnimation::UpdateBoxColorBuffer(int boxIndex) {
     
     VkDeviceSize bufferSize = sizeof(vertices);
     
-    // 更新缓冲区数据（使用已转换的Vulkan类型）
-    void* data;
-    vkMapMemory(vkDevice, vkMemory, 0, bufferSize, 0, &data);
-    memcpy(data, vertices, (size_t)bufferSize);
-    vkUnmapMemory(vkDevice, vkMemory);
+    // 更新缓冲区数据（持久映射时直接写入，无需每次映射）
+    VulkanMemoryAllocator::Write(vkDevice, m_vertexBufferAllocations[boxIndex], vertices, bufferSize);
 }
 
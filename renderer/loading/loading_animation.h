@@ -3,6 +3,7 @@
 #include <string>  // 2. 系统头文件
 #include <vector>  // 2. 系统头文件
 
+#include "core/interfaces/imemory_allocator.h"  // 4. 项目头文件（接口）
 #include "core/types/render_types.h"  // 4. 项目头文件（抽象类型）
 
 // 加载动画类 - 将CSS动画转换为Vulkan渲染
@@ -19,6 +20,12 @@ public:
     bool Initialize(DeviceHandle device, PhysicalDeviceHandle physicalDevice, CommandPoolHandle commandPool, 
                     QueueHandle graphicsQueue, RenderPassHandle renderPass, Extent2D swapchainExtent);
     
+    // 设置共享内存分配器（需在Initialize之前调用，为空时每个缓冲区独立分配内存）
+    void SetMemoryAllocator(IMemoryAllocator* memoryAllocator) { m_memoryAllocator = memoryAllocator; }
+    
+    // 设置共享管线缓存（需在Initialize之前调用，为空时不使用缓存）
+    void SetPipelineCache(PipelineCacheHandle pipelineCache) { m_pipelineCache = pipelineCache; }
+    
     // 清理资源
     void Cleanup();
     
@@ -63,10 +70,8 @@ private:
     QueueHandle m_graphicsQueue = nullptr;
     RenderPassHandle m_renderPass = nullptr;
     Extent2D m_swapchainExtent = {};
-    
-    // 查找内存类型
-    // 注意：在实现层需要将MemoryPropertyFlag转换为VkMemoryPropertyFlags
-    uint32_t FindMemoryType(uint32_t typeFilter, MemoryPropertyFlag properties);
+    IMemoryAllocator* m_memoryAllocator = nullptr;  // [BORROW] 共享内存分配器，由渲染器拥有
+    PipelineCacheHandle m_pipelineCache = nullptr;  // [BORROW] 共享管线缓存，由渲染器拥有
     
     // 方块动画数据
     std::vector<BoxAnimation> m_boxes;
@@ -96,7 +101,7 @@ private:
     
     // 渲染资源（使用抽象类型，在实现层转换为具体类型）
     std::vector<BufferHandle> m_vertexBuffers;  // 每个方块的顶点缓冲区
-    std::vector<DeviceMemoryHandle> m_vertexBufferMemories;  // 每个方块的顶点缓冲区内存
+    std::vector<MemoryAllocation> m_vertexBufferAllocations;  // 每个方块的顶点缓冲区内存（子分配）
     PipelineHandle m_graphicsPipeline = nullptr;
     PipelineLayoutHandle m_pipelineLayout = nullptr;
     
@@ -8,7 +8,21 @@
 layout(location = 0) in vec2 fragCoord;
 layout(location = 0) out vec4 outColor;
 
-layout(push_constant) uniform PushConstants {
+// 屏幕分块网格边长和每块可记录的立方体数量（与 loading_cubes_cull.comp 一致）
+#define TILE_GRID 64
+#define TILE_CAPACITY 64
+
+// 单个立方体的逐帧数据（CPU 每帧计算一次，整帧所有像素共用）
+struct CubeData {
+    vec4 rotation[3];  // 世界空间到立方体局部空间的旋转（mat3 的三列）
+    vec4 localOrigin;  // 相机位置在立方体局部空间中的坐标
+    vec4 halfSize;     // 立方体半边长
+    vec4 color;        // 立方体颜色（已做伽马校正）
+    vec4 bounds;       // 世界空间包围球（仅用于剔除）
+};
+
+// 场景参数（每个交换链图像一份统一缓冲区，每帧更新，命令缓冲区无需重新录制）
+layout(set = 0, binding = 0) uniform SceneParams {
     float time;
     float aspect;
     float cameraYaw;   // 相机水平旋转角度（弧度）
@@ -16,8 +30,19 @@ layout(push_constant) uniform PushConstants {
     float cameraPosX;  // 相机X位置
     float cameraPosY;  // 相机Y位置
     float cameraPosZ;  // 相机Z位置
+    uint cubeCount;    // 立方体数量
+    uint tileCulling;  // 非0时分块列表有效（本帧已执行剔除计算着色器）
 } pc;
 
+layout(std430, set = 0, binding = 1) readonly buffer CubeBuffer {
+    CubeData cubes[];
+};
+
+// 分块列表（由 loading_cubes_cull.comp 写入）：每块的立方体数量，然后是每块 TILE_CAPACITY 个立方体索引
+layout(std430, set = 0, binding = 2) readonly buffer TileBuffer {
+    uint tileData[];
+};
+
 #define PI 3.14159265359
 #define DEG2RAD (PI / 180.0)
 
@@ -69,65 +94,15 @@ vec3 buildRayDirection(vec2 uv, float fov, float aspectRatio, mat3 cameraRotatio
     return rayDir;
 }
 
-// 伪随机函数
-float hash(float n) {
-    return fract(sin(n) * 43758.5453123);
-}
-
-float hash(vec2 p) {
-    p = vec2(dot(p, vec2(127.1, 311.7)), dot(p, vec2(269.5, 183.3)));
-    return fract(sin(p.x + p.y) * 43758.5453123);
-}
-
-vec3 hash3(vec2 p) {
-    float h = hash(p);
-    return vec3(hash(h), hash(h * 1.1), hash(h * 1.2));
-}
-
-// 3D旋转矩阵
-mat3 rotateX(float angle) {
-    float c = cos(angle);
-    float s = sin(angle);
-    return mat3(
-        1.0, 0.0, 0.0,
-        0.0, c, -s,
-        0.0, s, c
-    );
-}
-
-mat3 rotateY(float angle) {
-    float c = cos(angle);
-    float s = sin(angle);
-    return mat3(
-        c, 0.0, s,
-        0.0, 1.0, 0.0,
-        -s, 0.0, c
-    );
-}
-
-mat3 rotateZ(float angle) {
-    float c = cos(angle);
-    float s = sin(angle);
-    return mat3(
-        c, -s, 0.0,
-        s, c, 0.0,
-        0.0, 0.0, 1.0
-    );
-}
-
 // SDF 立方体
 float sdBox(vec3 p, vec3 b) {
     vec3 q = abs(p) - b;
     return length(max(q, 0.0)) + min(max(q.x, max(q.y, q.z)), 0.0);
 }
 
-// 射线与旋转立方体的交点距离
-float intersectCube(vec3 ro, vec3 rd, vec3 cubePos, vec3 cubeSize, mat3 rot) {
-    // 将射线转换到立方体的局部空间
-    vec3 localRo = rot * (ro - cubePos);
-    vec3 localRd = rot * rd;
-    
-    // 计算与AABB的交点
+// 射线与立方体（局部空间中的 AABB）的交点距离
+// 旋转和局部空间的射线起点由 CPU 每帧计算，这里只剩逐像素的射线方向变换和 slab 测试
+float intersectCube(vec3 localRo, vec3 localRd, vec3 cubeSize) {
     vec3 invRd = 1.0 / (localRd + 0.0001); // 避免除零
     vec3 t0 = (-cubeSize - localRo) * invRd;
     vec3 t1 = (cubeSize - localRo) * invRd;
@@ -144,9 +119,8 @@ float intersectCube(vec3 ro, vec3 rd, vec3 cubePos, vec3 cubeSize, mat3 rot) {
     return tnear > 0.0 ? tnear : tfar;
 }
 
-// 计算立方体表面的法线（简化版本）
-vec3 getCubeNormal(vec3 p, vec3 cubePos, vec3 cubeSize, mat3 rot) {
-    vec3 localP = rot * (p - cubePos);
+// 计算立方体表面的法线（简化版本，localP 为命中点在立方体局部空间中的坐标）
+vec3 getCubeNormal(vec3 localP, vec3 cubeSize, mat3 rot) {
     vec3 q = abs(localP) - cubeSize;
     
     vec3 n = vec3(0.0);
@@ -161,16 +135,23 @@ vec3 getCubeNormal(vec3 p, vec3 cubePos, vec3 cubeSize, mat3 rot) {
     return normalize(rot * n);
 }
 
-// 渲染单个像素的函数
-vec3 renderPixel(vec2 uv, vec3 cameraPos, mat3 cameraRotation) {
-    // 固定的种子值
-    float seed = 123456.0;
-    
-    // 立方体网格数量
-    float cubeNum = 8.0;
-    float cubeW = 1.0 / cubeNum;
-    float cubeH = 1.0 / cubeNum;
+mat3 cubeRotation(uint index) {
+    return mat3(cubes[index].rotation[0].xyz, cubes[index].rotation[1].xyz, cubes[index].rotation[2].xyz);
+}
+
+// 射线与单个立方体求交，更近时更新最近命中
+void testCube(uint index, vec3 rayDir, inout float minDist, inout int hitIndex) {
+    vec3 localRd = cubeRotation(index) * rayDir;
+    float t = intersectCube(cubes[index].localOrigin.xyz, localRd, cubes[index].halfSize.xyz);
     
+    if (t > 0.0 && t < minDist) {
+        minDist = t;
+        hitIndex = int(index);
+    }
+}
+
+// 渲染单个像素的函数
+vec3 renderPixel(vec2 uv, mat3 cameraRotation, uint tile) {
     // 构建射线方向
     float fov = 45.0 * DEG2RAD;
     vec3 rayDir = buildRayDirection(uv, fov, pc.aspect, cameraRotation);
@@ -180,47 +161,29 @@ vec3 renderPixel(vec2 uv, vec3 cameraPos, mat3 cameraRotation) {
     vec3 col = bgColor;
     
     float minDist = 1000.0;
-    vec3 hitPos = vec3(0.0);
-    vec3 hitColor = vec3(0.0);
-    vec3 hitNormal = vec3(0.0);
+    int hitIndex = -1;
     
-    // 遍历所有立方体
-    for (float i = 0.0; i < cubeNum; i += 1.0) {
-        for (float j = 0.0; j < cubeNum; j += 1.0) {
-            // 计算立方体位置
-            vec2 gridPos = vec2(i, j);
-            vec2 normalizedGrid = (gridPos - cubeNum * 0.5 + 0.5) / cubeNum;
-            vec3 cubePos = vec3(normalizedGrid.x * 1.3, normalizedGrid.y * 1.3, 0.0);  // 稍微增大范围
-            
-            // 立方体大小（增大以便更清晰）
-            vec3 cubeSize = vec3(cubeW * 0.65, cubeH * 0.65, cubeW * 0.65);  // 进一步增大
-            
-            // 为每个立方体生成随机旋转
-            vec2 cubeSeed = gridPos + seed * 100.0;
-            float speed = 3.0;
-            float cubeRotX = hash(cubeSeed.x * 20.0) * 360.0 * DEG2RAD + pc.time * speed * (hash(cubeSeed.x * 21.0) * 2.0 - 1.0) * 0.1;
-            float cubeRotY = hash(cubeSeed.y * 20.0) * 360.0 * DEG2RAD + pc.time * speed * (hash(cubeSeed.y * 21.0) * 2.0 - 1.0) * 0.1;
-            float cubeRotZ = hash((cubeSeed.x + cubeSeed.y) * 20.0) * 360.0 * DEG2RAD + pc.time * speed * (hash((cubeSeed.x + cubeSeed.y) * 21.0) * 2.0 - 1.0) * 0.1;
-            
-            mat3 cubeRot = rotateX(cubeRotX) * rotateY(cubeRotY) * rotateZ(cubeRotZ);
-            
-            // 检查射线与立方体的交点（使用更新后的相机位置）
-            float t = intersectCube(cameraPos, rayDir, cubePos, cubeSize, cubeRot);
-            
-            if (t > 0.0 && t < minDist) {
-                minDist = t;
-                hitPos = cameraPos + rayDir * t;
-                hitNormal = getCubeNormal(hitPos, cubePos, cubeSize, cubeRot);
-                
-                // 立方体颜色
-                hitColor = hash3(cubeSeed + 1000.0);
-                hitColor = pow(hitColor, vec3(1.0 / 1.8));
-            }
+    // 只做求交，法线和颜色在找到最近命中后计算一次
+    // 分块列表有效且未溢出时只测试与该分块重叠的立方体，否则测试所有立方体
+    uint tileCount = (pc.tileCulling != 0u) ? tileData[tile] : (TILE_CAPACITY + 1u);
+    if (tileCount <= TILE_CAPACITY) {
+        uint listStart = TILE_GRID * TILE_GRID + tile * TILE_CAPACITY;
+        for (uint i = 0u; i < tileCount; i++) {
+            testCube(tileData[listStart + i], rayDir, minDist, hitIndex);
+        }
+    } else {
+        for (uint i = 0u; i < pc.cubeCount; i++) {
+            testCube(i, rayDir, minDist, hitIndex);
         }
     }
     
     // 如果有命中，使用立方体颜色
-    if (minDist < 1000.0) {
+    if (hitIndex >= 0) {
+        mat3 cubeRot = cubeRotation(uint(hitIndex));
+        vec3 localP = cubes[hitIndex].localOrigin.xyz + (cubeRot * rayDir) * minDist;
+        vec3 hitNormal = getCubeNormal(localP, cubes[hitIndex].halfSize.xyz, cubeRot);
+        vec3 hitColor = cubes[hitIndex].color.rgb;
+        
         // 改进的光照计算
         vec3 lightDir = normalize(vec3(1.0, 1.0, 1.0));
         float NdotL = max(dot(hitNormal, lightDir), 0.0);
@@ -250,8 +213,7 @@ vec3 renderPixel(vec2 uv, vec3 cameraPos, mat3 cameraRotation) {
 }
 
 void main() {
-    // 使用CPU端更新后的相机状态（相机状态在CPU端累积更新）
-    vec3 cameraPos = vec3(pc.cameraPosX, pc.cameraPosY, pc.cameraPosZ);
+    // 使用CPU端更新后的相机状态（相机位置已变换到各立方体的局部空间）
     float cameraYaw = pc.cameraYaw;
     float cameraPitch = pc.cameraPitch;
     
@@ -280,10 +242,14 @@ void main() {
     offsets[7] = vec2(-radius, 0.0);
     offsets[8] = vec2( radius, 0.0);
     
+    // 像素中心所在的屏幕分块（剔除时已为超采样偏移留出余量，9个采样点共用同一个分块列表）
+    ivec2 tileCoord = clamp(ivec2(floor((uv * 0.5 + 0.5) * float(TILE_GRID))), ivec2(0), ivec2(TILE_GRID - 1));
+    uint tile = uint(tileCoord.y * TILE_GRID + tileCoord.x);
+    
     // 对9个采样点进行采样并平均
     vec3 col = vec3(0.0);
     for (int i = 0; i < 9; i++) {
-        col += renderPixel(uv + offsets[i], cameraPos, cameraRotation);
+        col += renderPixel(uv + offsets[i], cameraRotation, tile);
     }
     col /= 9.0;
     
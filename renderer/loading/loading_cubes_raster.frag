@@ -0,0 +1,28 @@
+#version 450
+
+// loading_cubes 实例化光栅化路径的着色（光照与 loading_cubes.frag 的光线投射一致）
+// 抗锯齿由 4 倍多重采样完成，逐像素只着色一次
+
+layout(location = 0) flat in vec3 fragNormal;
+layout(location = 1) flat in vec3 fragColor;
+layout(location = 2) in vec3 fragViewOffset;
+
+layout(location = 0) out vec4 outColor;
+
+void main() {
+    vec3 lightDir = normalize(vec3(1.0, 1.0, 1.0));
+    float NdotL = max(dot(fragNormal, lightDir), 0.0);
+    
+    // 环境光 + 漫反射
+    float light = 0.4 + NdotL * 0.6;
+    vec3 col = fragColor * light;
+    
+    // 边缘高光（与光线投射相同，按相机到表面的距离计算）
+    float edge = 1.0 - smoothstep(0.0, 0.03, length(fragViewOffset) - 0.97);
+    col = mix(col, fragColor * 1.6, edge * 0.35);
+    
+    col = pow(col, vec3(0.85));
+    col = clamp(col, 0.0, 1.0);
+    
+    outColor = vec4(col, 1.0);
+}
@@ -0,0 +1,119 @@
+#version 450
+
+// loading_cubes 实例化光栅化路径
+// 每个实例一个立方体，36 个顶点由 gl_VertexIndex 生成（不需要顶点缓冲区），
+// 实例变换直接读取光线投射路径使用的逐立方体数据，两条路径的动画完全一致
+
+struct CubeData {
+    vec4 rotation[3];  // 世界空间到立方体局部空间的旋转（mat3 的三列）
+    vec4 localOrigin;
+    vec4 halfSize;     // 立方体半边长
+    vec4 color;        // 立方体颜色（已做伽马校正）
+    vec4 bounds;       // 世界空间包围球（xyz 为立方体中心）
+};
+
+layout(set = 0, binding = 0) uniform SceneParams {
+    float time;
+    float aspect;
+    float cameraYaw;
+    float cameraPitch;
+    float cameraPosX;
+    float cameraPosY;
+    float cameraPosZ;
+    uint cubeCount;
+    uint tileCulling;
+} pc;
+
+layout(std430, set = 0, binding = 1) readonly buffer CubeBuffer {
+    CubeData cubes[];
+};
+
+layout(location = 0) flat out vec3 fragNormal;
+layout(location = 1) flat out vec3 fragColor;
+layout(location = 2) out vec3 fragViewOffset;  // 相机到表面点的世界空间向量（用于边缘高光）
+
+#define PI 3.14159265359
+#define DEG2RAD (PI / 180.0)
+
+// 近、远裁剪面（立方体位于相机前方数个单位内）
+#define NEAR_PLANE 0.01
+#define FAR_PLANE 100.0
+
+// 每个面的法线和切线（局部空间），副切线为 cross(normal, tangent)
+const vec3 FACE_NORMALS[6] = vec3[](
+    vec3( 1.0, 0.0, 0.0), vec3(-1.0, 0.0, 0.0),
+    vec3( 0.0, 1.0, 0.0), vec3( 0.0,-1.0, 0.0),
+    vec3( 0.0, 0.0, 1.0), vec3( 0.0, 0.0,-1.0)
+);
+
+const vec3 FACE_TANGENTS[6] = vec3[](
+    vec3(0.0, 1.0, 0.0), vec3(0.0, 1.0, 0.0),
+    vec3(0.0, 0.0, 1.0), vec3(0.0, 0.0, 1.0),
+    vec3(1.0, 0.0, 0.0), vec3(1.0, 0.0, 0.0)
+);
+
+// 一个面的两个三角形
+const vec2 QUAD_CORNERS[6] = vec2[](
+    vec2(-1.0, -1.0), vec2( 1.0, -1.0), vec2( 1.0,  1.0),
+    vec2(-1.0, -1.0), vec2( 1.0,  1.0), vec2(-1.0,  1.0)
+);
+
+// 与 loading_cubes.frag 的相机一致：R = R_y(yaw) * R_x(pitch)，默认看向 -Z
+mat3 buildCameraRotationMatrix(float yaw, float pitch) {
+    float cosYaw = cos(yaw);
+    float sinYaw = sin(yaw);
+    float cosPitch = cos(pitch);
+    float sinPitch = sin(pitch);
+    
+    mat3 rotX = mat3(
+        1.0, 0.0, 0.0,
+        0.0, cosPitch, -sinPitch,
+        0.0, sinPitch, cosPitch
+    );
+    
+    mat3 rotY = mat3(
+        cosYaw, 0.0, sinYaw,
+        0.0, 1.0, 0.0,
+        -sinYaw, 0.0, cosYaw
+    );
+    
+    return rotY * rotX;
+}
+
+void main() {
+    uint cube = uint(gl_InstanceIndex);
+    int face = gl_VertexIndex / 6;
+    vec2 corner = QUAD_CORNERS[gl_VertexIndex % 6];
+    
+    vec3 normal = FACE_NORMALS[face];
+    vec3 tangent = FACE_TANGENTS[face];
+    vec3 bitangent = cross(normal, tangent);
+    vec3 localPos = (normal + tangent * corner.x + bitangent * corner.y) * cubes[cube].halfSize.xyz;
+    
+    // rotation 为正交矩阵，局部空间到世界空间用其转置
+    mat3 rot = mat3(cubes[cube].rotation[0].xyz, cubes[cube].rotation[1].xyz, cubes[cube].rotation[2].xyz);
+    vec3 worldPos = cubes[cube].bounds.xyz + transpose(rot) * localPos;
+    
+    // 法线与光线投射路径的 getCubeNormal 相同（同样乘以 rot），保证两条路径着色一致
+    fragNormal = normalize(rot * normal);
+    fragColor = cubes[cube].color.rgb;
+    
+    vec3 cameraPos = vec3(pc.cameraPosX, pc.cameraPosY, pc.cameraPosZ);
+    fragViewOffset = worldPos - cameraPos;
+    
+    // 投影到相机空间（与光线投射的射线构建互逆：uv = (x / (tan * aspect), y / tan) / z）
+    mat3 cameraRotation = buildCameraRotationMatrix(pc.cameraYaw, pc.cameraPitch);
+    vec3 forward = normalize(cameraRotation * vec3(0.0, 0.0, -1.0));
+    vec3 right = normalize(cameraRotation * vec3(1.0, 0.0, 0.0));
+    vec3 up = normalize(cameraRotation * vec3(0.0, 1.0, 0.0));
+    
+    float x = dot(fragViewOffset, right);
+    float y = dot(fragViewOffset, up);
+    float z = dot(fragViewOffset, forward);
+    
+    float tanHalfFov = tan(45.0 * DEG2RAD * 0.5);
+    float depthScale = FAR_PLANE / (FAR_PLANE - NEAR_PLANE);
+    
+    // 光线投射的 uv.y 直接对应 NDC 的 y（不翻转），这里保持相同的朝向
+    gl_Position = vec4(x / (tanHalfFov * pc.aspect), y / tanHalfFov, z * depthScale - NEAR_PLANE * depthScale, z);
+}
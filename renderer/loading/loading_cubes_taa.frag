@@ -0,0 +1,242 @@
+#version 450
+
+// by SamuelYAN
+// Converted from p5.js to Vulkan shader
+// Original: https://twitter.com/SamuelAnn0924
+// https://www.instagram.com/samuel_yan_1990/
+
+// 时间抗锯齿版本：每个像素每帧只做一次抖动采样，由 taa_resolve.frag 与重投影的历史混合
+// （除 main 和命中距离输出外与 loading_cubes.frag 相同，shaderc 不支持 #include）
+
+layout(location = 0) in vec2 fragCoord;
+layout(location = 0) out vec4 outColor;  // rgb 颜色，a 为命中距离（0 表示背景，供重投影重建命中点）
+
+// 屏幕分块网格边长和每块可记录的立方体数量（与 loading_cubes_cull.comp 一致）
+#define TILE_GRID 64
+#define TILE_CAPACITY 64
+
+// 单个立方体的逐帧数据（CPU 每帧计算一次，整帧所有像素共用）
+struct CubeData {
+    vec4 rotation[3];  // 世界空间到立方体局部空间的旋转（mat3 的三列）
+    vec4 localOrigin;  // 相机位置在立方体局部空间中的坐标
+    vec4 halfSize;     // 立方体半边长
+    vec4 color;        // 立方体颜色（已做伽马校正）
+    vec4 bounds;       // 世界空间包围球（仅用于剔除）
+};
+
+// 场景参数（每个交换链图像一份统一缓冲区，每帧更新，命令缓冲区无需重新录制）
+layout(set = 0, binding = 0) uniform SceneParams {
+    float time;
+    float aspect;
+    float cameraYaw;   // 相机水平旋转角度（弧度）
+    float cameraPitch; // 相机垂直旋转角度（弧度）
+    float cameraPosX;  // 相机X位置
+    float cameraPosY;  // 相机Y位置
+    float cameraPosZ;  // 相机Z位置
+    uint cubeCount;    // 立方体数量
+    uint tileCulling;  // 非0时分块列表有效（本帧已执行剔除计算着色器）
+    float prevCameraYaw;   // 以下为时间抗锯齿参数（其他场景着色器不声明）
+    float prevCameraPitch;
+    float prevCameraPosX;
+    float prevCameraPosY;
+    float prevCameraPosZ;
+    float jitterX;         // 本帧子像素抖动（标准化坐标）
+    float jitterY;
+    float historyWeight;   // 历史权重（0 表示历史无效）
+} pc;
+
+layout(std430, set = 0, binding = 1) readonly buffer CubeBuffer {
+    CubeData cubes[];
+};
+
+// 分块列表（由 loading_cubes_cull.comp 写入）：每块的立方体数量，然后是每块 TILE_CAPACITY 个立方体索引
+layout(std430, set = 0, binding = 2) readonly buffer TileBuffer {
+    uint tileData[];
+};
+
+#define PI 3.14159265359
+#define DEG2RAD (PI / 180.0)
+
+// 从yaw和pitch构建正确的旋转矩阵
+// 正确的顺序：先绕X轴旋转（pitch），再绕Y轴旋转（yaw）
+// 参考Godot的实现方式：R = R_y(yaw) * R_x(pitch)
+mat3 buildCameraRotationMatrix(float yaw, float pitch) {
+    float cosYaw = cos(yaw);
+    float sinYaw = sin(yaw);
+    float cosPitch = cos(pitch);
+    float sinPitch = sin(pitch);
+    
+    // 构建旋转矩阵：R = R_y(yaw) * R_x(pitch)
+    mat3 rotX = mat3(
+        1.0, 0.0, 0.0,
+        0.0, cosPitch, -sinPitch,
+        0.0, sinPitch, cosPitch
+    );
+    
+    mat3 rotY = mat3(
+        cosYaw, 0.0, sinYaw,
+        0.0, 1.0, 0.0,
+        -sinYaw, 0.0, cosYaw
+    );
+    
+    // 组合旋转：先X后Y（矩阵乘法从右到左）
+    return rotY * rotX;
+}
+
+// 从旋转矩阵提取前、右、上向量
+void getCameraBasis(mat3 rotation, out vec3 forward, out vec3 right, out vec3 up) {
+    // 相机默认看向-Z方向
+    forward = normalize(rotation * vec3(0.0, 0.0, -1.0));
+    right = normalize(rotation * vec3(1.0, 0.0, 0.0));
+    up = normalize(rotation * vec3(0.0, 1.0, 0.0));
+}
+
+// 构建射线方向（用于ray marching）
+vec3 buildRayDirection(vec2 uv, float fov, float aspectRatio, mat3 cameraRotation) {
+    vec3 forward, right, up;
+    getCameraBasis(cameraRotation, forward, right, up);
+    
+    // 构建射线方向
+    float tanHalfFov = tan(fov * 0.5);
+    vec3 rayDir = normalize(forward + 
+                           uv.x * tanHalfFov * aspectRatio * right + 
+                           uv.y * tanHalfFov * up);
+    
+    return rayDir;
+}
+
+// SDF 立方体
+float sdBox(vec3 p, vec3 b) {
+    vec3 q = abs(p) - b;
+    return length(max(q, 0.0)) + min(max(q.x, max(q.y, q.z)), 0.0);
+}
+
+// 射线与立方体（局部空间中的 AABB）的交点距离
+// 旋转和局部空间的射线起点由 CPU 每帧计算，这里只剩逐像素的射线方向变换和 slab 测试
+float intersectCube(vec3 localRo, vec3 localRd, vec3 cubeSize) {
+    vec3 invRd = 1.0 / (localRd + 0.0001); // 避免除零
+    vec3 t0 = (-cubeSize - localRo) * invRd;
+    vec3 t1 = (cubeSize - localRo) * invRd;
+    vec3 tmin = min(t0, t1);
+    vec3 tmax = max(t0, t1);
+    
+    float tnear = max(max(tmin.x, tmin.y), tmin.z);
+    float tfar = min(min(tmax.x, tmax.y), tmax.z);
+    
+    if (tnear > tfar || tfar < 0.0) {
+        return -1.0;
+    }
+    
+    return tnear > 0.0 ? tnear : tfar;
+}
+
+// 计算立方体表面的法线（简化版本，localP 为命中点在立方体局部空间中的坐标）
+vec3 getCubeNormal(vec3 localP, vec3 cubeSize, mat3 rot) {
+    vec3 q = abs(localP) - cubeSize;
+    
+    vec3 n = vec3(0.0);
+    if (q.x > q.y && q.x > q.z) {
+        n = vec3(sign(localP.x), 0.0, 0.0);
+    } else if (q.y > q.z) {
+        n = vec3(0.0, sign(localP.y), 0.0);
+    } else {
+        n = vec3(0.0, 0.0, sign(localP.z));
+    }
+    
+    return normalize(rot * n);
+}
+
+mat3 cubeRotation(uint index) {
+    return mat3(cubes[index].rotation[0].xyz, cubes[index].rotation[1].xyz, cubes[index].rotation[2].xyz);
+}
+
+// 射线与单个立方体求交，更近时更新最近命中
+void testCube(uint index, vec3 rayDir, inout float minDist, inout int hitIndex) {
+    vec3 localRd = cubeRotation(index) * rayDir;
+    float t = intersectCube(cubes[index].localOrigin.xyz, localRd, cubes[index].halfSize.xyz);
+    
+    if (t > 0.0 && t < minDist) {
+        minDist = t;
+        hitIndex = int(index);
+    }
+}
+
+// 渲染单个像素的函数（hitDist 返回最近命中距离，未命中时为 0）
+vec3 renderPixel(vec2 uv, mat3 cameraRotation, uint tile, out float hitDist) {
+    // 构建射线方向
+    float fov = 45.0 * DEG2RAD;
+    vec3 rayDir = buildRayDirection(uv, fov, pc.aspect, cameraRotation);
+    
+    // 初始化颜色（使用淡棕色背景）
+    vec3 bgColor = vec3(210.0 / 255.0, 180.0 / 255.0, 140.0 / 255.0);
+    vec3 col = bgColor;
+    
+    float minDist = 1000.0;
+    int hitIndex = -1;
+    hitDist = 0.0;
+    
+    // 只做求交，法线和颜色在找到最近命中后计算一次
+    // 分块列表有效且未溢出时只测试与该分块重叠的立方体，否则测试所有立方体
+    uint tileCount = (pc.tileCulling != 0u) ? tileData[tile] : (TILE_CAPACITY + 1u);
+    if (tileCount <= TILE_CAPACITY) {
+        uint listStart = TILE_GRID * TILE_GRID + tile * TILE_CAPACITY;
+        for (uint i = 0u; i < tileCount; i++) {
+            testCube(tileData[listStart + i], rayDir, minDist, hitIndex);
+        }
+    } else {
+        for (uint i = 0u; i < pc.cubeCount; i++) {
+            testCube(i, rayDir, minDist, hitIndex);
+        }
+    }
+    
+    // 如果有命中，使用立方体颜色
+    if (hitIndex >= 0) {
+        hitDist = minDist;
+        mat3 cubeRot = cubeRotation(uint(hitIndex));
+        vec3 localP = cubes[hitIndex].localOrigin.xyz + (cubeRot * rayDir) * minDist;
+        vec3 hitNormal = getCubeNormal(localP, cubes[hitIndex].halfSize.xyz, cubeRot);
+        vec3 hitColor = cubes[hitIndex].color.rgb;
+        
+        // 改进的光照计算
+        vec3 lightDir = normalize(vec3(1.0, 1.0, 1.0));
+        float NdotL = max(dot(hitNormal, lightDir), 0.0);
+        
+        // 环境光
+        float ambient = 0.4;
+        
+        // 漫反射光照
+        float diffuse = NdotL * 0.6;
+        
+        // 总光照强度
+        float light = ambient + diffuse;
+        
+        // 应用光照
+        col = hitColor * light;
+        
+        // 添加边缘高光（更清晰）
+        float edge = 1.0 - smoothstep(0.0, 0.03, minDist - 0.97);
+        col = mix(col, hitColor * 1.6, edge * 0.35);
+        
+        // 添加一些对比度增强和锐化
+        col = pow(col, vec3(0.85));  // 提高对比度
+        col = clamp(col, 0.0, 1.0);  // 确保颜色在有效范围内
+    }
+    
+    return col;
+}
+
+void main() {
+    // 使用CPU端更新后的相机状态（相机位置已变换到各立方体的局部空间）
+    mat3 cameraRotation = buildCameraRotationMatrix(pc.cameraYaw, pc.cameraPitch);
+    
+    // 像素中心所在的屏幕分块（剔除时留出的余量覆盖半个像素以内的抖动）
+    vec2 uv = fragCoord;
+    ivec2 tileCoord = clamp(ivec2(floor((uv * 0.5 + 0.5) * float(TILE_GRID))), ivec2(0), ivec2(TILE_GRID - 1));
+    uint tile = uint(tileCoord.y * TILE_GRID + tileCoord.x);
+    
+    // 单个抖动采样：抖动序列在多帧之间覆盖整个像素，累积后等效于超采样
+    float hitDist;
+    vec3 col = renderPixel(uv + vec2(pc.jitterX, pc.jitterY), cameraRotation, tile, hitDist);
+    
+    outColor = vec4(col, hitDist);
+}
@@ -0,0 +1,123 @@
+#version 450
+
+// loading_cubes 时间抗锯齿的解析通道：把本帧的单个抖动采样与重投影的历史混合
+// 输出写入解析目标，随后复制为下一帧的历史，并合成到交换链图像
+
+layout(location = 0) in vec2 fragUV;
+layout(location = 0) out vec4 outColor;
+
+// 场景参数（与 loading_cubes_taa.frag 的 SceneParams 一致）
+layout(set = 0, binding = 0) uniform SceneParams {
+    float time;
+    float aspect;
+    float cameraYaw;
+    float cameraPitch;
+    float cameraPosX;
+    float cameraPosY;
+    float cameraPosZ;
+    uint cubeCount;
+    uint tileCulling;
+    float prevCameraYaw;   // 上一帧的相机状态（历史缓冲区对应的相机）
+    float prevCameraPitch;
+    float prevCameraPosX;
+    float prevCameraPosY;
+    float prevCameraPosZ;
+    float jitterX;         // 本帧子像素抖动（标准化坐标）
+    float jitterY;
+    float historyWeight;   // 历史权重（0 表示历史无效，直接输出本帧采样）
+} pc;
+
+// 本帧的抖动采样（rgb 颜色，a 为命中距离，0 表示背景）和上一帧的解析结果
+layout(set = 1, binding = 0) uniform sampler2D currentFrame;
+layout(set = 1, binding = 1) uniform sampler2D historyFrame;
+
+#define PI 3.14159265359
+#define DEG2RAD (PI / 180.0)
+
+// 历史运动超过该像素数时权重降到一半（双线性重采样的历史在运动中逐渐变模糊）
+#define VELOCITY_FALLOFF_PIXELS 8.0
+
+// 与 loading_cubes.frag 相同的相机旋转：R = R_y(yaw) * R_x(pitch)
+mat3 buildCameraRotationMatrix(float yaw, float pitch) {
+    float cosYaw = cos(yaw);
+    float sinYaw = sin(yaw);
+    float cosPitch = cos(pitch);
+    float sinPitch = sin(pitch);
+    
+    mat3 rotX = mat3(
+        1.0, 0.0, 0.0,
+        0.0, cosPitch, -sinPitch,
+        0.0, sinPitch, cosPitch
+    );
+    
+    mat3 rotY = mat3(
+        cosYaw, 0.0, sinYaw,
+        0.0, 1.0, 0.0,
+        -sinYaw, 0.0, cosYaw
+    );
+    
+    return rotY * rotX;
+}
+
+// 与 loading_cubes.frag 的 buildRayDirection 相同（相机看向 -Z）
+vec3 buildRayDirection(vec2 uv, float tanHalfFov, mat3 cameraRotation) {
+    vec3 forward = cameraRotation * vec3(0.0, 0.0, -1.0);
+    vec3 right = cameraRotation * vec3(1.0, 0.0, 0.0);
+    vec3 up = cameraRotation * vec3(0.0, 1.0, 0.0);
+    return normalize(forward + uv.x * tanHalfFov * pc.aspect * right + uv.y * tanHalfFov * up);
+}
+
+void main() {
+    ivec2 size = textureSize(currentFrame, 0);
+    ivec2 pixel = ivec2(gl_FragCoord.xy);
+    vec4 current = texelFetch(currentFrame, pixel, 0);
+    
+    if (pc.historyWeight <= 0.0) {
+        outColor = vec4(current.rgb, 1.0);
+        return;
+    }
+    
+    // 本帧 3x3 邻域的颜色范围：历史限制在该范围内，遮挡变化和立方体自转造成的过时历史被拒绝
+    vec3 minColor = current.rgb;
+    vec3 maxColor = current.rgb;
+    for (int y = -1; y <= 1; y++) {
+        for (int x = -1; x <= 1; x++) {
+            ivec2 neighbor = clamp(pixel + ivec2(x, y), ivec2(0), size - 1);
+            vec3 color = texelFetch(currentFrame, neighbor, 0).rgb;
+            minColor = min(minColor, color);
+            maxColor = max(maxColor, color);
+        }
+    }
+    
+    // 由本帧的射线和命中距离重建命中点，投影到上一帧的相机（背景按无穷远方向投影）
+    float tanHalfFov = tan(45.0 * DEG2RAD * 0.5);
+    vec2 pixelCenter = (vec2(pixel) + 0.5) / vec2(size);
+    vec2 ndc = pixelCenter * 2.0 - 1.0 + vec2(pc.jitterX, pc.jitterY);
+    vec3 rayDir = buildRayDirection(ndc, tanHalfFov, buildCameraRotationMatrix(pc.cameraYaw, pc.cameraPitch));
+    
+    mat3 prevRotation = buildCameraRotationMatrix(pc.prevCameraYaw, pc.prevCameraPitch);
+    vec3 prevView;
+    if (current.a > 0.0) {
+        vec3 hitPoint = vec3(pc.cameraPosX, pc.cameraPosY, pc.cameraPosZ) + rayDir * current.a;
+        prevView = transpose(prevRotation) * (hitPoint - vec3(pc.prevCameraPosX, pc.prevCameraPosY, pc.prevCameraPosZ));
+    } else {
+        prevView = transpose(prevRotation) * rayDir;
+    }
+    
+    float depth = -prevView.z;
+    vec2 prevNdc = prevView.xy / (max(depth, 1e-4) * tanHalfFov * vec2(pc.aspect, 1.0));
+    vec2 prevUV = prevNdc * 0.5 + 0.5;
+    
+    // 上一帧位于相机后方或屏幕之外：没有可用的历史
+    if (depth <= 1e-4 || any(lessThan(prevUV, vec2(0.0))) || any(greaterThan(prevUV, vec2(1.0)))) {
+        outColor = vec4(current.rgb, 1.0);
+        return;
+    }
+    
+    vec3 history = clamp(texture(historyFrame, prevUV).rgb, minColor, maxColor);
+    
+    float velocity = length((prevUV - pixelCenter) * vec2(size));
+    float weight = pc.historyWeight * (1.0 - 0.5 * clamp(velocity / VELOCITY_FALLOFF_PIXELS, 0.0, 1.0));
+    
+    outColor = vec4(mix(current.rgb, history, weight), 1.0);
+}
@@ -3,7 +3,8 @@
 layout(location = 0) in vec2 fragCoord;
 layout(location = 0) out vec4 outColor;
 
-layout(push_constant) uniform PushConstants {
+// 场景参数（每个交换链图像一份统一缓冲区，每帧更新，命令缓冲区无需重新录制）
+layout(set = 0, binding = 0) uniform SceneParams {
     float time;
     float aspect;
 } pc;
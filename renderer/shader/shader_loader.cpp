@@ -1,8 +1,10 @@
 #include "shader/shader_loader.h"  // 1. 对应头文件
 
-#include <cstring>  // 2. 系统头文件
-#include <fstream>  // 2. 系统头文件
-#include <string>   // 2. 系统头文件
+#include <cstring>       // 2. 系统头文件
+#include <filesystem>    // 2. 系统头文件
+#include <fstream>       // 2. 系统头文件
+#include <string>        // 2. 系统头文件
+#include <system_error>  // 2. 系统头文件
 
 #include <vulkan/vulkan.h>  // 3. 第三方库头文件
 
@@ -92,6 +94,27 @@ std::vector<char> ShaderLoader::CompileGLSLFromFile(const std::string& filename,
     return CompileGLSLFromSource(glslSource, stage, filename);
 }
 
+std::vector<char> ShaderLoader::LoadShaderCode(const std::string& path, ShaderStage stage) {
+    const std::string spvSuffix = ".spv";
+    if (path.size() <= spvSuffix.size() ||
+        path.compare(path.size() - spvSuffix.size(), spvSuffix.size(), spvSuffix) != 0) {
+        return CompileGLSLFromFile(path, stage);
+    }
+    
+#ifdef USE_SHADERC
+    // SPIR-V 文件不存在时从同名 GLSL 源码编译（xxx.vert.spv -> xxx.vert）
+    std::error_code error;
+    if (!std::filesystem::exists(path, error)) {
+        std::string sourcePath = path.substr(0, path.size() - spvSuffix.size());
+        if (std::filesystem::exists(sourcePath, error)) {
+            return CompileGLSLFromFile(sourcePath, stage);
+        }
+    }
+#endif
+    
+    return LoadSPIRV(path);
+}
+
 std::vector<char> ShaderLoader::CompileGLSLFromSource(const std::string& glslSource, ShaderStage stage, const std::string& filename) {
 #ifdef USE_SHADERC
     // 使用Shaderc库进行运行时编译
@@ -24,6 +24,10 @@ public:
     // 使用抽象类型以支持多种渲染后端
     static std::vector<char> CompileGLSLFromSource(const std::string& glslSource, ShaderStage stage, const std::string& filename = "");
     
+    // 按扩展名加载着色器字节码：.spv 路径读取SPIR-V文件，其他路径作为GLSL源文件编译
+    // 启用运行时编译（USE_SHADERC）时，.spv 文件不存在而同名GLSL源文件存在则编译源文件
+    static std::vector<char> LoadShaderCode(const std::string& path, ShaderStage stage);
+    
     // 从SPIR-V字节码创建shader模块
     // 使用抽象类型以支持多种渲染后端
     static ShaderModuleHandle CreateShaderModuleFromSPIRV(DeviceHandle device, const std::vector<char>& spirvCode);
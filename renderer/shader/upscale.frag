@@ -0,0 +1,42 @@
+#version 450
+
+layout(location = 0) in vec2 fragUV;
+layout(location = 0) out vec4 outColor;
+
+// 以降低的分辨率渲染的场景（位于离屏目标左上角）
+layout(set = 0, binding = 0) uniform sampler2D sceneColor;
+
+// 放大参数（与 vulkan_resolution_scaler.cpp 的 UpscalePushConstants 一致）
+layout(push_constant) uniform UpscaleParams {
+    vec2 uvScale;    // 场景区域占离屏目标的比例
+    vec2 uvMax;      // 采样坐标上限（场景区域最后一个纹素的中心）
+    vec2 texelSize;  // 离屏目标的纹素大小
+    float sharpness; // 锐化强度（0 表示只做双线性放大）
+} params;
+
+vec3 sampleScene(vec2 uv) {
+    return texture(sceneColor, clamp(uv, params.texelSize * 0.5, params.uvMax)).rgb;
+}
+
+void main() {
+    vec2 uv = fragUV * params.uvScale;
+    vec3 center = sampleScene(uv);
+    if (params.sharpness <= 0.0) {
+        outColor = vec4(center, 1.0);
+        return;
+    }
+    
+    // 按邻域对比度自适应的锐化：平坦区域和高对比边缘锐化较弱，避免放大噪声和产生光晕
+    vec3 up = sampleScene(uv - vec2(0.0, params.texelSize.y));
+    vec3 down = sampleScene(uv + vec2(0.0, params.texelSize.y));
+    vec3 left = sampleScene(uv - vec2(params.texelSize.x, 0.0));
+    vec3 right = sampleScene(uv + vec2(params.texelSize.x, 0.0));
+    
+    vec3 minColor = min(center, min(min(up, down), min(left, right)));
+    vec3 maxColor = max(center, max(max(up, down), max(left, right)));
+    vec3 amp = sqrt(clamp(min(minColor, 1.0 - maxColor) / max(maxColor, vec3(1e-4)), 0.0, 1.0));
+    vec3 weight = -amp * (params.sharpness * 0.2);
+    
+    vec3 color = (center + (up + down + left + right) * weight) / (1.0 + 4.0 * weight);
+    outColor = vec4(clamp(color, minColor, maxColor), 1.0);
+}
@@ -0,0 +1,10 @@
+#version 450
+
+layout(location = 0) out vec2 fragUV;
+
+// 全屏三角形（3个顶点覆盖整个视口），UV 从左上角 (0,0) 到右下角 (1,1)
+void main() {
+    vec2 uv = vec2((gl_VertexIndex << 1) & 2, gl_VertexIndex & 2);
+    gl_Position = vec4(uv * 2.0 - 1.0, 0.0, 1.0);
+    fragUV = uv;
+}
@@ -0,0 +1,90 @@
+#include "text/distance_field.h"  // 1. 对应头文件
+
+#include <algorithm>  // 2. 系统头文件
+#include <cmath>      // 2. 系统头文件
+#include <vector>     // 2. 系统头文件
+
+namespace {
+
+// 一维平方欧氏距离变换（Felzenszwalb & Huttenlocher），原地处理 grid 中 offset 开始、步长 stride 的 length 个元素
+void DistanceTransform1D(std::vector<float>& grid, size_t offset, size_t stride, size_t length,
+                         std::vector<float>& f, std::vector<float>& z, std::vector<int>& v) {
+    const float INF = 1e20f;
+    for (size_t q = 0; q < length; q++) {
+        f[q] = grid[offset + q * stride];
+    }
+    
+    v[0] = 0;
+    z[0] = -INF;
+    z[1] = INF;
+    int k = 0;
+    for (int q = 1; q < (int)length; q++) {
+        // 弹出下包络中被抛物线 q 完全遮住的抛物线
+        float s;
+        do {
+            int r = v[k];
+            s = (f[q] - f[r] + (float)(q * q) - (float)(r * r)) / (float)(2 * (q - r));
+        } while (s <= z[k] && --k > -1);
+        k++;
+        v[k] = q;
+        z[k] = s;
+        z[k + 1] = INF;
+    }
+    
+    k = 0;
+    for (int q = 0; q < (int)length; q++) {
+        while (z[k + 1] < (float)q) {
+            k++;
+        }
+        int r = v[k];
+        grid[offset + q * stride] = (float)((q - r) * (q - r)) + f[r];
+    }
+}
+
+// 二维平方距离变换：先逐列再逐行
+void DistanceTransform2D(std::vector<float>& grid, uint32_t width, uint32_t height,
+                         std::vector<float>& f, std::vector<float>& z, std::vector<int>& v) {
+    for (uint32_t x = 0; x < width; x++) {
+        DistanceTransform1D(grid, x, width, height, f, z, v);
+    }
+    for (uint32_t y = 0; y < height; y++) {
+        DistanceTransform1D(grid, (size_t)y * width, 1, width, f, z, v);
+    }
+}
+
+} // namespace
+
+void BuildDistanceField(const uint8_t* coverage, uint32_t width, uint32_t height, float spread, uint8_t* output) {
+    const float INF = 1e20f;
+    size_t count = (size_t)width * height;
+    std::vector<float> outer(count);
+    std::vector<float> inner(count);
+    for (size_t i = 0; i < count; i++) {
+        float a = coverage[i] / 255.0f;
+        if (a >= 1.0f) {
+            outer[i] = 0.0f;
+            inner[i] = INF;
+        } else if (a <= 0.0f) {
+            outer[i] = INF;
+            inner[i] = 0.0f;
+        } else {
+            float d = 0.5f - a;
+            outer[i] = d > 0.0f ? d * d : 0.0f;
+            inner[i] = d < 0.0f ? d * d : 0.0f;
+        }
+    }
+    
+    size_t length = (std::max)(width, height);
+    std::vector<float> f(length);
+    std::vector<float> z(length + 1);
+    std::vector<int> v(length);
+    DistanceTransform2D(outer, width, height, f, z, v);
+    DistanceTransform2D(inner, width, height, f, z, v);
+    
+    for (size_t i = 0; i < count; i++) {
+        float distance = std::sqrt(outer[i]) - std::sqrt(inner[i]);
+        float value = 0.5f - distance / (2.0f * spread);
+        value = (std::min)((std::max)(value, 0.0f), 1.0f);
+        output[i] = (uint8_t)std::lround(value * 255.0f);
+    }
+}
@@ -0,0 +1,7 @@
+#pragma once
+
+#include <cstdint>  // 2. 系统头文件
+
+// 由覆盖率（0-255）生成有向距离场：轮廓处为 128，向内增大、向外减小，spread 像素处分别达到 255 和 0
+// 抗锯齿边缘像素按覆盖率给出亚像素距离，小字号缩放后轮廓也保持平滑；output 与 coverage 尺寸相同
+void BuildDistanceField(const uint8_t* coverage, uint32_t width, uint32_t height, float spread, uint8_t* output);
@@ -0,0 +1,181 @@
+#pragma once
+
+#include <cstddef>  // 2. 系统头文件
+#include <cstdint>  // 2. 系统头文件
+#include <vector>   // 2. 系统头文件
+
+// 字形表 - 按 Unicode 码位索引的两级表，替代逐字符哈希查找
+// ASCII/Latin-1（U+0000-U+00FF）直接按码位索引一个平坦数组，查找只需一次下标访问；
+// 其他码位（CJK 和其他平面）存放在线性探测的开放寻址表中，前面有一个按码位低位直接映射的小缓存，
+// 重复出现的字符通常不需要计算哈希和探测
+// 注意：插入可能导致开放寻址表重新分配，之前返回的非 Latin-1 指针随之失效
+template <typename T>
+class GlyphTable {
+public:
+    GlyphTable() {
+        Clear();
+    }
+    
+    // 查找字形，不存在时返回 nullptr
+    T* Find(uint32_t charCode) {
+        if (charCode < DIRECT_RANGE) {
+            Entry& entry = m_direct[charCode];
+            return entry.key == charCode ? &entry.value : nullptr;
+        }
+        
+        CacheEntry& cached = m_frontCache[charCode & (FRONT_CACHE_SIZE - 1)];
+        if (cached.key == charCode) {
+            return &m_entries[cached.index].value;
+        }
+        
+        uint32_t index = 0;
+        if (!FindIndex(charCode, index)) {
+            return nullptr;
+        }
+        cached.key = charCode;
+        cached.index = index;
+        return &m_entries[index].value;
+    }
+    
+    // 插入或覆盖字形，返回表内的副本
+    T& Insert(uint32_t charCode, const T& value) {
+        if (charCode < DIRECT_RANGE) {
+            Entry& entry = m_direct[charCode];
+            if (entry.key != charCode) {
+                entry.key = charCode;
+                m_directCount++;
+            }
+            entry.value = value;
+            return entry.value;
+        }
+        
+        uint32_t index = 0;
+        if (FindIndex(charCode, index)) {
+            m_entries[index].value = value;
+            return m_entries[index].value;
+        }
+        
+        // 已用槽位（含删除标记）超过 3/4 时重建：有效条目达到容量的 1/4 则容量翻倍，否则只清除删除标记
+        if ((m_count + m_tombstones + 1) * 4 > (uint32_t)m_entries.size() * 3) {
+            uint32_t capacity = (uint32_t)m_entries.size();
+            Rehash(m_count * 4 >= capacity ? capacity * 2 : capacity);
+        }
+        
+        index = Hash(charCode);
+        while (m_entries[index].key != EMPTY_KEY && m_entries[index].key != TOMBSTONE_KEY) {
+            index = (index + 1) & m_mask;
+        }
+        if (m_entries[index].key == TOMBSTONE_KEY) {
+            m_tombstones--;
+        }
+        m_entries[index].key = charCode;
+        m_entries[index].value = value;
+        m_count++;
+        return m_entries[index].value;
+    }
+    
+    // 删除字形（不存在时忽略）
+    void Erase(uint32_t charCode) {
+        if (charCode < DIRECT_RANGE) {
+            if (m_direct[charCode].key == charCode) {
+                m_direct[charCode].key = EMPTY_KEY;
+                m_directCount--;
+            }
+            return;
+        }
+        
+        uint32_t index = 0;
+        if (!FindIndex(charCode, index)) {
+            return;
+        }
+        // 线性探测的删除留下删除标记，保证之后的探测链不断开
+        m_entries[index].key = TOMBSTONE_KEY;
+        m_count--;
+        m_tombstones++;
+        CacheEntry& cached = m_frontCache[charCode & (FRONT_CACHE_SIZE - 1)];
+        if (cached.key == charCode) {
+            cached.key = EMPTY_KEY;
+        }
+    }
+    
+    void Clear() {
+        for (Entry& entry : m_direct) {
+            entry.key = EMPTY_KEY;
+        }
+        m_directCount = 0;
+        m_entries.clear();  // 先丢弃旧条目，Rehash 只重建空表
+        Rehash(INITIAL_CAPACITY);
+    }
+    
+    size_t Size() const { return (size_t)m_directCount + m_count; }
+
+private:
+    // 码位最大为 0x10FFFF，用两个不可能出现的值表示空槽位和删除标记
+    static constexpr uint32_t EMPTY_KEY = 0xFFFFFFFFu;
+    static constexpr uint32_t TOMBSTONE_KEY = 0xFFFFFFFEu;
+    static constexpr uint32_t DIRECT_RANGE = 256;
+    static constexpr uint32_t INITIAL_CAPACITY = 256;   // 2 的幂
+    static constexpr uint32_t FRONT_CACHE_SIZE = 64;    // 2 的幂
+    
+    struct Entry {
+        uint32_t key = EMPTY_KEY;
+        T value = {};
+    };
+    
+    struct CacheEntry {
+        uint32_t key = EMPTY_KEY;
+        uint32_t index = 0;       // m_entries 中的位置
+    };
+    
+    // 乘法哈希取高位（相邻的 CJK 码位分散到不同槽位）
+    uint32_t Hash(uint32_t charCode) const {
+        return (charCode * 0x9E3779B1u) >> m_shift;
+    }
+    
+    bool FindIndex(uint32_t charCode, uint32_t& index) const {
+        index = Hash(charCode);
+        while (m_entries[index].key != EMPTY_KEY) {
+            if (m_entries[index].key == charCode) {
+                return true;
+            }
+            index = (index + 1) & m_mask;
+        }
+        return false;
+    }
+    
+    // 按新容量重建开放寻址表（丢弃删除标记，前端缓存中的位置全部失效）
+    void Rehash(uint32_t capacity) {
+        std::vector<Entry> old;
+        old.swap(m_entries);
+        m_entries.assign(capacity, Entry());
+        m_mask = capacity - 1;
+        m_shift = 32;
+        for (uint32_t c = capacity; c > 1; c >>= 1) {
+            m_shift--;
+        }
+        m_count = 0;
+        m_tombstones = 0;
+        for (CacheEntry& cached : m_frontCache) {
+            cached.key = EMPTY_KEY;
+        }
+        
+        for (const Entry& entry : old) {
+            if (entry.key == EMPTY_KEY || entry.key == TOMBSTONE_KEY) continue;
+            uint32_t index = Hash(entry.key);
+            while (m_entries[index].key != EMPTY_KEY) {
+                index = (index + 1) & m_mask;
+            }
+            m_entries[index] = entry;
+            m_count++;
+        }
+    }
+    
+    Entry m_direct[DIRECT_RANGE];           // 按码位直接索引（U+0000-U+00FF）
+    uint32_t m_directCount = 0;
+    std::vector<Entry> m_entries;           // 开放寻址表（容量为 2 的幂）
+    uint32_t m_mask = 0;
+    uint32_t m_shift = 32;
+    uint32_t m_count = 0;
+    uint32_t m_tombstones = 0;
+    CacheEntry m_frontCache[FRONT_CACHE_SIZE];
+};
@@ -2,14 +2,18 @@
 
 layout(location = 0) in vec2 fragTexCoord;
 layout(location = 1) in vec4 fragColor;
+layout(location = 2) flat in float fragPage;
 
 layout(location = 0) out vec4 outColor;
 
-layout(binding = 0) uniform sampler2D fontTexture;
+// 多页字形图集（R8 有向距离场，每页一个数组层；轮廓处为 0.5，向内增大）
+layout(binding = 0) uniform sampler2DArray fontTexture;
 
 void main() {
-    // 采样字体纹理（alpha 通道）
-    float alpha = texture(fontTexture, fragTexCoord).a;
+    // 采样距离场，按屏幕空间导数确定抗锯齿过渡宽度（约一个像素），任意缩放下边缘都保持清晰
+    float distance = texture(fontTexture, vec3(fragTexCoord, fragPage)).r;
+    float smoothing = max(fwidth(distance) * 0.5, 1e-4);
+    float alpha = smoothstep(0.5 - smoothing, 0.5 + smoothing, distance);
     
     // 跳过空白像素
     if (alpha < 0.01) {
@@ -1,30 +1,53 @@
 #version 450
 
-layout(location = 0) in vec2 inPosition;
-layout(location = 1) in vec2 inTexCoord;
-layout(location = 2) in vec4 inColor;
+// 字形实例（每个字符一条记录，实例输入）
+layout(location = 0) in vec4 inRect;    // 四边形左上角和尺寸（窗口坐标，像素）
+layout(location = 1) in uint inGlyph;   // 图集单元索引（低 16 位）| 字形宽度（8 位）| 高度（8 位，图集像素）
+layout(location = 2) in vec4 inColor;   // RGBA8
 
 layout(location = 0) out vec2 fragTexCoord;
 layout(location = 1) out vec4 fragColor;
+layout(location = 2) flat out float fragPage;
 
 layout(push_constant) uniform PushConstants {
-    vec2 screenSize;  // 屏幕大小
+    vec2 screenSize;    // 屏幕大小
+    vec2 atlasSize;     // 图集单页尺寸（像素）
+    uvec2 cellSize;     // 图集单元尺寸（像素）
+    uint cellsPerRow;
+    uint cellsPerPage;
 } pc;
 
+// 两个三角形的角点（逆时针：左上 -> 右上 -> 右下，左上 -> 右下 -> 左下）
+const vec2 CORNERS[6] = vec2[](
+    vec2(0.0, 0.0), vec2(1.0, 0.0), vec2(1.0, 1.0),
+    vec2(0.0, 0.0), vec2(1.0, 1.0), vec2(0.0, 1.0)
+);
+
 void main() {
+    vec2 corner = CORNERS[gl_VertexIndex];
+    
     // 将窗口坐标转换为 NDC
-    // inPosition 是窗口坐标（像素）
+    // inRect.xy 是窗口坐标（像素）
     // Vulkan NDC: Y向上（-1在底部，1在顶部）
     // 窗口坐标: Y向下（0在顶部，height在底部）
     // 所以需要翻转Y轴
-    vec2 normalized = inPosition / pc.screenSize;
+    vec2 position = inRect.xy + corner * inRect.zw;
+    vec2 normalized = position / pc.screenSize;
     vec2 ndcPos;
     ndcPos.x = normalized.x * 2.0 - 1.0;
     ndcPos.y = 1.0 - normalized.y * 2.0;  // 翻转 Y 轴
-    
     gl_Position = vec4(ndcPos, 0.0, 1.0);
-    // 不翻转纹理坐标，保持原样
-    fragTexCoord = inTexCoord;
+    
+    // 由单元索引在图集网格中定位字形（与 TextRenderer::GetGlyph 的单元排列一致）
+    uint slot = inGlyph & 0xFFFFu;
+    vec2 glyphSize = vec2(float((inGlyph >> 16) & 0xFFu), float(inGlyph >> 24));
+    uint cellInPage = slot % pc.cellsPerPage;
+    vec2 cellOrigin = vec2(uvec2(cellInPage % pc.cellsPerRow, cellInPage / pc.cellsPerRow) * pc.cellSize);
+    
+    // 由于Y轴翻转，四边形顶部对应纹理底部
+    vec2 texel = cellOrigin + vec2(corner.x, 1.0 - corner.y) * glyphSize;
+    fragTexCoord = texel / pc.atlasSize;
     fragColor = inColor;
+    fragPage = float(slot / pc.cellsPerPage);
 }
 
@@ -1,8 +1,13 @@
 #include "text/text_renderer.h"  // 1. 对应头文件
 
 #include <algorithm>  // 2. 系统头文件
+#include <atomic>     // 2. 系统头文件
+#include <chrono>     // 2. 系统头文件
 #include <cmath>      // 2. 系统头文件
+#include <cstdio>     // 2. 系统头文件
 #include <cstring>    // 2. 系统头文件
+#include <iterator>   // 2. 系统头文件
+#include <thread>     // 2. 系统头文件
 
 #include <vulkan/vulkan.h>  // 3. 第三方库头文件
 
@@ -10,9 +15,37 @@
 // 根据开发标准第15.1节，应优先使用接口或前向声明，但静态方法需要完整定义
 // 未来可考虑创建IShaderLoader接口和IErrorHandler接口以符合依赖注入原则
 #include "shader/shader_loader.h"  // 4. 项目头文件
+#include "vulkan/vulkan_memory_allocator.h"  // 4. 项目头文件
+#include "core/config/render_constants.h"  // 4. 项目头文件
+#include "core/utils/frame_tracer.h"  // 4. 项目头文件
+#include "text/distance_field.h"  // 4. 项目头文件
+#include "text/truetype_font_rasterizer.h"  // 4. 项目头文件
+#include "text/utf8.h"  // 4. 项目头文件
 #include "window/window.h"         // 4. 项目头文件
 
-TextRenderer::TextRenderer() {
+namespace {
+
+// 文字顶点着色器的推送常量（与 text.vert 的 PushConstants 一致）
+struct TextPushConstants {
+    float screenSize[2];    // 屏幕大小
+    float atlasSize[2];     // 图集单页尺寸（像素）
+    uint32_t cellSize[2];   // 图集单元尺寸（像素）
+    uint32_t cellsPerRow;
+    uint32_t cellsPerPage;
+};
+
+// 把归一化颜色打包为 RGBA8（R 在最低字节，对应 VK_FORMAT_R8G8B8A8_UNORM）
+uint32_t PackColor(float r, float g, float b, float a) {
+    auto toByte = [](float value) {
+        return (uint32_t)std::lround((std::min)((std::max)(value, 0.0f), 1.0f) * 255.0f);
+    };
+    return toByte(r) | (toByte(g) << 8) | (toByte(b) << 16) | (toByte(a) << 24);
+}
+
+} // namespace
+
+TextRenderer::TextRenderer()
+    : m_rasterizer(std::make_unique<TrueTypeFontRasterizer>()) {
 }
 
 TextRenderer::~TextRenderer() {
@@ -29,6 +62,10 @@ bool TextRenderer::Initialize(DeviceHandle device, PhysicalDeviceHandle physical
     m_graphicsQueue = graphicsQueue;
     m_renderPass = renderPass;
     
+    m_atlasWidth = config::TEXT_ATLAS_PAGE_SIZE;
+    m_atlasHeight = config::TEXT_ATLAS_PAGE_SIZE;
+    m_atlasPageCount = config::TEXT_ATLAS_PAGE_COUNT;
+    
     // 默认加载系统字体
     if (!LoadFont("Arial", 16)) {
         return false;
@@ -38,7 +75,11 @@ bool TextRenderer::Initialize(DeviceHandle device, PhysicalDeviceHandle physical
         return false;
     }
     
-    if (!CreateVulkanTexture(m_atlasData.data(), m_atlasWidth, m_atlasHeight)) {
+    if (!CreateVulkanTexture(m_atlasWidth, m_atlasHeight, m_atlasPageCount)) {
+        return false;
+    }
+    
+    if (!CreateUploadResources()) {
         return false;
     }
     
@@ -96,36 +137,45 @@ void TextRenderer::Cleanup() {
         m_textureImage = nullptr;
     }
     
-    if (m_textureImageMemory != nullptr) {
-        vkFreeMemory(vkDevice, static_cast<VkDeviceMemory>(m_textureImageMemory), nullptr);
-        m_textureImageMemory = nullptr;
-    }
+    VulkanMemoryAllocator::Release(m_memoryAllocator, vkDevice, m_textureImageAllocation);
     
-    if (m_vertexBuffer != nullptr) {
-        vkDestroyBuffer(vkDevice, static_cast<VkBuffer>(m_vertexBuffer), nullptr);
-        m_vertexBuffer = nullptr;
+    // 调用前设备已空闲，退役的图集纹理和顶点缓冲区也可以直接销毁
+    for (RetiredAtlasTexture& texture : m_retiredAtlasTextures) {
+        vkDestroyImageView(vkDevice, static_cast<VkImageView>(texture.imageView), nullptr);
+        vkDestroyImage(vkDevice, static_cast<VkImage>(texture.image), nullptr);
+        VulkanMemoryAllocator::Release(m_memoryAllocator, vkDevice, texture.allocation);
     }
-    
-    if (m_vertexBufferMemory != nullptr) {
-        vkFreeMemory(vkDevice, static_cast<VkDeviceMemory>(m_vertexBufferMemory), nullptr);
-        m_vertexBufferMemory = nullptr;
+    m_retiredAtlasTextures.clear();
+    m_atlasGrowthPending = false;
+    DestroyVertexRingBuffer(m_vertexRing);
+    for (VertexRingBuffer& ringBuffer : m_retiredVertexBuffers) {
+        DestroyVertexRingBuffer(ringBuffer);
     }
-    
-    // 清理 GDI 资源
-    if (m_hBitmap != nullptr) {
-        DeleteObject(m_hBitmap);
-        m_hBitmap = nullptr;
-    }
-    
-    if (m_hDC != nullptr) {
-        DeleteDC(m_hDC);
-        m_hDC = nullptr;
+    for (VertexRingBuffer& ringBuffer : m_freeVertexBuffers) {
+        DestroyVertexRingBuffer(ringBuffer);
     }
+    m_retiredVertexBuffers.clear();
+    m_freeVertexBuffers.clear();
+    m_vertexRingHead = 0;
     
-    if (m_hFont != nullptr) {
-        DeleteObject(m_hFont);
-        m_hFont = nullptr;
+    // 调用前设备已空闲，上传槽位的提交均已完成
+    VkCommandPool vkCommandPool = static_cast<VkCommandPool>(m_commandPool);
+    for (GlyphUploadSlot& slot : m_uploadSlots) {
+        if (slot.commandBuffer != nullptr) {
+            VkCommandBuffer vkCommandBuffer = static_cast<VkCommandBuffer>(slot.commandBuffer);
+            vkFreeCommandBuffers(vkDevice, vkCommandPool, 1, &vkCommandBuffer);
+        }
+        if (slot.fence != nullptr) {
+            vkDestroyFence(vkDevice, static_cast<VkFence>(slot.fence), nullptr);
+        }
+        if (slot.stagingBuffer != nullptr) {
+            vkDestroyBuffer(vkDevice, static_cast<VkBuffer>(slot.stagingBuffer), nullptr);
+        }
+        VulkanMemoryAllocator::Release(m_memoryAllocator, vkDevice, slot.stagingAllocation);
     }
+    m_uploadSlots.clear();
+    m_pendingUploads.clear();
+    m_pendingPixels.clear();
     
     m_initialized = false;
 }
@@ -133,78 +183,68 @@ void TextRenderer::Cleanup() {
 bool TextRenderer::LoadFont(const std::string& fontName, int fontSize) {
     m_fontName = fontName;
     m_fontSize = fontSize;
+    m_glyphScale = (float)fontSize / (float)config::TEXT_SDF_REFERENCE_SIZE;
     
-    // 清理旧的字体资源
-    if (m_hFont != nullptr) {
-        DeleteObject(m_hFont);
-        m_hFont = nullptr;
+    // 按基准字号加载字体（实际字号只影响绘制时的缩放）
+    if (!m_rasterizer->LoadFont(fontName, (int)config::TEXT_SDF_REFERENCE_SIZE)) {
+        return false;
     }
     
-    if (m_hDC != nullptr) {
-        DeleteDC(m_hDC);
-        m_hDC = nullptr;
-    }
+    FontMetrics metrics = m_rasterizer->GetMetrics();
+    m_ascent = metrics.ascent;
+    m_lineHeight = metrics.lineHeight;
     
-    if (m_hBitmap != nullptr) {
-        DeleteObject(m_hBitmap);
-        m_hBitmap = nullptr;
+    // 初始化之后改变字体：已缓存的字形属于旧字体，重建图集
+    if (m_initialized) {
+        return CreateFontAtlas();
     }
     
-    // 创建内存 DC
-    HDC hScreenDC = GetDC(nullptr);
-    m_hDC = CreateCompatibleDC(hScreenDC);
-    ReleaseDC(nullptr, hScreenDC);
-    
-    if (m_hDC == nullptr) {
+    return true;
+}
+
+bool TextRenderer::CreateFontAtlas() {
+    // 单元按当前字体的行高划分为正方形（可容纳全角字符），字体改变时整个图集重新分配
+    m_cellHeight = (uint32_t)std::ceil(m_lineHeight) + config::TEXT_SDF_SPREAD * 2;
+    m_cellWidth = m_cellHeight;
+    m_cellsPerRow = m_atlasWidth / m_cellWidth;
+    m_cellsPerPage = m_cellsPerRow * (m_atlasHeight / m_cellHeight);
+    if (m_cellsPerPage == 0) {
         return false;
     }
     
-    // 创建字体
-    m_hFont = CreateFontA(
-        -fontSize, 0, 0, 0,
-        FW_NORMAL,
-        FALSE, FALSE, FALSE,
-        DEFAULT_CHARSET,
-        OUT_DEFAULT_PRECIS,
-        CLIP_DEFAULT_PRECIS,
-        ANTIALIASED_QUALITY,
-        DEFAULT_PITCH | FF_DONTCARE,
-        fontName.c_str()
-    );
-    
-    if (m_hFont == nullptr) {
+    // 字形实例用 8 位保存单元内字形尺寸、16 位保存单元索引
+    if (m_cellHeight > 0xFF) {
+        printf("[TEXT] Glyph cell %u px exceeds the 255 px instance limit, reduce TEXT_SDF_REFERENCE_SIZE\n", m_cellHeight);
         return false;
     }
     
-    SelectObject(m_hDC, m_hFont);
-    SetTextColor(m_hDC, RGB(255, 255, 255));
-    SetBkColor(m_hDC, RGB(0, 0, 0));
-    SetBkMode(m_hDC, TRANSPARENT);
+    // 清空字形缓存和等待上传的字形，所有单元回到空闲列表（从单元 0 开始分配）
+    m_glyphs.Clear();
+    m_layoutCache.clear();
+    m_lruCells.clear();
+    m_pendingUploads.clear();
+    m_pendingPixels.clear();
     
-    // 获取字体度量
-    TEXTMETRICA tm;
-    GetTextMetricsA(m_hDC, &tm);
-    m_lineHeight = (float)tm.tmHeight;
+    uint32_t cellCount = (std::min)(m_cellsPerPage * m_atlasPageCount, 0x10000u);
+    m_atlasCells.assign(cellCount, AtlasCell());
+    m_freeCells.clear();
+    m_freeCells.reserve(cellCount);
+    for (uint32_t i = cellCount; i > 0; i--) {
+        m_freeCells.push_back(i - 1);
+    }
     
-    return true;
-}
-
-bool TextRenderer::CreateFontAtlas() {
-    // 清空字形缓存
-    m_glyphs.clear();
-    m_currentX = 0.0f;
-    m_currentY = 0.0f;
+    // 之前录制的文本顶点引用旧单元的纹理坐标
+    m_atlasVersion++;
     
-    // 初始化纹理图集数据（RGBA，初始为黑色透明）
-    m_atlasData.resize(m_atlasWidth * m_atlasHeight * 4, 0);
+    // 预渲染常用字符（ASCII 32-126）和常用界面文本中的中文字符，减少运行时字形创建开销
+    // 一次性并行光栅化整批字符，构建耗时输出到日志并记录为追踪阶段，便于对比
+    TraceScope trace("TextAtlasBuild");
+    auto buildStart = std::chrono::steady_clock::now();
     
-    // 预渲染常用字符（ASCII 32-126）
+    std::vector<uint32_t> preload;
     for (uint32_t c = 32; c <= 126; c++) {
-        GetGlyph(c);
+        preload.push_back(c);
     }
-    
-    // 预渲染中文字符（常用汉字）
-    // 预加载常用界面文本中的字符，减少运行时字形创建开销
     const uint32_t commonChinese[] = {
         0x52A0,  // 加
         0x8F7D,  // 载
@@ -215,171 +255,255 @@ bool TextRenderer::CreateFontAtlas() {
         0x5165,  // 入
         0x6587, 0x6D4B, 0x8BD5, 0x5B57, 0x7B26  // 文测试字符
     };
-    for (uint32_t c : commonChinese) {
-        GetGlyph(c);
-    }
+    preload.insert(preload.end(), std::begin(commonChinese), std::end(commonChinese));
+    PreloadGlyphs(preload);
+    
+    double buildMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - buildStart).count();
+    printf("[TEXT] Atlas build: %zu glyphs in %.2f ms\n", m_glyphs.Size(), buildMs);
     
     return true;
 }
 
-const TextRenderer::Glyph& TextRenderer::GetGlyph(uint32_t charCode) {
-    // 检查是否已缓存
-    auto it = m_glyphs.find(charCode);
-    if (it != m_glyphs.end()) {
-        return it->second;
+bool TextRenderer::AllocateAtlasSlot(uint32_t charCode, uint32_t& slot) {
+    // 所有单元都被占用时先增加一页，页数达到上限后才淘汰
+    if (m_freeCells.empty()) {
+        GrowAtlas();
     }
     
-    // 创建新字形
-    Glyph glyph;
-    glyph.charCode = charCode;
-    glyph.textureIndex = 0;
-    
-    // 获取字符尺寸
-    SIZE size;
-    wchar_t wchar = (wchar_t)charCode;
-    if (GetTextExtentPoint32W(m_hDC, &wchar, 1, &size) == 0) {
-        // 如果失败，尝试使用更可靠的方法
-        // 对于中文字符，可能需要使用不同的方法
-        ABCFLOAT abc;
-        if (GetCharABCWidthsFloatW(m_hDC, charCode, charCode, &abc)) {
-            size.cx = (int)(abc.abcfA + abc.abcfB + abc.abcfC);
-        } else {
-            // 如果还是失败，使用默认尺寸
-            size.cx = m_fontSize;
+    if (!m_freeCells.empty()) {
+        slot = m_freeCells.back();
+        m_freeCells.pop_back();
+    } else {
+        // 淘汰最久未使用的字形；本帧使用过的字形可能已写入顶点，不能淘汰
+        if (m_lruCells.empty() || m_atlasCells[m_lruCells.back()].lastUsedFrame == m_frameIndex) {
+            return false;
         }
-        size.cy = m_fontSize;
-    }
-    
-    int charWidth = size.cx;
-    int charHeight = size.cy;
-    
-    // 检查是否有足够空间
-    const int padding = 2;
-    if (m_currentX + charWidth + padding > m_atlasWidth) {
-        m_currentX = 0;
-        m_currentY += m_lineHeight + padding;
-        if (m_currentY + charHeight + padding > m_atlasHeight) {
-            // 图集已满，返回默认字形
-            glyph.x = 0.0f;
-            glyph.y = 0.0f;
-            glyph.width = 0.0f;
-            glyph.height = 0.0f;
-            glyph.advanceX = (float)charWidth;
-            glyph.offsetX = 0.0f;
-            glyph.offsetY = 0.0f;
-            m_glyphs[charCode] = glyph;
-            return m_glyphs[charCode];
+        slot = m_lruCells.back();
+        m_lruCells.pop_back();
+        m_glyphs.Erase(m_atlasCells[slot].charCode);
+        m_atlasVersion++;
+    }
+    
+    AtlasCell& cell = m_atlasCells[slot];
+    cell.charCode = charCode;
+    cell.lastUsedFrame = m_frameIndex;
+    m_lruCells.push_front(slot);
+    cell.lruPosition = m_lruCells.begin();
+    return true;
+}
+
+bool TextRenderer::GrowAtlas() {
+    // 新页的单元索引也要放得进字形实例的 16 位；复制在帧之间提交，每帧最多增长一次
+    uint32_t pageCount = m_atlasPageCount + 1;
+    if (pageCount > config::TEXT_ATLAS_MAX_PAGE_COUNT || m_cellsPerPage * pageCount > 0x10000u ||
+        m_atlasGrowthPending) {
+        return false;
+    }
+    
+    // 纹理创建之前（初始化时预渲染字符）只增加单元，CreateVulkanTexture 按增长后的页数创建
+    if (m_textureImage != nullptr) {
+        RetiredAtlasTexture previous;
+        previous.image = m_textureImage;
+        previous.allocation = m_textureImageAllocation;
+        previous.imageView = m_textureImageView;
+        previous.pageCount = m_atlasPageCount;
+        previous.retiredFrame = m_frameIndex;
+        
+        // 之后绑定的描述符集指向新纹理；本帧之前录制的绘制仍绑定旧描述符集，旧纹理保留到这些帧完成
+        void* descriptorSet = m_descriptorSet;
+        m_textureImage = nullptr;
+        m_textureImageAllocation = MemoryAllocation();
+        m_textureImageView = nullptr;
+        if (!CreateAtlasImage(m_atlasWidth, m_atlasHeight, pageCount, m_textureImage, m_textureImageAllocation,
+                              m_textureImageView) || !AllocateAtlasDescriptorSet()) {
+            // 创建失败时销毁新纹理已创建的部分，继续使用旧纹理（之后按原来的方式淘汰）
+            VkDevice vkDevice = static_cast<VkDevice>(m_device);
+            if (m_textureImageView != nullptr) {
+                vkDestroyImageView(vkDevice, static_cast<VkImageView>(m_textureImageView), nullptr);
+            }
+            if (m_textureImage != nullptr) {
+                vkDestroyImage(vkDevice, static_cast<VkImage>(m_textureImage), nullptr);
+            }
+            VulkanMemoryAllocator::Release(m_memoryAllocator, vkDevice, m_textureImageAllocation);
+            m_textureImage = previous.image;
+            m_textureImageAllocation = previous.allocation;
+            m_textureImageView = previous.imageView;
+            m_descriptorSet = descriptorSet;
+            return false;
         }
+        m_retiredAtlasTextures.push_back(previous);
+        m_atlasGrowthPending = true;
+        
+        // 已录制的命令缓冲区绑定旧描述符集
+        m_atlasVersion++;
     }
     
-    // 创建临时位图用于渲染字符
-    int tempWidth = charWidth + padding * 2;
-    int tempHeight = charHeight + padding * 2;
-    
-    HDC hTempDC = CreateCompatibleDC(m_hDC);
-    BITMAPINFO bmi = {};
-    bmi.bmiHeader.biSize = sizeof(BITMAPINFOHEADER);
-    bmi.bmiHeader.biWidth = tempWidth;
-    bmi.bmiHeader.biHeight = -tempHeight;  // 负值表示从上到下
-    bmi.bmiHeader.biPlanes = 1;
-    bmi.bmiHeader.biBitCount = 32;
-    bmi.bmiHeader.biCompression = BI_RGB;
-    
-    void* tempData = nullptr;
-    HBITMAP hTempBitmap = CreateDIBSection(hTempDC, &bmi, DIB_RGB_COLORS, &tempData, nullptr, 0);
-    if (hTempBitmap == nullptr) {
-        DeleteDC(hTempDC);
-        // 返回默认字形
-        glyph.x = 0.0f;
-        glyph.y = 0.0f;
-        glyph.width = 0.0f;
-        glyph.height = 0.0f;
-        glyph.advanceX = (float)charWidth;
-        glyph.offsetX = 0.0f;
-        glyph.offsetY = 0.0f;
-        m_glyphs[charCode] = glyph;
-        return m_glyphs[charCode];
-    }
-    
-    HBITMAP hOldBitmap = (HBITMAP)SelectObject(hTempDC, hTempBitmap);
-    SelectObject(hTempDC, m_hFont);
-    SetTextColor(hTempDC, RGB(255, 255, 255));
-    SetBkColor(hTempDC, RGB(0, 0, 0));
-    SetBkMode(hTempDC, TRANSPARENT);
-    
-    // 渲染字符（使用之前声明的 wchar）
-    TextOutW(hTempDC, padding, padding, &wchar, 1);
-    
-    // 获取字符的 ABC 宽度
-    ABC abc;
-    if (GetCharABCWidthsW(m_hDC, charCode, charCode, &abc)) {
-        glyph.offsetX = (float)abc.abcA;
-        glyph.advanceX = (float)(abc.abcA + abc.abcB + abc.abcC);
-    } else {
-        glyph.offsetX = 0.0f;
-        glyph.advanceX = (float)charWidth;
+    // 新页的单元加入空闲列表（从新页的第一个单元开始分配）
+    uint32_t firstCell = m_cellsPerPage * m_atlasPageCount;
+    uint32_t cellCount = m_cellsPerPage * pageCount;
+    m_atlasCells.resize(cellCount);
+    for (uint32_t i = cellCount; i > firstCell; i--) {
+        m_freeCells.push_back(i - 1);
+    }
+    m_atlasPageCount = pageCount;
+    printf("[TEXT] Atlas grown to %u pages\n", pageCount);
+    return true;
+}
+
+void TextRenderer::ReleaseRetiredAtlasTextures() {
+    // 与退役的顶点缓冲区相同：retiredFrame 及之前的提交完成后不再有命令引用旧纹理（复制尚未提交的除外）
+    VkDevice vkDevice = static_cast<VkDevice>(m_device);
+    for (size_t i = 0; i < m_retiredAtlasTextures.size();) {
+        RetiredAtlasTexture& texture = m_retiredAtlasTextures[i];
+        bool copySource = m_atlasGrowthPending && i + 1 == m_retiredAtlasTextures.size();
+        if (!copySource && texture.retiredFrame + config::MAX_FRAMES_IN_FLIGHT <= m_frameIndex) {
+            vkDestroyImageView(vkDevice, static_cast<VkImageView>(texture.imageView), nullptr);
+            vkDestroyImage(vkDevice, static_cast<VkImage>(texture.image), nullptr);
+            VulkanMemoryAllocator::Release(m_memoryAllocator, vkDevice, texture.allocation);
+            m_retiredAtlasTextures.erase(m_retiredAtlasTextures.begin() + i);
+        } else {
+            i++;
+        }
+    }
+}
+
+void TextRenderer::TouchAtlasSlot(uint32_t slot) {
+    AtlasCell& cell = m_atlasCells[slot];
+    cell.lastUsedFrame = m_frameIndex;
+    m_lruCells.splice(m_lruCells.begin(), m_lruCells, cell.lruPosition);
+}
+
+const TextRenderer::Glyph& TextRenderer::GetGlyph(uint32_t charCode) {
+    // 检查是否已缓存（命中时移到 LRU 链表头部）
+    if (Glyph* cached = m_glyphs.Find(charCode)) {
+        TouchAtlasSlot(cached->atlasSlot);
+        return *cached;
     }
     
-    // 获取字符基线偏移
-    TEXTMETRICA tm;
-    GetTextMetricsA(m_hDC, &tm);
-    glyph.offsetY = (float)tm.tmAscent;
+    // 创建新字形
+    GlyphBitmap bitmap;
+    PrepareGlyph(charCode, bitmap);
+    return InsertGlyph(bitmap);
+}
+
+void TextRenderer::PrepareGlyph(uint32_t charCode, GlyphBitmap& bitmap) const {
+    // 字符从 (padding, padding) 处绘制，超出单元的部分被裁剪；覆盖率原地替换为距离场
+    const uint32_t padding = config::TEXT_SDF_SPREAD;
+    if (!m_rasterizer->RasterizeGlyph(charCode, padding, m_cellWidth, m_cellHeight, bitmap)) {
+        bitmap = GlyphBitmap();
+        bitmap.charCode = charCode;
+        return;
+    }
     
-    // 复制到位图图集
-    // 注意：Windows DIB 使用 BGRA 格式，且 DIB_RGB_COLORS 创建的位图 alpha 通道为 0
-    // 由于文本是白色的，我们使用 R 通道（或任何颜色通道）的值作为 alpha
-    int atlasX = (int)m_currentX;
-    int atlasY = (int)m_currentY;
+    if (bitmap.width > 0 && bitmap.height > 0) {
+        std::vector<uint8_t> coverage = std::move(bitmap.pixels);
+        bitmap.pixels.resize(coverage.size());
+        BuildDistanceField(coverage.data(), bitmap.width, bitmap.height, (float)padding, bitmap.pixels.data());
+    }
+}
+
+void TextRenderer::PreloadGlyphs(const std::vector<uint32_t>& charCodes) {
+    // 只准备尚未缓存的字符（去重）
+    std::vector<uint32_t> missing;
+    for (uint32_t charCode : charCodes) {
+        if (m_glyphs.Find(charCode) == nullptr &&
+            std::find(missing.begin(), missing.end(), charCode) == missing.end()) {
+            missing.push_back(charCode);
+        }
+    }
+    if (missing.empty()) {
+        return;
+    }
     
-    for (int y = 0; y < tempHeight; y++) {
-        for (int x = 0; x < tempWidth; x++) {
-            int srcIdx = (y * tempWidth + x) * 4;
-            int dstIdx = ((atlasY + y) * m_atlasWidth + (atlasX + x)) * 4;
-            
-            if (dstIdx + 3 < (int)m_atlasData.size()) {
-                uint8_t* src = (uint8_t*)tempData + srcIdx;
-                // Windows DIB 格式：B, G, R, A (但 A 为 0)
-                uint8_t b = src[0];
-                uint8_t g = src[1];
-                uint8_t r = src[2];
-                // 使用 R 通道作为 alpha（因为文本是白色的）
-                uint8_t alpha = r;
-                
-                // 存储为 RGBA 格式
-                m_atlasData[dstIdx] = 255;     // R (白色)
-                m_atlasData[dstIdx + 1] = 255; // G (白色)
-                m_atlasData[dstIdx + 2] = 255; // B (白色)
-                m_atlasData[dstIdx + 3] = alpha; // A (从 R 通道提取)
+    // 光栅化和距离场在工作线程上并行生成（按原子索引取字符），图集单元分配和上传数据在当前线程按顺序写入
+    std::vector<GlyphBitmap> bitmaps(missing.size());
+    uint32_t workerCount = (std::min)(config::TEXT_RASTER_WORKER_COUNT, (std::max)(std::thread::hardware_concurrency(), 1u));
+    if (missing.size() < config::TEXT_RASTER_PARALLEL_MIN_GLYPHS || workerCount <= 1) {
+        for (size_t i = 0; i < missing.size(); i++) {
+            PrepareGlyph(missing[i], bitmaps[i]);
+        }
+    } else {
+        std::atomic<size_t> nextIndex(0);
+        auto worker = [&]() {
+            for (size_t i = nextIndex++; i < missing.size(); i = nextIndex++) {
+                PrepareGlyph(missing[i], bitmaps[i]);
             }
+        };
+        
+        // 当前线程也参与处理
+        std::vector<std::thread> threads;
+        for (uint32_t i = 1; i < workerCount; i++) {
+            threads.emplace_back(worker);
+        }
+        worker();
+        for (std::thread& thread : threads) {
+            thread.join();
         }
     }
     
-    // 设置字形信息
-    glyph.x = (float)atlasX / (float)m_atlasWidth;
-    glyph.y = (float)atlasY / (float)m_atlasHeight;
-    glyph.width = (float)tempWidth / (float)m_atlasWidth;
-    glyph.height = (float)tempHeight / (float)m_atlasHeight;
-    
-    // 更新当前位置
-    m_currentX += tempWidth;
+    for (const GlyphBitmap& bitmap : bitmaps) {
+        InsertGlyph(bitmap);
+    }
+}
+
+const TextRenderer::Glyph& TextRenderer::InsertGlyph(const GlyphBitmap& bitmap) {
+    // 四边形相对笔位置和基线的偏移包含距离场留白
+    const uint32_t padding = config::TEXT_SDF_SPREAD;
+    Glyph glyph = {};
+    glyph.charCode = bitmap.charCode;
+    glyph.advanceX = bitmap.advanceX;
+    glyph.offsetX = -(float)padding;
+    glyph.offsetY = m_ascent + (float)padding;
+    
+    // 无法光栅化或图集单元都被本帧使用时，本次不绘制该字形，只保留字符间距（不缓存，下次使用时重试）
+    m_overflowGlyph = glyph;
+    if (bitmap.width == 0 || bitmap.height == 0) {
+        return m_overflowGlyph;
+    }
+    
+    uint32_t slot = 0;
+    if (!AllocateAtlasSlot(bitmap.charCode, slot)) {
+        return m_overflowGlyph;
+    }
+    
+    // 单元位置：先按页，再按行优先排列
+    uint32_t page = slot / m_cellsPerPage;
+    uint32_t cellInPage = slot % m_cellsPerPage;
+    uint32_t cellX = (cellInPage % m_cellsPerRow) * m_cellWidth;
+    uint32_t cellY = (cellInPage / m_cellsPerRow) * m_cellHeight;
+    
+    // 整个单元写入等待上传的像素（字形之外为 0）；缓冲区偏移按 4 字节对齐以满足复制要求
+    PendingGlyphUpload upload;
+    upload.page = page;
+    upload.x = cellX;
+    upload.y = cellY;
+    upload.offset = (m_pendingPixels.size() + 3) & ~(size_t)3;
+    m_pendingPixels.resize(upload.offset + (size_t)m_cellWidth * m_cellHeight, 0);
+    m_pendingUploads.push_back(upload);
+    
+    uint8_t* dst = m_pendingPixels.data() + upload.offset;
+    for (uint32_t y = 0; y < bitmap.height; y++) {
+        memcpy(dst + (size_t)y * m_cellWidth, bitmap.pixels.data() + (size_t)y * bitmap.width, bitmap.width);
+    }
     
-    // 清理临时资源
-    SelectObject(hTempDC, hOldBitmap);
-    DeleteObject(hTempBitmap);
-    DeleteDC(hTempDC);
+    // 设置字形信息
+    glyph.x = (float)cellX / (float)m_atlasWidth;
+    glyph.y = (float)cellY / (float)m_atlasHeight;
+    glyph.width = (float)bitmap.width / (float)m_atlasWidth;
+    glyph.height = (float)bitmap.height / (float)m_atlasHeight;
+    glyph.textureIndex = (int)page;
+    glyph.atlasSlot = slot;
     
     // 缓存字形
-    m_glyphs[charCode] = glyph;
-    return m_glyphs[charCode];
+    return m_glyphs.Insert(bitmap.charCode, glyph);
 }
 
-bool TextRenderer::CreateVulkanTexture(const void* data, uint32_t width, uint32_t height) {
+bool TextRenderer::CreateAtlasImage(uint32_t width, uint32_t height, uint32_t pageCount,
+                                    void*& image, MemoryAllocation& allocation, void*& imageView) {
     // 将不透明指针转换为 Vulkan 类型
     VkDevice vkDevice = static_cast<VkDevice>(m_device);
-    VkCommandPool vkCommandPool = static_cast<VkCommandPool>(m_commandPool);
-    VkQueue vkGraphicsQueue = static_cast<VkQueue>(m_graphicsQueue);
     
-    // 创建图像
+    // 创建图像（单通道，每页一个数组层）
     VkImageCreateInfo imageInfo = {};
     imageInfo.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
     imageInfo.imageType = VK_IMAGE_TYPE_2D;
@@ -387,8 +511,8 @@ bool TextRenderer::CreateVulkanTexture(const void* data, uint32_t width, uint32_
     imageInfo.extent.height = height;
     imageInfo.extent.depth = 1;
     imageInfo.mipLevels = 1;
-    imageInfo.arrayLayers = 1;
-    imageInfo.format = VK_FORMAT_R8G8B8A8_UNORM;
+    imageInfo.arrayLayers = pageCount;
+    imageInfo.format = VK_FORMAT_R8_UNORM;
     imageInfo.tiling = VK_IMAGE_TILING_OPTIMAL;
     imageInfo.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
     imageInfo.usage = VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_SAMPLED_BIT;
@@ -400,67 +524,48 @@ bool TextRenderer::CreateVulkanTexture(const void* data, uint32_t width, uint32_
         Window::ShowError("Failed to create texture image!");
         return false;
     }
-    m_textureImage = vkTextureImage;
+    image = vkTextureImage;
     
     // 分配内存
-    VkMemoryRequirements memRequirements;
-    vkGetImageMemoryRequirements(vkDevice, vkTextureImage, &memRequirements);
-    
-    VkMemoryAllocateInfo allocInfo = {};
-    allocInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
-    allocInfo.allocationSize = memRequirements.size;
-    allocInfo.memoryTypeIndex = FindMemoryType(memRequirements.memoryTypeBits, 
-                                               VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
-    
-    VkDeviceMemory vkTextureImageMemory;
-    if (vkAllocateMemory(vkDevice, &allocInfo, nullptr, &vkTextureImageMemory) != VK_SUCCESS) {
+    VkPhysicalDevice vkPhysicalDevice = static_cast<VkPhysicalDevice>(m_physicalDevice);
+    if (!VulkanMemoryAllocator::AllocateImage(m_memoryAllocator, vkDevice, vkPhysicalDevice, vkTextureImage,
+                                              MemoryPropertyFlag::DeviceLocal, allocation)) {
         Window::ShowError("Failed to allocate texture image memory!");
         return false;
     }
-    m_textureImageMemory = vkTextureImageMemory;
     
-    vkBindImageMemory(vkDevice, vkTextureImage, vkTextureImageMemory, 0);
-    
-    // 创建暂存缓冲区并上传数据
-    VkDeviceSize imageSize = width * height * 4;
-    
-    VkBuffer stagingBuffer;
-    VkDeviceMemory stagingBufferMemory;
-    
-    VkBufferCreateInfo bufferInfo = {};
-    bufferInfo.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
-    bufferInfo.size = imageSize;
-    bufferInfo.usage = VK_BUFFER_USAGE_TRANSFER_SRC_BIT;
-    bufferInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+    // 创建图像视图
+    VkImageViewCreateInfo viewInfo = {};
+    viewInfo.sType = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO;
+    viewInfo.image = vkTextureImage;
+    viewInfo.viewType = VK_IMAGE_VIEW_TYPE_2D_ARRAY;
+    viewInfo.format = VK_FORMAT_R8_UNORM;
+    viewInfo.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+    viewInfo.subresourceRange.baseMipLevel = 0;
+    viewInfo.subresourceRange.levelCount = 1;
+    viewInfo.subresourceRange.baseArrayLayer = 0;
+    viewInfo.subresourceRange.layerCount = pageCount;
     
-    if (vkCreateBuffer(vkDevice, &bufferInfo, nullptr, &stagingBuffer) != VK_SUCCESS) {
-        Window::ShowError("Failed to create staging buffer!");
+    VkImageView vkTextureImageView;
+    if (vkCreateImageView(vkDevice, &viewInfo, nullptr, &vkTextureImageView) != VK_SUCCESS) {
+        Window::ShowError("Failed to create texture image view!");
         return false;
     }
+    imageView = vkTextureImageView;
     
-    VkMemoryRequirements stagingMemReq;
-    vkGetBufferMemoryRequirements(vkDevice, stagingBuffer, &stagingMemReq);
-    
-    VkMemoryAllocateInfo stagingAllocInfo = {};
-    stagingAllocInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
-    stagingAllocInfo.allocationSize = stagingMemReq.size;
-    stagingAllocInfo.memoryTypeIndex = FindMemoryType(stagingMemReq.memoryTypeBits,
-                                                      VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | 
-                                                      VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
+    return true;
+}
+
+bool TextRenderer::CreateVulkanTexture(uint32_t width, uint32_t height, uint32_t pageCount) {
+    // 将不透明指针转换为 Vulkan 类型
+    VkDevice vkDevice = static_cast<VkDevice>(m_device);
+    VkCommandPool vkCommandPool = static_cast<VkCommandPool>(m_commandPool);
+    VkQueue vkGraphicsQueue = static_cast<VkQueue>(m_graphicsQueue);
     
-    if (vkAllocateMemory(vkDevice, &stagingAllocInfo, nullptr, &stagingBufferMemory) != VK_SUCCESS) {
-        vkDestroyBuffer(vkDevice, stagingBuffer, nullptr);
-        Window::ShowError("Failed to allocate staging buffer memory!");
+    if (!CreateAtlasImage(width, height, pageCount, m_textureImage, m_textureImageAllocation, m_textureImageView)) {
         return false;
     }
-    
-    vkBindBufferMemory(vkDevice, stagingBuffer, stagingBufferMemory, 0);
-    
-    // 复制数据到暂存缓冲区
-    void* mappedData;
-    vkMapMemory(vkDevice, stagingBufferMemory, 0, imageSize, 0, &mappedData);
-    memcpy(mappedData, data, imageSize);
-    vkUnmapMemory(vkDevice, stagingBufferMemory);
+    VkImage vkTextureImage = static_cast<VkImage>(m_textureImage);
     
     // 创建命令缓冲区
     VkCommandBufferAllocateInfo allocCmdInfo = {};
@@ -490,7 +595,7 @@ bool TextRenderer::CreateVulkanTexture(const void* data, uint32_t width, uint32_
     barrier.subresourceRange.baseMipLevel = 0;
     barrier.subresourceRange.levelCount = 1;
     barrier.subresourceRange.baseArrayLayer = 0;
-    barrier.subresourceRange.layerCount = 1;
+    barrier.subresourceRange.layerCount = pageCount;
     barrier.srcAccessMask = 0;
     barrier.dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
     
@@ -499,20 +604,10 @@ bool TextRenderer::CreateVulkanTexture(const void* data, uint32_t width, uint32_
                          VK_PIPELINE_STAGE_TRANSFER_BIT,
                          0, 0, nullptr, 0, nullptr, 1, &barrier);
     
-    // 复制缓冲区到图像
-    VkBufferImageCopy region = {};
-    region.bufferOffset = 0;
-    region.bufferRowLength = 0;
-    region.bufferImageHeight = 0;
-    region.imageSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
-    region.imageSubresource.mipLevel = 0;
-    region.imageSubresource.baseArrayLayer = 0;
-    region.imageSubresource.layerCount = 1;
-    region.imageOffset = {0, 0, 0};
-    region.imageExtent = {width, height, 1};
-    
-    vkCmdCopyBufferToImage(commandBuffer, stagingBuffer, vkTextureImage, 
-                          VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &region);
+    // 所有页清零，字形由 FlushGlyphUploads 按单元增量上传
+    VkClearColorValue clearValue = {};
+    vkCmdClearColorImage(commandBuffer, vkTextureImage, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+                         &clearValue, 1, &barrier.subresourceRange);
     
     // 转换图像布局为着色器读取
     barrier.oldLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
@@ -538,29 +633,6 @@ bool TextRenderer::CreateVulkanTexture(const void* data, uint32_t width, uint32_
     
     vkFreeCommandBuffers(vkDevice, vkCommandPool, 1, &commandBuffer);
     
-    // 清理暂存缓冲区
-    vkDestroyBuffer(vkDevice, stagingBuffer, nullptr);
-    vkFreeMemory(vkDevice, stagingBufferMemory, nullptr);
-    
-    // 创建图像视图
-    VkImageViewCreateInfo viewInfo = {};
-    viewInfo.sType = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO;
-    viewInfo.image = vkTextureImage;
-    viewInfo.viewType = VK_IMAGE_VIEW_TYPE_2D;
-    viewInfo.format = VK_FORMAT_R8G8B8A8_UNORM;
-    viewInfo.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
-    viewInfo.subresourceRange.baseMipLevel = 0;
-    viewInfo.subresourceRange.levelCount = 1;
-    viewInfo.subresourceRange.baseArrayLayer = 0;
-    viewInfo.subresourceRange.layerCount = 1;
-    
-    VkImageView vkTextureImageView;
-    if (vkCreateImageView(vkDevice, &viewInfo, nullptr, &vkTextureImageView) != VK_SUCCESS) {
-        Window::ShowError("Failed to create texture image view!");
-        return false;
-    }
-    m_textureImageView = vkTextureImageView;
-    
     // 创建采样器
     VkSamplerCreateInfo samplerInfo = {};
     samplerInfo.sType = VK_STRUCTURE_TYPE_SAMPLER_CREATE_INFO;
@@ -590,6 +662,44 @@ bool TextRenderer::CreateVulkanTexture(const void* data, uint32_t width, uint32_
     return true;
 }
 
+bool TextRenderer::AllocateAtlasDescriptorSet() {
+    // 将不透明指针转换为 Vulkan 类型
+    VkDevice vkDevice = static_cast<VkDevice>(m_device);
+    VkDescriptorSetLayout vkDescriptorSetLayout = static_cast<VkDescriptorSetLayout>(m_descriptorSetLayout);
+    
+    // 分配描述符集
+    VkDescriptorSetAllocateInfo allocInfo = {};
+    allocInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
+    allocInfo.descriptorPool = static_cast<VkDescriptorPool>(m_descriptorPool);
+    allocInfo.descriptorSetCount = 1;
+    allocInfo.pSetLayouts = &vkDescriptorSetLayout;
+    
+    VkDescriptorSet vkDescriptorSet;
+    if (vkAllocateDescriptorSets(vkDevice, &allocInfo, &vkDescriptorSet) != VK_SUCCESS) {
+        Window::ShowError("Failed to allocate descriptor set!");
+        return false;
+    }
+    m_descriptorSet = vkDescriptorSet;
+    
+    // 更新描述符集
+    VkDescriptorImageInfo imageInfo = {};
+    imageInfo.imageLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+    imageInfo.imageView = static_cast<VkImageView>(m_textureImageView);
+    imageInfo.sampler = static_cast<VkSampler>(m_textureSampler);
+    
+    VkWriteDescriptorSet descriptorWrite = {};
+    descriptorWrite.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+    descriptorWrite.dstSet = vkDescriptorSet;
+    descriptorWrite.dstBinding = 0;
+    descriptorWrite.dstArrayElement = 0;
+    descriptorWrite.descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+    descriptorWrite.descriptorCount = 1;
+    descriptorWrite.pImageInfo = &imageInfo;
+    
+    vkUpdateDescriptorSets(vkDevice, 1, &descriptorWrite, 0, nullptr);
+    return true;
+}
+
 bool TextRenderer::CreatePipeline(void* renderPass) {
     // 将不透明指针转换为 Vulkan 类型
     VkRenderPass vkRenderPass = static_cast<VkRenderPass>(renderPass);
@@ -614,16 +724,16 @@ bool TextRenderer::CreatePipeline(void* renderPass) {
     }
     m_descriptorSetLayout = vkDescriptorSetLayout;
     
-    // 创建描述符池
+    // 创建描述符池（每个图集页数一个描述符集，增长时不更新已提交的帧仍在使用的描述符集）
     VkDescriptorPoolSize poolSize = {};
     poolSize.type = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
-    poolSize.descriptorCount = 1;
+    poolSize.descriptorCount = config::TEXT_ATLAS_MAX_PAGE_COUNT;
     
     VkDescriptorPoolCreateInfo poolInfo = {};
     poolInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
     poolInfo.poolSizeCount = 1;
     poolInfo.pPoolSizes = &poolSize;
-    poolInfo.maxSets = 1;
+    poolInfo.maxSets = config::TEXT_ATLAS_MAX_PAGE_COUNT;
     
     VkDescriptorPool vkDescriptorPool;
     if (vkCreateDescriptorPool(vkDevice, &poolInfo, nullptr, &vkDescriptorPool) != VK_SUCCESS) {
@@ -632,54 +742,13 @@ bool TextRenderer::CreatePipeline(void* renderPass) {
     }
     m_descriptorPool = vkDescriptorPool;
     
-    // 分配描述符集
-    VkDescriptorSetAllocateInfo allocInfo = {};
-    allocInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
-    allocInfo.descriptorPool = vkDescriptorPool;
-    allocInfo.descriptorSetCount = 1;
-    allocInfo.pSetLayouts = &vkDescriptorSetLayout;
-    
-    VkDescriptorSet vkDescriptorSet;
-    if (vkAllocateDescriptorSets(vkDevice, &allocInfo, &vkDescriptorSet) != VK_SUCCESS) {
-        Window::ShowError("Failed to allocate descriptor set!");
+    if (!AllocateAtlasDescriptorSet()) {
         return false;
     }
-    m_descriptorSet = vkDescriptorSet;
-    
-    // 更新描述符集
-    VkDescriptorImageInfo imageInfo = {};
-    imageInfo.imageLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
-    imageInfo.imageView = static_cast<VkImageView>(m_textureImageView);
-    imageInfo.sampler = static_cast<VkSampler>(m_textureSampler);
-    
-    VkWriteDescriptorSet descriptorWrite = {};
-    descriptorWrite.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
-    descriptorWrite.dstSet = vkDescriptorSet;
-    descriptorWrite.dstBinding = 0;
-    descriptorWrite.dstArrayElement = 0;
-    descriptorWrite.descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
-    descriptorWrite.descriptorCount = 1;
-    descriptorWrite.pImageInfo = &imageInfo;
     
-    vkUpdateDescriptorSets(vkDevice, 1, &descriptorWrite, 0, nullptr);
-    
-    // 加载 shader（优先尝试加载 SPIR-V 文件，如果不存在则尝试编译 GLSL）
-    std::vector<char> vertShaderCode;
-    std::vector<char> fragShaderCode;
-    
-    // 尝试加载 SPIR-V 文件
-    vertShaderCode = renderer::shader::ShaderLoader::LoadSPIRV("renderer/text/text.vert.spv");
-    fragShaderCode = renderer::shader::ShaderLoader::LoadSPIRV("renderer/text/text.frag.spv");
-    
-    // 如果 SPIR-V 文件不存在，尝试编译 GLSL
-    if (vertShaderCode.empty()) {
-        vertShaderCode = renderer::shader::ShaderLoader::CompileGLSLFromFile(
-            "renderer/text/text.vert", ShaderStage::Vertex);
-    }
-    if (fragShaderCode.empty()) {
-        fragShaderCode = renderer::shader::ShaderLoader::CompileGLSLFromFile(
-            "renderer/text/text.frag", ShaderStage::Fragment);
-    }
+    // 加载 shader（SPIR-V 文件不存在时由 ShaderLoader 编译同名 GLSL 源码）
+    std::vector<char> vertShaderCode = renderer::shader::ShaderLoader::LoadShaderCode("renderer/text/text.vert.spv", ShaderStage::Vertex);
+    std::vector<char> fragShaderCode = renderer::shader::ShaderLoader::LoadShaderCode("renderer/text/text.frag.spv", ShaderStage::Fragment);
     
     if (vertShaderCode.empty() || fragShaderCode.empty()) {
         Window::ShowError("Failed to load text shaders! Make sure renderer/text/text.vert.spv and renderer/text/text.frag.spv exist, or shaderc is available.");
@@ -715,26 +784,27 @@ bool TextRenderer::CreatePipeline(void* renderPass) {
     VkPipelineShaderStageCreateInfo shaderStages[] = {vertShaderStageInfo, fragShaderStageInfo};
     
     // 顶点输入
+    // 每个字形一条实例记录，四边形的 6 个顶点由顶点着色器按 gl_VertexIndex 展开
     VkVertexInputBindingDescription bindingDescription = {};
     bindingDescription.binding = 0;
-    bindingDescription.stride = sizeof(TextVertex);
-    bindingDescription.inputRate = VK_VERTEX_INPUT_RATE_VERTEX;
+    bindingDescription.stride = sizeof(GlyphInstance);
+    bindingDescription.inputRate = VK_VERTEX_INPUT_RATE_INSTANCE;
     
     VkVertexInputAttributeDescription attributeDescriptions[3] = {};
     attributeDescriptions[0].binding = 0;
     attributeDescriptions[0].location = 0;
-    attributeDescriptions[0].format = VK_FORMAT_R32G32_SFLOAT;
-    attributeDescriptions[0].offset = offsetof(TextVertex, x);
+    attributeDescriptions[0].format = VK_FORMAT_R32G32B32A32_SFLOAT;
+    attributeDescriptions[0].offset = offsetof(GlyphInstance, x);
     
     attributeDescriptions[1].binding = 0;
     attributeDescriptions[1].location = 1;
-    attributeDescriptions[1].format = VK_FORMAT_R32G32_SFLOAT;
-    attributeDescriptions[1].offset = offsetof(TextVertex, u);
+    attributeDescriptions[1].format = VK_FORMAT_R32_UINT;
+    attributeDescriptions[1].offset = offsetof(GlyphInstance, glyph);
     
     attributeDescriptions[2].binding = 0;
     attributeDescriptions[2].location = 2;
-    attributeDescriptions[2].format = VK_FORMAT_R32G32B32A32_SFLOAT;
-    attributeDescriptions[2].offset = offsetof(TextVertex, r);
+    attributeDescriptions[2].format = VK_FORMAT_R8G8B8A8_UNORM;
+    attributeDescriptions[2].offset = offsetof(GlyphInstance, color);
     
     VkPipelineVertexInputStateCreateInfo vertexInputInfo = {};
     vertexInputInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO;
@@ -822,7 +892,7 @@ bool TextRenderer::CreatePipeline(void* renderPass) {
     VkPushConstantRange pushConstantRange = {};
     pushConstantRange.stageFlags = VK_SHADER_STAGE_VERTEX_BIT;
     pushConstantRange.offset = 0;
-    pushConstantRange.size = sizeof(float) * 2; // screenSize (vec2)
+    pushConstantRange.size = sizeof(TextPushConstants);
     
     // 创建管线布局
     VkPipelineLayoutCreateInfo pipelineLayoutInfo = {};
@@ -860,7 +930,7 @@ bool TextRenderer::CreatePipeline(void* renderPass) {
     pipelineInfo.basePipelineHandle = VK_NULL_HANDLE;
     
     VkPipeline vkGraphicsPipeline;
-    if (vkCreateGraphicsPipelines(vkDevice, VK_NULL_HANDLE, 1, &pipelineInfo, nullptr, &vkGraphicsPipeline) != VK_SUCCESS) {
+    if (vkCreateGraphicsPipelines(vkDevice, static_cast<VkPipelineCache>(m_pipelineCache), 1, &pipelineInfo, nullptr, &vkGraphicsPipeline) != VK_SUCCESS) {
         Window::ShowError("Failed to create graphics pipeline!");
         vkDestroyPipelineLayout(vkDevice, vkPipelineLayout, nullptr);
         vkDestroyShaderModule(vkDevice, fragShaderModule, nullptr);
@@ -876,66 +946,416 @@ bool TextRenderer::CreatePipeline(void* renderPass) {
     return true;
 }
 
-uint32_t TextRenderer::FindMemoryType(uint32_t typeFilter, uint32_t properties) {
-    VkPhysicalDeviceMemoryProperties memProperties;
-    VkPhysicalDevice vkPhysicalDevice = static_cast<VkPhysicalDevice>(m_physicalDevice);
-    vkGetPhysicalDeviceMemoryProperties(vkPhysicalDevice, &memProperties);
-    
-    for (uint32_t i = 0; i < memProperties.memoryTypeCount; i++) {
-        if ((typeFilter & (1 << i)) && 
-            (memProperties.memoryTypes[i].propertyFlags & properties) == properties) {
-            return i;
-        }
+bool TextRenderer::CreateVertexBuffer() {
+    if (!CreateVertexRingBuffer(config::TEXT_GLYPH_RING_INITIAL_INSTANCES, m_vertexRing)) {
+        Window::ShowError("Failed to create vertex buffer!");
+        return false;
     }
     
-    Window::ShowError("Failed to find suitable memory type!");
-    return 0;
+    m_vertexRingHead = 0;
+    m_vertexRingStartFrame = m_frameIndex;
+    return true;
 }
 
-bool TextRenderer::CreateVertexBuffer() {
+bool TextRenderer::CreateVertexRingBuffer(uint32_t capacity, VertexRingBuffer& ringBuffer) {
     // 将不透明指针转换为 Vulkan 类型
     VkDevice vkDevice = static_cast<VkDevice>(m_device);
     
-    // 创建动态顶点缓冲区（可以动态更新）
-    VkDeviceSize bufferSize = sizeof(TextVertex) * 1000; // 最多支持 1000 个字符（每个字符 6 个顶点）
-    
     VkBufferCreateInfo bufferInfo = {};
     bufferInfo.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
-    bufferInfo.size = bufferSize;
-    bufferInfo.usage = VK_BUFFER_USAGE_VERTEX_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT;
+    bufferInfo.size = sizeof(GlyphInstance) * (VkDeviceSize)capacity;
+    bufferInfo.usage = VK_BUFFER_USAGE_VERTEX_BUFFER_BIT;
     bufferInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
     
     VkBuffer vkVertexBuffer;
     if (vkCreateBuffer(vkDevice, &bufferInfo, nullptr, &vkVertexBuffer) != VK_SUCCESS) {
-        Window::ShowError("Failed to create vertex buffer!");
         return false;
     }
-    m_vertexBuffer = vkVertexBuffer;
     
-    VkMemoryRequirements memRequirements;
-    vkGetBufferMemoryRequirements(vkDevice, vkVertexBuffer, &memRequirements);
+    // 顶点缓冲区每帧写入，从分配器获得持久映射内存，避免每次 vkMapMemory/vkUnmapMemory
+    MemoryAllocation allocation;
+    if (!VulkanMemoryAllocator::AllocateBuffer(m_memoryAllocator, vkDevice, static_cast<VkPhysicalDevice>(m_physicalDevice),
+                                               vkVertexBuffer, MemoryPropertyFlag::HostVisible | MemoryPropertyFlag::HostCoherent,
+                                               allocation)) {
+        vkDestroyBuffer(vkDevice, vkVertexBuffer, nullptr);
+        return false;
+    }
+    
+    ringBuffer.buffer = vkVertexBuffer;
+    ringBuffer.allocation = allocation;
+    ringBuffer.capacity = capacity;
+    ringBuffer.retiredFrame = 0;
+    return true;
+}
+
+void TextRenderer::DestroyVertexRingBuffer(VertexRingBuffer& ringBuffer) {
+    // 将不透明指针转换为 Vulkan 类型
+    VkDevice vkDevice = static_cast<VkDevice>(m_device);
+    
+    if (ringBuffer.buffer != nullptr) {
+        vkDestroyBuffer(vkDevice, static_cast<VkBuffer>(ringBuffer.buffer), nullptr);
+        ringBuffer.buffer = nullptr;
+    }
+    VulkanMemoryAllocator::Release(m_memoryAllocator, vkDevice, ringBuffer.allocation);
+    ringBuffer.capacity = 0;
+}
+
+bool TextRenderer::WriteGlyphInstances(const GlyphInstance* instances, uint32_t count, uint32_t& firstInstance) {
+    if (m_vertexRing.buffer == nullptr) {
+        return false;
+    }
+    
+    if (count > m_vertexRing.capacity - m_vertexRingHead) {
+        // 当前缓冲区写满：不到 MAX_FRAMES_IN_FLIGHT 帧就写满时退役的缓冲区来不及回收，容量翻倍
+        uint32_t capacity = m_vertexRing.capacity;
+        if (m_frameIndex - m_vertexRingStartFrame < config::MAX_FRAMES_IN_FLIGHT) {
+            capacity *= 2;
+        }
+        while (capacity < count) {
+            capacity *= 2;
+        }
+        
+        // 优先使用容量足够的空闲缓冲区，容量不足的空闲缓冲区不会再被使用
+        VertexRingBuffer next;
+        for (VertexRingBuffer& ringBuffer : m_freeVertexBuffers) {
+            if (next.buffer == nullptr && ringBuffer.capacity >= capacity) {
+                next = ringBuffer;
+            } else {
+                DestroyVertexRingBuffer(ringBuffer);
+            }
+        }
+        m_freeVertexBuffers.clear();
+        
+        if (next.buffer == nullptr && !CreateVertexRingBuffer(capacity, next)) {
+            printf("[TEXT] Failed to grow text vertex buffer to %u glyphs\n", capacity);
+            return false;
+        }
+        
+        m_vertexRing.retiredFrame = m_frameIndex;
+        m_retiredVertexBuffers.push_back(m_vertexRing);
+        m_vertexRing = next;
+        m_vertexRingHead = 0;
+        m_vertexRingStartFrame = m_frameIndex;
+        m_vertexRingVersion++;
+    }
+    
+    VkDevice vkDevice = static_cast<VkDevice>(m_device);
+    VulkanMemoryAllocator::Write(vkDevice, m_vertexRing.allocation, instances, sizeof(GlyphInstance) * (VkDeviceSize)count,
+                                 sizeof(GlyphInstance) * (VkDeviceSize)m_vertexRingHead);
+    firstInstance = m_vertexRingHead;
+    m_vertexRingHead += count;
+    return true;
+}
+
+void TextRenderer::RecycleVertexBuffers() {
+    // 帧 F 结束时渲染器已等待过帧 F - MAX_FRAMES_IN_FLIGHT 的栅栏；
+    // 退役后不再录制引用它的命令（版本递增后全部重新录制），所以 retiredFrame 及之前的提交完成后即可复用
+    for (size_t i = 0; i < m_retiredVertexBuffers.size();) {
+        if (m_retiredVertexBuffers[i].retiredFrame + config::MAX_FRAMES_IN_FLIGHT <= m_frameIndex) {
+            m_freeVertexBuffers.push_back(m_retiredVertexBuffers[i]);
+            m_retiredVertexBuffers.erase(m_retiredVertexBuffers.begin() + i);
+        } else {
+            i++;
+        }
+    }
+}
+
+bool TextRenderer::CreateUploadResources() {
+    // 将不透明指针转换为 Vulkan 类型
+    VkDevice vkDevice = static_cast<VkDevice>(m_device);
+    VkCommandPool vkCommandPool = static_cast<VkCommandPool>(m_commandPool);
+    
+    m_uploadSlots.resize(config::MAX_FRAMES_IN_FLIGHT);
+    for (uint32_t i = 0; i < (uint32_t)m_uploadSlots.size(); i++) {
+        GlyphUploadSlot& slot = m_uploadSlots[i];
+        
+        VkCommandBufferAllocateInfo allocInfo = {};
+        allocInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+        allocInfo.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+        allocInfo.commandPool = vkCommandPool;
+        allocInfo.commandBufferCount = 1;
+        
+        VkCommandBuffer vkCommandBuffer;
+        if (vkAllocateCommandBuffers(vkDevice, &allocInfo, &vkCommandBuffer) != VK_SUCCESS) {
+            Window::ShowError("Failed to allocate glyph upload command buffer!");
+            return false;
+        }
+        slot.commandBuffer = vkCommandBuffer;
+        
+        // 初始为已触发状态，第一次使用时不等待
+        VkFenceCreateInfo fenceInfo = {};
+        fenceInfo.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+        fenceInfo.flags = VK_FENCE_CREATE_SIGNALED_BIT;
+        
+        VkFence vkFence;
+        if (vkCreateFence(vkDevice, &fenceInfo, nullptr, &vkFence) != VK_SUCCESS) {
+            Window::ShowError("Failed to create glyph upload fence!");
+            return false;
+        }
+        slot.fence = vkFence;
+        
+        if (!EnsureStagingCapacity(i, config::TEXT_ATLAS_UPLOAD_BUFFER_SIZE)) {
+            Window::ShowError("Failed to create glyph staging buffer!");
+            return false;
+        }
+    }
+    
+    return true;
+}
+
+bool TextRenderer::EnsureStagingCapacity(uint32_t slotIndex, uint64_t size) {
+    GlyphUploadSlot& slot = m_uploadSlots[slotIndex];
+    if (slot.stagingBuffer != nullptr && slot.stagingSize >= size) {
+        return true;
+    }
+    
+    // 将不透明指针转换为 Vulkan 类型
+    VkDevice vkDevice = static_cast<VkDevice>(m_device);
+    
+    if (slot.stagingBuffer != nullptr) {
+        vkDestroyBuffer(vkDevice, static_cast<VkBuffer>(slot.stagingBuffer), nullptr);
+        slot.stagingBuffer = nullptr;
+        slot.stagingSize = 0;
+    }
+    VulkanMemoryAllocator::Release(m_memoryAllocator, vkDevice, slot.stagingAllocation);
     
-    VkMemoryAllocateInfo allocInfo = {};
-    allocInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
-    allocInfo.allocationSize = memRequirements.size;
-    allocInfo.memoryTypeIndex = FindMemoryType(memRequirements.memoryTypeBits,
-                                               VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | 
-                                               VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
+    // 一次性加载大量字形（例如切换字号后的首帧）时超出默认大小，按需增长
+    uint64_t capacity = (std::max)((uint64_t)config::TEXT_ATLAS_UPLOAD_BUFFER_SIZE, size);
     
-    VkDeviceMemory vkVertexBufferMemory;
-    if (vkAllocateMemory(vkDevice, &allocInfo, nullptr, &vkVertexBufferMemory) != VK_SUCCESS) {
-        Window::ShowError("Failed to allocate vertex buffer memory!");
+    VkBufferCreateInfo bufferInfo = {};
+    bufferInfo.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+    bufferInfo.size = capacity;
+    bufferInfo.usage = VK_BUFFER_USAGE_TRANSFER_SRC_BIT;
+    bufferInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+    
+    VkBuffer vkStagingBuffer;
+    if (vkCreateBuffer(vkDevice, &bufferInfo, nullptr, &vkStagingBuffer) != VK_SUCCESS) {
         return false;
     }
-    m_vertexBufferMemory = vkVertexBufferMemory;
     
-    vkBindBufferMemory(vkDevice, vkVertexBuffer, vkVertexBufferMemory, 0);
+    if (!VulkanMemoryAllocator::AllocateBuffer(m_memoryAllocator, vkDevice, static_cast<VkPhysicalDevice>(m_physicalDevice),
+                                               vkStagingBuffer, MemoryPropertyFlag::HostVisible | MemoryPropertyFlag::HostCoherent,
+                                               slot.stagingAllocation)) {
+        vkDestroyBuffer(vkDevice, vkStagingBuffer, nullptr);
+        return false;
+    }
     
+    slot.stagingBuffer = vkStagingBuffer;
+    slot.stagingSize = capacity;
     return true;
 }
 
+void TextRenderer::FlushGlyphUploads() {
+    if (!m_initialized) {
+        return;
+    }
+    
+    // 之后的字形使用计入新的一帧（本帧使用过的字形从下一帧起可以被淘汰）
+    RecycleVertexBuffers();
+    TrimLayoutCache();
+    m_frameIndex++;
+    ReleaseRetiredAtlasTextures();
+    if (m_pendingUploads.empty() && !m_atlasGrowthPending) {
+        return;
+    }
+    
+    TraceScope traceScope("TextGlyphUpload");
+    
+    // 将不透明指针转换为 Vulkan 类型
+    VkDevice vkDevice = static_cast<VkDevice>(m_device);
+    VkQueue vkGraphicsQueue = static_cast<VkQueue>(m_graphicsQueue);
+    VkImage vkTextureImage = static_cast<VkImage>(m_textureImage);
+    
+    // 该槽位上次的提交在 MAX_FRAMES_IN_FLIGHT 帧之前，通常早已完成
+    uint32_t slotIndex = m_uploadSlotIndex;
+    m_uploadSlotIndex = (m_uploadSlotIndex + 1) % (uint32_t)m_uploadSlots.size();
+    GlyphUploadSlot& slot = m_uploadSlots[slotIndex];
+    VkFence vkFence = static_cast<VkFence>(slot.fence);
+    vkWaitForFences(vkDevice, 1, &vkFence, VK_TRUE, UINT64_MAX);
+    
+    // 暂存缓冲区创建失败时保留等待上传的字形，下一帧重试（图集增长的复制仍然提交，新纹理本帧就会被采样）
+    bool uploadGlyphs = !m_pendingUploads.empty();
+    if (uploadGlyphs && !EnsureStagingCapacity(slotIndex, m_pendingPixels.size())) {
+        printf("[TEXT] Failed to grow glyph staging buffer to %zu bytes\n", m_pendingPixels.size());
+        uploadGlyphs = false;
+    }
+    if (!uploadGlyphs && !m_atlasGrowthPending) {
+        return;
+    }
+    if (uploadGlyphs) {
+        VulkanMemoryAllocator::Write(vkDevice, slot.stagingAllocation, m_pendingPixels.data(), m_pendingPixels.size());
+    }
+    
+    VkCommandBuffer vkCommandBuffer = static_cast<VkCommandBuffer>(slot.commandBuffer);
+    vkResetCommandBuffer(vkCommandBuffer, 0);
+    
+    VkCommandBufferBeginInfo beginInfo = {};
+    beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+    beginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+    vkBeginCommandBuffer(vkCommandBuffer, &beginInfo);
+    
+    // 之前提交的帧可能仍在采样被淘汰字形的单元：等待其片段着色器读取完成后再写入
+    VkImageMemoryBarrier barrier = {};
+    barrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+    barrier.oldLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+    barrier.newLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+    barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    barrier.image = vkTextureImage;
+    barrier.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+    barrier.subresourceRange.baseMipLevel = 0;
+    barrier.subresourceRange.levelCount = 1;
+    barrier.subresourceRange.baseArrayLayer = 0;
+    barrier.subresourceRange.layerCount = m_atlasPageCount;
+    barrier.srcAccessMask = 0;
+    barrier.dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+    
+    // 图集刚增长时新纹理的布局转换和已有页的复制由 RecordAtlasGrowth 完成
+    if (m_atlasGrowthPending) {
+        RecordAtlasGrowth(vkCommandBuffer);
+    } else {
+        vkCmdPipelineBarrier(vkCommandBuffer,
+                             VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT,
+                             VK_PIPELINE_STAGE_TRANSFER_BIT,
+                             0, 0, nullptr, 0, nullptr, 1, &barrier);
+    }
+    
+    // 每个新字形一个单元大小的子矩形，合并为一次复制命令
+    std::vector<VkBufferImageCopy> regions(uploadGlyphs ? m_pendingUploads.size() : 0);
+    for (size_t i = 0; i < m_pendingUploads.size(); i++) {
+        const PendingGlyphUpload& upload = m_pendingUploads[i];
+        VkBufferImageCopy& region = regions[i];
+        region.bufferOffset = upload.offset;
+        region.bufferRowLength = 0;
+        region.bufferImageHeight = 0;
+        region.imageSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+        region.imageSubresource.mipLevel = 0;
+        region.imageSubresource.baseArrayLayer = upload.page;
+        region.imageSubresource.layerCount = 1;
+        region.imageOffset = {(int32_t)upload.x, (int32_t)upload.y, 0};
+        region.imageExtent = {m_cellWidth, m_cellHeight, 1};
+    }
+    
+    if (!regions.empty()) {
+        vkCmdCopyBufferToImage(vkCommandBuffer, static_cast<VkBuffer>(slot.stagingBuffer), vkTextureImage,
+                               VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, (uint32_t)regions.size(), regions.data());
+    }
+    
+    // 转换图像布局为着色器读取（对之后提交的帧可见）
+    barrier.oldLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+    barrier.newLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+    barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+    barrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
+    
+    vkCmdPipelineBarrier(vkCommandBuffer,
+                         VK_PIPELINE_STAGE_TRANSFER_BIT,
+                         VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT,
+                         0, 0, nullptr, 0, nullptr, 1, &barrier);
+    
+    vkEndCommandBuffer(vkCommandBuffer);
+    
+    VkSubmitInfo submitInfo = {};
+    submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+    submitInfo.commandBufferCount = 1;
+    submitInfo.pCommandBuffers = &vkCommandBuffer;
+    
+    vkResetFences(vkDevice, 1, &vkFence);
+    if (vkQueueSubmit(vkGraphicsQueue, 1, &submitInfo, vkFence) != VK_SUCCESS) {
+        printf("[TEXT] Failed to submit glyph uploads\n");
+        return;
+    }
+    
+    m_atlasGrowthPending = false;
+    if (uploadGlyphs) {
+        m_pendingUploads.clear();
+        m_pendingPixels.clear();
+    }
+}
+
+void TextRenderer::RecordAtlasGrowth(void* commandBuffer) {
+    // 将不透明指针转换为 Vulkan 类型
+    VkCommandBuffer vkCommandBuffer = static_cast<VkCommandBuffer>(commandBuffer);
+    const RetiredAtlasTexture& source = m_retiredAtlasTextures.back();
+    VkImage vkSourceImage = static_cast<VkImage>(source.image);
+    VkImage vkTextureImage = static_cast<VkImage>(m_textureImage);
+    
+    // 新纹理的所有页准备写入；旧纹理等待之前提交的帧读取完成后转为复制源
+    VkImageMemoryBarrier barriers[2] = {};
+    for (VkImageMemoryBarrier& barrier : barriers) {
+        barrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+        barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        barrier.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+        barrier.subresourceRange.baseMipLevel = 0;
+        barrier.subresourceRange.levelCount = 1;
+        barrier.subresourceRange.baseArrayLayer = 0;
+    }
+    barriers[0].image = vkTextureImage;
+    barriers[0].subresourceRange.layerCount = m_atlasPageCount;
+    barriers[0].oldLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+    barriers[0].newLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+    barriers[0].srcAccessMask = 0;
+    barriers[0].dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+    barriers[1].image = vkSourceImage;
+    barriers[1].subresourceRange.layerCount = source.pageCount;
+    barriers[1].oldLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+    barriers[1].newLayout = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+    barriers[1].srcAccessMask = 0;
+    barriers[1].dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
+    
+    vkCmdPipelineBarrier(vkCommandBuffer,
+                         VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT,
+                         VK_PIPELINE_STAGE_TRANSFER_BIT,
+                         0, 0, nullptr, 0, nullptr, 2, barriers);
+    
+    // 已有的页整页复制，新增的页清零
+    VkImageCopy region = {};
+    region.srcSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+    region.srcSubresource.mipLevel = 0;
+    region.srcSubresource.baseArrayLayer = 0;
+    region.srcSubresource.layerCount = source.pageCount;
+    region.dstSubresource = region.srcSubresource;
+    region.extent = {m_atlasWidth, m_atlasHeight, 1};
+    vkCmdCopyImage(vkCommandBuffer, vkSourceImage, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
+                   vkTextureImage, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &region);
+    
+    VkImageSubresourceRange newPages = barriers[0].subresourceRange;
+    newPages.baseArrayLayer = source.pageCount;
+    newPages.layerCount = m_atlasPageCount - source.pageCount;
+    VkClearColorValue clearValue = {};
+    vkCmdClearColorImage(vkCommandBuffer, vkTextureImage, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+                         &clearValue, 1, &newPages);
+    
+    // 之后的字形上传写入刚清零的页；本帧先前录制的绘制仍在采样旧纹理，复制后转回着色器读取
+    barriers[0].oldLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+    barriers[0].srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+    barriers[1].oldLayout = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+    barriers[1].newLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+    barriers[1].srcAccessMask = 0;
+    barriers[1].dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
+    
+    vkCmdPipelineBarrier(vkCommandBuffer,
+                         VK_PIPELINE_STAGE_TRANSFER_BIT,
+                         VK_PIPELINE_STAGE_TRANSFER_BIT | VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT,
+                         0, 0, nullptr, 0, nullptr, 2, barriers);
+}
+
+void TextRenderer::TrimLayoutCache() {
+    // 超过上限时丢弃本帧未使用的排版（例如每帧变化的 FPS 文本留下的旧字符串）
+    if (m_layoutCache.size() <= config::TEXT_LAYOUT_CACHE_SIZE) {
+        return;
+    }
+    for (auto it = m_layoutCache.begin(); it != m_layoutCache.end();) {
+        if (it->second.lastUsedFrame != m_frameIndex) {
+            it = m_layoutCache.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
 void TextRenderer::BeginTextBatch() {
-    m_batchVertices.clear();
+    m_batchGlyphs.clear();
     m_textBlocks.clear();
     m_inBatchMode = true;
 }
@@ -957,23 +1377,21 @@ void TextRenderer::AddTextCenteredToBatch(const std::string& text, float centerX
     
     // 记录文本块的起始索引和中心点
     TextBlockInfo blockInfo;
-    blockInfo.startIndex = m_batchVertices.size();
+    blockInfo.startIndex = m_batchGlyphs.size();
     
-    // 获取文字尺寸
-    float textWidth = 0.0f, textHeight = 0.0f;
-    GetTextSize(text, textWidth, textHeight);
+    // 获取缓存的排版（尺寸、居中偏移和字形四边形只查找一次）
+    TextLayout& layout = GetTextLayout(text);
     
     // 计算文字左上角坐标
-    float textCenterOffset = GetTextCenterOffset(text);
-    float textX = centerX - textWidth / 2.0f;
-    float textY = centerY + textCenterOffset;
+    float textX = centerX - layout.width / 2.0f;
+    float textY = centerY + layout.centerOffset;
     
     // 添加到批次（注意：这里的Y坐标会被AppendVerticesToBuffer翻转）
     float flippedY = screenHeight - textY;
-    AppendVerticesToBuffer(text, textX, flippedY, r, g, b, a);
+    AppendLayoutToBuffer(layout, textX, flippedY, r, g, b, a);
     
     // 记录文本块的结束索引
-    blockInfo.endIndex = m_batchVertices.size();
+    blockInfo.endIndex = m_batchGlyphs.size();
     
     // 记录文本块的中心点（使用翻转后的坐标，与顶点坐标系统一致）
     // 顶点坐标是翻转后的坐标系统
@@ -991,94 +1409,129 @@ void TextRenderer::AddTextCenteredToBatch(const std::string& text, float centerX
 void TextRenderer::EndTextBatch(CommandBufferHandle commandBuffer, float screenWidth, float screenHeight,
                                 float viewportX, float viewportY,
                                 float scaleX, float scaleY) {
-    if (m_batchVertices.empty()) return;
+    if (m_batchGlyphs.empty()) return;
     
     // 将抽象句柄转换为 Vulkan 类型
     VkCommandBuffer vkCommandBuffer = static_cast<VkCommandBuffer>(commandBuffer);
     FlushBatch(vkCommandBuffer, screenWidth, screenHeight, viewportX, viewportY, scaleX, scaleY);
 }
 
-void TextRenderer::AppendVerticesToBuffer(const std::string& text, float x, float y, 
-                                          float r, float g, float b, float a) {
-    // 注意：这里传入的y已经是翻转后的坐标（flippedY = screenHeight - y）
-    // 所以currentY是翻转后的Y坐标，字符位置计算需要考虑这一点
+TextRenderer::TextLayout& TextRenderer::GetTextLayout(const std::string& text) {
+    TextLayout& layout = m_layoutCache[text];
+    layout.lastUsedFrame = m_frameIndex;
     
-    std::vector<TextVertex> vertices;
-    float currentX = x;
-    float currentY = y;  // 这是翻转后的Y坐标
+    // 字形被淘汰、图集重建或字号改变后重新排版（纹理坐标和度量可能已变化）
+    if (layout.atlasVersion != m_atlasVersion) {
+        BuildTextLayout(text, layout);
+    } else {
+        // 未经过 GetGlyph 的字形也要标记为本帧使用，避免在本帧内被淘汰
+        for (uint32_t slot : layout.atlasSlots) {
+            TouchAtlasSlot(slot);
+        }
+    }
+    return layout;
+}
+
+void TextRenderer::BuildTextLayout(const std::string& text, TextLayout& layout) {
+    // 实例以笔起点 (0, 0) 为原点（翻转后的Y坐标），颜色在放置时写入
+    std::vector<GlyphInstance>& instances = layout.instances;
+    instances.clear();
+    layout.atlasSlots.clear();
+    layout.placedValid = false;
+    layout.width = 0.0f;
+    layout.height = m_lineHeight * m_glyphScale;
+    layout.centerOffset = 0.0f;
     
-    // 将 UTF-8 字符串转换为宽字符
-    int wlen = MultiByteToWideChar(CP_UTF8, 0, text.c_str(), -1, nullptr, 0);
-    if (wlen <= 0) return;
+    float currentX = 0.0f;
+    float currentY = 0.0f;
     
-    std::vector<wchar_t> wtext(wlen);
-    MultiByteToWideChar(CP_UTF8, 0, text.c_str(), -1, wtext.data(), wlen);
+    // 将 UTF-8 字符串解码为码位
+    std::vector<uint32_t> codePoints = DecodeUtf8(text);
+    if (codePoints.empty()) {
+        layout.atlasVersion = m_atlasVersion;
+        return;
+    }
     
-    // 为每个字符创建两个三角形（6 个顶点）
-    for (int i = 0; i < wlen - 1; i++) { // -1 因为末尾有 null terminator
-        wchar_t wchar = wtext[i];
-        const Glyph& glyph = GetGlyph((uint32_t)wchar);
+    // 先批量准备尚未缓存的字形（新字符较多时并行光栅化）
+    PreloadGlyphs(codePoints);
+    
+    // 为每个字符创建一个字形实例
+    for (uint32_t charCode : codePoints) {
+        const Glyph& glyph = GetGlyph(charCode);
         
         if (glyph.width == 0.0f || glyph.height == 0.0f) {
             // 跳过无效字符，使用advanceX保持字符间距
-            currentX += glyph.advanceX;
+            currentX += glyph.advanceX * m_glyphScale;
             continue;
         }
         
-        // 计算字符的屏幕位置
-        float charX = currentX + glyph.offsetX;
+        // 计算字符的屏幕位置（字形度量为基准字号下的像素，按当前字号缩放）
         // 注意：currentY是传入的y坐标（窗口坐标，Y向下）
         // offsetY是字符基线偏移（正值表示字符在基线上方）
         // 所以 charY = currentY - offsetY 表示字符顶部位置
-        // 但是，由于shader会翻转Y轴，我们需要确保字符位置正确
-        float charY = currentY - glyph.offsetY;
-        float charWidth = glyph.width * m_atlasWidth;
-        float charHeight = glyph.height * m_atlasHeight;
-        
-        // 纹理坐标：位图是负高度（从上到下），但复制到图集时也是从上到下
-        // 所以纹理坐标不需要翻转，glyph.y 是顶部，glyph.y + glyph.height 是底部
-        // 但是由于 shader 翻转了 Y 轴，我们需要确保顶点顺序正确
-        float texU1 = glyph.x;
-        float texV1 = glyph.y;  // 纹理顶部
-        float texU2 = glyph.x + glyph.width;
-        float texV2 = glyph.y + glyph.height;  // 纹理底部
+        float charX = currentX + glyph.offsetX * m_glyphScale;
+        float charY = currentY - glyph.offsetY * m_glyphScale;
         
-        // 创建两个三角形（矩形）
-        // 由于 shader 翻转了 Y 轴，窗口坐标 Y=0（顶部）映射到 NDC y=1（顶部）
-        // 所以需要交换纹理坐标的V值：窗口顶部对应纹理底部，窗口底部对应纹理顶部
-        // 管线使用 COUNTER_CLOCKWISE，所以需要逆时针顺序
-        // 第一个三角形（逆时针：左上 -> 右上 -> 右下）
-        TextVertex v1 = {charX, charY, texU1, texV2, r, g, b, a};  // 左上，纹理底部（因为Y轴翻转）
-        TextVertex v2 = {charX + charWidth, charY, texU2, texV2, r, g, b, a};  // 右上，纹理底部
-        TextVertex v3 = {charX + charWidth, charY + charHeight, texU2, texV1, r, g, b, a};  // 右下，纹理顶部
-        vertices.push_back(v1);
-        vertices.push_back(v2);
-        vertices.push_back(v3);
+        // 字形在图集单元内的像素尺寸（纹理坐标由顶点着色器根据单元索引和该尺寸计算）
+        uint32_t glyphWidth = (uint32_t)std::lround(glyph.width * m_atlasWidth);
+        uint32_t glyphHeight = (uint32_t)std::lround(glyph.height * m_atlasHeight);
         
-        // 第二个三角形（逆时针：左上 -> 右下 -> 左下）
-        TextVertex v4 = {charX, charY, texU1, texV2, r, g, b, a};  // 左上，纹理底部
-        TextVertex v5 = {charX + charWidth, charY + charHeight, texU2, texV1, r, g, b, a};  // 右下，纹理顶部
-        TextVertex v6 = {charX, charY + charHeight, texU1, texV1, r, g, b, a};  // 左下，纹理顶部
-        vertices.push_back(v4);
-        vertices.push_back(v5);
-        vertices.push_back(v6);
+        GlyphInstance instance;
+        instance.x = charX;
+        instance.y = charY;
+        instance.width = glyphWidth * m_glyphScale;
+        instance.height = glyphHeight * m_glyphScale;
+        instance.glyph = (glyph.atlasSlot & 0xFFFF) | ((glyphWidth & 0xFF) << 16) | ((glyphHeight & 0xFF) << 24);
+        instance.color = 0;
+        instances.push_back(instance);
+        layout.atlasSlots.push_back(glyph.atlasSlot);
         
-        currentX += glyph.advanceX;
+        currentX += glyph.advanceX * m_glyphScale;
     }
     
-    // 将顶点追加到批次列表中
-    for (const auto& v : vertices) {
-        m_batchVertices.push_back(v);
+    MeasureTextLayout(codePoints, layout);
+    
+    // 排版过程中创建新字形可能淘汰其他字形，记录排版完成后的图集版本（本帧使用过的字形不会被淘汰）
+    layout.atlasVersion = m_atlasVersion;
+}
+
+void TextRenderer::AppendVerticesToBuffer(const std::string& text, float x, float y, 
+                                          float r, float g, float b, float a) {
+    // 注意：这里传入的y已经是翻转后的坐标（flippedY = screenHeight - y）
+    // 所以currentY是翻转后的Y坐标，字符位置计算需要考虑这一点
+    AppendLayoutToBuffer(GetTextLayout(text), x, y, r, g, b, a);
+}
+
+void TextRenderer::AppendLayoutToBuffer(TextLayout& layout, float x, float y,
+                                        float r, float g, float b, float a) {
+    // 位置和颜色与上次相同时直接复制上次放置的实例（静态标签每帧只需一次复制）
+    uint32_t color = PackColor(r, g, b, a);
+    if (!layout.placedValid || layout.placedX != x || layout.placedY != y || layout.placedColor != color) {
+        layout.placed.resize(layout.instances.size());
+        for (size_t i = 0; i < layout.instances.size(); i++) {
+            GlyphInstance instance = layout.instances[i];
+            instance.x += x;
+            instance.y += y;
+            instance.color = color;
+            layout.placed[i] = instance;
+        }
+        layout.placedX = x;
+        layout.placedY = y;
+        layout.placedColor = color;
+        layout.placedValid = true;
     }
+    
+    m_batchGlyphs.insert(m_batchGlyphs.end(), layout.placed.begin(), layout.placed.end());
 }
 
 void TextRenderer::FlushBatch(void* commandBuffer, float screenWidth, float screenHeight,
                               float viewportX, float viewportY,
                               float scaleX, float scaleY) {
+    TraceScope traceScope("TextFlushBatch");
+    
     // 将不透明指针转换为 Vulkan 类型
     VkCommandBuffer vkCommandBuffer = static_cast<VkCommandBuffer>(commandBuffer);
-    VkDevice vkDevice = static_cast<VkDevice>(m_device);
-    if (m_batchVertices.empty() || !m_initialized) {
+    if (m_batchGlyphs.empty() || !m_initialized) {
         return;
     }
     
@@ -1110,15 +1563,17 @@ void TextRenderer::FlushBatch(void* commandBuffer, float screenWidth, float scre
             // 这样字符的位置（包括字间距）和字符大小都会被正确缩放
             // 每个文本块独立缩放，不会相互影响
             for (size_t i = block.startIndex; i < block.endIndex; i++) {
-                auto& v = m_batchVertices[i];
-                // 计算相对于文本块中心点的偏移
-                float offsetX = v.x - centerX;
-                float offsetY = v.y - centerY;
+                auto& instance = m_batchGlyphs[i];
+                // 计算四边形左上角相对于文本块中心点的偏移
+                float offsetX = instance.x - centerX;
+                float offsetY = instance.y - centerY;
                 
                 // 应用缩放，保持文本块中心点不变
                 // 这样字符的位置和大小都会被缩放，包括字间距
-                v.x = centerX + offsetX * uniformScale;
-                v.y = centerY + offsetY * uniformScale;
+                instance.x = centerX + offsetX * uniformScale;
+                instance.y = centerY + offsetY * uniformScale;
+                instance.width *= uniformScale;
+                instance.height *= uniformScale;
             }
         }
     }
@@ -1127,24 +1582,55 @@ void TextRenderer::FlushBatch(void* commandBuffer, float screenWidth, float scre
     if (viewportX != 0.0f || viewportY != 0.0f) {
         // 注意：在Fit模式下，由于使用窗口大小作为screenSize，viewport偏移应该为0
         // 这里保留逻辑以防万一，但正常情况下不应该执行
-        for (auto& vertex : m_batchVertices) {
-            vertex.x -= viewportX;
-            vertex.y -= viewportY;
+        for (auto& instance : m_batchGlyphs) {
+            instance.x -= viewportX;
+            instance.y -= viewportY;
         }
     }
     
-    // 上传所有累积的顶点到GPU
-    if (!m_batchVertices.empty()) {
-        void* data;
-        size_t bufferSize = sizeof(TextVertex) * m_batchVertices.size();
-        VkDeviceMemory vkVertexBufferMemory = static_cast<VkDeviceMemory>(m_vertexBufferMemory);
-        vkMapMemory(vkDevice, vkVertexBufferMemory, 0, bufferSize, 0, &data);
-        memcpy(data, m_batchVertices.data(), bufferSize);
-        vkUnmapMemory(vkDevice, vkVertexBufferMemory);
+    // 把所有累积的字形实例追加到环形缓冲区（不覆盖本帧和之前录制的绘制引用的实例）
+    uint32_t firstInstance = 0;
+    uint32_t instanceCount = (uint32_t)m_batchGlyphs.size();
+    if (!WriteGlyphInstances(m_batchGlyphs.data(), instanceCount, firstInstance)) {
+        m_batchGlyphs.clear();
+        m_textBlocks.clear();
+        m_inBatchMode = false;
+        return;
     }
     
-    // 设置viewport和scissor（使用传入的screenSize）
     // 在Fit模式下，Button::RenderText使用窗口大小，所以这里也使用窗口大小
+    BindTextPipeline(vkCommandBuffer, screenWidth, screenHeight);
+    
+    // 绘制所有字形（每个实例 6 个顶点）
+    vkCmdDraw(vkCommandBuffer, 6, instanceCount, 0, firstInstance);
+    
+    // 清空批次，准备下一帧
+    m_batchGlyphs.clear();
+    m_textBlocks.clear();
+    m_inBatchMode = false;
+}
+
+bool TextRenderer::UpdateVertexBuffer(const std::string& text, float x, float y, 
+                                     float r, float g, float b, float a,
+                                     uint32_t& firstInstance, uint32_t& instanceCount) {
+    // 注意：这里传入的y已经是翻转后的坐标（flippedY = screenHeight - y）
+    // 所以currentY是翻转后的Y坐标，字符位置计算需要考虑这一点
+    
+    // 使用AppendVerticesToBuffer生成字形实例，然后立即追加到环形缓冲区
+    AppendVerticesToBuffer(text, x, y, r, g, b, a);
+    
+    // 空白字符不生成实例，绘制数量以实际生成的实例为准
+    instanceCount = (uint32_t)m_batchGlyphs.size();
+    bool written = instanceCount > 0 && WriteGlyphInstances(m_batchGlyphs.data(), instanceCount, firstInstance);
+    m_batchGlyphs.clear();
+    return written;
+}
+
+void TextRenderer::BindTextPipeline(void* commandBuffer, float screenWidth, float screenHeight) {
+    // 将不透明指针转换为 Vulkan 类型
+    VkCommandBuffer vkCommandBuffer = static_cast<VkCommandBuffer>(commandBuffer);
+    
+    // 设置全屏viewport和scissor，确保文本不被裁剪
     VkViewport viewport = {};
     viewport.x = 0.0f;
     viewport.y = 0.0f;
@@ -1161,7 +1647,7 @@ void TextRenderer::FlushBatch(void* commandBuffer, float screenWidth, float scre
     VkPipeline vkGraphicsPipeline = static_cast<VkPipeline>(m_graphicsPipeline);
     vkCmdBindPipeline(vkCommandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, vkGraphicsPipeline);
     
-    // 设置viewport和scissor
+    // 设置viewport和scissor（必须在绑定管线之后设置，因为它们是动态状态）
     vkCmdSetViewport(vkCommandBuffer, 0, 1, &viewport);
     vkCmdSetScissor(vkCommandBuffer, 0, 1, &scissor);
     
@@ -1171,47 +1657,24 @@ void TextRenderer::FlushBatch(void* commandBuffer, float screenWidth, float scre
     vkCmdBindDescriptorSets(vkCommandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, 
                            vkPipelineLayout, 0, 1, &vkDescriptorSet, 0, nullptr);
     
-    // 设置 push constants（屏幕大小）
-    float screenSize[2] = {screenWidth, screenHeight};
+    // 设置 push constants（屏幕大小和图集单元网格，顶点着色器据此计算纹理坐标）
+    TextPushConstants pushConstants = {};
+    pushConstants.screenSize[0] = screenWidth;
+    pushConstants.screenSize[1] = screenHeight;
+    pushConstants.atlasSize[0] = (float)m_atlasWidth;
+    pushConstants.atlasSize[1] = (float)m_atlasHeight;
+    pushConstants.cellSize[0] = m_cellWidth;
+    pushConstants.cellSize[1] = m_cellHeight;
+    pushConstants.cellsPerRow = m_cellsPerRow;
+    pushConstants.cellsPerPage = m_cellsPerPage;
     vkCmdPushConstants(vkCommandBuffer, vkPipelineLayout, VK_SHADER_STAGE_VERTEX_BIT, 
-                       0, sizeof(float) * 2, screenSize);
+                       0, sizeof(pushConstants), &pushConstants);
     
-    // 绑定顶点缓冲区
-    VkBuffer vkVertexBuffer = static_cast<VkBuffer>(m_vertexBuffer);
+    // 绑定顶点缓冲区（写入实例的缓冲区，实例从 firstInstance 开始）
+    VkBuffer vkVertexBuffer = static_cast<VkBuffer>(m_vertexRing.buffer);
     VkBuffer vertexBuffers[] = {vkVertexBuffer};
     VkDeviceSize offsets[] = {0};
     vkCmdBindVertexBuffers(vkCommandBuffer, 0, 1, vertexBuffers, offsets);
-    
-    // 绘制所有顶点
-    vkCmdDraw(vkCommandBuffer, (uint32_t)m_batchVertices.size(), 1, 0, 0);
-    
-    // 清空批次，准备下一帧
-    m_batchVertices.clear();
-    m_textBlocks.clear();
-    m_inBatchMode = false;
-}
-
-void TextRenderer::UpdateVertexBuffer(const std::string& text, float x, float y, 
-                                     float r, float g, float b, float a) {
-    // 注意：这里传入的y已经是翻转后的坐标（flippedY = screenHeight - y）
-    // 所以currentY是翻转后的Y坐标，字符位置计算需要考虑这一点
-    
-    // 使用AppendVerticesToBuffer生成顶点，然后立即上传到GPU（覆盖模式）
-    AppendVerticesToBuffer(text, x, y, r, g, b, a);
-    
-    // 立即上传到GPU并清空批次（覆盖模式）
-    if (!m_batchVertices.empty()) {
-        // 将不透明指针转换为 Vulkan 类型
-        VkDevice vkDevice = static_cast<VkDevice>(m_device);
-        VkDeviceMemory vkVertexBufferMemory = static_cast<VkDeviceMemory>(m_vertexBufferMemory);
-        
-        void* data;
-        size_t bufferSize = sizeof(TextVertex) * m_batchVertices.size();
-        vkMapMemory(vkDevice, vkVertexBufferMemory, 0, bufferSize, 0, &data);
-        memcpy(data, m_batchVertices.data(), bufferSize);
-        vkUnmapMemory(vkDevice, vkVertexBufferMemory);
-        m_batchVertices.clear();
-    }
 }
 
 void TextRenderer::RenderText(CommandBufferHandle commandBuffer, const std::string& text, 
@@ -1234,55 +1697,15 @@ void TextRenderer::RenderText(CommandBufferHandle commandBuffer, const std::stri
         return;
     }
     
-    // 设置全屏viewport和scissor，确保文本不被裁剪
-    // 注意：viewport和scissor应该在绑定管线之前设置，但这里在绑定管线之后设置也可以
-    // 因为viewport和scissor是动态状态，可以在任何时候设置
-    VkViewport viewport = {};
-    viewport.x = 0.0f;
-    viewport.y = 0.0f;
-    viewport.width = screenWidth;
-    viewport.height = screenHeight;
-    viewport.minDepth = 0.0f;
-    viewport.maxDepth = 1.0f;
-    
-    VkRect2D scissor = {};
-    scissor.offset = {0, 0};
-    scissor.extent = {(uint32_t)screenWidth, (uint32_t)screenHeight};
-    
     // 更新顶点缓冲区
-    UpdateVertexBuffer(text, x, flippedY, r, g, b, a);
-    
-    // 绑定管线
-    VkPipeline vkGraphicsPipeline = static_cast<VkPipeline>(m_graphicsPipeline);
-    vkCmdBindPipeline(vkCommandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, vkGraphicsPipeline);
-    
-    // 设置viewport和scissor（必须在绑定管线之后设置，因为它们是动态状态）
-    vkCmdSetViewport(vkCommandBuffer, 0, 1, &viewport);
-    vkCmdSetScissor(vkCommandBuffer, 0, 1, &scissor);
-    
-    // 绑定描述符集
-    VkPipelineLayout vkPipelineLayout = static_cast<VkPipelineLayout>(m_pipelineLayout);
-    VkDescriptorSet vkDescriptorSet = static_cast<VkDescriptorSet>(m_descriptorSet);
-    vkCmdBindDescriptorSets(vkCommandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, 
-                           vkPipelineLayout, 0, 1, &vkDescriptorSet, 0, nullptr);
-    
-    // 设置 push constants（屏幕大小）
-    float screenSize[2] = {screenWidth, screenHeight};
-    vkCmdPushConstants(vkCommandBuffer, vkPipelineLayout, VK_SHADER_STAGE_VERTEX_BIT, 
-                       0, sizeof(float) * 2, screenSize);
-    
-    // 绑定顶点缓冲区
-    VkBuffer vkVertexBuffer = static_cast<VkBuffer>(m_vertexBuffer);
-    VkBuffer vertexBuffers[] = {vkVertexBuffer};
-    VkDeviceSize offsets[] = {0};
-    vkCmdBindVertexBuffers(vkCommandBuffer, 0, 1, vertexBuffers, offsets);
-    
-    // 计算顶点数量（每个字符 6 个顶点）
-    int wlen = MultiByteToWideChar(CP_UTF8, 0, text.c_str(), -1, nullptr, 0);
-    if (wlen > 0) {
-        int vertexCount = (wlen - 1) * 6; // -1 因为末尾有 null terminator
-        vkCmdDraw(vkCommandBuffer, vertexCount, 1, 0, 0);
+    uint32_t firstInstance = 0;
+    uint32_t instanceCount = 0;
+    if (!UpdateVertexBuffer(text, x, flippedY, r, g, b, a, firstInstance, instanceCount)) {
+        return;
     }
+    
+    BindTextPipeline(vkCommandBuffer, screenWidth, screenHeight);
+    vkCmdDraw(vkCommandBuffer, 6, instanceCount, 0, firstInstance);
 }
 
 void TextRenderer::RenderTextCentered(CommandBufferHandle commandBuffer, const std::string& text,
@@ -1317,24 +1740,28 @@ void TextRenderer::RenderTextCentered(CommandBufferHandle commandBuffer, const s
 }
 
 void TextRenderer::GetTextSize(const std::string& text, float& width, float& height) {
-    width = 0.0f;
-    height = m_lineHeight;
-    
-    // 将 UTF-8 字符串转换为宽字符
-    int wlen = MultiByteToWideChar(CP_UTF8, 0, text.c_str(), -1, nullptr, 0);
-    if (wlen <= 1) return; // 只有 null terminator
-    
-    std::vector<wchar_t> wtext(wlen);
-    MultiByteToWideChar(CP_UTF8, 0, text.c_str(), -1, wtext.data(), wlen);
-    
-    if (wlen <= 1) return; // 没有有效字符
+    const TextLayout& layout = GetTextLayout(text);
+    width = layout.width;
+    height = layout.height;
+}
+
+float TextRenderer::GetTextCenterOffset(const std::string& text) {
+    return GetTextLayout(text).centerOffset;
+}
+
+void TextRenderer::MeasureTextLayout(const std::vector<uint32_t>& codePoints, TextLayout& layout) {
+    int count = (int)codePoints.size();
+    float& width = layout.width;
+    float& height = layout.height;
     
     // 计算文字的实际宽度（考虑offsetX和实际字符宽度）
     // 模拟渲染过程：第一个字符的左边界和最后一个字符的右边界
     float firstCharOffsetX = 0.0f;
     float lastCharRightEdge = 0.0f;
     float currentX = 0.0f;
-    const Glyph* lastValidGlyph = nullptr;
+    // 保存副本：之后的 GetGlyph 可能插入新字形并使字形表重新分配，之前返回的引用失效
+    Glyph lastValidGlyph = {};
+    bool hasValidGlyph = false;
     float lastValidCurrentX = 0.0f;
     
     // 计算文字的实际高度（考虑offsetY和字符高度）
@@ -1342,25 +1769,25 @@ void TextRenderer::GetTextSize(const std::string& text, float& width, float& hei
     float maxCharBottom = 0.0f;
     bool firstChar = true;
     
-    for (int i = 0; i < wlen - 1; i++) { // -1 因为末尾有 null terminator
-        wchar_t wchar = wtext[i];
-        const Glyph& glyph = GetGlyph((uint32_t)wchar);
+    for (int i = 0; i < count; i++) {
+        const Glyph& glyph = GetGlyph(codePoints[i]);
         
         if (i == 0) {
             // 第一个字符的左边界
-            firstCharOffsetX = glyph.offsetX;
+            firstCharOffsetX = glyph.offsetX * m_glyphScale;
         }
         
         if (glyph.width > 0.0f && glyph.height > 0.0f) {
             // 记录最后一个有效字符的信息
-            lastValidGlyph = &glyph;
+            lastValidGlyph = glyph;
+            hasValidGlyph = true;
             lastValidCurrentX = currentX;
             
             // 计算字符的顶部和底部（相对于基线）
             // charY = currentY - glyph.offsetY，所以字符顶部是 -offsetY
             // 字符底部是 -offsetY + charHeight
-            float charTop = -glyph.offsetY;
-            float charBottom = -glyph.offsetY + glyph.height * m_atlasHeight;
+            float charTop = -glyph.offsetY * m_glyphScale;
+            float charBottom = charTop + glyph.height * m_atlasHeight * m_glyphScale;
             
             if (firstChar) {
                 minCharTop = charTop;
@@ -1372,24 +1799,27 @@ void TextRenderer::GetTextSize(const std::string& text, float& width, float& hei
             }
         }
         
-        currentX += glyph.advanceX;
+        currentX += glyph.advanceX * m_glyphScale;
     }
     
-    if (lastValidGlyph) {
+    if (hasValidGlyph) {
         // 最后一个字符的右边界 = currentX位置（在加上advanceX之前） + offsetX + 实际宽度
-        lastCharRightEdge = lastValidCurrentX + lastValidGlyph->offsetX + lastValidGlyph->width * m_atlasWidth;
+        lastCharRightEdge = lastValidCurrentX + (lastValidGlyph.offsetX + lastValidGlyph.width * m_atlasWidth) * m_glyphScale;
     }
     
+    // 四边形四周的距离场留白不属于文字
+    float margin = (float)config::TEXT_SDF_SPREAD * m_glyphScale;
+    
     // 文字的实际宽度 = 最后一个字符的右边界 - 第一个字符的左边界
-    width = lastCharRightEdge - firstCharOffsetX;
+    if (hasValidGlyph) {
+        width = lastCharRightEdge - firstCharOffsetX - margin * 2.0f;
+    }
     
     // 文字的实际高度 = 字符的最大底部 - 字符的最小顶部
     if (!firstChar) {
-        height = maxCharBottom - minCharTop;
+        height = maxCharBottom - minCharTop - margin * 2.0f;
     }
-}
-
-float TextRenderer::GetTextCenterOffset(const std::string& text) {
+    
     // 计算文字中心相对于传入Y坐标的偏移
     // 在UpdateVertexBuffer中，字符Y坐标是：charY = currentY - glyph.offsetY
     // 其中currentY是翻转后的Y坐标（flippedY = screenHeight - y）
@@ -1397,30 +1827,25 @@ float TextRenderer::GetTextCenterOffset(const std::string& text) {
     // 字符底部：charY + charHeight = flippedY - glyph.offsetY + charHeight
     // 文字中心（在翻转后的坐标系中）：flippedY - averageOffsetY + averageCharHeight/2
     
-    // 将 UTF-8 字符串转换为宽字符
-    int wlen = MultiByteToWideChar(CP_UTF8, 0, text.c_str(), -1, nullptr, 0);
-    if (wlen <= 1) return 0.0f; // 没有有效字符
-    
-    std::vector<wchar_t> wtext(wlen);
-    MultiByteToWideChar(CP_UTF8, 0, text.c_str(), -1, wtext.data(), wlen);
-    
     // 计算所有字符的平均offsetY和平均charHeight
     float sumOffsetY = 0.0f;
     float sumCharHeight = 0.0f;
     int validCharCount = 0;
     
-    for (int i = 0; i < wlen - 1; i++) { // -1 因为末尾有 null terminator
-        wchar_t wchar = wtext[i];
-        const Glyph& glyph = GetGlyph((uint32_t)wchar);
+    for (int i = 0; i < count; i++) {
+        const Glyph& glyph = GetGlyph(codePoints[i]);
         
         if (glyph.width > 0.0f && glyph.height > 0.0f) {
-            sumOffsetY += glyph.offsetY;
-            sumCharHeight += glyph.height * m_atlasHeight;
+            sumOffsetY += glyph.offsetY * m_glyphScale;
+            sumCharHeight += glyph.height * m_atlasHeight * m_glyphScale;
             validCharCount++;
         }
     }
     
-    if (validCharCount == 0) return 0.0f;
+    if (validCharCount == 0) {
+        layout.centerOffset = 0.0f;
+        return;
+    }
     
     float avgOffsetY = sumOffsetY / validCharCount;
     float avgCharHeight = sumCharHeight / validCharCount;
@@ -1442,7 +1867,7 @@ float TextRenderer::GetTextCenterOffset(const std::string& text) {
     // 但是，由于字符Y坐标是 charY = flippedY - offsetY，我们需要补偿offsetY
     
     // 文字中心相对于传入Y坐标的偏移（正值表示文字中心在Y坐标下方）
-    return -avgOffsetY + avgCharHeight / 2.0f;
+    layout.centerOffset = -avgOffsetY + avgCharHeight / 2.0f;
 }
 
 void TextRenderer::SetFontSize(int fontSize) {
@@ -1450,43 +1875,10 @@ void TextRenderer::SetFontSize(int fontSize) {
         return;
     }
     
-    // 重新加载字体并重建图集
-    if (LoadFont(m_fontName, fontSize)) {
-        CreateFontAtlas();
-        // 需要重新创建 Vulkan 纹理
-        if (m_textureImage != nullptr) {
-            // 将不透明指针转换为 Vulkan 类型
-            VkDevice vkDevice = static_cast<VkDevice>(m_device);
-            VkSampler vkTextureSampler = static_cast<VkSampler>(m_textureSampler);
-            VkImageView vkTextureImageView = static_cast<VkImageView>(m_textureImageView);
-            VkImage vkTextureImage = static_cast<VkImage>(m_textureImage);
-            VkDeviceMemory vkTextureImageMemory = static_cast<VkDeviceMemory>(m_textureImageMemory);
-            
-            vkDestroySampler(vkDevice, vkTextureSampler, nullptr);
-            vkDestroyImageView(vkDevice, vkTextureImageView, nullptr);
-            vkDestroyImage(vkDevice, vkTextureImage, nullptr);
-            vkFreeMemory(vkDevice, vkTextureImageMemory, nullptr);
-        }
-        CreateVulkanTexture(m_atlasData.data(), m_atlasWidth, m_atlasHeight);
-        
-        // 更新描述符集
-        VkDevice vkDevice = static_cast<VkDevice>(m_device);
-        VkDescriptorSet vkDescriptorSet = static_cast<VkDescriptorSet>(m_descriptorSet);
-        VkDescriptorImageInfo imageInfo = {};
-        imageInfo.imageLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
-        imageInfo.imageView = static_cast<VkImageView>(m_textureImageView);
-        imageInfo.sampler = static_cast<VkSampler>(m_textureSampler);
-        
-        VkWriteDescriptorSet descriptorWrite = {};
-        descriptorWrite.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
-        descriptorWrite.dstSet = vkDescriptorSet;
-        descriptorWrite.dstBinding = 0;
-        descriptorWrite.dstArrayElement = 0;
-        descriptorWrite.descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
-        descriptorWrite.descriptorCount = 1;
-        descriptorWrite.pImageInfo = &imageInfo;
-        
-        vkUpdateDescriptorSets(vkDevice, 1, &descriptorWrite, 0, nullptr);
-    }
+    // 图集保存基准字号下的距离场，改变字号只改变缩放比例，不需要重新光栅化或上传字形
+    m_fontSize = fontSize;
+    m_glyphScale = (float)fontSize / (float)config::TEXT_SDF_REFERENCE_SIZE;
+    
+    // 已录制的文本顶点按旧字号布局
+    m_atlasVersion++;
 }
-    
\ No newline at end of file
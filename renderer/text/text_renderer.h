@@ -1,33 +1,49 @@
 #pragma once
 
+#ifdef _WIN32
 #define VK_USE_PLATFORM_WIN32_KHR
 #define WIN32_LEAN_AND_MEAN
 #define NOMINMAX
+#include <windows.h>      // 2. 系统头文件
+#endif
+#include <list>           // 2. 系统头文件
+#include <memory>         // 2. 系统头文件
 #include <string>         // 2. 系统头文件
 #include <unordered_map>  // 2. 系统头文件
 #include <vector>         // 2. 系统头文件
-#include <windows.h>      // 2. 系统头文件
 
+#include "core/interfaces/ifont_rasterizer.h"  // 4. 项目头文件（接口）
+#include "core/interfaces/imemory_allocator.h"  // 4. 项目头文件（接口）
 #include "core/interfaces/itext_renderer.h"  // 4. 项目头文件（接口）
 #include "core/types/render_types.h"         // 4. 项目头文件（类型）
+#include "text/glyph_table.h"                // 4. 项目头文件
 
-// 文字渲染器 - 使用Windows GDI生成字体纹理图集，在Vulkan中渲染文本
+// 文字渲染器 - 通过字体光栅化接口（默认为可移植的 TrueType 光栅化器）生成字体纹理图集，在Vulkan中渲染文本
 // 支持批量渲染和居中文本，自动处理UTF-8编码和字符字形缓存
+// 图集为单通道多页纹理（数组纹理，每页一层），按固定大小的单元分配字形；首次使用的字形在CPU光栅化后
+// 由 FlushGlyphUploads 每帧批量以子矩形复制上传，所有页写满后淘汰最久未使用（且本帧未使用）的字形
+// 图集保存基准字号下的有向距离场，改变字号只改变缩放比例，不重新光栅化字形
+// 每个字符串的排版结果（字形四边形和度量）按字符串缓存，未变化的标签每帧只复制一次顶点
+// 每个字符只写入一条紧凑的字形实例记录，纹理坐标由顶点着色器根据图集单元网格计算
+// 顶点在持久映射的环形缓冲区中顺序追加（每次绘制一段，不覆盖之前录制的绘制引用的顶点），写满时换用已回收的缓冲区
 class TextRenderer : public ITextRenderer {
 public:
     struct Glyph {
         uint32_t charCode;           // 字符代码
         float x, y;                  // 纹理坐标（归一化）
         float width, height;          // 纹理尺寸（归一化）
-        float advanceX;               // 水平前进距离
-        float offsetX, offsetY;       // 字符偏移（相对于基线）
-        int textureIndex;             // 纹理索引（如果使用多个纹理）
+        float advanceX;               // 水平前进距离（基准字号下的像素）
+        float offsetX, offsetY;       // 四边形左上角相对于基线笔位置的偏移（基准字号下的像素，包含距离场留白）
+        int textureIndex;             // 图集页索引（数组纹理层）
+        uint32_t atlasSlot;           // 图集单元索引（跨所有页编号）
     };
     
-    struct TextVertex {
-        float x, y;                   // 屏幕坐标
-        float u, v;                   // 纹理坐标
-        float r, g, b, a;             // 颜色
+    // 字形实例（每个字符一条记录，顶点着色器按 gl_VertexIndex 展开为两个三角形）
+    struct GlyphInstance {
+        float x, y;                   // 四边形左上角（屏幕坐标，翻转后的Y坐标）
+        float width, height;          // 四边形尺寸（屏幕像素）
+        uint32_t glyph;               // 图集单元索引（低 16 位）| 单元内字形宽度（8 位）| 高度（8 位，图集像素）
+        uint32_t color;               // RGBA8（R 在最低字节）
     };
     
     TextRenderer();
@@ -38,6 +54,8 @@ public:
                     CommandPoolHandle commandPool, QueueHandle graphicsQueue,
                     RenderPassHandle renderPass) override;
     
+    void SetMemoryAllocator(IMemoryAllocator* memoryAllocator) override { m_memoryAllocator = memoryAllocator; }
+    void SetPipelineCache(PipelineCacheHandle pipelineCache) override { m_pipelineCache = pipelineCache; }
     void Cleanup() override;
     bool LoadFont(const std::string& fontName, int fontSize) override;
     void BeginTextBatch() override;
@@ -63,16 +81,45 @@ public:
     float GetTextCenterOffset(const std::string& text) override;
     void SetFontSize(int fontSize) override;
     int GetFontSize() const override { return m_fontSize; }
+    void FlushGlyphUploads() override;
+    uint64_t GetAtlasVersion() const override { return m_atlasVersion; }
+    uint64_t GetVertexBufferVersion() const override { return m_vertexRingVersion; }
     
 private:
-    // 查找内存类型
-    uint32_t FindMemoryType(uint32_t typeFilter, uint32_t properties);
-    
-    // 创建字体纹理图集
+    // 重置字体纹理图集（按当前字体划分单元、清空字形缓存，并预渲染常用字符）
     bool CreateFontAtlas();
     
-    // 创建 Vulkan 纹理
-    bool CreateVulkanTexture(const void* data, uint32_t width, uint32_t height);
+    // 创建图集的 Vulkan 纹理（所有页清零，之后只按单元增量上传）
+    bool CreateVulkanTexture(uint32_t width, uint32_t height, uint32_t pageCount);
+    
+    // 创建图集图像（每页一个数组层）、分配内存并创建数组视图，不转换布局
+    bool CreateAtlasImage(uint32_t width, uint32_t height, uint32_t pageCount,
+                          void*& image, MemoryAllocation& allocation, void*& imageView);
+    
+    // 为当前图集视图分配并写入描述符集（图集增长后使用新的描述符集，旧的仍可能被已提交的帧使用）
+    bool AllocateAtlasDescriptorSet();
+    
+    // 图集增加一页（所有单元都被占用时在淘汰之前调用）：换用多一层的新纹理，旧纹理退役，
+    // 复制旧页和清零新页在 FlushGlyphUploads 中提交；页数达到上限或本帧已经增长过时返回 false
+    bool GrowAtlas();
+    
+    // 录制图集增长的复制和清零（新纹理结束于 TRANSFER_DST 布局，旧纹理恢复为着色器读取）
+    void RecordAtlasGrowth(void* commandBuffer);
+    
+    // 销毁 MAX_FRAMES_IN_FLIGHT 帧之前退役的图集纹理
+    void ReleaseRetiredAtlasTextures();
+    
+    // 创建字形上传资源（每个并发帧一个命令缓冲区、栅栏和暂存缓冲区）
+    bool CreateUploadResources();
+    
+    // 分配一个图集单元（没有空闲单元时先增加一页，页数达到上限后淘汰最久未使用的字形，本帧使用过的字形不会被淘汰）
+    bool AllocateAtlasSlot(uint32_t charCode, uint32_t& slot);
+    
+    // 把图集单元标记为本帧使用（移到 LRU 链表头部）
+    void TouchAtlasSlot(uint32_t slot);
+    
+    // 确保上传槽位的暂存缓冲区至少有 size 字节（调用前该槽位上次的提交已完成）
+    bool EnsureStagingCapacity(uint32_t slotIndex, uint64_t size);
     
     // 创建渲染管线
     bool CreatePipeline(void* renderPass);
@@ -80,16 +127,81 @@ private:
     // 获取或创建字符字形
     const Glyph& GetGlyph(uint32_t charCode);
     
-    // 创建字符缓冲区
+    // 光栅化字符并把覆盖率转换为距离场（只读取字体和单元尺寸，可在工作线程上并行调用）
+    void PrepareGlyph(uint32_t charCode, GlyphBitmap& bitmap) const;
+    
+    // 准备一批字符中尚未缓存的字形并写入图集（数量达到 TEXT_RASTER_PARALLEL_MIN_GLYPHS 时并行光栅化）
+    void PreloadGlyphs(const std::vector<uint32_t>& charCodes);
+    
+    // 把准备好的字形写入图集单元并缓存（图集单元都被本帧使用时返回只保留前进距离的空字形）
+    const Glyph& InsertGlyph(const GlyphBitmap& bitmap);
+    
+    // 文本排版结果：以笔起点为原点的字形实例、度量，以及最近一次放置后的实例
+    struct TextLayout {
+        std::vector<GlyphInstance> instances;  // 相对笔起点（翻转后的Y坐标），颜色在放置时写入
+        std::vector<uint32_t> atlasSlots;   // 引用的图集单元（使用缓存时标记为本帧使用）
+        float width = 0.0f;
+        float height = 0.0f;
+        float centerOffset = 0.0f;          // GetTextCenterOffset 的结果
+        uint64_t atlasVersion = 0;          // 排版时的图集版本（0 表示尚未排版）
+        uint64_t lastUsedFrame = 0;
+        
+        // 最近一次放置的位置、颜色和实例（相同时直接复制）
+        std::vector<GlyphInstance> placed;
+        float placedX = 0.0f, placedY = 0.0f;
+        uint32_t placedColor = 0;
+        bool placedValid = false;
+    };
+    
+    // 获取字符串的排版（图集版本变化后重新排版）
+    TextLayout& GetTextLayout(const std::string& text);
+    
+    // 排版字符串：生成字形四边形并计算度量
+    void BuildTextLayout(const std::string& text, TextLayout& layout);
+    
+    // 计算排版的尺寸和垂直居中偏移
+    void MeasureTextLayout(const std::vector<uint32_t>& codePoints, TextLayout& layout);
+    
+    // 排版缓存超过上限时丢弃本帧未使用的条目（每帧调用一次）
+    void TrimLayoutCache();
+    
+    // 顶点环形缓冲区中的一个缓冲区
+    struct VertexRingBuffer {
+        void* buffer = nullptr;
+        MemoryAllocation allocation;
+        uint32_t capacity = 0;          // 字形实例数
+        uint64_t retiredFrame = 0;      // 退役时的帧序号（MAX_FRAMES_IN_FLIGHT 帧后可以重新使用）
+    };
+    
+    // 创建顶点环形缓冲区的第一个缓冲区
     bool CreateVertexBuffer();
     
+    // 创建/销毁一个持久映射的顶点缓冲区
+    bool CreateVertexRingBuffer(uint32_t capacity, VertexRingBuffer& ringBuffer);
+    void DestroyVertexRingBuffer(VertexRingBuffer& ringBuffer);
+    
+    // 把字形实例追加到环形缓冲区（当前缓冲区剩余空间不足时换用另一个缓冲区），输出第一个实例的索引
+    // 调用后 m_vertexRing 为包含这些实例的缓冲区
+    bool WriteGlyphInstances(const GlyphInstance* instances, uint32_t count, uint32_t& firstInstance);
+    
+    // 回收已退役且 GPU 不再使用的缓冲区（每帧调用一次）
+    void RecycleVertexBuffers();
+    
     // 更新顶点缓冲区（追加模式，不清除现有顶点）
     void AppendVerticesToBuffer(const std::string& text, float x, float y, 
                                 float r, float g, float b, float a);
     
-    // 更新顶点缓冲区（覆盖模式，清除现有顶点）
-    void UpdateVertexBuffer(const std::string& text, float x, float y, 
-                           float r, float g, float b, float a);
+    // 把排版的实例放到 (x, y) 并追加到批次（位置和颜色与上次相同时直接复制上次放置的实例）
+    void AppendLayoutToBuffer(TextLayout& layout, float x, float y,
+                              float r, float g, float b, float a);
+    
+    // 生成文本的字形实例并立即写入环形缓冲区，输出绘制范围（没有可绘制的字形时返回 false）
+    bool UpdateVertexBuffer(const std::string& text, float x, float y, 
+                            float r, float g, float b, float a,
+                            uint32_t& firstInstance, uint32_t& instanceCount);
+    
+    // 绑定管线、描述符集、推送常量和顶点缓冲区（RenderText 和 FlushBatch 共用）
+    void BindTextPipeline(void* commandBuffer, float screenWidth, float screenHeight);
     
     // 将累积的顶点数据上传到GPU并渲染
     // viewportX/viewportY: viewport的偏移（在Fit模式下需要设置，用于正确对齐文本）
@@ -105,50 +217,108 @@ private:
     void* m_commandPool = nullptr;
     void* m_graphicsQueue = nullptr;
     void* m_renderPass = nullptr;
+    IMemoryAllocator* m_memoryAllocator = nullptr;  // [BORROW] 共享内存分配器，由渲染器拥有
+    PipelineCacheHandle m_pipelineCache = nullptr;  // [BORROW] 共享管线缓存，由渲染器拥有
     
-    // 字体相关
+    // 字体相关（字体始终按基准字号加载，m_glyphScale 把基准字号下的度量换算到当前字号）
     std::string m_fontName;
     int m_fontSize = 16;
-    HFONT m_hFont = nullptr;
-    HDC m_hDC = nullptr;
-    HBITMAP m_hBitmap = nullptr;
-    void* m_bitmapData = nullptr;
+    float m_glyphScale = 1.0f;
+    std::unique_ptr<IFontRasterizer> m_rasterizer;  // 字体光栅化器
     
-    // 纹理图集
+    // 纹理图集（m_atlasWidth / m_atlasHeight 为单页尺寸，字形纹理坐标按单页归一化；
+    // 从 TEXT_ATLAS_PAGE_COUNT 页开始，单元不够时增长到 TEXT_ATLAS_MAX_PAGE_COUNT 页）
     uint32_t m_atlasWidth = 512;
     uint32_t m_atlasHeight = 512;
-    std::vector<uint8_t> m_atlasData;
+    uint32_t m_atlasPageCount = 1;
+    uint32_t m_cellWidth = 0;       // 单元尺寸（像素，由字体行高决定）
+    uint32_t m_cellHeight = 0;
+    uint32_t m_cellsPerRow = 0;
+    uint32_t m_cellsPerPage = 0;
     // Vulkan 纹理对象（使用不透明指针，避免头文件直接依赖 Vulkan 实现）
     // 注意：在 .cpp 文件中转换为 Vulkan 类型使用
     void* m_textureImage = nullptr;
-    void* m_textureImageMemory = nullptr;
+    MemoryAllocation m_textureImageAllocation;
     void* m_textureImageView = nullptr;
     void* m_textureSampler = nullptr;
     
-    // 字形缓存
-    std::unordered_map<uint32_t, Glyph> m_glyphs;
-    float m_currentX = 0.0f;
-    float m_currentY = 0.0f;
-    float m_lineHeight = 0.0f;
+    // 图集增长后退役的纹理（之前录制的命令仍在采样，MAX_FRAMES_IN_FLIGHT 帧后销毁）
+    struct RetiredAtlasTexture {
+        void* image = nullptr;
+        MemoryAllocation allocation;
+        void* imageView = nullptr;
+        uint32_t pageCount = 0;
+        uint64_t retiredFrame = 0;
+    };
+    std::vector<RetiredAtlasTexture> m_retiredAtlasTextures;
+    bool m_atlasGrowthPending = false;  // 新纹理的内容尚未提交（复制源为最后退役的纹理）
+    
+    // 字形缓存（Latin-1 按码位直接索引，其他码位使用开放寻址表）
+    GlyphTable<Glyph> m_glyphs;
+    float m_lineHeight = 0.0f;      // 基准字号下的行高
+    float m_ascent = 0.0f;          // 基准字号下基线以上的高度
+    Glyph m_overflowGlyph = {};  // 所有单元都被本帧使用时返回的空字形（只保留前进距离）
+    
+    // 排版缓存（按字符串；字体和字号的变化通过图集版本使条目失效）
+    std::unordered_map<std::string, TextLayout> m_layoutCache;
+    
+    // 图集单元（LRU 链表头部为最近使用的单元）
+    struct AtlasCell {
+        uint32_t charCode = 0;
+        uint64_t lastUsedFrame = 0;
+        std::list<uint32_t>::iterator lruPosition;
+    };
+    std::vector<AtlasCell> m_atlasCells;
+    std::vector<uint32_t> m_freeCells;
+    std::list<uint32_t> m_lruCells;
+    uint64_t m_frameIndex = 1;      // 每次 FlushGlyphUploads 递增
+    uint64_t m_atlasVersion = 1;    // 字形被淘汰、图集重置或字号改变时递增
+    
+    // 等待上传的字形（每个单元整块上传，单元内字形之外的像素为 0，覆盖被淘汰字形的残留）
+    struct PendingGlyphUpload {
+        uint32_t page;
+        uint32_t x, y;              // 单元左上角（像素）
+        size_t offset;              // 在 m_pendingPixels 中的字节偏移
+    };
+    std::vector<PendingGlyphUpload> m_pendingUploads;
+    std::vector<uint8_t> m_pendingPixels;
+    
+    // 字形上传资源（每个并发帧一份，轮流使用；使用前等待该槽位上次提交完成）
+    struct GlyphUploadSlot {
+        void* commandBuffer = nullptr;
+        void* fence = nullptr;
+        void* stagingBuffer = nullptr;
+        MemoryAllocation stagingAllocation;
+        uint64_t stagingSize = 0;
+    };
+    std::vector<GlyphUploadSlot> m_uploadSlots;
+    uint32_t m_uploadSlotIndex = 0;
+    
+    // 顶点环形缓冲区：在当前缓冲区中顺序追加，写满后当前缓冲区退役（已录制的命令缓冲区可能仍被重复提交，
+    // 所以不回绕覆盖，而是换用 MAX_FRAMES_IN_FLIGHT 帧前退役的空闲缓冲区，并递增版本要求重新录制）
+    VertexRingBuffer m_vertexRing;
+    uint32_t m_vertexRingHead = 0;          // 当前缓冲区中下一个可写的顶点
+    uint64_t m_vertexRingStartFrame = 0;    // 当前缓冲区开始使用的帧序号
+    uint64_t m_vertexRingVersion = 1;
+    std::vector<VertexRingBuffer> m_retiredVertexBuffers;
+    std::vector<VertexRingBuffer> m_freeVertexBuffers;
     
     // 渲染资源（使用不透明指针，避免头文件直接依赖 Vulkan 实现）
     // 注意：在 .cpp 文件中转换为 Vulkan 类型使用
-    void* m_vertexBuffer = nullptr;
-    void* m_vertexBufferMemory = nullptr;
     void* m_graphicsPipeline = nullptr;
     void* m_pipelineLayout = nullptr;
     void* m_descriptorSetLayout = nullptr;
     void* m_descriptorPool = nullptr;
     void* m_descriptorSet = nullptr;
     
-    // 批量渲染相关的临时顶点数据
-    std::vector<TextVertex> m_batchVertices;
+    // 批量渲染相关的临时字形实例
+    std::vector<GlyphInstance> m_batchGlyphs;
     bool m_inBatchMode = false;  // 是否处于批量渲染模式
     
     // 文本块信息（用于Fit模式下的缩放）
     struct TextBlockInfo {
-        size_t startIndex;      // 文本块在m_batchVertices中的起始索引
-        size_t endIndex;        // 文本块在m_batchVertices中的结束索引
+        size_t startIndex;      // 文本块在m_batchGlyphs中的起始索引
+        size_t endIndex;        // 文本块在m_batchGlyphs中的结束索引
         float centerX;          // 文本块中心点X坐标（窗口坐标，已转换）
         float centerY;          // 文本块中心点Y坐标（窗口坐标，已转换）
     };
@@ -0,0 +1,765 @@
+#include "text/truetype_font_rasterizer.h"  // 1. 对应头文件
+
+#include <algorithm>   // 2. 系统头文件
+#include <cmath>       // 2. 系统头文件
+#include <cstdio>      // 2. 系统头文件
+#include <cstdlib>     // 2. 系统头文件
+#include <cstring>     // 2. 系统头文件
+#include <filesystem>  // 2. 系统头文件
+#include <fstream>     // 2. 系统头文件
+
+namespace {
+
+// 字体文件中的整数均为大端序；越界读取返回 0（由调用方的范围检查拒绝损坏的字体）
+uint16_t ReadU16(const uint8_t* data, size_t size, size_t offset) {
+    if (offset + 2 > size) return 0;
+    return (uint16_t)((data[offset] << 8) | data[offset + 1]);
+}
+
+int16_t ReadS16(const uint8_t* data, size_t size, size_t offset) {
+    return (int16_t)ReadU16(data, size, offset);
+}
+
+uint32_t ReadU32(const uint8_t* data, size_t size, size_t offset) {
+    if (offset + 4 > size) return 0;
+    return ((uint32_t)data[offset] << 24) | ((uint32_t)data[offset + 1] << 16) |
+           ((uint32_t)data[offset + 2] << 8) | (uint32_t)data[offset + 3];
+}
+
+uint32_t MakeTag(const char* tag) {
+    return ((uint32_t)(uint8_t)tag[0] << 24) | ((uint32_t)(uint8_t)tag[1] << 16) |
+           ((uint32_t)(uint8_t)tag[2] << 8) | (uint32_t)(uint8_t)tag[3];
+}
+
+const uint32_t TAG_COLLECTION = 0x74746366;  // 'ttcf'
+const uint32_t TAG_TRUETYPE = 0x00010000;
+const uint32_t TAG_TRUETYPE_MAC = 0x74727565;  // 'true'
+
+bool IsTrueTypeOutline(uint32_t version) {
+    return version == TAG_TRUETYPE || version == TAG_TRUETYPE_MAC;
+}
+
+bool ReadFileRange(std::ifstream& file, uint32_t offset, uint32_t length, std::vector<uint8_t>& out) {
+    out.resize(length);
+    file.clear();
+    file.seekg(offset);
+    file.read(reinterpret_cast<char*>(out.data()), length);
+    return (uint32_t)file.gcount() == length;
+}
+
+bool ReadWholeFile(const std::string& path, std::vector<uint8_t>& out) {
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    if (!file) return false;
+    std::streamoff size = file.tellg();
+    if (size <= 0) return false;
+    return ReadFileRange(file, 0, (uint32_t)size, out);
+}
+
+std::string ToLowerAscii(std::string text) {
+    for (char& c : text) {
+        if (c >= 'A' && c <= 'Z') c = (char)(c - 'A' + 'a');
+    }
+    return text;
+}
+
+void AppendUtf8(std::string& out, uint32_t codePoint) {
+    if (codePoint < 0x80) {
+        out += (char)codePoint;
+    } else if (codePoint < 0x800) {
+        out += (char)(0xC0 | (codePoint >> 6));
+        out += (char)(0x80 | (codePoint & 0x3F));
+    } else if (codePoint < 0x10000) {
+        out += (char)(0xE0 | (codePoint >> 12));
+        out += (char)(0x80 | ((codePoint >> 6) & 0x3F));
+        out += (char)(0x80 | (codePoint & 0x3F));
+    } else {
+        out += (char)(0xF0 | (codePoint >> 18));
+        out += (char)(0x80 | ((codePoint >> 12) & 0x3F));
+        out += (char)(0x80 | ((codePoint >> 6) & 0x3F));
+        out += (char)(0x80 | (codePoint & 0x3F));
+    }
+}
+
+// 字体文件中一个字体的查找信息
+struct FontFace {
+    uint32_t faceIndex = 0;
+    bool hasOutlines = false;          // 含 glyf 轮廓（CFF 轮廓的 OpenType 字体不支持）
+    std::vector<std::string> names;    // 字体族名称和完整名称（UTF-8，小写）
+};
+
+// 解析 name 表中的字体族名称（1）、完整名称（4）和排版字体族名称（16），Unicode/Windows 平台为 UTF-16BE
+void ParseNameTable(const std::vector<uint8_t>& table, std::vector<std::string>& names) {
+    const uint8_t* data = table.data();
+    size_t size = table.size();
+    uint16_t count = ReadU16(data, size, 2);
+    uint16_t stringOffset = ReadU16(data, size, 4);
+    for (uint16_t i = 0; i < count; i++) {
+        size_t record = 6 + (size_t)i * 12;
+        uint16_t platformId = ReadU16(data, size, record);
+        uint16_t nameId = ReadU16(data, size, record + 6);
+        uint16_t length = ReadU16(data, size, record + 8);
+        size_t offset = (size_t)stringOffset + ReadU16(data, size, record + 10);
+        if ((nameId != 1 && nameId != 4 && nameId != 16) || offset + length > size) {
+            continue;
+        }
+        
+        std::string name;
+        if (platformId == 0 || platformId == 3) {
+            for (size_t j = 0; j + 1 < length; j += 2) {
+                uint32_t unit = ReadU16(data, size, offset + j);
+                if (unit >= 0xD800 && unit < 0xDC00 && j + 3 < length) {
+                    uint32_t low = ReadU16(data, size, offset + j + 2);
+                    unit = 0x10000 + ((unit - 0xD800) << 10) + (low - 0xDC00);
+                    j += 2;
+                }
+                AppendUtf8(name, unit);
+            }
+        } else if (platformId == 1) {
+            name.assign(reinterpret_cast<const char*>(data + offset), length);
+        }
+        if (!name.empty()) {
+            names.push_back(ToLowerAscii(name));
+        }
+    }
+}
+
+// 只读取文件头、表目录和 name 表，枚举文件中每个字体的名称（扫描整个字体目录时避免读入整个文件）
+std::vector<FontFace> ReadFontFaces(const std::string& path) {
+    std::vector<FontFace> faces;
+    std::ifstream file(path, std::ios::binary);
+    std::vector<uint8_t> header;
+    if (!file || !ReadFileRange(file, 0, 12, header)) {
+        return faces;
+    }
+    
+    std::vector<uint32_t> faceOffsets;
+    if (ReadU32(header.data(), header.size(), 0) == TAG_COLLECTION) {
+        uint32_t numFonts = (std::min)(ReadU32(header.data(), header.size(), 8), 64u);
+        std::vector<uint8_t> offsets;
+        if (!ReadFileRange(file, 12, numFonts * 4, offsets)) {
+            return faces;
+        }
+        for (uint32_t i = 0; i < numFonts; i++) {
+            faceOffsets.push_back(ReadU32(offsets.data(), offsets.size(), i * 4));
+        }
+    } else {
+        faceOffsets.push_back(0);
+    }
+    
+    for (uint32_t faceIndex = 0; faceIndex < (uint32_t)faceOffsets.size(); faceIndex++) {
+        std::vector<uint8_t> directory;
+        if (!ReadFileRange(file, faceOffsets[faceIndex], 12, directory)) {
+            continue;
+        }
+        uint32_t version = ReadU32(directory.data(), directory.size(), 0);
+        uint16_t numTables = ReadU16(directory.data(), directory.size(), 4);
+        if (!ReadFileRange(file, faceOffsets[faceIndex] + 12, (uint32_t)numTables * 16, directory)) {
+            continue;
+        }
+        
+        FontFace face;
+        face.faceIndex = faceIndex;
+        for (uint16_t i = 0; i < numTables; i++) {
+            uint32_t tag = ReadU32(directory.data(), directory.size(), (size_t)i * 16);
+            if (tag == MakeTag("glyf")) {
+                face.hasOutlines = IsTrueTypeOutline(version);
+            } else if (tag == MakeTag("name")) {
+                std::vector<uint8_t> table;
+                uint32_t offset = ReadU32(directory.data(), directory.size(), (size_t)i * 16 + 8);
+                uint32_t length = ReadU32(directory.data(), directory.size(), (size_t)i * 16 + 12);
+                if (length <= 1024 * 1024 && ReadFileRange(file, offset, length, table)) {
+                    ParseNameTable(table, face.names);
+                }
+            }
+        }
+        faces.push_back(face);
+    }
+    return faces;
+}
+
+// 系统字体目录
+std::vector<std::string> GetFontDirectories() {
+    std::vector<std::string> directories;
+#ifdef _WIN32
+    const char* windowsDir = std::getenv("WINDIR");
+    directories.push_back(std::string(windowsDir != nullptr ? windowsDir : "C:\\Windows") + "\\Fonts");
+    const char* localAppData = std::getenv("LOCALAPPDATA");
+    if (localAppData != nullptr) {
+        directories.push_back(std::string(localAppData) + "\\Microsoft\\Windows\\Fonts");
+    }
+#else
+    directories.push_back("/usr/share/fonts");
+    directories.push_back("/usr/local/share/fonts");
+    directories.push_back("/System/Library/Fonts");
+    directories.push_back("/Library/Fonts");
+    const char* home = std::getenv("HOME");
+    if (home != nullptr) {
+        directories.push_back(std::string(home) + "/.local/share/fonts");
+        directories.push_back(std::string(home) + "/.fonts");
+    }
+#endif
+    return directories;
+}
+
+// 在系统字体目录中按名称查找字体；没有同名字体时输出第一个可加载的字体（按路径排序，结果稳定）
+bool FindFontFile(const std::string& fontName, std::string& path, uint32_t& faceIndex) {
+    std::vector<std::string> candidates;
+    for (const std::string& directory : GetFontDirectories()) {
+        std::error_code ec;
+        std::filesystem::recursive_directory_iterator it(directory, ec), end;
+        for (; !ec && it != end; it.increment(ec)) {
+            if (!it->is_regular_file(ec)) continue;
+            std::string extension = ToLowerAscii(it->path().extension().string());
+            if (extension == ".ttf" || extension == ".ttc" || extension == ".otf") {
+                candidates.push_back(it->path().string());
+            }
+        }
+    }
+    std::sort(candidates.begin(), candidates.end());
+    
+    std::string wanted = ToLowerAscii(fontName);
+    std::string fallbackPath;
+    uint32_t fallbackFace = 0;
+    for (const std::string& candidate : candidates) {
+        for (const FontFace& face : ReadFontFaces(candidate)) {
+            if (!face.hasOutlines) continue;
+            if (std::find(face.names.begin(), face.names.end(), wanted) != face.names.end()) {
+                path = candidate;
+                faceIndex = face.faceIndex;
+                return true;
+            }
+            if (fallbackPath.empty()) {
+                fallbackPath = candidate;
+                fallbackFace = face.faceIndex;
+            }
+        }
+    }
+    
+    if (fallbackPath.empty()) {
+        return false;
+    }
+    printf("[TEXT] Font \"%s\" not found, falling back to %s\n", fontName.c_str(), fallbackPath.c_str());
+    path = fallbackPath;
+    faceIndex = fallbackFace;
+    return true;
+}
+
+struct Point {
+    float x, y;
+};
+
+// 按面积累积覆盖率的光栅化：每条边把有向面积差写入累积缓冲区，逐行前缀求和后即为像素覆盖率
+// （非零环绕规则下重叠的轮廓按绝对值截断到 1）
+class CoverageRasterizer {
+public:
+    CoverageRasterizer(uint32_t width, uint32_t height)
+        : m_width(width), m_height(height), m_accumulation((size_t)width * height + 1, 0.0f) {
+    }
+    
+    void DrawLine(Point p0, Point p1) {
+        // x 限制在位图内（裁剪掉的部分面积落在边缘列），y 超出的行直接跳过
+        float maxX = (float)m_width - 0.001f;
+        p0.x = (std::min)((std::max)(p0.x, 0.0f), maxX);
+        p1.x = (std::min)((std::max)(p1.x, 0.0f), maxX);
+        if (std::fabs(p0.y - p1.y) <= 1e-6f) {
+            return;
+        }
+        
+        float direction = 1.0f;
+        if (p0.y > p1.y) {
+            std::swap(p0, p1);
+            direction = -1.0f;
+        }
+        
+        float dxdy = (p1.x - p0.x) / (p1.y - p0.y);
+        float x = p0.x;
+        if (p0.y < 0.0f) {
+            x -= p0.y * dxdy;
+        }
+        
+        int yStart = (std::max)((int)std::floor(p0.y), 0);
+        int yEnd = (std::min)((int)std::ceil(p1.y), (int)m_height);
+        for (int y = yStart; y < yEnd; y++) {
+            float* line = m_accumulation.data() + (size_t)y * m_width;
+            float dy = (std::min)((float)(y + 1), p1.y) - (std::max)((float)y, p0.y);
+            float xNext = x + dxdy * dy;
+            float d = dy * direction;
+            float x0 = (std::min)(x, xNext);
+            float x1 = (std::max)(x, xNext);
+            float x0Floor = std::floor(x0);
+            int x0i = (int)x0Floor;
+            float x1Ceil = std::ceil(x1);
+            int x1i = (int)x1Ceil;
+            
+            if (x1i <= x0i + 1) {
+                // 边在本行只经过一个像素
+                float xMid = 0.5f * (x + xNext) - x0Floor;
+                line[x0i] += d - d * xMid;
+                line[x0i + 1] += d * xMid;
+            } else {
+                // 边跨越多个像素：两端像素按三角形面积，中间像素均分
+                float s = 1.0f / (x1 - x0);
+                float x0f = x0 - x0Floor;
+                float a0 = 0.5f * s * (1.0f - x0f) * (1.0f - x0f);
+                float x1f = x1 - x1Ceil + 1.0f;
+                float am = 0.5f * s * x1f * x1f;
+                line[x0i] += d * a0;
+                if (x1i == x0i + 2) {
+                    line[x0i + 1] += d * (1.0f - a0 - am);
+                } else {
+                    float a1 = s * (1.5f - x0f);
+                    line[x0i + 1] += d * (a1 - a0);
+                    for (int xi = x0i + 2; xi < x1i - 1; xi++) {
+                        line[xi] += d * s;
+                    }
+                    float a2 = a1 + (float)(x1i - x0i - 3) * s;
+                    line[x1i - 1] += d * (1.0f - a2 - am);
+                }
+                line[x1i] += d * am;
+            }
+            x = xNext;
+        }
+    }
+    
+    // 二次贝塞尔曲线按偏离程度细分为线段
+    void DrawQuad(Point p0, Point control, Point p1) {
+        float devX = p0.x - 2.0f * control.x + p1.x;
+        float devY = p0.y - 2.0f * control.y + p1.y;
+        float deviation = devX * devX + devY * devY;
+        if (deviation < 0.333f) {
+            DrawLine(p0, p1);
+            return;
+        }
+        
+        int segments = 1 + (int)std::floor(std::sqrt(std::sqrt(3.0f * deviation)));
+        Point previous = p0;
+        for (int i = 1; i <= segments; i++) {
+            float t = (float)i / (float)segments;
+            float u = 1.0f - t;
+            Point next = {
+                u * u * p0.x + 2.0f * u * t * control.x + t * t * p1.x,
+                u * u * p0.y + 2.0f * u * t * control.y + t * t * p1.y
+            };
+            DrawLine(previous, next);
+            previous = next;
+        }
+    }
+    
+    void Resolve(uint8_t* pixels) const {
+        float accumulated = 0.0f;
+        size_t count = (size_t)m_width * m_height;
+        for (size_t i = 0; i < count; i++) {
+            accumulated += m_accumulation[i];
+            float coverage = (std::min)(std::fabs(accumulated), 1.0f);
+            pixels[i] = (uint8_t)std::lround(coverage * 255.0f);
+        }
+    }
+
+private:
+    uint32_t m_width;
+    uint32_t m_height;
+    std::vector<float> m_accumulation;
+};
+
+} // namespace
+
+bool TrueTypeFontRasterizer::LoadFont(const std::string& fontName, int pixelSize) {
+    // 字体名称是文件路径时直接加载，否则在系统字体目录中查找
+    std::string path = fontName;
+    uint32_t faceIndex = 0;
+    std::error_code ec;
+    if (!std::filesystem::is_regular_file(path, ec) && !FindFontFile(fontName, path, faceIndex)) {
+        printf("[TEXT] No TrueType font available for \"%s\"\n", fontName.c_str());
+        return false;
+    }
+    
+    // 解析成功后才替换当前字体（失败时保留之前加载的字体）
+    TrueTypeFontRasterizer loaded;
+    std::vector<uint8_t> data;
+    if (!ReadWholeFile(path, data) || !loaded.ParseFont(std::move(data), faceIndex)) {
+        printf("[TEXT] Failed to load TrueType font %s\n", path.c_str());
+        return false;
+    }
+    *this = std::move(loaded);
+    
+    // 与 GDI 负字高一致：像素字号为 em 方框高度
+    uint32_t headOffset = 0, headLength = 0, hheaOffset = 0, hheaLength = 0;
+    FindTable("head", headOffset, headLength);
+    FindTable("hhea", hheaOffset, hheaLength);
+    const uint8_t* bytes = m_data.data();
+    size_t size = m_data.size();
+    uint16_t unitsPerEm = ReadU16(bytes, size, headOffset + 18);
+    m_scale = (float)pixelSize / (float)(unitsPerEm != 0 ? unitsPerEm : 2048);
+    
+    float ascender = (float)ReadS16(bytes, size, hheaOffset + 4);
+    float descender = (float)ReadS16(bytes, size, hheaOffset + 6);
+    m_metrics.ascent = ascender * m_scale;
+    m_metrics.lineHeight = (ascender - descender) * m_scale;
+    return true;
+}
+
+bool TrueTypeFontRasterizer::ParseFont(std::vector<uint8_t> data, uint32_t faceIndex) {
+    m_data = std::move(data);
+    const uint8_t* bytes = m_data.data();
+    size_t size = m_data.size();
+    
+    m_fontOffset = 0;
+    if (ReadU32(bytes, size, 0) == TAG_COLLECTION) {
+        if (faceIndex >= ReadU32(bytes, size, 8)) {
+            return false;
+        }
+        m_fontOffset = ReadU32(bytes, size, 12 + (size_t)faceIndex * 4);
+    }
+    if (!IsTrueTypeOutline(ReadU32(bytes, size, m_fontOffset))) {
+        return false;
+    }
+    
+    uint32_t headOffset, hheaOffset, maxpOffset, cmapOffset, length;
+    uint32_t hmtxLength = 0, locaLength = 0;
+    if (!FindTable("head", headOffset, length) || !FindTable("hhea", hheaOffset, length) ||
+        !FindTable("maxp", maxpOffset, length) || !FindTable("cmap", cmapOffset, length) ||
+        !FindTable("hmtx", m_hmtxOffset, hmtxLength) || !FindTable("loca", m_locaOffset, locaLength) ||
+        !FindTable("glyf", m_glyfOffset, m_glyfLength)) {
+        return false;
+    }
+    
+    m_indexToLocFormat = ReadS16(bytes, size, headOffset + 50);
+    m_numGlyphs = ReadU16(bytes, size, maxpOffset + 4);
+    m_numHMetrics = (std::min)((uint32_t)ReadU16(bytes, size, hheaOffset + 34), hmtxLength / 4);
+    size_t locaSize = (size_t)(m_numGlyphs + 1) * (m_indexToLocFormat == 0 ? 2 : 4);
+    if (m_numGlyphs == 0 || m_numHMetrics == 0 || locaLength < locaSize) {
+        return false;
+    }
+    
+    // 选择 cmap 子表：优先完整 Unicode（格式 12），其次 BMP（格式 4）
+    m_cmapOffset = 0;
+    int bestScore = 0;
+    uint16_t numTables = ReadU16(bytes, size, cmapOffset + 2);
+    for (uint16_t i = 0; i < numTables; i++) {
+        size_t record = cmapOffset + 4 + (size_t)i * 8;
+        uint16_t platformId = ReadU16(bytes, size, record);
+        uint16_t encodingId = ReadU16(bytes, size, record + 2);
+        uint32_t subtable = cmapOffset + ReadU32(bytes, size, record + 4);
+        uint16_t format = ReadU16(bytes, size, subtable);
+        bool unicode = platformId == 0 || (platformId == 3 && (encodingId == 1 || encodingId == 10));
+        int score = 0;
+        if (format == 12 && unicode) {
+            score = 3;
+        } else if (format == 4 && unicode) {
+            score = 2;
+        } else if (format == 4 && platformId == 3 && encodingId == 0) {
+            score = 1;  // 符号字体
+        }
+        if (score > bestScore) {
+            bestScore = score;
+            m_cmapOffset = subtable;
+        }
+    }
+    return bestScore > 0;
+}
+
+bool TrueTypeFontRasterizer::FindTable(const char* tag, uint32_t& offset, uint32_t& length) const {
+    const uint8_t* bytes = m_data.data();
+    size_t size = m_data.size();
+    uint32_t wanted = MakeTag(tag);
+    uint16_t numTables = ReadU16(bytes, size, m_fontOffset + 4);
+    for (uint16_t i = 0; i < numTables; i++) {
+        size_t record = m_fontOffset + 12 + (size_t)i * 16;
+        if (ReadU32(bytes, size, record) != wanted) continue;
+        offset = ReadU32(bytes, size, record + 8);
+        length = ReadU32(bytes, size, record + 12);
+        return (size_t)offset + length <= size;
+    }
+    return false;
+}
+
+uint32_t TrueTypeFontRasterizer::FindGlyphIndex(uint32_t charCode) const {
+    const uint8_t* bytes = m_data.data();
+    size_t size = m_data.size();
+    uint32_t glyphIndex = 0;
+    
+    if (ReadU16(bytes, size, m_cmapOffset) == 12) {
+        // 格式 12：按起始码位排序的码位区间
+        uint32_t groupCount = ReadU32(bytes, size, m_cmapOffset + 12);
+        uint32_t low = 0, high = groupCount;
+        while (low < high) {
+            uint32_t mid = (low + high) / 2;
+            size_t group = m_cmapOffset + 16 + (size_t)mid * 12;
+            if (charCode < ReadU32(bytes, size, group)) {
+                high = mid;
+            } else if (charCode > ReadU32(bytes, size, group + 4)) {
+                low = mid + 1;
+            } else {
+                glyphIndex = ReadU32(bytes, size, group + 8) + (charCode - ReadU32(bytes, size, group));
+                break;
+            }
+        }
+    } else if (charCode <= 0xFFFF) {
+        // 格式 4：按结束码位排序的区间，码位映射为 idDelta 偏移或经 idRangeOffset 查表
+        uint32_t segCountX2 = ReadU16(bytes, size, m_cmapOffset + 6);
+        size_t endCodes = m_cmapOffset + 14;
+        size_t startCodes = endCodes + segCountX2 + 2;
+        size_t idDeltas = startCodes + segCountX2;
+        size_t idRangeOffsets = idDeltas + segCountX2;
+        uint32_t low = 0, high = segCountX2 / 2;
+        while (low < high) {
+            uint32_t mid = (low + high) / 2;
+            if (charCode > ReadU16(bytes, size, endCodes + (size_t)mid * 2)) {
+                low = mid + 1;
+            } else {
+                high = mid;
+            }
+        }
+        if (low < segCountX2 / 2) {
+            uint32_t startCode = ReadU16(bytes, size, startCodes + (size_t)low * 2);
+            uint16_t idDelta = ReadU16(bytes, size, idDeltas + (size_t)low * 2);
+            size_t rangeOffsetAddress = idRangeOffsets + (size_t)low * 2;
+            uint16_t rangeOffset = ReadU16(bytes, size, rangeOffsetAddress);
+            if (charCode >= startCode) {
+                if (rangeOffset == 0) {
+                    glyphIndex = (charCode + idDelta) & 0xFFFF;
+                } else {
+                    uint16_t index = ReadU16(bytes, size, rangeOffsetAddress + rangeOffset + (charCode - startCode) * 2);
+                    glyphIndex = index != 0 ? ((index + idDelta) & 0xFFFF) : 0;
+                }
+            }
+        }
+    }
+    
+    return glyphIndex < m_numGlyphs ? glyphIndex : 0;
+}
+
+float TrueTypeFontRasterizer::GetAdvanceWidth(uint32_t glyphIndex) const {
+    // 超出 numberOfHMetrics 的字形沿用最后一个前进距离（等宽字形）
+    uint32_t metric = (std::min)(glyphIndex, m_numHMetrics - 1);
+    return (float)ReadU16(m_data.data(), m_data.size(), m_hmtxOffset + (size_t)metric * 4);
+}
+
+bool TrueTypeFontRasterizer::LoadOutline(uint32_t glyphIndex, Outline& outline, int depth) const {
+    const uint8_t* bytes = m_data.data();
+    size_t size = m_data.size();
+    if (glyphIndex >= m_numGlyphs || depth > 8) {
+        return false;
+    }
+    
+    uint32_t start, end;
+    if (m_indexToLocFormat == 0) {
+        start = (uint32_t)ReadU16(bytes, size, m_locaOffset + (size_t)glyphIndex * 2) * 2;
+        end = (uint32_t)ReadU16(bytes, size, m_locaOffset + (size_t)glyphIndex * 2 + 2) * 2;
+    } else {
+        start = ReadU32(bytes, size, m_locaOffset + (size_t)glyphIndex * 4);
+        end = ReadU32(bytes, size, m_locaOffset + (size_t)glyphIndex * 4 + 4);
+    }
+    if (start == end) {
+        return true;  // 没有轮廓（空格等）
+    }
+    if (start > end || end > m_glyfLength) {
+        return false;
+    }
+    
+    // 字形数据只在 [glyph, glyphEnd) 内读取
+    size_t glyph = (size_t)m_glyfOffset + start;
+    size_t glyphEnd = (size_t)m_glyfOffset + end;
+    int16_t contourCount = ReadS16(bytes, size, glyph);
+    
+    if (contourCount >= 0) {
+        // 简单字形：轮廓结束点、指令、标志（可重复）、X 和 Y 坐标（相对前一点的增量）
+        size_t cursor = glyph + 10;
+        uint32_t pointBase = (uint32_t)outline.points.size();
+        uint32_t pointCount = 0;
+        for (int16_t i = 0; i < contourCount; i++) {
+            uint32_t contourEnd = ReadU16(bytes, size, cursor + (size_t)i * 2);
+            if (contourEnd + 1 < pointCount) {
+                return false;
+            }
+            pointCount = contourEnd + 1;
+            outline.contourEnds.push_back(pointBase + contourEnd);
+        }
+        cursor += (size_t)contourCount * 2;
+        cursor += 2 + ReadU16(bytes, size, cursor);
+        
+        std::vector<uint8_t> flags;
+        flags.reserve(pointCount);
+        while (flags.size() < pointCount) {
+            if (cursor >= glyphEnd) return false;
+            uint8_t flag = bytes[cursor++];
+            flags.push_back(flag);
+            if (flag & 0x08) {
+                if (cursor >= glyphEnd) return false;
+                uint8_t repeat = bytes[cursor++];
+                for (uint8_t r = 0; r < repeat && flags.size() < pointCount; r++) {
+                    flags.push_back(flag);
+                }
+            }
+        }
+        
+        outline.points.resize(pointBase + pointCount);
+        for (int axis = 0; axis < 2; axis++) {
+            uint8_t shortBit = axis == 0 ? 0x02 : 0x04;
+            uint8_t sameOrPositiveBit = axis == 0 ? 0x10 : 0x20;
+            int value = 0;
+            for (uint32_t i = 0; i < pointCount; i++) {
+                uint8_t flag = flags[i];
+                if (flag & shortBit) {
+                    if (cursor >= glyphEnd) return false;
+                    int delta = bytes[cursor++];
+                    value += (flag & sameOrPositiveBit) ? delta : -delta;
+                } else if (!(flag & sameOrPositiveBit)) {
+                    if (cursor + 2 > glyphEnd) return false;
+                    value += ReadS16(bytes, size, cursor);
+                    cursor += 2;
+                }
+                OutlinePoint& point = outline.points[pointBase + i];
+                (axis == 0 ? point.x : point.y) = (float)value;
+                point.onCurve = (flag & 0x01) != 0;
+            }
+        }
+        return true;
+    }
+    
+    // 组合字形：逐个加载子字形并做仿射变换（只支持按 XY 偏移放置）
+    size_t cursor = glyph + 10;
+    uint16_t componentFlags;
+    do {
+        if (cursor + 4 > glyphEnd) return false;
+        componentFlags = ReadU16(bytes, size, cursor);
+        uint16_t componentIndex = ReadU16(bytes, size, cursor + 2);
+        cursor += 4;
+        
+        float dx, dy;
+        if (componentFlags & 0x0001) {
+            dx = (float)ReadS16(bytes, size, cursor);
+            dy = (float)ReadS16(bytes, size, cursor + 2);
+            cursor += 4;
+        } else {
+            uint16_t args = ReadU16(bytes, size, cursor);
+            dx = (float)(int8_t)(args >> 8);
+            dy = (float)(int8_t)(args & 0xFF);
+            cursor += 2;
+        }
+        if (!(componentFlags & 0x0002)) {
+            dx = dy = 0.0f;  // 点匹配定位，不支持
+        }
+        
+        float a = 1.0f, b = 0.0f, c = 0.0f, d = 1.0f;
+        if (componentFlags & 0x0008) {
+            a = d = ReadS16(bytes, size, cursor) / 16384.0f;
+            cursor += 2;
+        } else if (componentFlags & 0x0040) {
+            a = ReadS16(bytes, size, cursor) / 16384.0f;
+            d = ReadS16(bytes, size, cursor + 2) / 16384.0f;
+            cursor += 4;
+        } else if (componentFlags & 0x0080) {
+            a = ReadS16(bytes, size, cursor) / 16384.0f;
+            b = ReadS16(bytes, size, cursor + 2) / 16384.0f;
+            c = ReadS16(bytes, size, cursor + 4) / 16384.0f;
+            d = ReadS16(bytes, size, cursor + 6) / 16384.0f;
+            cursor += 8;
+        }
+        
+        Outline component;
+        if (!LoadOutline(componentIndex, component, depth + 1)) {
+            return false;
+        }
+        uint32_t pointBase = (uint32_t)outline.points.size();
+        for (const OutlinePoint& point : component.points) {
+            outline.points.push_back({ a * point.x + c * point.y + dx, b * point.x + d * point.y + dy, point.onCurve });
+        }
+        for (uint32_t contourEnd : component.contourEnds) {
+            outline.contourEnds.push_back(pointBase + contourEnd);
+        }
+    } while (componentFlags & 0x0020);
+    return true;
+}
+
+bool TrueTypeFontRasterizer::RasterizeGlyph(uint32_t charCode, uint32_t padding, uint32_t maxWidth, uint32_t maxHeight,
+                                            GlyphBitmap& bitmap) const {
+    if (m_data.empty()) {
+        return false;
+    }
+    
+    uint32_t glyphIndex = FindGlyphIndex(charCode);
+    Outline outline;
+    if (!LoadOutline(glyphIndex, outline, 0)) {
+        outline = Outline();  // 损坏的字形按空白处理，只保留前进距离
+    }
+    
+    // 位图覆盖前进距离和轮廓右边缘，四周加留白（超出最大尺寸的部分裁剪）
+    float advance = GetAdvanceWidth(glyphIndex) * m_scale;
+    float right = advance;
+    for (const OutlinePoint& point : outline.points) {
+        right = (std::max)(right, point.x * m_scale);
+    }
+    bitmap.charCode = charCode;
+    bitmap.advanceX = advance;
+    bitmap.width = (std::min)((uint32_t)std::ceil(right) + padding * 2, maxWidth);
+    bitmap.height = (std::min)((uint32_t)std::ceil(m_metrics.lineHeight) + padding * 2, maxHeight);
+    bitmap.pixels.assign((size_t)bitmap.width * bitmap.height, 0);
+    if (outline.points.empty() || bitmap.width == 0 || bitmap.height == 0) {
+        return true;
+    }
+    
+    // 字体单位（Y 向上、原点在基线笔位置）到位图像素（Y 向下、字符单元顶部在 padding 处）
+    float originX = (float)padding;
+    float baseline = (float)padding + m_metrics.ascent;
+    auto toBitmap = [&](const OutlinePoint& point) {
+        return Point{ originX + point.x * m_scale, baseline - point.y * m_scale };
+    };
+    
+    CoverageRasterizer rasterizer(bitmap.width, bitmap.height);
+    uint32_t contourStart = 0;
+    for (uint32_t contourEnd : outline.contourEnds) {
+        if (contourEnd < contourStart || contourEnd >= outline.points.size()) break;
+        uint32_t count = contourEnd - contourStart + 1;
+        const OutlinePoint* points = outline.points.data() + contourStart;
+        contourStart = contourEnd + 1;
+        if (count < 2) continue;
+        
+        // 从第一个曲线上的点开始；全部是控制点时从前两个控制点的中点开始
+        uint32_t first = 0;
+        while (first < count && !points[first].onCurve) first++;
+        Point start;
+        if (first < count) {
+            start = toBitmap(points[first]);
+        } else {
+            first = 0;
+            Point p0 = toBitmap(points[0]);
+            Point p1 = toBitmap(points[1]);
+            start = { (p0.x + p1.x) * 0.5f, (p0.y + p1.y) * 0.5f };
+        }
+        
+        // 相邻两个控制点之间隐含一个曲线上的点
+        Point current = start;
+        Point control = {};
+        bool hasControl = false;
+        for (uint32_t k = 1; k <= count; k++) {
+            const OutlinePoint& point = points[(first + k) % count];
+            Point p = toBitmap(point);
+            if (point.onCurve) {
+                if (hasControl) {
+                    rasterizer.DrawQuad(current, control, p);
+                } else {
+                    rasterizer.DrawLine(current, p);
+                }
+                current = p;
+                hasControl = false;
+            } else {
+                if (hasControl) {
+                    Point mid = { (control.x + p.x) * 0.5f, (control.y + p.y) * 0.5f };
+                    rasterizer.DrawQuad(current, control, mid);
+                    current = mid;
+                }
+                control = p;
+                hasControl = true;
+            }
+        }
+        if (hasControl) {
+            rasterizer.DrawQuad(current, control, start);
+        } else {
+            rasterizer.DrawLine(current, start);
+        }
+    }
+    
+    rasterizer.Resolve(bitmap.pixels.data());
+    return true;
+}
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <cstdint>  // 2. 系统头文件
+#include <string>   // 2. 系统头文件
+#include <vector>   // 2. 系统头文件
+
+#include "core/interfaces/ifont_rasterizer.h"  // 4. 项目头文件（接口）
+
+// TrueType 字体光栅化器 - 直接解析 TrueType 字体文件（.ttf/.ttc，glyf 轮廓）并按面积覆盖率光栅化，不依赖平台字体 API
+// 字体名称不是文件路径时，在系统字体目录中按 name 表的字体族名称查找；找不到时使用第一个可加载的字体
+// 加载后只读访问字体数据，RasterizeGlyph 可在多个线程上同时调用
+class TrueTypeFontRasterizer : public IFontRasterizer {
+public:
+    TrueTypeFontRasterizer() = default;
+    
+    // IFontRasterizer 接口实现
+    bool LoadFont(const std::string& fontName, int pixelSize) override;
+    FontMetrics GetMetrics() const override { return m_metrics; }
+    bool RasterizeGlyph(uint32_t charCode, uint32_t padding, uint32_t maxWidth, uint32_t maxHeight,
+                        GlyphBitmap& bitmap) const override;
+
+private:
+    // 字形轮廓上的点（字体单位，Y 向上）
+    struct OutlinePoint {
+        float x, y;
+        bool onCurve;
+    };
+    
+    // 字形轮廓：所有点和每个轮廓最后一个点的索引
+    struct Outline {
+        std::vector<OutlinePoint> points;
+        std::vector<uint32_t> contourEnds;
+    };
+    
+    // 解析字体数据中的第 faceIndex 个字体（集合文件可包含多个字体）
+    bool ParseFont(std::vector<uint8_t> data, uint32_t faceIndex);
+    
+    // 按表标签查找表，输出表在文件中的偏移（没有该表时返回 false）
+    bool FindTable(const char* tag, uint32_t& offset, uint32_t& length) const;
+    
+    // 字符码位到字形索引（cmap 格式 4 和 12），没有该字符时返回 0（缺字形状）
+    uint32_t FindGlyphIndex(uint32_t charCode) const;
+    
+    // 字形的前进距离（字体单位）
+    float GetAdvanceWidth(uint32_t glyphIndex) const;
+    
+    // 读取字形轮廓（组合字形递归展开，depth 防止循环引用）
+    bool LoadOutline(uint32_t glyphIndex, Outline& outline, int depth) const;
+    
+    std::vector<uint8_t> m_data;    // 整个字体文件
+    uint32_t m_fontOffset = 0;      // 当前字体在文件中的偏移（集合文件中非零）
+    uint32_t m_cmapOffset = 0;      // 选中的 cmap 子表偏移
+    uint32_t m_locaOffset = 0;
+    uint32_t m_glyfOffset = 0;
+    uint32_t m_glyfLength = 0;
+    uint32_t m_hmtxOffset = 0;
+    uint32_t m_numGlyphs = 0;
+    uint32_t m_numHMetrics = 0;
+    int m_indexToLocFormat = 0;
+    float m_scale = 0.0f;           // 字体单位到像素
+    FontMetrics m_metrics;
+};
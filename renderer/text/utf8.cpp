@@ -0,0 +1,59 @@
+#include "text/utf8.h"  // 1. 对应头文件
+
+std::vector<uint32_t> DecodeUtf8(const std::string& text) {
+    std::vector<uint32_t> codePoints;
+    codePoints.reserve(text.size());
+    size_t i = 0;
+    while (i < text.size()) {
+        uint8_t lead = (uint8_t)text[i++];
+        if (lead < 0x80) {
+            codePoints.push_back(lead);
+            continue;
+        }
+        
+        // 首字节决定序列长度；第二个字节的取值范围额外排除过长编码（E0、F0）、代理码位（ED）和超出 U+10FFFF 的值（F4）
+        size_t length = 0;
+        uint32_t codePoint = 0;
+        uint8_t lower = 0x80;
+        uint8_t upper = 0xBF;
+        if (lead >= 0xC2 && lead <= 0xDF) {
+            length = 2;
+            codePoint = lead & 0x1F;
+        } else if (lead >= 0xE0 && lead <= 0xEF) {
+            length = 3;
+            codePoint = lead & 0x0F;
+            if (lead == 0xE0) {
+                lower = 0xA0;
+            } else if (lead == 0xED) {
+                upper = 0x9F;
+            }
+        } else if (lead >= 0xF0 && lead <= 0xF4) {
+            length = 4;
+            codePoint = lead & 0x07;
+            if (lead == 0xF0) {
+                lower = 0x90;
+            } else if (lead == 0xF4) {
+                upper = 0x8F;
+            }
+        } else {
+            // 后续字节、C0/C1（只能构成过长编码）和 F5-FF
+            codePoints.push_back(0xFFFD);
+            continue;
+        }
+        
+        size_t count = 1;
+        while (count < length && i < text.size()) {
+            uint8_t next = (uint8_t)text[i];
+            if (next < lower || next > upper) {
+                break;
+            }
+            codePoint = (codePoint << 6) | (next & 0x3F);
+            lower = 0x80;
+            upper = 0xBF;
+            count++;
+            i++;
+        }
+        codePoints.push_back(count == length ? codePoint : 0xFFFD);
+    }
+    return codePoints;
+}
@@ -0,0 +1,10 @@
+#pragma once
+
+#include <cstdint>  // 2. 系统头文件
+#include <string>   // 2. 系统头文件
+#include <vector>   // 2. 系统头文件
+
+// 将 UTF-8 字符串解码为 Unicode 码位
+// 无效输入按 Unicode 标准的"最大有效子序列"规则替换为 U+FFFD：无效首字节、孤立的后续字节、截断序列、
+// 过长编码、代理码位（U+D800-U+DFFF）和超出 U+10FFFF 的值各产生一个 U+FFFD，之后从第一个不属于该序列的字节继续解码
+std::vector<uint32_t> DecodeUtf8(const std::string& text);
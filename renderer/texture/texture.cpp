@@ -13,6 +13,7 @@ class Window;
 
 // 使用前向声明替代直接包含，减少头文件依赖
 // 注意：Window::ShowError 是静态方法，需要在实现文件中包含
+#include "vulkan/vulkan_memory_allocator.h"  // 4. 项目头文件
 #include "window/window.h"  // 4. 项目头文件（仅用于静态方法调用）
 
 renderer::texture::Texture::Texture() {
@@ -115,10 +116,9 @@ void renderer::texture::Texture::Cleanup(VkDevice device) {
         m_image = VK_NULL_HANDLE;
     }
     
-    if (m_imageMemory != VK_NULL_HANDLE) {
+    if (m_imageAllocation.IsValid()) {
         printf("[TEXTURE] Freeing image memory\n");
-        vkFreeMemory(device, m_imageMemory, nullptr);
-        m_imageMemory = VK_NULL_HANDLE;
+        VulkanMemoryAllocator::Release(m_memoryAllocator, device, m_imageAllocation);
     }
     
     m_width = 0;
@@ -157,30 +157,16 @@ bool renderer::texture::Texture::CreateImage(VkDevice device, VkPhysicalDevice p
     }
     printf("[TEXTURE] VkImage created successfully, handle=%p\n", (void*)m_image);
     
-    // 分配内存
-    VkMemoryRequirements memRequirements;
-    vkGetImageMemoryRequirements(device, m_image, &memRequirements);
-    printf("[TEXTURE] Image memory requirements: size=%llu, alignment=%llu, typeBits=0x%x\n",
-           memRequirements.size, memRequirements.alignment, memRequirements.memoryTypeBits);
-    
-    VkMemoryAllocateInfo allocInfo = {};
-    allocInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
-    allocInfo.allocationSize = memRequirements.size;
-    allocInfo.memoryTypeIndex = FindMemoryType(physicalDevice, memRequirements.memoryTypeBits,
-                                              VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
-    printf("[TEXTURE] Allocating image memory: size=%llu, typeIndex=%u\n",
-           allocInfo.allocationSize, allocInfo.memoryTypeIndex);
-    
-    result = vkAllocateMemory(device, &allocInfo, nullptr, &m_imageMemory);
-    if (result != VK_SUCCESS) {
-        printf("[TEXTURE] ERROR: Failed to allocate image memory, result=%d\n", result);
+    // 分配内存（注入分配器时子分配，否则独立分配）并绑定
+    if (!VulkanMemoryAllocator::AllocateImage(m_memoryAllocator, device, physicalDevice, m_image,
+                                              MemoryPropertyFlag::DeviceLocal, m_imageAllocation)) {
+        printf("[TEXTURE] ERROR: Failed to allocate image memory\n");
         Window::ShowError("Failed to allocate image memory!");
         return false;
     }
-    printf("[TEXTURE] Image memory allocated successfully, handle=%p\n", (void*)m_imageMemory);
-    
-    vkBindImageMemory(device, m_image, m_imageMemory, 0);
-    printf("[TEXTURE] Image memory bound successfully\n");
+    printf("[TEXTURE] Image memory bound successfully: memory=%p, offset=%llu, size=%llu\n",
+           m_imageAllocation.memory, (unsigned long long)m_imageAllocation.offset,
+           (unsigned long long)m_imageAllocation.size);
     
     return true;
 }
@@ -252,8 +238,8 @@ bool renderer::texture::Texture::UploadImageData(VkDevice device, VkCommandPool
     // 创建临时缓冲区
     printf("[TEXTURE] Creating staging buffer...\n");
     VkBuffer stagingBuffer;
-    VkDeviceMemory stagingBufferMemory;
-    stagingBuffer = CreateStagingBuffer(device, m_physicalDevice, imageSize, stagingBufferMemory);
+    MemoryAllocation stagingAllocation;
+    stagingBuffer = CreateStagingBuffer(device, m_physicalDevice, imageSize, stagingAllocation);
     if (stagingBuffer == VK_NULL_HANDLE) {
         printf("[TEXTURE] ERROR: Failed to create staging buffer\n");
         return false;
@@ -262,10 +248,7 @@ bool renderer::texture::Texture::UploadImageData(VkDevice device, VkCommandPool
     
     // 复制数据到缓冲区
     printf("[TEXTURE] Copying pixel data to staging buffer...\n");
-    void* data;
-    vkMapMemory(device, stagingBufferMemory, 0, imageSize, 0, &data);
-    memcpy(data, imageData.pixels.data(), static_cast<size_t>(imageSize));
-    vkUnmapMemory(device, stagingBufferMemory);
+    VulkanMemoryAllocator::Write(device, stagingAllocation, imageData.pixels.data(), imageSize);
     printf("[TEXTURE] Pixel data copied to staging buffer\n");
     
     // 转换图像布局为传输目标
@@ -286,7 +269,7 @@ bool renderer::texture::Texture::UploadImageData(VkDevice device, VkCommandPool
     
     // 清理临时缓冲区
     printf("[TEXTURE] Destroying staging buffer...\n");
-    DestroyStagingBuffer(device, stagingBuffer, stagingBufferMemory);
+    DestroyStagingBuffer(device, stagingBuffer, stagingAllocation);
     printf("[TEXTURE] Image data uploaded successfully\n");
     
     return true;
@@ -409,23 +392,8 @@ void renderer::texture::Texture::CopyBufferToImage(VkDevice device, VkCommandPoo
     vkFreeCommandBuffers(device, commandPool, 1, &commandBuffer);
 }
 
-uint32_t renderer::texture::Texture::FindMemoryType(VkPhysicalDevice physicalDevice, uint32_t typeFilter,
-                                 VkMemoryPropertyFlags properties) {
-    VkPhysicalDeviceMemoryProperties memProperties;
-    vkGetPhysicalDeviceMemoryProperties(physicalDevice, &memProperties);
-    
-    for (uint32_t i = 0; i < memProperties.memoryTypeCount; i++) {
-        if ((typeFilter & (1 << i)) && (memProperties.memoryTypes[i].propertyFlags & properties) == properties) {
-            return i;
-        }
-    }
-    
-    Window::ShowError("Failed to find suitable memory type!");
-    return 0;
-}
-
 VkBuffer renderer::texture::Texture::CreateStagingBuffer(VkDevice device, VkPhysicalDevice physicalDevice,
-                                      VkDeviceSize size, VkDeviceMemory& bufferMemory) {
+                                      VkDeviceSize size, MemoryAllocation& bufferAllocation) {
     if (physicalDevice == VK_NULL_HANDLE) {
         Window::ShowError("Physical device is null, cannot create staging buffer!");
         return VK_NULL_HANDLE;
@@ -444,30 +412,20 @@ VkBuffer renderer::texture::Texture::CreateStagingBuffer(VkDevice device, VkPhys
         return VK_NULL_HANDLE;
     }
     
-    VkMemoryRequirements memRequirements;
-    vkGetBufferMemoryRequirements(device, stagingBuffer, &memRequirements);
-    
-    VkMemoryAllocateInfo allocInfo = {};
-    allocInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
-    allocInfo.allocationSize = memRequirements.size;
-    allocInfo.memoryTypeIndex = FindMemoryType(physicalDevice, memRequirements.memoryTypeBits,
-                                              VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
-    
-    result = vkAllocateMemory(device, &allocInfo, nullptr, &bufferMemory);
-    if (result != VK_SUCCESS) {
+    if (!VulkanMemoryAllocator::AllocateBuffer(m_memoryAllocator, device, physicalDevice, stagingBuffer,
+                                               MemoryPropertyFlag::HostVisible | MemoryPropertyFlag::HostCoherent,
+                                               bufferAllocation)) {
         Window::ShowError("Failed to allocate staging buffer memory!");
         vkDestroyBuffer(device, stagingBuffer, nullptr);
         return VK_NULL_HANDLE;
     }
     
-    vkBindBufferMemory(device, stagingBuffer, bufferMemory, 0);
-    
     return stagingBuffer;
 }
 
-void renderer::texture::Texture::DestroyStagingBuffer(VkDevice device, VkBuffer buffer, VkDeviceMemory bufferMemory) {
+void renderer::texture::Texture::DestroyStagingBuffer(VkDevice device, VkBuffer buffer, MemoryAllocation& bufferAllocation) {
     vkDestroyBuffer(device, buffer, nullptr);
-    vkFreeMemory(device, bufferMemory, nullptr);
+    VulkanMemoryAllocator::Release(m_memoryAllocator, device, bufferAllocation);
 }
 
 VkDescriptorImageInfo renderer::texture::Texture::GetDescriptorInfo() const {
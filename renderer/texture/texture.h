@@ -11,6 +11,7 @@
 #undef LoadImage  // 取消Windows API的LoadImage宏定义，避免与ImageLoader::LoadImage冲突
 #endif
 
+#include "core/interfaces/imemory_allocator.h"  // 4. 项目头文件（接口）
 #include "image/image_loader.h"  // 4. 项目头文件
 
 namespace renderer {
@@ -40,6 +41,9 @@ public:
     // 设置物理设备（用于内部操作）
     void SetPhysicalDevice(VkPhysicalDevice physicalDevice) { m_physicalDevice = physicalDevice; }
     
+    // 设置共享内存分配器（需在加载之前调用，不拥有所有权，为空时独立分配内存）
+    void SetMemoryAllocator(IMemoryAllocator* memoryAllocator) { m_memoryAllocator = memoryAllocator; }
+    
     // 清理资源
     void Cleanup(VkDevice device);
     
@@ -81,19 +85,15 @@ private:
     void CopyBufferToImage(VkDevice device, VkCommandPool commandPool, VkQueue graphicsQueue,
                           VkBuffer buffer, uint32_t width, uint32_t height);
     
-    // 查找内存类型
-    uint32_t FindMemoryType(VkPhysicalDevice physicalDevice, uint32_t typeFilter, 
-                            VkMemoryPropertyFlags properties);
-    
     // 创建临时缓冲区
     VkBuffer CreateStagingBuffer(VkDevice device, VkPhysicalDevice physicalDevice, 
-                                VkDeviceSize size, VkDeviceMemory& bufferMemory);
+                                VkDeviceSize size, MemoryAllocation& bufferAllocation);
     
     // 销毁临时缓冲区
-    void DestroyStagingBuffer(VkDevice device, VkBuffer buffer, VkDeviceMemory bufferMemory);
+    void DestroyStagingBuffer(VkDevice device, VkBuffer buffer, MemoryAllocation& bufferAllocation);
 
     VkImage m_image = VK_NULL_HANDLE;
-    VkDeviceMemory m_imageMemory = VK_NULL_HANDLE;
+    MemoryAllocation m_imageAllocation;
     VkImageView m_imageView = VK_NULL_HANDLE;
     VkSampler m_sampler = VK_NULL_HANDLE;
     
@@ -103,6 +103,7 @@ private:
     
     VkDevice m_device = VK_NULL_HANDLE;
     VkPhysicalDevice m_physicalDevice = VK_NULL_HANDLE;
+    IMemoryAllocator* m_memoryAllocator = nullptr;  // [BORROW] 共享内存分配器
 };
 
 } // namespace texture
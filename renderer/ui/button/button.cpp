@@ -1,8 +1,8 @@
 #include "ui/button/button.h"  // 1. 对应头文件
 
 #include <algorithm>           // 2. 系统头文件
+#include <atomic>              // 2. 系统头文件
 #include <cmath>               // 2. 系统头文件
-#include <fstream>             // 2. 系统头文件
 #include <stdio.h>             // 2. 系统头文件
 
 #include <vulkan/vulkan.h>     // 3. 第三方库头文件
@@ -29,9 +29,11 @@
 #include "core/config/stretch_params.h"                    // 4. 项目头文件
 #include "renderer/vulkan/vulkan_render_context_factory.h"  // 4. 项目头文件（工厂函数）
 #include "image/image_loader.h"                            // 4. 项目头文件
-#include "shader/shader_loader.h"                          // 4. 项目头文件
 #include "core/interfaces/itext_renderer.h"                // 4. 项目头文件（接口）
 #include "texture/texture.h"                               // 4. 项目头文件
+#include "ui/quad_batch/ui_quad_batch.h"                   // 4. 项目头文件
+#include "vulkan/vulkan_memory_allocator.h"                // 4. 项目头文件
+#include "vulkan/vulkan_pipeline_registry.h"               // 4. 项目头文件
 #include "window/window.h"                                 // 4. 项目头文件
 
 // 在包含 window.h 之后再次取消 LoadImage 宏定义，防止与 ImageLoader::LoadImage 冲突
@@ -61,6 +63,9 @@ bool Button::Initialize(IRenderContext* renderContext,
     }
     
     m_renderContext = renderContext;
+    m_memoryAllocator = renderContext->GetMemoryAllocator();
+    m_pipelineCache = renderContext->GetPipelineCache();
+    m_pipelineRegistry = renderContext->GetPipelineRegistry();
     // 将抽象句柄转换为 Vulkan 类型（存储为抽象类型，在需要时转换）
     m_device = renderContext->GetDevice();
     m_physicalDevice = renderContext->GetPhysicalDevice();
@@ -146,32 +151,14 @@ bool Button::Initialize(IRenderContext* renderContext,
         }
         
         // 纯shader方案不使用Vulkan纹理渲染，只使用颜色
-        // 传统方案才需要加载Vulkan纹理资源
+        // 传统方案才需要加载Vulkan纹理资源（在管线创建之后加载，描述符集使用管线的描述符集布局）
         if (!m_usePureShader) {
-            printf("[BUTTON] Initializing with texture: %s (usePureShader=false)\n", config.texturePath.c_str());
             m_useTexture = true;
-            if (!LoadTexture(config.texturePath)) {
-                printf("[BUTTON] ERROR: Failed to load texture during initialization\n");
-                return false;
-            }
-            printf("[BUTTON] Texture loaded successfully during initialization\n");
         } else {
             printf("[BUTTON] Texture path provided but usePureShader=true, skipping Vulkan texture load\n");
         }
     }
     
-    // 如果使用纹理，先创建描述符集布局（传统渲染方式需要）
-    if (m_useTexture && !m_usePureShader) {
-        printf("[BUTTON] Creating descriptor set layout for texture (useTexture=true, usePureShader=false)\n");
-        if (!CreateDescriptorSetLayout()) {
-            printf("[BUTTON] ERROR: Failed to create descriptor set layout during initialization\n");
-            return false;
-        }
-    } else {
-        printf("[BUTTON] Skipping descriptor set layout creation (useTexture=%s, usePureShader=%s)\n",
-               m_useTexture ? "true" : "false", m_usePureShader ? "true" : "false");
-    }
-    
     // 根据选择的渲染方式创建相应的资源
     if (m_usePureShader) {
         // 纯shader方式：创建全屏四边形和纯shader管线
@@ -191,6 +178,16 @@ bool Button::Initialize(IRenderContext* renderContext,
         }
     }
     
+    // 加载纹理并创建描述符集（管线已携带纹理描述符集布局）
+    if (m_useTexture && !m_usePureShader) {
+        printf("[BUTTON] Initializing with texture: %s (usePureShader=false)\n", m_texturePath.c_str());
+        if (!LoadTexture(m_texturePath)) {
+            printf("[BUTTON] ERROR: Failed to load texture during initialization\n");
+            return false;
+        }
+        printf("[BUTTON] Texture loaded successfully during initialization\n");
+    }
+    
     m_initialized = true;
     return true;
 }
@@ -217,24 +214,8 @@ void Button::Cleanup() {
         m_descriptorPool = nullptr;
     }
     
-    VkDescriptorSetLayout vkDescriptorSetLayout = static_cast<VkDescriptorSetLayout>(m_descriptorSetLayout);
-    if (vkDescriptorSetLayout != VK_NULL_HANDLE) {
-        vkDestroyDescriptorSetLayout(vkDevice, vkDescriptorSetLayout, nullptr);
-        m_descriptorSetLayout = nullptr;
-    }
-    
-    // 清理传统渲染资源
-    VkPipeline vkGraphicsPipeline = static_cast<VkPipeline>(m_graphicsPipeline);
-    if (vkGraphicsPipeline != VK_NULL_HANDLE) {
-        vkDestroyPipeline(vkDevice, vkGraphicsPipeline, nullptr);
-        m_graphicsPipeline = nullptr;
-    }
-    
-    VkPipelineLayout vkPipelineLayout = static_cast<VkPipelineLayout>(m_pipelineLayout);
-    if (vkPipelineLayout != VK_NULL_HANDLE) {
-        vkDestroyPipelineLayout(vkDevice, vkPipelineLayout, nullptr);
-        m_pipelineLayout = nullptr;
-    }
+    // 清理传统渲染资源（管线归还给注册表，描述符集布局随管线共享）
+    VulkanPipelineRegistry::Release(m_pipelineRegistry, vkDevice, m_pipeline);
     
     VkBuffer vkVertexBuffer = static_cast<VkBuffer>(m_vertexBuffer);
     if (vkVertexBuffer != VK_NULL_HANDLE) {
@@ -242,24 +223,10 @@ void Button::Cleanup() {
         m_vertexBuffer = nullptr;
     }
     
-    VkDeviceMemory vkVertexBufferMemory = static_cast<VkDeviceMemory>(m_vertexBufferMemory);
-    if (vkVertexBufferMemory != VK_NULL_HANDLE) {
-        vkFreeMemory(vkDevice, vkVertexBufferMemory, nullptr);
-        m_vertexBufferMemory = nullptr;
-    }
+    VulkanMemoryAllocator::Release(m_memoryAllocator, vkDevice, m_vertexBufferAllocation);
     
     // 清理纯shader渲染资源
-    VkPipeline vkPureShaderPipeline = static_cast<VkPipeline>(m_pureShaderPipeline);
-    if (vkPureShaderPipeline != VK_NULL_HANDLE) {
-        vkDestroyPipeline(vkDevice, vkPureShaderPipeline, nullptr);
-        m_pureShaderPipeline = nullptr;
-    }
-    
-    VkPipelineLayout vkPureShaderPipelineLayout = static_cast<VkPipelineLayout>(m_pureShaderPipelineLayout);
-    if (vkPureShaderPipelineLayout != VK_NULL_HANDLE) {
-        vkDestroyPipelineLayout(vkDevice, vkPureShaderPipelineLayout, nullptr);
-        m_pureShaderPipelineLayout = nullptr;
-    }
+    VulkanPipelineRegistry::Release(m_pipelineRegistry, vkDevice, m_pureShaderPipeline);
     
     VkBuffer vkFullscreenQuadBuffer = static_cast<VkBuffer>(m_fullscreenQuadBuffer);
     if (vkFullscreenQuadBuffer != VK_NULL_HANDLE) {
@@ -267,11 +234,7 @@ void Button::Cleanup() {
         m_fullscreenQuadBuffer = nullptr;
     }
     
-    VkDeviceMemory vkFullscreenQuadBufferMemory = static_cast<VkDeviceMemory>(m_fullscreenQuadBufferMemory);
-    if (vkFullscreenQuadBufferMemory != VK_NULL_HANDLE) {
-        vkFreeMemory(vkDevice, vkFullscreenQuadBufferMemory, nullptr);
-        m_fullscreenQuadBufferMemory = nullptr;
-    }
+    VulkanMemoryAllocator::Release(m_memoryAllocator, vkDevice, m_fullscreenQuadBufferAllocation);
     
     m_initialized = false;
 }
@@ -313,37 +276,22 @@ bool Button::CreateButtonBuffer() {
     }
     m_vertexBuffer = vkVertexBuffer;
     
-    // 分配内存
-    VkMemoryRequirements memRequirements;
-    vkGetBufferMemoryRequirements(vkDevice, vkVertexBuffer, &memRequirements);
-    
-    VkMemoryAllocateInfo allocInfo = {};
-    allocInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
-    allocInfo.allocationSize = memRequirements.size;
-    allocInfo.memoryTypeIndex = FindMemoryType(memRequirements.memoryTypeBits, 
-                                                MemoryPropertyFlag::HostVisible | MemoryPropertyFlag::HostCoherent);
-    
-    VkDeviceMemory vkVertexBufferMemory = VK_NULL_HANDLE;
-    if (vkAllocateMemory(vkDevice, &allocInfo, nullptr, &vkVertexBufferMemory) != VK_SUCCESS) {
+    // 分配内存（从共享分配器子分配，内存已持久映射）
+    if (!VulkanMemoryAllocator::AllocateBuffer(m_memoryAllocator, vkDevice, static_cast<VkPhysicalDevice>(m_physicalDevice),
+                                               vkVertexBuffer, MemoryPropertyFlag::HostVisible | MemoryPropertyFlag::HostCoherent,
+                                               m_vertexBufferAllocation)) {
         Window::ShowError("Failed to allocate button vertex buffer memory!");
         return false;
     }
-    m_vertexBufferMemory = vkVertexBufferMemory;
-    
-    vkBindBufferMemory(vkDevice, vkVertexBuffer, vkVertexBufferMemory, 0);
     
     // 填充数据
-    void* data;
-    vkMapMemory(vkDevice, vkVertexBufferMemory, 0, bufferSize, 0, &data);
-    memcpy(data, buttonVertices, (size_t)bufferSize);
-    vkUnmapMemory(vkDevice, vkVertexBufferMemory);
+    VulkanMemoryAllocator::Write(vkDevice, m_vertexBufferAllocation, buttonVertices, bufferSize);
     
     return true;
 }
 
 void Button::UpdateButtonBuffer() {
-    VkDeviceMemory vkVertexBufferMemory = static_cast<VkDeviceMemory>(m_vertexBufferMemory);
-    if (!m_initialized || vkVertexBufferMemory == VK_NULL_HANDLE) return;
+    if (!m_initialized || !m_vertexBufferAllocation.IsValid()) return;
     
     VkDevice vkDevice = static_cast<VkDevice>(m_device);
     
@@ -381,262 +329,59 @@ void Button::UpdateButtonBuffer() {
     };
     
     VkDeviceSize bufferSize = sizeof(buttonVertices);
-    void* data;
-    vkMapMemory(vkDevice, vkVertexBufferMemory, 0, bufferSize, 0, &data);
-    memcpy(data, buttonVertices, (size_t)bufferSize);
-    vkUnmapMemory(vkDevice, vkVertexBufferMemory);
-}
-
-uint32_t Button::FindMemoryType(uint32_t typeFilter, MemoryPropertyFlag properties) {
-    if (m_renderContext) {
-        // 使用抽象类型，直接调用渲染上下文的方法
-        return m_renderContext->FindMemoryType(typeFilter, properties);
-    }
-    
-    // 向后兼容：如果没有渲染上下文，使用旧方法（需要转换为 Vulkan 类型）
-    VkPhysicalDevice vkPhysicalDevice = static_cast<VkPhysicalDevice>(m_physicalDevice);
-    VkPhysicalDeviceMemoryProperties memProperties;
-    vkGetPhysicalDeviceMemoryProperties(vkPhysicalDevice, &memProperties);
-    
-    // 将抽象类型转换为 Vulkan 类型
-    VkMemoryPropertyFlags vkProperties = 0;
-    if ((properties & MemoryPropertyFlag::DeviceLocal) != MemoryPropertyFlag::None) {
-        vkProperties |= VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT;
-    }
-    if ((properties & MemoryPropertyFlag::HostVisible) != MemoryPropertyFlag::None) {
-        vkProperties |= VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT;
-    }
-    if ((properties & MemoryPropertyFlag::HostCoherent) != MemoryPropertyFlag::None) {
-        vkProperties |= VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
-    }
-    if ((properties & MemoryPropertyFlag::HostCached) != MemoryPropertyFlag::None) {
-        vkProperties |= VK_MEMORY_PROPERTY_HOST_CACHED_BIT;
-    }
-    
-    for (uint32_t i = 0; i < memProperties.memoryTypeCount; i++) {
-        if ((typeFilter & (1 << i)) && 
-            (memProperties.memoryTypes[i].propertyFlags & vkProperties) == vkProperties) {
-            return i;
-        }
-    }
-    
-    Window::ShowError("Failed to find suitable memory type for button!");
-    return 0;
+    VulkanMemoryAllocator::Write(vkDevice, m_vertexBufferAllocation, buttonVertices, bufferSize);
 }
 
 bool Button::CreatePipeline(RenderPassHandle renderPass) {
     // 将抽象类型转换为 Vulkan 类型
-    VkRenderPass vkRenderPass = static_cast<VkRenderPass>(renderPass);
     VkDevice vkDevice = static_cast<VkDevice>(m_device);
-    // 加载shader（使用按钮专用的shader，支持纹理）
-    std::vector<char> vertCode = renderer::shader::ShaderLoader::LoadSPIRV("renderer/ui/button/button.vert.spv");
-    std::vector<char> fragCode = renderer::shader::ShaderLoader::LoadSPIRV("renderer/ui/button/button.frag.spv");
-    
-    if (vertCode.empty() || fragCode.empty()) {
-        // 如果SPIR-V文件不存在，尝试从源码编译
-        #ifdef USE_SHADERC
-        std::ifstream vertFile("renderer/ui/button/button.vert");
-        std::ifstream fragFile("renderer/ui/button/button.frag");
-        if (vertFile.is_open() && fragFile.is_open()) {
-            std::string vertSource((std::istreambuf_iterator<char>(vertFile)), std::istreambuf_iterator<char>());
-            std::string fragSource((std::istreambuf_iterator<char>(fragFile)), std::istreambuf_iterator<char>());
-            vertCode = renderer::shader::ShaderLoader::CompileGLSLFromSource(vertSource, ShaderStage::Vertex, "button.vert");
-            fragCode = renderer::shader::ShaderLoader::CompileGLSLFromSource(fragSource, ShaderStage::Fragment, "button.frag");
-        }
-        #endif
-    }
-    
-    if (vertCode.empty() || fragCode.empty()) {
-        Window::ShowError("Failed to load shaders for button!");
-        return false;
-    }
-    
-    // 使用抽象类型，然后在需要时转换为Vulkan类型
-    ShaderModuleHandle vertShaderModuleHandle = renderer::shader::ShaderLoader::CreateShaderModuleFromSPIRV(static_cast<DeviceHandle>(vkDevice), vertCode);
-    ShaderModuleHandle fragShaderModuleHandle = renderer::shader::ShaderLoader::CreateShaderModuleFromSPIRV(static_cast<DeviceHandle>(vkDevice), fragCode);
     
-    if (vertShaderModuleHandle == nullptr || fragShaderModuleHandle == nullptr) {
-        Window::ShowError("Failed to create shader modules for button!");
-        return false;
-    }
-    
-    // 将抽象句柄转换为Vulkan类型用于创建管线
-    VkShaderModule vertShaderModule = static_cast<VkShaderModule>(vertShaderModuleHandle);
-    VkShaderModule fragShaderModule = static_cast<VkShaderModule>(fragShaderModuleHandle);
-    
-    if (vertShaderModule == VK_NULL_HANDLE || fragShaderModule == VK_NULL_HANDLE) {
-        Window::ShowError("Failed to create shader modules for button!");
+    // 相同描述的按钮（和滑块）共享同一条管线，只有第一次获取时才加载shader并编译
+    GraphicsPipelineDesc desc = GetPipelineDesc(false, m_useTexture, renderPass);
+    SharedPipeline pipeline;
+    if (!VulkanPipelineRegistry::Acquire(m_pipelineRegistry, vkDevice, static_cast<VkPipelineCache>(m_pipelineCache), desc, pipeline)) {
+        Window::ShowError("Failed to create graphics pipeline for button!");
         return false;
     }
     
-    // Shader阶段
-    VkPipelineShaderStageCreateInfo vertShaderStageInfo = {};
-    vertShaderStageInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
-    vertShaderStageInfo.stage = VK_SHADER_STAGE_VERTEX_BIT;
-    vertShaderStageInfo.module = vertShaderModule;
-    vertShaderStageInfo.pName = "main";
-    
-    VkPipelineShaderStageCreateInfo fragShaderStageInfo = {};
-    fragShaderStageInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
-    fragShaderStageInfo.stage = VK_SHADER_STAGE_FRAGMENT_BIT;
-    fragShaderStageInfo.module = fragShaderModule;
-    fragShaderStageInfo.pName = "main";
-    
-    VkPipelineShaderStageCreateInfo shaderStages[] = {vertShaderStageInfo, fragShaderStageInfo};
-    
-    // 顶点输入
-    VkVertexInputBindingDescription bindingDescription = {};
-    bindingDescription.binding = 0;
-    bindingDescription.stride = sizeof(float) * 6; // x, y, r, g, b, a
-    bindingDescription.inputRate = VK_VERTEX_INPUT_RATE_VERTEX;
-    
-    VkVertexInputAttributeDescription attributeDescriptions[2] = {};
-    attributeDescriptions[0].binding = 0;
-    attributeDescriptions[0].location = 0;
-    attributeDescriptions[0].format = VK_FORMAT_R32G32_SFLOAT;
-    attributeDescriptions[0].offset = 0;
-    
-    attributeDescriptions[1].binding = 0;
-    attributeDescriptions[1].location = 1;
-    attributeDescriptions[1].format = VK_FORMAT_R32G32B32A32_SFLOAT;
-    attributeDescriptions[1].offset = sizeof(float) * 2;
-    
-    VkPipelineVertexInputStateCreateInfo vertexInputInfo = {};
-    vertexInputInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO;
-    vertexInputInfo.vertexBindingDescriptionCount = 1;
-    vertexInputInfo.pVertexBindingDescriptions = &bindingDescription;
-    vertexInputInfo.vertexAttributeDescriptionCount = 2;
-    vertexInputInfo.pVertexAttributeDescriptions = attributeDescriptions;
-    
-    // 输入装配
-    VkPipelineInputAssemblyStateCreateInfo inputAssembly = {};
-    inputAssembly.sType = VK_STRUCTURE_TYPE_PIPELINE_INPUT_ASSEMBLY_STATE_CREATE_INFO;
-    inputAssembly.topology = VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
-    inputAssembly.primitiveRestartEnable = VK_FALSE;
-    
-    // 视口（使用动态状态，在渲染时设置）
-    VkPipelineViewportStateCreateInfo viewportState = {};
-    viewportState.sType = VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_STATE_CREATE_INFO;
-    viewportState.viewportCount = 1;
-    viewportState.pViewports = nullptr;  // Dynamic
-    viewportState.scissorCount = 1;
-    viewportState.pScissors = nullptr;    // Dynamic
-    
-    // 光栅化
-    VkPipelineRasterizationStateCreateInfo rasterizer = {};
-    rasterizer.sType = VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_STATE_CREATE_INFO;
-    rasterizer.depthClampEnable = VK_FALSE;
-    rasterizer.rasterizerDiscardEnable = VK_FALSE;
-    rasterizer.polygonMode = VK_POLYGON_MODE_FILL;
-    rasterizer.lineWidth = 1.0f;
-    rasterizer.cullMode = VK_CULL_MODE_NONE;
-    rasterizer.frontFace = VK_FRONT_FACE_COUNTER_CLOCKWISE;
-    rasterizer.depthBiasEnable = VK_FALSE;
-    
-    // 多重采样
-    VkPipelineMultisampleStateCreateInfo multisampling = {};
-    multisampling.sType = VK_STRUCTURE_TYPE_PIPELINE_MULTISAMPLE_STATE_CREATE_INFO;
-    multisampling.sampleShadingEnable = VK_FALSE;
-    multisampling.rasterizationSamples = VK_SAMPLE_COUNT_1_BIT;
-    
-    // 颜色混合
-    VkPipelineColorBlendAttachmentState colorBlendAttachment = {};
-    colorBlendAttachment.colorWriteMask = VK_COLOR_COMPONENT_R_BIT | VK_COLOR_COMPONENT_G_BIT | 
-                                          VK_COLOR_COMPONENT_B_BIT | VK_COLOR_COMPONENT_A_BIT;
-    colorBlendAttachment.blendEnable = VK_TRUE;
-    colorBlendAttachment.srcColorBlendFactor = VK_BLEND_FACTOR_SRC_ALPHA;
-    colorBlendAttachment.dstColorBlendFactor = VK_BLEND_FACTOR_ONE_MINUS_SRC_ALPHA;
-    colorBlendAttachment.colorBlendOp = VK_BLEND_OP_ADD;
-    // Alpha混合：保持目标alpha不变，避免影响后续渲染
-    // 使用ONE作为源alpha因子，ONE作为目标alpha因子，这样alpha值会累加
-    // 但实际上我们想要的是：如果按钮不透明，alpha应该是1.0；如果透明，保持目标alpha
-    // 使用ONE_MINUS_SRC_ALPHA作为目标alpha因子，这样：resultAlpha = srcAlpha * 1 + dstAlpha * (1 - srcAlpha)
-    // 当srcAlpha=1时，resultAlpha=1；当srcAlpha=0时，resultAlpha=dstAlpha（保持不变）
-    colorBlendAttachment.srcAlphaBlendFactor = VK_BLEND_FACTOR_ONE;
-    colorBlendAttachment.dstAlphaBlendFactor = VK_BLEND_FACTOR_ONE_MINUS_SRC_ALPHA;
-    colorBlendAttachment.alphaBlendOp = VK_BLEND_OP_ADD;
-    
-    VkPipelineColorBlendStateCreateInfo colorBlending = {};
-    colorBlending.sType = VK_STRUCTURE_TYPE_PIPELINE_COLOR_BLEND_STATE_CREATE_INFO;
-    colorBlending.logicOpEnable = VK_FALSE;
-    colorBlending.attachmentCount = 1;
-    colorBlending.pAttachments = &colorBlendAttachment;
-    
-    // Dynamic states (viewport and scissor)
-    VkDynamicState dynamicStates[] = {
-        VK_DYNAMIC_STATE_VIEWPORT,
-        VK_DYNAMIC_STATE_SCISSOR
-    };
-    
-    VkPipelineDynamicStateCreateInfo dynamicState = {};
-    dynamicState.sType = VK_STRUCTURE_TYPE_PIPELINE_DYNAMIC_STATE_CREATE_INFO;
-    dynamicState.dynamicStateCount = 2;
-    dynamicState.pDynamicStates = dynamicStates;
-    
-    // 深度测试状态（禁用深度测试，因为渲染通道没有深度附件）
-    VkPipelineDepthStencilStateCreateInfo depthStencil = {};
-    depthStencil.sType = VK_STRUCTURE_TYPE_PIPELINE_DEPTH_STENCIL_STATE_CREATE_INFO;
-    depthStencil.depthTestEnable = VK_FALSE;
-    depthStencil.depthWriteEnable = VK_FALSE;
-    depthStencil.depthCompareOp = VK_COMPARE_OP_ALWAYS;
-    depthStencil.depthBoundsTestEnable = VK_FALSE;
-    depthStencil.stencilTestEnable = VK_FALSE;
-    
-    // Push constants: position(2) + size(2) + screenSize(2) + useTexture(1) + shapeType(1) + hoverEffect(1) = 9 floats
-    VkPushConstantRange pushConstantRange = {};
-    pushConstantRange.stageFlags = VK_SHADER_STAGE_VERTEX_BIT | VK_SHADER_STAGE_FRAGMENT_BIT;
-    pushConstantRange.offset = 0;
-    pushConstantRange.size = sizeof(float) * 9; // position(2) + size(2) + screenSize(2) + useTexture(1) + shapeType(1) + hoverEffect(1)
-    
-    // Pipeline layout（如果使用纹理，需要包含描述符集布局）
-    VkDescriptorSetLayout vkDescriptorSetLayout = static_cast<VkDescriptorSetLayout>(m_descriptorSetLayout);
-    VkDescriptorSetLayout setLayouts[] = {vkDescriptorSetLayout};
-    VkPipelineLayoutCreateInfo pipelineLayoutInfo = {};
-    pipelineLayoutInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
-    pipelineLayoutInfo.setLayoutCount = (vkDescriptorSetLayout != VK_NULL_HANDLE) ? 1 : 0;
-    pipelineLayoutInfo.pSetLayouts = (vkDescriptorSetLayout != VK_NULL_HANDLE) ? setLayouts : nullptr;
-    pipelineLayoutInfo.pushConstantRangeCount = 1;
-    pipelineLayoutInfo.pPushConstantRanges = &pushConstantRange;
-    
-    VkPipelineLayout vkPipelineLayout = VK_NULL_HANDLE;
-    if (vkCreatePipelineLayout(vkDevice, &pipelineLayoutInfo, nullptr, &vkPipelineLayout) != VK_SUCCESS) {
-        vkDestroyShaderModule(vkDevice, vertShaderModule, nullptr);
-        vkDestroyShaderModule(vkDevice, fragShaderModule, nullptr);
-        Window::ShowError("Failed to create pipeline layout for button!");
-        return false;
-    }
-    m_pipelineLayout = vkPipelineLayout;
-    
-    // 创建管线
-    VkGraphicsPipelineCreateInfo pipelineInfo = {};
-    pipelineInfo.sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO;
-    pipelineInfo.stageCount = 2;
-    pipelineInfo.pStages = shaderStages;
-    pipelineInfo.pVertexInputState = &vertexInputInfo;
-    pipelineInfo.pInputAssemblyState = &inputAssembly;
-    pipelineInfo.pViewportState = &viewportState;
-    pipelineInfo.pRasterizationState = &rasterizer;
-    pipelineInfo.pMultisampleState = &multisampling;
-    pipelineInfo.pDepthStencilState = &depthStencil;
-    pipelineInfo.pColorBlendState = &colorBlending;
-    pipelineInfo.pDynamicState = &dynamicState;
-    pipelineInfo.layout = vkPipelineLayout;
-    pipelineInfo.renderPass = vkRenderPass;
-    pipelineInfo.subpass = 0;
-    
-    VkPipeline vkGraphicsPipeline = VK_NULL_HANDLE;
-    VkResult result = vkCreateGraphicsPipelines(vkDevice, VK_NULL_HANDLE, 1, &pipelineInfo, nullptr, &vkGraphicsPipeline);
-    m_graphicsPipeline = vkGraphicsPipeline;
-    
-    vkDestroyShaderModule(vkDevice, vertShaderModule, nullptr);
-    vkDestroyShaderModule(vkDevice, fragShaderModule, nullptr);
+    // 纹理状态变化时会重新获取对应的管线变体：新变体获取成功后再归还旧引用，
+    // 旧管线由注册表退役，等引用它的在途帧完成后才销毁
+    VulkanPipelineRegistry::Release(m_pipelineRegistry, vkDevice, m_pipeline);
+    m_pipeline = pipeline;
     
-    if (result != VK_SUCCESS) {
-        Window::ShowError("Failed to create graphics pipeline for button!");
-        return false;
+    return true;
+}
+
+GraphicsPipelineDesc Button::GetPipelineDesc(bool usePureShader, bool useTexture, RenderPassHandle renderPass) {
+    GraphicsPipelineDesc desc;
+    desc.blendMode = PipelineBlendMode::AlphaBlend;
+    desc.renderPass = renderPass;
+    
+    if (usePureShader) {
+        // 顶点输入（只有位置，没有颜色）
+        desc.vertShaderPath = "renderer/ui/button/button_pure.vert.spv";
+        desc.fragShaderPath = "renderer/ui/button/button_pure.frag.spv";
+        desc.vertexStride = sizeof(float) * 2; // x, y
+        desc.vertexAttributes = { { 0, VertexAttributeFormat::Float2, 0 } };
+        // Push constants: position(2) + size(2) + screenSize(2) + color(4) + shapeType(1) = 11 floats
+        desc.pushConstantStages = static_cast<uint32_t>(ShaderStage::Fragment);
+        desc.pushConstantSize = sizeof(float) * 11;
+    } else {
+        desc.vertShaderPath = "renderer/ui/button/button.vert.spv";
+        desc.fragShaderPath = "renderer/ui/button/button.frag.spv";
+        desc.vertexStride = sizeof(float) * 6; // x, y, r, g, b, a
+        desc.vertexAttributes = {
+            { 0, VertexAttributeFormat::Float2, 0 },
+            { 1, VertexAttributeFormat::Float4, sizeof(float) * 2 }
+        };
+        // Push constants: position(2) + size(2) + screenSize(2) + useTexture(1) + shapeType(1) + hoverEffect(1) = 9 floats
+        desc.pushConstantStages = static_cast<uint32_t>(ShaderStage::Vertex) | static_cast<uint32_t>(ShaderStage::Fragment);
+        desc.pushConstantSize = sizeof(float) * 9;
+        // 使用纹理时管线布局包含一个组合图像采样器描述符集
+        desc.textureSamplerCount = useTexture ? 1 : 0;
     }
     
-    return true;
+    return desc;
 }
 
 void Button::Render(CommandBufferHandle commandBuffer, Extent2D extent) {
@@ -649,9 +394,9 @@ void Button::Render(CommandBufferHandle commandBuffer, Extent2D extent) {
     
     // 将成员变量转换为 Vulkan 类型
     VkDevice vkDevice = static_cast<VkDevice>(m_device);
-    VkPipeline vkGraphicsPipeline = static_cast<VkPipeline>(m_graphicsPipeline);
+    VkPipeline vkGraphicsPipeline = static_cast<VkPipeline>(m_pipeline.pipeline);
     VkBuffer vkVertexBuffer = static_cast<VkBuffer>(m_vertexBuffer);
-    VkPipelineLayout vkPipelineLayout = static_cast<VkPipelineLayout>(m_pipelineLayout);
+    VkPipelineLayout vkPipelineLayout = static_cast<VkPipelineLayout>(m_pipeline.layout);
     VkDescriptorSet vkDescriptorSet = static_cast<VkDescriptorSet>(m_descriptorSet);
     
     // 根据选择的渲染方式调用相应的渲染方法
@@ -661,14 +406,13 @@ void Button::Render(CommandBufferHandle commandBuffer, Extent2D extent) {
         // 传统渲染方式
         if (!m_initialized || vkGraphicsPipeline == VK_NULL_HANDLE || vkVertexBuffer == VK_NULL_HANDLE) return;
         
-        // 调试输出：显示按钮信息（每60帧一次）
-        static int renderDebugCount = 0;
-        if (renderDebugCount % 60 == 0) {
+        // 调试输出：显示按钮信息（每60帧一次，背景按钮和控件可能在不同录制线程上渲染）
+        static std::atomic<int> renderDebugCount{0};
+        if (renderDebugCount.fetch_add(1) % 60 == 0) {
             printf("[BUTTON RENDER] Button: pos=(%.2f, %.2f), size=(%.2f, %.2f), useTexture=%s, descriptorSet=%p, texturePath=%s\n",
                    m_x, m_y, m_width, m_height, m_useTexture ? "true" : "false", 
                    (void*)m_descriptorSet, m_texturePath.c_str());
         }
-        renderDebugCount++;
         
         // 绑定管线
         vkCmdBindPipeline(vkCommandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, vkGraphicsPipeline);
@@ -732,6 +476,62 @@ void Button::Render(CommandBufferHandle commandBuffer, Extent2D extent) {
     }
 }
 
+bool Button::AppendToBatch(UIQuadBatch& batch, Extent2D extent) const {
+    if (!m_visible) return true;
+    
+    // 纯shader方式使用全屏四边形和自己的视口，保持逐按钮渲染
+    if (m_usePureShader || !m_initialized || !m_pipeline.IsValid()) return false;
+    
+    // 与 Render() 相同的坐标转换（Scaled模式：逻辑坐标 -> 屏幕坐标）
+    float renderX = m_x;
+    float renderY = m_y;
+    float renderWidth = m_width;
+    float renderHeight = m_height;
+    float renderScreenWidth = (float)extent.width;
+    float renderScreenHeight = (float)extent.height;
+    
+    if (m_stretchParams) {
+        renderX = m_x * m_stretchParams->m_stretchScaleX + m_stretchParams->m_marginX;
+        renderY = m_y * m_stretchParams->m_stretchScaleY + m_stretchParams->m_marginY;
+        renderWidth = m_width * m_stretchParams->m_stretchScaleX;
+        renderHeight = m_height * m_stretchParams->m_stretchScaleY;
+        renderScreenWidth = m_stretchParams->m_screenWidth;
+        renderScreenHeight = m_stretchParams->m_screenHeight;
+    }
+    
+    UIQuadInstance instance(renderX, renderY, renderWidth, renderHeight, renderScreenWidth, renderScreenHeight);
+    instance.params[2] = (float)m_shapeType;
+    
+    bool hovering = m_enableHoverEffect && m_isHovering;
+    if (m_useTexture && m_descriptorSet != nullptr) {
+        // 纹理按钮的悬停效果在着色器中应用（正数=变暗, 负数=变淡）
+        if (hovering) {
+            instance.params[3] = m_hoverEffectType == 0 ? m_hoverEffectStrength : -m_hoverEffectStrength;
+        }
+        batch.Add(instance, m_descriptorSet);
+        return true;
+    }
+    
+    // 颜色按钮的悬停效果在CPU端应用（与 UpdateButtonBuffer 一致）
+    float renderR = m_colorR;
+    float renderG = m_colorG;
+    float renderB = m_colorB;
+    float renderA = m_colorA;
+    if (hovering) {
+        if (m_hoverEffectType == 0) {
+            float darkenFactor = 1.0f - m_hoverEffectStrength;
+            renderR *= darkenFactor;
+            renderG *= darkenFactor;
+            renderB *= darkenFactor;
+        } else if (m_hoverEffectType == 1) {
+            renderA *= (1.0f - m_hoverEffectStrength);
+        }
+    }
+    instance.SetColor(renderR, renderG, renderB, renderA);
+    batch.Add(instance);
+    return true;
+}
+
 void Button::RenderText(CommandBufferHandle commandBuffer, Extent2D extent,
                         const void* viewport, const void* scissor) {
     // 如果按钮不可见，不渲染文本
@@ -872,6 +672,7 @@ bool Button::LoadTexture(const std::string& texturePath) {
     
     // 创建纹理对象
     m_texture = std::make_unique<renderer::texture::Texture>();
+    m_texture->SetMemoryAllocator(m_memoryAllocator);
     
     // 加载纹理
     if (!m_texture->LoadFromFile(vkDevice, vkPhysicalDevice, vkCommandPool, vkGraphicsQueue, texturePath)) {
@@ -880,10 +681,9 @@ bool Button::LoadTexture(const std::string& texturePath) {
         return false;
     }
     
-    // 创建描述符集布局（如果还没有创建）
-    VkDescriptorSetLayout vkDescriptorSetLayout = static_cast<VkDescriptorSetLayout>(m_descriptorSetLayout);
-    if (vkDescriptorSetLayout == VK_NULL_HANDLE) {
-        if (!CreateDescriptorSetLayout()) {
+    // 当前管线不带纹理描述符集布局时（按钮创建时没有纹理），切换到带采样器的管线变体
+    if (m_pipeline.descriptorSetLayout == nullptr) {
+        if (!CreatePipeline(m_renderPass)) {
             CleanupTexture();
             m_useTexture = false;  // 创建失败，设置为false
             return false;
@@ -914,34 +714,6 @@ void Button::CleanupTexture() {
     // m_useTexture会在LoadTexture成功后设置为true，失败时保持原值或由调用者设置
 }
 
-bool Button::CreateDescriptorSetLayout() {
-    // 将抽象类型转换为 Vulkan 类型
-    VkDevice vkDevice = static_cast<VkDevice>(m_device);
-    
-    // 创建描述符集布局，用于绑定纹理采样器
-    VkDescriptorSetLayoutBinding samplerLayoutBinding = {};
-    samplerLayoutBinding.binding = 0;
-    samplerLayoutBinding.descriptorCount = 1;
-    samplerLayoutBinding.descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
-    samplerLayoutBinding.pImmutableSamplers = nullptr;
-    samplerLayoutBinding.stageFlags = VK_SHADER_STAGE_FRAGMENT_BIT;
-    
-    VkDescriptorSetLayoutCreateInfo layoutInfo = {};
-    layoutInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
-    layoutInfo.bindingCount = 1;
-    layoutInfo.pBindings = &samplerLayoutBinding;
-    
-    VkDescriptorSetLayout vkDescriptorSetLayout = VK_NULL_HANDLE;
-    VkResult result = vkCreateDescriptorSetLayout(vkDevice, &layoutInfo, nullptr, &vkDescriptorSetLayout);
-    if (result != VK_SUCCESS) {
-        Window::ShowError("Failed to create descriptor set layout for button texture!");
-        return false;
-    }
-    m_descriptorSetLayout = vkDescriptorSetLayout;
-    
-    return true;
-}
-
 bool Button::HasTexture() const {
     return m_useTexture && m_texture != nullptr && m_texture->IsValid();
 }
@@ -981,7 +753,7 @@ bool Button::CreateDescriptorSet() {
     m_descriptorPool = vkDescriptorPool;
     
     // 分配描述符集
-    VkDescriptorSetLayout vkDescriptorSetLayout = static_cast<VkDescriptorSetLayout>(m_descriptorSetLayout);
+    VkDescriptorSetLayout vkDescriptorSetLayout = static_cast<VkDescriptorSetLayout>(m_pipeline.descriptorSetLayout);
     VkDescriptorSetLayout setLayouts[] = {vkDescriptorSetLayout};
     VkDescriptorSetAllocateInfo allocInfo = {};
     allocInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
@@ -1195,235 +967,26 @@ bool Button::CreateFullscreenQuadBuffer() {
     }
     m_fullscreenQuadBuffer = vkFullscreenQuadBuffer;
     
-    // 分配内存
-    VkMemoryRequirements memRequirements;
-    vkGetBufferMemoryRequirements(vkDevice, vkFullscreenQuadBuffer, &memRequirements);
-    
-    VkMemoryAllocateInfo allocInfo = {};
-    allocInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
-    allocInfo.allocationSize = memRequirements.size;
-    allocInfo.memoryTypeIndex = FindMemoryType(memRequirements.memoryTypeBits, 
-                                                MemoryPropertyFlag::HostVisible | MemoryPropertyFlag::HostCoherent);
-    
-    VkDeviceMemory vkFullscreenQuadBufferMemory = VK_NULL_HANDLE;
-    if (vkAllocateMemory(vkDevice, &allocInfo, nullptr, &vkFullscreenQuadBufferMemory) != VK_SUCCESS) {
+    // 分配内存（从共享分配器子分配）
+    if (!VulkanMemoryAllocator::AllocateBuffer(m_memoryAllocator, vkDevice, static_cast<VkPhysicalDevice>(m_physicalDevice),
+                                               vkFullscreenQuadBuffer, MemoryPropertyFlag::HostVisible | MemoryPropertyFlag::HostCoherent,
+                                               m_fullscreenQuadBufferAllocation)) {
         Window::ShowError("Failed to allocate fullscreen quad vertex buffer memory!");
         return false;
     }
-    m_fullscreenQuadBufferMemory = vkFullscreenQuadBufferMemory;
-    
-    vkBindBufferMemory(vkDevice, vkFullscreenQuadBuffer, vkFullscreenQuadBufferMemory, 0);
     
     // 填充数据
-    void* data;
-    vkMapMemory(vkDevice, vkFullscreenQuadBufferMemory, 0, bufferSize, 0, &data);
-    memcpy(data, quadVertices, (size_t)bufferSize);
-    vkUnmapMemory(vkDevice, vkFullscreenQuadBufferMemory);
+    VulkanMemoryAllocator::Write(vkDevice, m_fullscreenQuadBufferAllocation, quadVertices, bufferSize);
     
     return true;
 }
 
 bool Button::CreatePureShaderPipeline(RenderPassHandle renderPass) {
     // 将抽象类型转换为 Vulkan 类型
-    VkRenderPass vkRenderPass = static_cast<VkRenderPass>(renderPass);
     VkDevice vkDevice = static_cast<VkDevice>(m_device);
-    // 加载纯shader（使用新创建的shader文件）
-    std::vector<char> vertCode = renderer::shader::ShaderLoader::LoadSPIRV("renderer/ui/button/button_pure.vert.spv");
-    std::vector<char> fragCode = renderer::shader::ShaderLoader::LoadSPIRV("renderer/ui/button/button_pure.frag.spv");
-    
-    if (vertCode.empty() || fragCode.empty()) {
-        // 如果SPIR-V文件不存在，尝试从源码编译
-        #ifdef USE_SHADERC
-        std::ifstream vertFile("renderer/ui/button/button_pure.vert");
-        std::ifstream fragFile("renderer/ui/button/button_pure.frag");
-        if (vertFile.is_open() && fragFile.is_open()) {
-            std::string vertSource((std::istreambuf_iterator<char>(vertFile)), std::istreambuf_iterator<char>());
-            std::string fragSource((std::istreambuf_iterator<char>(fragFile)), std::istreambuf_iterator<char>());
-            vertCode = renderer::shader::ShaderLoader::CompileGLSLFromSource(vertSource, ShaderStage::Vertex, "button_pure.vert");
-            fragCode = renderer::shader::ShaderLoader::CompileGLSLFromSource(fragSource, ShaderStage::Fragment, "button_pure.frag");
-        }
-        #endif
-    }
-    
-    if (vertCode.empty() || fragCode.empty()) {
-        Window::ShowError("Failed to load pure shader shaders for button!");
-        return false;
-    }
     
-    // 使用抽象类型，然后在需要时转换为Vulkan类型
-    ShaderModuleHandle vertShaderModuleHandle = renderer::shader::ShaderLoader::CreateShaderModuleFromSPIRV(static_cast<DeviceHandle>(vkDevice), vertCode);
-    ShaderModuleHandle fragShaderModuleHandle = renderer::shader::ShaderLoader::CreateShaderModuleFromSPIRV(static_cast<DeviceHandle>(vkDevice), fragCode);
-    
-    if (vertShaderModuleHandle == nullptr || fragShaderModuleHandle == nullptr) {
-        Window::ShowError("Failed to create shader modules for button!");
-        return false;
-    }
-    
-    // 将抽象句柄转换为Vulkan类型用于创建管线
-    VkShaderModule vertShaderModule = static_cast<VkShaderModule>(vertShaderModuleHandle);
-    VkShaderModule fragShaderModule = static_cast<VkShaderModule>(fragShaderModuleHandle);
-    
-    if (vertShaderModule == VK_NULL_HANDLE || fragShaderModule == VK_NULL_HANDLE) {
-        Window::ShowError("Failed to create pure shader modules for button!");
-        return false;
-    }
-    
-    // Shader阶段
-    VkPipelineShaderStageCreateInfo vertShaderStageInfo = {};
-    vertShaderStageInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
-    vertShaderStageInfo.stage = VK_SHADER_STAGE_VERTEX_BIT;
-    vertShaderStageInfo.module = vertShaderModule;
-    vertShaderStageInfo.pName = "main";
-    
-    VkPipelineShaderStageCreateInfo fragShaderStageInfo = {};
-    fragShaderStageInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
-    fragShaderStageInfo.stage = VK_SHADER_STAGE_FRAGMENT_BIT;
-    fragShaderStageInfo.module = fragShaderModule;
-    fragShaderStageInfo.pName = "main";
-    
-    VkPipelineShaderStageCreateInfo shaderStages[] = {vertShaderStageInfo, fragShaderStageInfo};
-    
-    // 顶点输入（只有位置，没有颜色）
-    VkVertexInputBindingDescription bindingDescription = {};
-    bindingDescription.binding = 0;
-    bindingDescription.stride = sizeof(float) * 2; // x, y
-    bindingDescription.inputRate = VK_VERTEX_INPUT_RATE_VERTEX;
-    
-    VkVertexInputAttributeDescription attributeDescription = {};
-    attributeDescription.binding = 0;
-    attributeDescription.location = 0;
-    attributeDescription.format = VK_FORMAT_R32G32_SFLOAT;
-    attributeDescription.offset = 0;
-    
-    VkPipelineVertexInputStateCreateInfo vertexInputInfo = {};
-    vertexInputInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO;
-    vertexInputInfo.vertexBindingDescriptionCount = 1;
-    vertexInputInfo.pVertexBindingDescriptions = &bindingDescription;
-    vertexInputInfo.vertexAttributeDescriptionCount = 1;
-    vertexInputInfo.pVertexAttributeDescriptions = &attributeDescription;
-    
-    // 输入装配
-    VkPipelineInputAssemblyStateCreateInfo inputAssembly = {};
-    inputAssembly.sType = VK_STRUCTURE_TYPE_PIPELINE_INPUT_ASSEMBLY_STATE_CREATE_INFO;
-    inputAssembly.topology = VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
-    inputAssembly.primitiveRestartEnable = VK_FALSE;
-    
-    // 视口（使用动态状态）
-    VkPipelineViewportStateCreateInfo viewportState = {};
-    viewportState.sType = VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_STATE_CREATE_INFO;
-    viewportState.viewportCount = 1;
-    viewportState.pViewports = nullptr;  // Dynamic
-    viewportState.scissorCount = 1;
-    viewportState.pScissors = nullptr;    // Dynamic
-    
-    // 光栅化
-    VkPipelineRasterizationStateCreateInfo rasterizer = {};
-    rasterizer.sType = VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_STATE_CREATE_INFO;
-    rasterizer.depthClampEnable = VK_FALSE;
-    rasterizer.rasterizerDiscardEnable = VK_FALSE;
-    rasterizer.polygonMode = VK_POLYGON_MODE_FILL;
-    rasterizer.lineWidth = 1.0f;
-    rasterizer.cullMode = VK_CULL_MODE_NONE;
-    rasterizer.frontFace = VK_FRONT_FACE_COUNTER_CLOCKWISE;
-    rasterizer.depthBiasEnable = VK_FALSE;
-    
-    // 多重采样
-    VkPipelineMultisampleStateCreateInfo multisampling = {};
-    multisampling.sType = VK_STRUCTURE_TYPE_PIPELINE_MULTISAMPLE_STATE_CREATE_INFO;
-    multisampling.sampleShadingEnable = VK_FALSE;
-    multisampling.rasterizationSamples = VK_SAMPLE_COUNT_1_BIT;
-    
-    // 颜色混合
-    VkPipelineColorBlendAttachmentState colorBlendAttachment = {};
-    colorBlendAttachment.colorWriteMask = VK_COLOR_COMPONENT_R_BIT | VK_COLOR_COMPONENT_G_BIT | 
-                                          VK_COLOR_COMPONENT_B_BIT | VK_COLOR_COMPONENT_A_BIT;
-    colorBlendAttachment.blendEnable = VK_TRUE;
-    colorBlendAttachment.srcColorBlendFactor = VK_BLEND_FACTOR_SRC_ALPHA;
-    colorBlendAttachment.dstColorBlendFactor = VK_BLEND_FACTOR_ONE_MINUS_SRC_ALPHA;
-    colorBlendAttachment.colorBlendOp = VK_BLEND_OP_ADD;
-    // Alpha混合：保持目标alpha不变，避免影响后续渲染
-    // 使用ONE作为源alpha因子，ONE作为目标alpha因子，这样alpha值会累加
-    // 但实际上我们想要的是：如果按钮不透明，alpha应该是1.0；如果透明，保持目标alpha
-    // 使用ONE_MINUS_SRC_ALPHA作为目标alpha因子，这样：resultAlpha = srcAlpha * 1 + dstAlpha * (1 - srcAlpha)
-    // 当srcAlpha=1时，resultAlpha=1；当srcAlpha=0时，resultAlpha=dstAlpha（保持不变）
-    colorBlendAttachment.srcAlphaBlendFactor = VK_BLEND_FACTOR_ONE;
-    colorBlendAttachment.dstAlphaBlendFactor = VK_BLEND_FACTOR_ONE_MINUS_SRC_ALPHA;
-    colorBlendAttachment.alphaBlendOp = VK_BLEND_OP_ADD;
-    
-    VkPipelineColorBlendStateCreateInfo colorBlending = {};
-    colorBlending.sType = VK_STRUCTURE_TYPE_PIPELINE_COLOR_BLEND_STATE_CREATE_INFO;
-    colorBlending.logicOpEnable = VK_FALSE;
-    colorBlending.attachmentCount = 1;
-    colorBlending.pAttachments = &colorBlendAttachment;
-    
-    // Dynamic states (viewport and scissor)
-    VkDynamicState dynamicStates[] = {
-        VK_DYNAMIC_STATE_VIEWPORT,
-        VK_DYNAMIC_STATE_SCISSOR
-    };
-    
-    VkPipelineDynamicStateCreateInfo dynamicState = {};
-    dynamicState.sType = VK_STRUCTURE_TYPE_PIPELINE_DYNAMIC_STATE_CREATE_INFO;
-    dynamicState.dynamicStateCount = 2;
-    dynamicState.pDynamicStates = dynamicStates;
-    
-    // 深度测试状态（禁用深度测试，因为渲染通道没有深度附件）
-    VkPipelineDepthStencilStateCreateInfo depthStencil = {};
-    depthStencil.sType = VK_STRUCTURE_TYPE_PIPELINE_DEPTH_STENCIL_STATE_CREATE_INFO;
-    depthStencil.depthTestEnable = VK_FALSE;
-    depthStencil.depthWriteEnable = VK_FALSE;
-    depthStencil.depthCompareOp = VK_COMPARE_OP_ALWAYS;
-    depthStencil.depthBoundsTestEnable = VK_FALSE;
-    depthStencil.stencilTestEnable = VK_FALSE;
-    
-    // Push constants: position(2) + size(2) + screenSize(2) + color(4) + shapeType(1) = 11 floats
-    // 注意：vec4 color需要4个float，shapeType需要1个float，所以总共是11个float
-    VkPushConstantRange pushConstantRange = {};
-    pushConstantRange.stageFlags = VK_SHADER_STAGE_FRAGMENT_BIT;
-    pushConstantRange.offset = 0;
-    pushConstantRange.size = sizeof(float) * 11;
-    
-    // Pipeline layout
-    VkPipelineLayoutCreateInfo pipelineLayoutInfo = {};
-    pipelineLayoutInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
-    pipelineLayoutInfo.setLayoutCount = 0;
-    pipelineLayoutInfo.pushConstantRangeCount = 1;
-    pipelineLayoutInfo.pPushConstantRanges = &pushConstantRange;
-    
-    VkPipelineLayout vkPureShaderPipelineLayout = VK_NULL_HANDLE;
-    if (vkCreatePipelineLayout(vkDevice, &pipelineLayoutInfo, nullptr, &vkPureShaderPipelineLayout) != VK_SUCCESS) {
-        vkDestroyShaderModule(vkDevice, vertShaderModule, nullptr);
-        vkDestroyShaderModule(vkDevice, fragShaderModule, nullptr);
-        Window::ShowError("Failed to create pure shader pipeline layout for button!");
-        return false;
-    }
-    m_pureShaderPipelineLayout = vkPureShaderPipelineLayout;
-    
-    // 创建管线
-    VkGraphicsPipelineCreateInfo pipelineInfo = {};
-    pipelineInfo.sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO;
-    pipelineInfo.stageCount = 2;
-    pipelineInfo.pStages = shaderStages;
-    pipelineInfo.pVertexInputState = &vertexInputInfo;
-    pipelineInfo.pInputAssemblyState = &inputAssembly;
-    pipelineInfo.pViewportState = &viewportState;
-    pipelineInfo.pRasterizationState = &rasterizer;
-    pipelineInfo.pMultisampleState = &multisampling;
-    pipelineInfo.pDepthStencilState = &depthStencil;
-    pipelineInfo.pColorBlendState = &colorBlending;
-    pipelineInfo.pDynamicState = &dynamicState;
-    pipelineInfo.layout = vkPureShaderPipelineLayout;
-    pipelineInfo.renderPass = vkRenderPass;
-    pipelineInfo.subpass = 0;
-    
-    VkPipeline vkPureShaderPipeline = VK_NULL_HANDLE;
-    VkResult result = vkCreateGraphicsPipelines(vkDevice, VK_NULL_HANDLE, 1, &pipelineInfo, nullptr, &vkPureShaderPipeline);
-    m_pureShaderPipeline = vkPureShaderPipeline;
-    
-    vkDestroyShaderModule(vkDevice, vertShaderModule, nullptr);
-    vkDestroyShaderModule(vkDevice, fragShaderModule, nullptr);
-    
-    if (result != VK_SUCCESS) {
+    GraphicsPipelineDesc desc = GetPipelineDesc(true, false, renderPass);
+    if (!VulkanPipelineRegistry::Acquire(m_pipelineRegistry, vkDevice, static_cast<VkPipelineCache>(m_pipelineCache), desc, m_pureShaderPipeline)) {
         Window::ShowError("Failed to create pure shader graphics pipeline for button!");
         return false;
     }
@@ -1438,9 +1001,9 @@ void Button::RenderPureShader(CommandBufferHandle commandBuffer, Extent2D extent
     // 将抽象类型转换为 Vulkan 类型
     VkCommandBuffer vkCommandBuffer = static_cast<VkCommandBuffer>(commandBuffer);
     VkExtent2D vkExtent = { extent.width, extent.height };
-    VkPipeline vkPureShaderPipeline = static_cast<VkPipeline>(m_pureShaderPipeline);
+    VkPipeline vkPureShaderPipeline = static_cast<VkPipeline>(m_pureShaderPipeline.pipeline);
     VkBuffer vkFullscreenQuadBuffer = static_cast<VkBuffer>(m_fullscreenQuadBuffer);
-    VkPipelineLayout vkPureShaderPipelineLayout = static_cast<VkPipelineLayout>(m_pureShaderPipelineLayout);
+    VkPipelineLayout vkPureShaderPipelineLayout = static_cast<VkPipelineLayout>(m_pureShaderPipeline.layout);
     
     if (!m_initialized || vkPureShaderPipeline == VK_NULL_HANDLE || vkFullscreenQuadBuffer == VK_NULL_HANDLE) return;
     
@@ -5,11 +5,14 @@
 #include <string>         // 2. 系统头文件
 
 #include "core/interfaces/ibutton.h"  // 4. 项目头文件（接口）
+#include "core/interfaces/imemory_allocator.h"  // 4. 项目头文件（接口）
+#include "core/interfaces/ipipeline_registry.h"  // 4. 项目头文件（接口）
 #include "core/types/render_types.h"  // 4. 项目头文件（抽象类型）
 
 // 前向声明
 class IRenderContext;
 class ITextRenderer;
+class UIQuadBatch;
 namespace renderer { namespace texture { class Texture; } }
 
 // Scaled 模式的拉伸参数（前向声明，实际定义在 core/stretch_params.h，已废弃）
@@ -466,6 +469,15 @@ public:
      */
     void RenderPureShader(CommandBufferHandle commandBuffer, Extent2D extent);
     
+    /**
+     * 把按钮四边形追加到UI批量渲染器（与 Render() 的传统方式输出相同）
+     * 
+     * @param batch UI四边形批量渲染器
+     * @param extent 渲染区域大小
+     * @return 已追加或按钮不可见返回true；纯shader模式或资源未就绪返回false，调用方应改用 Render()
+     */
+    bool AppendToBatch(UIQuadBatch& batch, Extent2D extent) const;
+    
     /**
      * 渲染按钮文本（单独调用，确保在所有其他元素之后渲染）
      * 
@@ -550,6 +562,16 @@ public:
      * @param params 拉伸参数
      */
     void SetStretchParams(const struct StretchParams& params) override;
+    
+    /**
+     * 获取按钮管线描述（滑块轨道和填充使用相同的着色器，共用此描述以共享管线）
+     * 
+     * @param usePureShader 是否为纯shader管线
+     * @param useTexture 是否绑定纹理采样器（仅传统方式有效）
+     * @param renderPass 渲染通道
+     * @return 管线描述
+     */
+    static GraphicsPipelineDesc GetPipelineDesc(bool usePureShader, bool useTexture, RenderPassHandle renderPass);
 
 private:
     // 更新相对位置
@@ -566,18 +588,12 @@ private:
     // 更新按钮缓冲区（当颜色改变时）
     void UpdateButtonBuffer();
     
-    // 查找内存类型
-    uint32_t FindMemoryType(uint32_t typeFilter, MemoryPropertyFlag properties);
-    
     // 创建图形管线（传统方式）
     bool CreatePipeline(RenderPassHandle renderPass);
     
     // 创建纯shader图形管线
     bool CreatePureShaderPipeline(RenderPassHandle renderPass);
     
-    // 创建描述符集布局（用于纹理绑定）
-    bool CreateDescriptorSetLayout();
-    
     // 创建描述符池和描述符集
     bool CreateDescriptorSet();
     
@@ -592,6 +608,23 @@ private:
      */
     IRenderContext* m_renderContext = nullptr;
     
+    /**
+     * 共享内存分配器（初始化时从渲染上下文复制，渲染上下文可能是临时对象）
+     * 
+     * [BORROW] 由渲染器拥有，为 nullptr 时缓冲区独立分配内存
+     */
+    IMemoryAllocator* m_memoryAllocator = nullptr;
+    
+    /**
+     * 共享管线缓存（初始化时从渲染上下文复制，[BORROW] 由渲染器拥有，可为 nullptr）
+     */
+    PipelineCacheHandle m_pipelineCache = nullptr;
+    
+    /**
+     * 共享管线注册表（初始化时从渲染上下文复制，[BORROW] 由渲染器拥有，为 nullptr 时独立创建管线）
+     */
+    IPipelineRegistry* m_pipelineRegistry = nullptr;
+    
     /**
      * 渲染设备句柄（通过渲染上下文获取，使用抽象类型）
      * 
@@ -714,10 +747,8 @@ private:
      * 使用不透明指针避免头文件直接依赖 Vulkan 实现
      */
     void* m_vertexBuffer = nullptr;          // 顶点缓冲区（存储按钮顶点数据）
-    void* m_vertexBufferMemory = nullptr;   // 顶点缓冲区内存（拥有所有权）
-    void* m_graphicsPipeline = nullptr;      // 图形管线（定义渲染状态和shader）
-    void* m_pipelineLayout = nullptr;         // 管线布局（定义描述符集布局）
-    void* m_descriptorSetLayout = nullptr;   // 描述符集布局（定义纹理绑定方式）
+    MemoryAllocation m_vertexBufferAllocation;  // 顶点缓冲区内存（子分配，拥有所有权）
+    SharedPipeline m_pipeline;               // 图形管线、管线布局和纹理描述符集布局（由注册表共享）
     
     /**
      * 纯shader渲染资源
@@ -727,9 +758,8 @@ private:
      */
     bool m_usePureShader = false;                    // 是否使用纯shader渲染模式
     void* m_fullscreenQuadBuffer = nullptr;          // 全屏四边形顶点缓冲区
-    void* m_fullscreenQuadBufferMemory = nullptr;    // 全屏四边形缓冲区内存（拥有所有权）
-    void* m_pureShaderPipeline = nullptr;            // 纯shader图形管线
-    void* m_pureShaderPipelineLayout = nullptr;      // 纯shader管线布局
+    MemoryAllocation m_fullscreenQuadBufferAllocation;  // 全屏四边形缓冲区内存（子分配，拥有所有权）
+    SharedPipeline m_pureShaderPipeline;             // 纯shader图形管线和管线布局（由注册表共享）
     
     // 点击回调
     std::function<void()> m_onClickCallback;
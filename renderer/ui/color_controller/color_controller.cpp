@@ -67,6 +67,18 @@ bool ColorController::Initialize(DeviceHandle device, PhysicalDeviceHandle physi
     float sliderStartY = config.relativeY;
     float screenHeight = config.screenHeight;
     
+    // 创建临时渲染上下文（直接使用抽象类型），滑块和颜色显示按钮共用，并携带共享内存分配器
+    std::unique_ptr<IRenderContext> tempContext(CreateVulkanRenderContext(
+        device,
+        physicalDevice,
+        commandPool,
+        graphicsQueue,
+        renderPass,
+        swapchainExtent,
+        m_memoryAllocator,
+        m_pipelineCache,
+        m_pipelineRegistry));
+    
     // 初始化4个滑块（垂直排列）
     for (int i = 0; i < 4; i++) {
         SliderConfig sliderConfig = SliderConfig::CreateRelative(
@@ -99,14 +111,8 @@ bool ColorController::Initialize(DeviceHandle device, PhysicalDeviceHandle physi
         else if (i == 3) initialValue = m_colorA * 255.0f;
         sliderConfig.defaultValue = initialValue;
         
-        // 使用废弃接口初始化滑块（直接使用抽象类型）
         if (m_sliders[i]->Initialize(
-                device,
-                physicalDevice,
-                commandPool,
-                graphicsQueue,
-                renderPass,
-                swapchainExtent,
+                tempContext.get(),
                 sliderConfig,
                 false)) {  // 使用传统渲染方式
             
@@ -141,15 +147,6 @@ bool ColorController::Initialize(DeviceHandle device, PhysicalDeviceHandle physi
     colorDisplayConfig.textColorB = 1.0f - m_colorB;
     colorDisplayConfig.textColorA = 1.0f;
     
-    // 创建临时渲染上下文（直接使用抽象类型）
-    std::unique_ptr<IRenderContext> tempContext(CreateVulkanRenderContext(
-        device,
-        physicalDevice,
-        commandPool,
-        graphicsQueue,
-        renderPass,
-        swapchainExtent));
-    
     if (m_colorDisplayButton->Initialize(
             tempContext.get(),
             colorDisplayConfig,
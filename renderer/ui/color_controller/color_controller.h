@@ -63,6 +63,15 @@ public:
                     const ColorControllerConfig& config,
                     ITextRenderer* textRenderer = nullptr) override;
     
+    // 设置共享内存分配器（需在Initialize之前调用）
+    void SetMemoryAllocator(IMemoryAllocator* memoryAllocator) override { m_memoryAllocator = memoryAllocator; }
+    
+    // 设置共享管线缓存（需在Initialize之前调用）
+    void SetPipelineCache(PipelineCacheHandle pipelineCache) override { m_pipelineCache = pipelineCache; }
+    
+    // 设置共享管线注册表（需在Initialize之前调用）
+    void SetPipelineRegistry(IPipelineRegistry* pipelineRegistry) override { m_pipelineRegistry = pipelineRegistry; }
+    
     // 清理资源
     void Cleanup() override;
     
@@ -147,6 +156,9 @@ private:
     RenderPassHandle m_renderPass = nullptr;
     Extent2D m_swapchainExtent = {};
     ITextRenderer* m_textRenderer = nullptr;
+    IMemoryAllocator* m_memoryAllocator = nullptr;  // [BORROW] 共享内存分配器，由渲染器拥有
+    PipelineCacheHandle m_pipelineCache = nullptr;  // [BORROW] 共享管线缓存，由渲染器拥有
+    IPipelineRegistry* m_pipelineRegistry = nullptr;  // [BORROW] 共享管线注册表，由渲染器拥有
     
     // 颜色变化回调
     std::function<void(float, float, float, float)> m_onColorChangedCallback;
@@ -0,0 +1,19 @@
+#version 450
+
+layout(location = 0) in vec2 fragTexCoord;
+layout(location = 1) flat in vec4 fragColor;
+layout(location = 2) flat in vec4 fragParams;  // 像素尺寸 (w, h)、形状类型、悬停效果
+
+layout(location = 0) out vec4 outColor;
+
+void main() {
+    // 圆形：以四边形中心为圆心、高度的一半为半径（像素空间，保证屏幕上是正圆；与 button.frag 一致）
+    if (fragParams.z > 0.5) {
+        vec2 offset = (fragTexCoord - vec2(0.5)) * fragParams.xy;
+        if (length(offset) > fragParams.y * 0.5) {
+            discard;
+        }
+    }
+    
+    outColor = fragColor;
+}
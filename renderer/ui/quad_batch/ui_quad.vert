@@ -0,0 +1,26 @@
+#version 450
+
+// 实例属性（每个UI四边形一个实例，绑定 1）
+layout(location = 0) in vec4 inRect;    // NDC 左上角 (x, y) 和 NDC 尺寸 (w, h)
+layout(location = 1) in vec4 inColor;   // 颜色（不使用纹理时，已在CPU端应用悬停效果）
+layout(location = 2) in vec4 inParams;  // 像素尺寸 (w, h)、形状类型、悬停效果
+
+layout(location = 0) out vec2 fragTexCoord;        // 四边形内的归一化坐标（0-1，Y向下）
+layout(location = 1) flat out vec4 fragColor;
+layout(location = 2) flat out vec4 fragParams;
+
+// 单位四边形的两个三角形（由 gl_VertexIndex 生成，不需要顶点缓冲区）
+const vec2 QUAD_CORNERS[6] = vec2[](
+    vec2(0.0, 0.0), vec2(1.0, 0.0), vec2(1.0, 1.0),
+    vec2(0.0, 0.0), vec2(1.0, 1.0), vec2(0.0, 1.0)
+);
+
+void main() {
+    vec2 corner = QUAD_CORNERS[gl_VertexIndex];
+    
+    gl_Position = vec4(inRect.xy + corner * inRect.zw, 0.0, 1.0);
+    
+    fragTexCoord = corner;
+    fragColor = inColor;
+    fragParams = inParams;
+}
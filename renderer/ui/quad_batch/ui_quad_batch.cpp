@@ -0,0 +1,241 @@
+#include "ui/quad_batch/ui_quad_batch.h"  // 1. 对应头文件
+
+#include <cstddef>  // 2. 系统头文件
+#include <stdio.h>  // 2. 系统头文件
+
+#include <vulkan/vulkan.h>  // 3. 第三方库头文件
+
+#include "core/interfaces/irender_context.h"  // 4. 项目头文件（接口）
+#include "renderer/vulkan/vulkan_memory_allocator.h"  // 4. 项目头文件
+#include "renderer/vulkan/vulkan_pipeline_registry.h"  // 4. 项目头文件
+
+namespace {
+
+// 每个帧槽位实例缓冲区的初始容量（实例数）
+const uint32_t INITIAL_INSTANCE_CAPACITY = 64;
+
+// 顶点着色器由 gl_VertexIndex 生成单位四边形的两个三角形
+const uint32_t QUAD_VERTEX_COUNT = 6;
+
+GraphicsPipelineDesc GetQuadPipelineDesc(bool useTexture, RenderPassHandle renderPass) {
+    GraphicsPipelineDesc desc;
+    desc.vertShaderPath = "renderer/ui/quad_batch/ui_quad.vert.spv";
+    desc.fragShaderPath = useTexture ? "renderer/ui/quad_batch/ui_quad_textured.frag.spv"
+                                     : "renderer/ui/quad_batch/ui_quad.frag.spv";
+    desc.blendMode = PipelineBlendMode::AlphaBlend;
+    desc.renderPass = renderPass;
+    // 没有逐顶点输入，实例属性：rect(vec4) + color(vec4) + params(vec4)
+    desc.instanceStride = sizeof(UIQuadInstance);
+    desc.instanceAttributes = {
+        { 0, VertexAttributeFormat::Float4, offsetof(UIQuadInstance, rect) },
+        { 1, VertexAttributeFormat::Float4, offsetof(UIQuadInstance, color) },
+        { 2, VertexAttributeFormat::Float4, offsetof(UIQuadInstance, params) }
+    };
+    // 使用纹理时与按钮纹理管线使用相同采样器数量，按钮的描述符集可以直接绑定
+    desc.textureSamplerCount = useTexture ? 1 : 0;
+    return desc;
+}
+
+} // namespace
+
+UIQuadBatch::UIQuadBatch() {
+}
+
+UIQuadBatch::~UIQuadBatch() {
+    Cleanup();
+}
+
+bool UIQuadBatch::Initialize(IRenderContext* renderContext, uint32_t framesInFlight) {
+    if (m_initialized) {
+        return true;
+    }
+    
+    if (!renderContext || framesInFlight == 0) {
+        return false;
+    }
+    
+    m_memoryAllocator = renderContext->GetMemoryAllocator();
+    m_pipelineRegistry = renderContext->GetPipelineRegistry();
+    m_device = renderContext->GetDevice();
+    m_physicalDevice = renderContext->GetPhysicalDevice();
+    
+    VkDevice vkDevice = static_cast<VkDevice>(m_device);
+    VkPipelineCache vkPipelineCache = static_cast<VkPipelineCache>(renderContext->GetPipelineCache());
+    RenderPassHandle renderPass = renderContext->GetRenderPass();
+    
+    if (!VulkanPipelineRegistry::Acquire(m_pipelineRegistry, vkDevice, vkPipelineCache,
+                                         GetQuadPipelineDesc(false, renderPass), m_colorPipeline) ||
+        !VulkanPipelineRegistry::Acquire(m_pipelineRegistry, vkDevice, vkPipelineCache,
+                                         GetQuadPipelineDesc(true, renderPass), m_texturePipeline)) {
+        printf("[UI_BATCH] Failed to create UI quad pipelines, falling back to per-widget rendering\n");
+        VulkanPipelineRegistry::Release(m_pipelineRegistry, vkDevice, m_colorPipeline);
+        VulkanPipelineRegistry::Release(m_pipelineRegistry, vkDevice, m_texturePipeline);
+        return false;
+    }
+    
+    m_frames.resize(framesInFlight);
+    m_frameIndex = 0;
+    m_pendingInstances.reserve(INITIAL_INSTANCE_CAPACITY);
+    m_pendingTextures.reserve(INITIAL_INSTANCE_CAPACITY);
+    
+    m_initialized = true;
+    return true;
+}
+
+void UIQuadBatch::Cleanup() {
+    if (!m_initialized) {
+        return;
+    }
+    
+    VkDevice vkDevice = static_cast<VkDevice>(m_device);
+    
+    for (FrameResources& frame : m_frames) {
+        for (InstanceBuffer& retired : frame.retired) {
+            DestroyInstanceBuffer(retired);
+        }
+        frame.retired.clear();
+        DestroyInstanceBuffer(frame.current);
+    }
+    m_frames.clear();
+    m_pendingInstances.clear();
+    m_pendingTextures.clear();
+    
+    VulkanPipelineRegistry::Release(m_pipelineRegistry, vkDevice, m_colorPipeline);
+    VulkanPipelineRegistry::Release(m_pipelineRegistry, vkDevice, m_texturePipeline);
+    
+    m_initialized = false;
+}
+
+void UIQuadBatch::BeginFrame(uint32_t frameIndex) {
+    if (!m_initialized) {
+        return;
+    }
+    
+    m_frameIndex = frameIndex % (uint32_t)m_frames.size();
+    FrameResources& frame = m_frames[m_frameIndex];
+    
+    // 该槽位上一次使用的命令已完成（调用方已等待栅栏），可以回收扩容前的缓冲区
+    for (InstanceBuffer& retired : frame.retired) {
+        DestroyInstanceBuffer(retired);
+    }
+    frame.retired.clear();
+    frame.used = 0;
+    
+    m_pendingInstances.clear();
+    m_pendingTextures.clear();
+}
+
+void UIQuadBatch::Add(const UIQuadInstance& instance, void* textureDescriptorSet) {
+    m_pendingInstances.push_back(instance);
+    m_pendingTextures.push_back(textureDescriptorSet);
+}
+
+void UIQuadBatch::Flush(CommandBufferHandle commandBuffer) {
+    if (!m_initialized || m_pendingInstances.empty()) {
+        return;
+    }
+    
+    VkCommandBuffer vkCommandBuffer = static_cast<VkCommandBuffer>(commandBuffer);
+    VkDevice vkDevice = static_cast<VkDevice>(m_device);
+    FrameResources& frame = m_frames[m_frameIndex];
+    uint32_t count = (uint32_t)m_pendingInstances.size();
+    
+    // 容量不足时扩容：旧缓冲区可能已被本帧之前的绘制引用，保留到该槽位下次复用
+    if (frame.used + count > frame.capacity) {
+        uint32_t newCapacity = frame.capacity > 0 ? frame.capacity * 2 : INITIAL_INSTANCE_CAPACITY;
+        while (newCapacity < count) {
+            newCapacity *= 2;
+        }
+        
+        InstanceBuffer newBuffer;
+        if (!CreateInstanceBuffer(newCapacity, newBuffer)) {
+            printf("[UI_BATCH] Failed to grow instance buffer to %u instances, dropping %u quads\n", newCapacity, count);
+            m_pendingInstances.clear();
+            m_pendingTextures.clear();
+            return;
+        }
+        
+        if (frame.current.buffer != nullptr) {
+            frame.retired.push_back(frame.current);
+        }
+        frame.current = newBuffer;
+        frame.capacity = newCapacity;
+        frame.used = 0;
+    }
+    
+    VkDeviceSize byteOffset = (VkDeviceSize)frame.used * sizeof(UIQuadInstance);
+    VulkanMemoryAllocator::Write(vkDevice, frame.current.allocation, m_pendingInstances.data(),
+                                 (VkDeviceSize)count * sizeof(UIQuadInstance), byteOffset);
+    
+    VkBuffer vkInstanceBuffer = static_cast<VkBuffer>(frame.current.buffer);
+    vkCmdBindVertexBuffers(vkCommandBuffer, 1, 1, &vkInstanceBuffer, &byteOffset);
+    
+    // 按提交顺序把纹理状态相同的连续实例合并为一次实例化绘制
+    VkPipeline boundPipeline = VK_NULL_HANDLE;
+    uint32_t runStart = 0;
+    while (runStart < count) {
+        void* texture = m_pendingTextures[runStart];
+        uint32_t runEnd = runStart + 1;
+        while (runEnd < count && m_pendingTextures[runEnd] == texture) {
+            runEnd++;
+        }
+        
+        const SharedPipeline& pipeline = texture ? m_texturePipeline : m_colorPipeline;
+        VkPipeline vkPipeline = static_cast<VkPipeline>(pipeline.pipeline);
+        if (vkPipeline != boundPipeline) {
+            vkCmdBindPipeline(vkCommandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, vkPipeline);
+            boundPipeline = vkPipeline;
+        }
+        if (texture) {
+            VkDescriptorSet vkDescriptorSet = static_cast<VkDescriptorSet>(texture);
+            vkCmdBindDescriptorSets(vkCommandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS,
+                                    static_cast<VkPipelineLayout>(pipeline.layout),
+                                    0, 1, &vkDescriptorSet, 0, nullptr);
+        }
+        
+        vkCmdDraw(vkCommandBuffer, QUAD_VERTEX_COUNT, runEnd - runStart, 0, runStart);
+        runStart = runEnd;
+    }
+    
+    frame.used += count;
+    m_pendingInstances.clear();
+    m_pendingTextures.clear();
+}
+
+bool UIQuadBatch::CreateInstanceBuffer(uint32_t capacity, InstanceBuffer& instanceBuffer) {
+    VkDevice vkDevice = static_cast<VkDevice>(m_device);
+    
+    VkBufferCreateInfo bufferInfo = {};
+    bufferInfo.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+    bufferInfo.size = (VkDeviceSize)capacity * sizeof(UIQuadInstance);
+    bufferInfo.usage = VK_BUFFER_USAGE_VERTEX_BUFFER_BIT;
+    bufferInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+    
+    VkBuffer vkBuffer = VK_NULL_HANDLE;
+    if (vkCreateBuffer(vkDevice, &bufferInfo, nullptr, &vkBuffer) != VK_SUCCESS) {
+        return false;
+    }
+    instanceBuffer.buffer = vkBuffer;
+    
+    // 每帧由 CPU 重写，使用持久映射的主机可见内存
+    if (!VulkanMemoryAllocator::AllocateBuffer(m_memoryAllocator, vkDevice, static_cast<VkPhysicalDevice>(m_physicalDevice),
+                                               vkBuffer, MemoryPropertyFlag::HostVisible | MemoryPropertyFlag::HostCoherent,
+                                               instanceBuffer.allocation)) {
+        DestroyInstanceBuffer(instanceBuffer);
+        return false;
+    }
+    
+    return true;
+}
+
+void UIQuadBatch::DestroyInstanceBuffer(InstanceBuffer& instanceBuffer) {
+    VkDevice vkDevice = static_cast<VkDevice>(m_device);
+    
+    VkBuffer vkBuffer = static_cast<VkBuffer>(instanceBuffer.buffer);
+    if (vkBuffer != VK_NULL_HANDLE) {
+        vkDestroyBuffer(vkDevice, vkBuffer, nullptr);
+        instanceBuffer.buffer = nullptr;
+    }
+    
+    VulkanMemoryAllocator::Release(m_memoryAllocator, vkDevice, instanceBuffer.allocation);
+}
@@ -0,0 +1,139 @@
+#pragma once
+
+#include <vector>  // 2. 系统头文件
+
+#include "core/interfaces/imemory_allocator.h"  // 4. 项目头文件（接口）
+#include "core/interfaces/ipipeline_registry.h"  // 4. 项目头文件（接口）
+#include "core/types/render_types.h"  // 4. 项目头文件（抽象类型）
+
+// 前向声明
+class IRenderContext;
+
+/**
+ * UI 四边形实例数据（与 ui_quad.vert 的实例属性布局一致，每个实例 48 字节）
+ */
+struct UIQuadInstance {
+    float rect[4] = {};    // NDC 左上角 (x, y) 和 NDC 尺寸 (w, h)
+    float color[4] = {};   // 颜色（不使用纹理时已应用悬停效果）
+    float params[4] = {};  // 像素尺寸 (w, h)、形状类型（0=矩形，1=圆形）、悬停效果（>0变暗，<0变淡，仅纹理）
+    
+    /**
+     * 由屏幕坐标构造实例
+     * 
+     * @param x 左上角X坐标（像素，Y向下）
+     * @param y 左上角Y坐标（像素，Y向下）
+     * @param width 宽度（像素）
+     * @param height 高度（像素）
+     * @param screenWidth 坐标系宽度（像素）
+     * @param screenHeight 坐标系高度（像素）
+     */
+    UIQuadInstance(float x, float y, float width, float height, float screenWidth, float screenHeight) {
+        rect[0] = x / screenWidth * 2.0f - 1.0f;
+        rect[1] = y / screenHeight * 2.0f - 1.0f;
+        rect[2] = width / screenWidth * 2.0f;
+        rect[3] = height / screenHeight * 2.0f;
+        params[0] = width;
+        params[1] = height;
+    }
+    
+    void SetColor(float r, float g, float b, float a) {
+        color[0] = r; color[1] = g; color[2] = b; color[3] = a;
+    }
+};
+
+/**
+ * UI 四边形批量渲染器 - 把按钮和滑块的矩形合并为实例化绘制
+ * 
+ * 每帧把所有可见控件的四边形写入同一个实例缓冲区，按提交顺序（即层级顺序）
+ * 把连续的、渲染状态相同的实例合并为一次 vkCmdDraw(6, N)：
+ * - 不使用纹理的四边形（颜色按钮、滑块轨道和填充）共用一条管线，跨层级连续时也合并
+ * - 使用纹理的按钮仅在纹理描述符集改变时拆分绘制
+ * 这样录制命令的 CPU 开销取决于状态切换次数而不是控件数量。
+ * 
+ * 实例缓冲区每个在途帧一个，容量不足时翻倍重建，旧缓冲区保留到该帧槽位下次复用时销毁。
+ * 
+ * 使用方式：
+ * 1. BeginFrame() 开始新的一帧（调用前必须已等待该帧槽位的栅栏）
+ * 2. 控件通过 Add() 追加实例（Button::AppendToBatch / Slider::AppendToBatch）
+ * 3. Flush() 录制已追加实例的绘制命令；无法批量渲染的控件在 Flush() 之后单独渲染以保持层级顺序
+ */
+class UIQuadBatch {
+public:
+    UIQuadBatch();
+    ~UIQuadBatch();
+    
+    /**
+     * 初始化批量渲染器（获取共享管线）
+     * 
+     * @param renderContext 渲染上下文（只在初始化期间使用）
+     * @param framesInFlight 在途帧数量（每帧一个实例缓冲区）
+     * @return 成功返回 true，失败返回 false（调用方应退回到逐控件渲染）
+     */
+    bool Initialize(IRenderContext* renderContext, uint32_t framesInFlight);
+    
+    /**
+     * 清理资源（调用前 GPU 必须已完成使用实例缓冲区的所有命令）
+     */
+    void Cleanup();
+    
+    /**
+     * 开始新的一帧，重置该帧槽位的实例缓冲区
+     * 
+     * @param frameIndex 帧槽位索引（0 到 framesInFlight-1）
+     */
+    void BeginFrame(uint32_t frameIndex);
+    
+    /**
+     * 追加一个四边形实例
+     * 
+     * @param instance 实例数据
+     * @param textureDescriptorSet 纹理描述符集（nullptr 表示只使用颜色，[BORROW] 由控件拥有）
+     */
+    void Add(const UIQuadInstance& instance, void* textureDescriptorSet = nullptr);
+    
+    /**
+     * 录制自上次 Flush() 以来追加的所有实例（使用调用方已设置的视口和裁剪区域）
+     * 
+     * @param commandBuffer 命令缓冲区句柄
+     */
+    void Flush(CommandBufferHandle commandBuffer);
+
+private:
+    // 禁止拷贝和赋值
+    UIQuadBatch(const UIQuadBatch&) = delete;
+    UIQuadBatch& operator=(const UIQuadBatch&) = delete;
+    
+    // 实例缓冲区（持久映射的主机可见内存）
+    struct InstanceBuffer {
+        void* buffer = nullptr;
+        MemoryAllocation allocation;
+    };
+    
+    // 帧槽位资源
+    struct FrameResources {
+        InstanceBuffer current;
+        uint32_t capacity = 0;                // 当前缓冲区可容纳的实例数
+        uint32_t used = 0;                    // 本帧已写入的实例数
+        std::vector<InstanceBuffer> retired;  // 本帧扩容前的缓冲区（可能仍被本帧命令引用）
+    };
+    
+    bool CreateInstanceBuffer(uint32_t capacity, InstanceBuffer& instanceBuffer);
+    void DestroyInstanceBuffer(InstanceBuffer& instanceBuffer);
+    
+    IMemoryAllocator* m_memoryAllocator = nullptr;  // [BORROW] 由渲染器拥有，为 nullptr 时独立分配
+    IPipelineRegistry* m_pipelineRegistry = nullptr;  // [BORROW] 由渲染器拥有，为 nullptr 时独立创建管线
+    DeviceHandle m_device = nullptr;
+    PhysicalDeviceHandle m_physicalDevice = nullptr;
+    
+    SharedPipeline m_colorPipeline;    // 只使用颜色的四边形
+    SharedPipeline m_texturePipeline;  // 使用纹理的四边形（描述符集布局与按钮纹理描述符集兼容）
+    
+    std::vector<FrameResources> m_frames;
+    uint32_t m_frameIndex = 0;
+    
+    // 本帧待录制的实例（Flush 时写入实例缓冲区）
+    std::vector<UIQuadInstance> m_pendingInstances;
+    std::vector<void*> m_pendingTextures;
+    
+    bool m_initialized = false;
+};
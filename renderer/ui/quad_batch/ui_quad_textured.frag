@@ -0,0 +1,31 @@
+#version 450
+
+layout(location = 0) in vec2 fragTexCoord;
+layout(location = 1) flat in vec4 fragColor;
+layout(location = 2) flat in vec4 fragParams;  // 像素尺寸 (w, h)、形状类型、悬停效果
+
+layout(location = 0) out vec4 outColor;
+
+// 按钮纹理（与按钮纹理管线使用相同的描述符集布局）
+layout(set = 0, binding = 0) uniform sampler2D texSampler;
+
+void main() {
+    // 圆形：以四边形中心为圆心、高度的一半为半径（像素空间，保证屏幕上是正圆；与 button.frag 一致）
+    if (fragParams.z > 0.5) {
+        vec2 offset = (fragTexCoord - vec2(0.5)) * fragParams.xy;
+        if (length(offset) > fragParams.y * 0.5) {
+            discard;
+        }
+    }
+    
+    // fragTexCoord 的Y轴向下，与纹理坐标方向一致
+    outColor = texture(texSampler, fragTexCoord);
+    
+    // 悬停效果：>0 将RGB乘以(1 - hoverEffect)变暗，<0 将Alpha乘以(1 + hoverEffect)变淡
+    float hoverEffect = fragParams.w;
+    if (hoverEffect > 0.0) {
+        outColor.rgb *= 1.0 - hoverEffect;
+    } else if (hoverEffect < 0.0) {
+        outColor.a *= 1.0 + hoverEffect;
+    }
+}
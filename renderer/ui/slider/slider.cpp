@@ -2,7 +2,6 @@
 
 #include <algorithm>           // 2. 系统头文件
 #include <cmath>               // 2. 系统头文件
-#include <fstream>             // 2. 系统头文件
 
 #include <vulkan/vulkan.h>     // 3. 第三方库头文件
 
@@ -11,8 +10,10 @@
 #include "core/interfaces/irender_context.h"  // 4. 项目头文件（接口）
 #include "core/config/stretch_params.h"                    // 4. 项目头文件
 #include "renderer/vulkan/vulkan_render_context_factory.h"  // 4. 项目头文件（工厂函数）
-#include "shader/shader_loader.h"                          // 4. 项目头文件
 #include "ui/button/button.h"                              // 4. 项目头文件
+#include "ui/quad_batch/ui_quad_batch.h"                   // 4. 项目头文件
+#include "vulkan/vulkan_memory_allocator.h"                // 4. 项目头文件
+#include "vulkan/vulkan_pipeline_registry.h"               // 4. 项目头文件
 #include "window/window.h"                                 // 4. 项目头文件
 
 Slider::Slider() {
@@ -30,6 +31,9 @@ bool Slider::Initialize(IRenderContext* renderContext,
     }
     
     m_renderContext = renderContext;
+    m_memoryAllocator = renderContext->GetMemoryAllocator();
+    m_pipelineCache = renderContext->GetPipelineCache();
+    m_pipelineRegistry = renderContext->GetPipelineRegistry();
     // 存储抽象类型（在需要时转换为 Vulkan 类型）
     m_device = renderContext->GetDevice();
     m_physicalDevice = renderContext->GetPhysicalDevice();
@@ -161,56 +165,31 @@ void Slider::Cleanup() {
     VkDevice vkDevice = static_cast<VkDevice>(m_device);
     
     // 清理传统渲染资源
-    if (m_graphicsPipeline != nullptr) {
-        vkDestroyPipeline(vkDevice, static_cast<VkPipeline>(m_graphicsPipeline), nullptr);
-        m_graphicsPipeline = nullptr;
-    }
-    
-    if (m_pipelineLayout != nullptr) {
-        vkDestroyPipelineLayout(vkDevice, static_cast<VkPipelineLayout>(m_pipelineLayout), nullptr);
-        m_pipelineLayout = nullptr;
-    }
+    VulkanPipelineRegistry::Release(m_pipelineRegistry, vkDevice, m_pipeline);
     
     if (m_trackVertexBuffer != nullptr) {
         vkDestroyBuffer(vkDevice, static_cast<VkBuffer>(m_trackVertexBuffer), nullptr);
         m_trackVertexBuffer = nullptr;
     }
     
-    if (m_trackVertexBufferMemory != nullptr) {
-        vkFreeMemory(vkDevice, static_cast<VkDeviceMemory>(m_trackVertexBufferMemory), nullptr);
-        m_trackVertexBufferMemory = nullptr;
-    }
+    VulkanMemoryAllocator::Release(m_memoryAllocator, vkDevice, m_trackVertexBufferAllocation);
     
     if (m_fillVertexBuffer != nullptr) {
         vkDestroyBuffer(vkDevice, static_cast<VkBuffer>(m_fillVertexBuffer), nullptr);
         m_fillVertexBuffer = nullptr;
     }
     
-    if (m_fillVertexBufferMemory != nullptr) {
-        vkFreeMemory(vkDevice, static_cast<VkDeviceMemory>(m_fillVertexBufferMemory), nullptr);
-        m_fillVertexBufferMemory = nullptr;
-    }
+    VulkanMemoryAllocator::Release(m_memoryAllocator, vkDevice, m_fillVertexBufferAllocation);
     
     // 清理纯shader渲染资源
-    if (m_pureShaderPipeline != nullptr) {
-        vkDestroyPipeline(vkDevice, static_cast<VkPipeline>(m_pureShaderPipeline), nullptr);
-        m_pureShaderPipeline = nullptr;
-    }
-    
-    if (m_pureShaderPipelineLayout != nullptr) {
-        vkDestroyPipelineLayout(vkDevice, static_cast<VkPipelineLayout>(m_pureShaderPipelineLayout), nullptr);
-        m_pureShaderPipelineLayout = nullptr;
-    }
+    VulkanPipelineRegistry::Release(m_pipelineRegistry, vkDevice, m_pureShaderPipeline);
     
     if (m_fullscreenQuadBuffer != nullptr) {
         vkDestroyBuffer(vkDevice, static_cast<VkBuffer>(m_fullscreenQuadBuffer), nullptr);
         m_fullscreenQuadBuffer = nullptr;
     }
     
-    if (m_fullscreenQuadBufferMemory != nullptr) {
-        vkFreeMemory(vkDevice, static_cast<VkDeviceMemory>(m_fullscreenQuadBufferMemory), nullptr);
-        m_fullscreenQuadBufferMemory = nullptr;
-    }
+    VulkanMemoryAllocator::Release(m_memoryAllocator, vkDevice, m_fullscreenQuadBufferAllocation);
     
     m_initialized = false;
 }
@@ -252,30 +231,16 @@ bool Slider::CreateTrackBuffer() {
     }
     m_trackVertexBuffer = vkBuffer;
     
-    // 分配内存
-    VkMemoryRequirements memRequirements;
-    vkGetBufferMemoryRequirements(vkDevice, vkBuffer, &memRequirements);
-    
-    VkMemoryAllocateInfo allocInfo = {};
-    allocInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
-    allocInfo.allocationSize = memRequirements.size;
-    allocInfo.memoryTypeIndex = FindMemoryType(memRequirements.memoryTypeBits, 
-                                                MemoryPropertyFlag::HostVisible | MemoryPropertyFlag::HostCoherent);
-    
-    VkDeviceMemory vkMemory = VK_NULL_HANDLE;
-    if (vkAllocateMemory(vkDevice, &allocInfo, nullptr, &vkMemory) != VK_SUCCESS) {
+    // 分配内存（从共享分配器子分配）
+    if (!VulkanMemoryAllocator::AllocateBuffer(m_memoryAllocator, vkDevice, static_cast<VkPhysicalDevice>(m_physicalDevice),
+                                               vkBuffer, MemoryPropertyFlag::HostVisible | MemoryPropertyFlag::HostCoherent,
+                                               m_trackVertexBufferAllocation)) {
         Window::ShowError("Failed to allocate slider track vertex buffer memory!");
         return false;
     }
-    m_trackVertexBufferMemory = vkMemory;
-    
-    vkBindBufferMemory(vkDevice, vkBuffer, vkMemory, 0);
     
     // 填充数据
-    void* data;
-    vkMapMemory(vkDevice, vkMemory, 0, bufferSize, 0, &data);
-    memcpy(data, trackVertices, (size_t)bufferSize);
-    vkUnmapMemory(vkDevice, vkMemory);
+    VulkanMemoryAllocator::Write(vkDevice, m_trackVertexBufferAllocation, trackVertices, bufferSize);
     
     return true;
 }
@@ -321,40 +286,25 @@ bool Slider::CreateFillBuffer() {
     }
     m_fillVertexBuffer = vkBuffer;
     
-    // 分配内存
-    VkMemoryRequirements memRequirements;
-    vkGetBufferMemoryRequirements(vkDevice, vkBuffer, &memRequirements);
-    
-    VkMemoryAllocateInfo allocInfo = {};
-    allocInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
-    allocInfo.allocationSize = memRequirements.size;
-    allocInfo.memoryTypeIndex = FindMemoryType(memRequirements.memoryTypeBits, 
-                                                MemoryPropertyFlag::HostVisible | MemoryPropertyFlag::HostCoherent);
-    
-    VkDeviceMemory vkMemory = VK_NULL_HANDLE;
-    if (vkAllocateMemory(vkDevice, &allocInfo, nullptr, &vkMemory) != VK_SUCCESS) {
+    // 分配内存（从共享分配器子分配）
+    if (!VulkanMemoryAllocator::AllocateBuffer(m_memoryAllocator, vkDevice, static_cast<VkPhysicalDevice>(m_physicalDevice),
+                                               vkBuffer, MemoryPropertyFlag::HostVisible | MemoryPropertyFlag::HostCoherent,
+                                               m_fillVertexBufferAllocation)) {
         Window::ShowError("Failed to allocate slider fill vertex buffer memory!");
         return false;
     }
-    m_fillVertexBufferMemory = vkMemory;
-    
-    vkBindBufferMemory(vkDevice, vkBuffer, vkMemory, 0);
     
     // 填充数据
-    void* data;
-    vkMapMemory(vkDevice, vkMemory, 0, bufferSize, 0, &data);
-    memcpy(data, fillVertices, (size_t)bufferSize);
-    vkUnmapMemory(vkDevice, vkMemory);
+    VulkanMemoryAllocator::Write(vkDevice, m_fillVertexBufferAllocation, fillVertices, bufferSize);
     
     return true;
 }
 
 void Slider::UpdateTrackBuffer() {
-    if (!m_initialized || m_trackVertexBufferMemory == nullptr) return;
+    if (!m_initialized || !m_trackVertexBufferAllocation.IsValid()) return;
     
     // 将抽象类型转换为 Vulkan 类型
     VkDevice vkDevice = static_cast<VkDevice>(m_device);
-    VkDeviceMemory vkMemory = static_cast<VkDeviceMemory>(m_trackVertexBufferMemory);
     
     struct Vertex {
         float x, y;
@@ -371,18 +321,14 @@ void Slider::UpdateTrackBuffer() {
     };
     
     VkDeviceSize bufferSize = sizeof(trackVertices);
-    void* data;
-    vkMapMemory(vkDevice, vkMemory, 0, bufferSize, 0, &data);
-    memcpy(data, trackVertices, (size_t)bufferSize);
-    vkUnmapMemory(vkDevice, vkMemory);
+    VulkanMemoryAllocator::Write(vkDevice, m_trackVertexBufferAllocation, trackVertices, bufferSize);
 }
 
 void Slider::UpdateFillBuffer() {
-    if (!m_initialized || m_fillVertexBufferMemory == nullptr) return;
+    if (!m_initialized || !m_fillVertexBufferAllocation.IsValid()) return;
     
     // 将抽象类型转换为 Vulkan 类型
     VkDevice vkDevice = static_cast<VkDevice>(m_device);
-    VkDeviceMemory vkMemory = static_cast<VkDeviceMemory>(m_fillVertexBufferMemory);
     
     struct Vertex {
         float x, y;
@@ -403,251 +349,19 @@ void Slider::UpdateFillBuffer() {
     };
     
     VkDeviceSize bufferSize = sizeof(fillVertices);
-    void* data;
-    vkMapMemory(vkDevice, vkMemory, 0, bufferSize, 0, &data);
-    memcpy(data, fillVertices, (size_t)bufferSize);
-    vkUnmapMemory(vkDevice, vkMemory);
-}
-
-uint32_t Slider::FindMemoryType(uint32_t typeFilter, MemoryPropertyFlag properties) {
-    if (m_renderContext) {
-        return m_renderContext->FindMemoryType(typeFilter, properties);
-    }
-    
-    // 向后兼容：如果没有渲染上下文，使用旧方法
-    // 将 MemoryPropertyFlag 转换为 VkMemoryPropertyFlags
-    VkMemoryPropertyFlags vkProperties = 0;
-    if ((properties & MemoryPropertyFlag::DeviceLocal) != MemoryPropertyFlag::None) {
-        vkProperties |= VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT;
-    }
-    if ((properties & MemoryPropertyFlag::HostVisible) != MemoryPropertyFlag::None) {
-        vkProperties |= VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT;
-    }
-    if ((properties & MemoryPropertyFlag::HostCoherent) != MemoryPropertyFlag::None) {
-        vkProperties |= VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
-    }
-    if ((properties & MemoryPropertyFlag::HostCached) != MemoryPropertyFlag::None) {
-        vkProperties |= VK_MEMORY_PROPERTY_HOST_CACHED_BIT;
-    }
-    
-    VkPhysicalDevice vkPhysicalDevice = static_cast<VkPhysicalDevice>(m_physicalDevice);
-    VkPhysicalDeviceMemoryProperties memProperties;
-    vkGetPhysicalDeviceMemoryProperties(vkPhysicalDevice, &memProperties);
-    
-    for (uint32_t i = 0; i < memProperties.memoryTypeCount; i++) {
-        if ((typeFilter & (1 << i)) && 
-            (memProperties.memoryTypes[i].propertyFlags & vkProperties) == vkProperties) {
-            return i;
-        }
-    }
-    
-    Window::ShowError("Failed to find suitable memory type for slider!");
-    return 0;
+    VulkanMemoryAllocator::Write(vkDevice, m_fillVertexBufferAllocation, fillVertices, bufferSize);
 }
 
 bool Slider::CreatePipeline(RenderPassHandle renderPass) {
     // 将抽象类型转换为 Vulkan 类型
     VkDevice vkDevice = static_cast<VkDevice>(m_device);
-    VkRenderPass vkRenderPass = static_cast<VkRenderPass>(renderPass);
-    // 加载shader（复用按钮的shader）
-    std::vector<char> vertCode = renderer::shader::ShaderLoader::LoadSPIRV("renderer/ui/button/button.vert.spv");
-    std::vector<char> fragCode = renderer::shader::ShaderLoader::LoadSPIRV("renderer/ui/button/button.frag.spv");
-    
-    if (vertCode.empty() || fragCode.empty()) {
-        // 如果SPIR-V文件不存在，尝试从源码编译
-        #ifdef USE_SHADERC
-        std::ifstream vertFile("renderer/ui/button/button.vert");
-        std::ifstream fragFile("renderer/ui/button/button.frag");
-        if (vertFile.is_open() && fragFile.is_open()) {
-            std::string vertSource((std::istreambuf_iterator<char>(vertFile)), std::istreambuf_iterator<char>());
-            std::string fragSource((std::istreambuf_iterator<char>(fragFile)), std::istreambuf_iterator<char>());
-            vertCode = renderer::shader::ShaderLoader::CompileGLSLFromSource(vertSource, ShaderStage::Vertex, "button.vert");
-            fragCode = renderer::shader::ShaderLoader::CompileGLSLFromSource(fragSource, ShaderStage::Fragment, "button.frag");
-        }
-        #endif
-    }
-    
-    if (vertCode.empty() || fragCode.empty()) {
-        Window::ShowError("Failed to load shaders for slider!");
-        return false;
-    }
-    
-    // 使用抽象类型，然后在需要时转换为Vulkan类型
-    ShaderModuleHandle vertShaderModuleHandle = renderer::shader::ShaderLoader::CreateShaderModuleFromSPIRV(static_cast<DeviceHandle>(m_device), vertCode);
-    ShaderModuleHandle fragShaderModuleHandle = renderer::shader::ShaderLoader::CreateShaderModuleFromSPIRV(static_cast<DeviceHandle>(m_device), fragCode);
-    
-    if (vertShaderModuleHandle == nullptr || fragShaderModuleHandle == nullptr) {
-        Window::ShowError("Failed to create shader modules for slider!");
-        return false;
-    }
-    
-    // 将抽象句柄转换为Vulkan类型用于创建管线
-    VkShaderModule vertShaderModule = static_cast<VkShaderModule>(vertShaderModuleHandle);
-    VkShaderModule fragShaderModule = static_cast<VkShaderModule>(fragShaderModuleHandle);
     
-    if (vertShaderModule == VK_NULL_HANDLE || fragShaderModule == VK_NULL_HANDLE) {
-        Window::ShowError("Failed to create shader modules for slider!");
-        return false;
-    }
-    
-    // Shader阶段
-    VkPipelineShaderStageCreateInfo vertShaderStageInfo = {};
-    vertShaderStageInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
-    vertShaderStageInfo.stage = VK_SHADER_STAGE_VERTEX_BIT;
-    vertShaderStageInfo.module = vertShaderModule;
-    vertShaderStageInfo.pName = "main";
-    
-    VkPipelineShaderStageCreateInfo fragShaderStageInfo = {};
-    fragShaderStageInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
-    fragShaderStageInfo.stage = VK_SHADER_STAGE_FRAGMENT_BIT;
-    fragShaderStageInfo.module = fragShaderModule;
-    fragShaderStageInfo.pName = "main";
-    
-    VkPipelineShaderStageCreateInfo shaderStages[] = {vertShaderStageInfo, fragShaderStageInfo};
-    
-    // 顶点输入
-    VkVertexInputBindingDescription bindingDescription = {};
-    bindingDescription.binding = 0;
-    bindingDescription.stride = sizeof(float) * 6; // x, y, r, g, b, a
-    bindingDescription.inputRate = VK_VERTEX_INPUT_RATE_VERTEX;
-    
-    VkVertexInputAttributeDescription attributeDescriptions[2] = {};
-    attributeDescriptions[0].binding = 0;
-    attributeDescriptions[0].location = 0;
-    attributeDescriptions[0].format = VK_FORMAT_R32G32_SFLOAT;
-    attributeDescriptions[0].offset = 0;
-    
-    attributeDescriptions[1].binding = 0;
-    attributeDescriptions[1].location = 1;
-    attributeDescriptions[1].format = VK_FORMAT_R32G32B32A32_SFLOAT;
-    attributeDescriptions[1].offset = sizeof(float) * 2;
-    
-    VkPipelineVertexInputStateCreateInfo vertexInputInfo = {};
-    vertexInputInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO;
-    vertexInputInfo.vertexBindingDescriptionCount = 1;
-    vertexInputInfo.pVertexBindingDescriptions = &bindingDescription;
-    vertexInputInfo.vertexAttributeDescriptionCount = 2;
-    vertexInputInfo.pVertexAttributeDescriptions = attributeDescriptions;
-    
-    // 输入装配
-    VkPipelineInputAssemblyStateCreateInfo inputAssembly = {};
-    inputAssembly.sType = VK_STRUCTURE_TYPE_PIPELINE_INPUT_ASSEMBLY_STATE_CREATE_INFO;
-    inputAssembly.topology = VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
-    inputAssembly.primitiveRestartEnable = VK_FALSE;
-    
-    // 视口（使用动态状态）
-    VkPipelineViewportStateCreateInfo viewportState = {};
-    viewportState.sType = VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_STATE_CREATE_INFO;
-    viewportState.viewportCount = 1;
-    viewportState.pViewports = nullptr;  // Dynamic
-    viewportState.scissorCount = 1;
-    viewportState.pScissors = nullptr;    // Dynamic
-    
-    // 光栅化
-    VkPipelineRasterizationStateCreateInfo rasterizer = {};
-    rasterizer.sType = VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_STATE_CREATE_INFO;
-    rasterizer.depthClampEnable = VK_FALSE;
-    rasterizer.rasterizerDiscardEnable = VK_FALSE;
-    rasterizer.polygonMode = VK_POLYGON_MODE_FILL;
-    rasterizer.lineWidth = 1.0f;
-    rasterizer.cullMode = VK_CULL_MODE_NONE;
-    rasterizer.frontFace = VK_FRONT_FACE_COUNTER_CLOCKWISE;
-    rasterizer.depthBiasEnable = VK_FALSE;
-    
-    // 多重采样
-    VkPipelineMultisampleStateCreateInfo multisampling = {};
-    multisampling.sType = VK_STRUCTURE_TYPE_PIPELINE_MULTISAMPLE_STATE_CREATE_INFO;
-    multisampling.sampleShadingEnable = VK_FALSE;
-    multisampling.rasterizationSamples = VK_SAMPLE_COUNT_1_BIT;
-    
-    // 颜色混合
-    VkPipelineColorBlendAttachmentState colorBlendAttachment = {};
-    colorBlendAttachment.colorWriteMask = VK_COLOR_COMPONENT_R_BIT | VK_COLOR_COMPONENT_G_BIT | 
-                                          VK_COLOR_COMPONENT_B_BIT | VK_COLOR_COMPONENT_A_BIT;
-    colorBlendAttachment.blendEnable = VK_TRUE;
-    colorBlendAttachment.srcColorBlendFactor = VK_BLEND_FACTOR_SRC_ALPHA;
-    colorBlendAttachment.dstColorBlendFactor = VK_BLEND_FACTOR_ONE_MINUS_SRC_ALPHA;
-    colorBlendAttachment.colorBlendOp = VK_BLEND_OP_ADD;
-    colorBlendAttachment.srcAlphaBlendFactor = VK_BLEND_FACTOR_ONE;
-    colorBlendAttachment.dstAlphaBlendFactor = VK_BLEND_FACTOR_ONE_MINUS_SRC_ALPHA;
-    colorBlendAttachment.alphaBlendOp = VK_BLEND_OP_ADD;
-    
-    VkPipelineColorBlendStateCreateInfo colorBlending = {};
-    colorBlending.sType = VK_STRUCTURE_TYPE_PIPELINE_COLOR_BLEND_STATE_CREATE_INFO;
-    colorBlending.logicOpEnable = VK_FALSE;
-    colorBlending.attachmentCount = 1;
-    colorBlending.pAttachments = &colorBlendAttachment;
-    
-    // Dynamic states
-    VkDynamicState dynamicStates[] = {
-        VK_DYNAMIC_STATE_VIEWPORT,
-        VK_DYNAMIC_STATE_SCISSOR
-    };
-    
-    VkPipelineDynamicStateCreateInfo dynamicState = {};
-    dynamicState.sType = VK_STRUCTURE_TYPE_PIPELINE_DYNAMIC_STATE_CREATE_INFO;
-    dynamicState.dynamicStateCount = 2;
-    dynamicState.pDynamicStates = dynamicStates;
-    
-    // 深度测试状态
-    VkPipelineDepthStencilStateCreateInfo depthStencil = {};
-    depthStencil.sType = VK_STRUCTURE_TYPE_PIPELINE_DEPTH_STENCIL_STATE_CREATE_INFO;
-    depthStencil.depthTestEnable = VK_FALSE;
-    depthStencil.depthWriteEnable = VK_FALSE;
-    depthStencil.depthCompareOp = VK_COMPARE_OP_ALWAYS;
-    depthStencil.depthBoundsTestEnable = VK_FALSE;
-    depthStencil.stencilTestEnable = VK_FALSE;
-    
-    // Push constants: position(2) + size(2) + screenSize(2) + useTexture(1) = 7 floats
-    VkPushConstantRange pushConstantRange = {};
-    pushConstantRange.stageFlags = VK_SHADER_STAGE_VERTEX_BIT | VK_SHADER_STAGE_FRAGMENT_BIT;
-    pushConstantRange.offset = 0;
-    pushConstantRange.size = sizeof(float) * 8; // position(2) + size(2) + screenSize(2) + useTexture(1) + shapeType(1)
-    
-    // Pipeline layout
-    VkPipelineLayoutCreateInfo pipelineLayoutInfo = {};
-    pipelineLayoutInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
-    pipelineLayoutInfo.setLayoutCount = 0;
-    pipelineLayoutInfo.pushConstantRangeCount = 1;
-    pipelineLayoutInfo.pPushConstantRanges = &pushConstantRange;
-    
-    VkPipelineLayout vkPipelineLayout = VK_NULL_HANDLE;
-    if (vkCreatePipelineLayout(vkDevice, &pipelineLayoutInfo, nullptr, &vkPipelineLayout) != VK_SUCCESS) {
-        vkDestroyShaderModule(vkDevice, vertShaderModule, nullptr);
-        vkDestroyShaderModule(vkDevice, fragShaderModule, nullptr);
-        Window::ShowError("Failed to create pipeline layout for slider!");
-        return false;
-    }
-    m_pipelineLayout = vkPipelineLayout;
-    
-    // 创建管线
-    VkGraphicsPipelineCreateInfo pipelineInfo = {};
-    pipelineInfo.sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO;
-    pipelineInfo.stageCount = 2;
-    pipelineInfo.pStages = shaderStages;
-    pipelineInfo.pVertexInputState = &vertexInputInfo;
-    pipelineInfo.pInputAssemblyState = &inputAssembly;
-    pipelineInfo.pViewportState = &viewportState;
-    pipelineInfo.pRasterizationState = &rasterizer;
-    pipelineInfo.pMultisampleState = &multisampling;
-    pipelineInfo.pDepthStencilState = &depthStencil;
-    pipelineInfo.pColorBlendState = &colorBlending;
-    pipelineInfo.pDynamicState = &dynamicState;
-    pipelineInfo.layout = vkPipelineLayout;
-    pipelineInfo.renderPass = vkRenderPass;
-    pipelineInfo.subpass = 0;
-    
-    VkPipeline vkPipeline = VK_NULL_HANDLE;
-    VkResult result = vkCreateGraphicsPipelines(vkDevice, VK_NULL_HANDLE, 1, &pipelineInfo, nullptr, &vkPipeline);
-    
-    vkDestroyShaderModule(vkDevice, vertShaderModule, nullptr);
-    vkDestroyShaderModule(vkDevice, fragShaderModule, nullptr);
-    
-    if (result != VK_SUCCESS) {
+    // 复用按钮的shader和管线描述，与无纹理按钮共享同一条管线
+    GraphicsPipelineDesc desc = Button::GetPipelineDesc(false, false, renderPass);
+    if (!VulkanPipelineRegistry::Acquire(m_pipelineRegistry, vkDevice, static_cast<VkPipelineCache>(m_pipelineCache), desc, m_pipeline)) {
         Window::ShowError("Failed to create graphics pipeline for slider!");
         return false;
     }
-    m_graphicsPipeline = vkPipeline;
     
     return true;
 }
@@ -686,30 +400,16 @@ bool Slider::CreateFullscreenQuadBuffer() {
     }
     m_fullscreenQuadBuffer = vkBuffer;
     
-    // 分配内存
-    VkMemoryRequirements memRequirements;
-    vkGetBufferMemoryRequirements(vkDevice, vkBuffer, &memRequirements);
-    
-    VkMemoryAllocateInfo allocInfo = {};
-    allocInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
-    allocInfo.allocationSize = memRequirements.size;
-    allocInfo.memoryTypeIndex = FindMemoryType(memRequirements.memoryTypeBits, 
-                                                MemoryPropertyFlag::HostVisible | MemoryPropertyFlag::HostCoherent);
-    
-    VkDeviceMemory vkMemory = VK_NULL_HANDLE;
-    if (vkAllocateMemory(vkDevice, &allocInfo, nullptr, &vkMemory) != VK_SUCCESS) {
+    // 分配内存（从共享分配器子分配）
+    if (!VulkanMemoryAllocator::AllocateBuffer(m_memoryAllocator, vkDevice, static_cast<VkPhysicalDevice>(m_physicalDevice),
+                                               vkBuffer, MemoryPropertyFlag::HostVisible | MemoryPropertyFlag::HostCoherent,
+                                               m_fullscreenQuadBufferAllocation)) {
         Window::ShowError("Failed to allocate fullscreen quad vertex buffer memory!");
         return false;
     }
-    m_fullscreenQuadBufferMemory = vkMemory;
-    
-    vkBindBufferMemory(vkDevice, vkBuffer, vkMemory, 0);
     
     // 填充数据
-    void* data;
-    vkMapMemory(vkDevice, vkMemory, 0, bufferSize, 0, &data);
-    memcpy(data, quadVertices, (size_t)bufferSize);
-    vkUnmapMemory(vkDevice, vkMemory);
+    VulkanMemoryAllocator::Write(vkDevice, m_fullscreenQuadBufferAllocation, quadVertices, bufferSize);
     
     return true;
 }
@@ -717,200 +417,13 @@ bool Slider::CreateFullscreenQuadBuffer() {
 bool Slider::CreatePureShaderPipeline(RenderPassHandle renderPass) {
     // 将抽象类型转换为 Vulkan 类型
     VkDevice vkDevice = static_cast<VkDevice>(m_device);
-    VkRenderPass vkRenderPass = static_cast<VkRenderPass>(renderPass);
-    // 加载纯shader（复用按钮的纯shader）
-    std::vector<char> vertCode = renderer::shader::ShaderLoader::LoadSPIRV("renderer/ui/button/button_pure.vert.spv");
-    std::vector<char> fragCode = renderer::shader::ShaderLoader::LoadSPIRV("renderer/ui/button/button_pure.frag.spv");
-    
-    if (vertCode.empty() || fragCode.empty()) {
-        #ifdef USE_SHADERC
-        std::ifstream vertFile("renderer/ui/button/button_pure.vert");
-        std::ifstream fragFile("renderer/ui/button/button_pure.frag");
-        if (vertFile.is_open() && fragFile.is_open()) {
-            std::string vertSource((std::istreambuf_iterator<char>(vertFile)), std::istreambuf_iterator<char>());
-            std::string fragSource((std::istreambuf_iterator<char>(fragFile)), std::istreambuf_iterator<char>());
-            vertCode = renderer::shader::ShaderLoader::CompileGLSLFromSource(vertSource, ShaderStage::Vertex, "button_pure.vert");
-            fragCode = renderer::shader::ShaderLoader::CompileGLSLFromSource(fragSource, ShaderStage::Fragment, "button_pure.frag");
-        }
-        #endif
-    }
-    
-    if (vertCode.empty() || fragCode.empty()) {
-        Window::ShowError("Failed to load pure shader shaders for slider!");
-        return false;
-    }
-    
-    // 使用抽象类型，然后在需要时转换为Vulkan类型
-    ShaderModuleHandle vertShaderModuleHandle = renderer::shader::ShaderLoader::CreateShaderModuleFromSPIRV(static_cast<DeviceHandle>(m_device), vertCode);
-    ShaderModuleHandle fragShaderModuleHandle = renderer::shader::ShaderLoader::CreateShaderModuleFromSPIRV(static_cast<DeviceHandle>(m_device), fragCode);
-    
-    if (vertShaderModuleHandle == nullptr || fragShaderModuleHandle == nullptr) {
-        Window::ShowError("Failed to create shader modules for slider!");
-        return false;
-    }
     
-    // 将抽象句柄转换为Vulkan类型用于创建管线
-    VkShaderModule vertShaderModule = static_cast<VkShaderModule>(vertShaderModuleHandle);
-    VkShaderModule fragShaderModule = static_cast<VkShaderModule>(fragShaderModuleHandle);
-    
-    if (vertShaderModule == VK_NULL_HANDLE || fragShaderModule == VK_NULL_HANDLE) {
-        Window::ShowError("Failed to create pure shader modules for slider!");
-        return false;
-    }
-    
-    // Shader阶段
-    VkPipelineShaderStageCreateInfo vertShaderStageInfo = {};
-    vertShaderStageInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
-    vertShaderStageInfo.stage = VK_SHADER_STAGE_VERTEX_BIT;
-    vertShaderStageInfo.module = vertShaderModule;
-    vertShaderStageInfo.pName = "main";
-    
-    VkPipelineShaderStageCreateInfo fragShaderStageInfo = {};
-    fragShaderStageInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
-    fragShaderStageInfo.stage = VK_SHADER_STAGE_FRAGMENT_BIT;
-    fragShaderStageInfo.module = fragShaderModule;
-    fragShaderStageInfo.pName = "main";
-    
-    VkPipelineShaderStageCreateInfo shaderStages[] = {vertShaderStageInfo, fragShaderStageInfo};
-    
-    // 顶点输入
-    VkVertexInputBindingDescription bindingDescription = {};
-    bindingDescription.binding = 0;
-    bindingDescription.stride = sizeof(float) * 2; // x, y
-    bindingDescription.inputRate = VK_VERTEX_INPUT_RATE_VERTEX;
-    
-    VkVertexInputAttributeDescription attributeDescription = {};
-    attributeDescription.binding = 0;
-    attributeDescription.location = 0;
-    attributeDescription.format = VK_FORMAT_R32G32_SFLOAT;
-    attributeDescription.offset = 0;
-    
-    VkPipelineVertexInputStateCreateInfo vertexInputInfo = {};
-    vertexInputInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO;
-    vertexInputInfo.vertexBindingDescriptionCount = 1;
-    vertexInputInfo.pVertexBindingDescriptions = &bindingDescription;
-    vertexInputInfo.vertexAttributeDescriptionCount = 1;
-    vertexInputInfo.pVertexAttributeDescriptions = &attributeDescription;
-    
-    // 输入装配
-    VkPipelineInputAssemblyStateCreateInfo inputAssembly = {};
-    inputAssembly.sType = VK_STRUCTURE_TYPE_PIPELINE_INPUT_ASSEMBLY_STATE_CREATE_INFO;
-    inputAssembly.topology = VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
-    inputAssembly.primitiveRestartEnable = VK_FALSE;
-    
-    // 视口（使用动态状态）
-    VkPipelineViewportStateCreateInfo viewportState = {};
-    viewportState.sType = VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_STATE_CREATE_INFO;
-    viewportState.viewportCount = 1;
-    viewportState.pViewports = nullptr;  // Dynamic
-    viewportState.scissorCount = 1;
-    viewportState.pScissors = nullptr;    // Dynamic
-    
-    // 光栅化
-    VkPipelineRasterizationStateCreateInfo rasterizer = {};
-    rasterizer.sType = VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_STATE_CREATE_INFO;
-    rasterizer.depthClampEnable = VK_FALSE;
-    rasterizer.rasterizerDiscardEnable = VK_FALSE;
-    rasterizer.polygonMode = VK_POLYGON_MODE_FILL;
-    rasterizer.lineWidth = 1.0f;
-    rasterizer.cullMode = VK_CULL_MODE_NONE;
-    rasterizer.frontFace = VK_FRONT_FACE_COUNTER_CLOCKWISE;
-    rasterizer.depthBiasEnable = VK_FALSE;
-    
-    // 多重采样
-    VkPipelineMultisampleStateCreateInfo multisampling = {};
-    multisampling.sType = VK_STRUCTURE_TYPE_PIPELINE_MULTISAMPLE_STATE_CREATE_INFO;
-    multisampling.sampleShadingEnable = VK_FALSE;
-    multisampling.rasterizationSamples = VK_SAMPLE_COUNT_1_BIT;
-    
-    // 颜色混合
-    VkPipelineColorBlendAttachmentState colorBlendAttachment = {};
-    colorBlendAttachment.colorWriteMask = VK_COLOR_COMPONENT_R_BIT | VK_COLOR_COMPONENT_G_BIT | 
-                                          VK_COLOR_COMPONENT_B_BIT | VK_COLOR_COMPONENT_A_BIT;
-    colorBlendAttachment.blendEnable = VK_TRUE;
-    colorBlendAttachment.srcColorBlendFactor = VK_BLEND_FACTOR_SRC_ALPHA;
-    colorBlendAttachment.dstColorBlendFactor = VK_BLEND_FACTOR_ONE_MINUS_SRC_ALPHA;
-    colorBlendAttachment.colorBlendOp = VK_BLEND_OP_ADD;
-    colorBlendAttachment.srcAlphaBlendFactor = VK_BLEND_FACTOR_ONE;
-    colorBlendAttachment.dstAlphaBlendFactor = VK_BLEND_FACTOR_ONE_MINUS_SRC_ALPHA;
-    colorBlendAttachment.alphaBlendOp = VK_BLEND_OP_ADD;
-    
-    VkPipelineColorBlendStateCreateInfo colorBlending = {};
-    colorBlending.sType = VK_STRUCTURE_TYPE_PIPELINE_COLOR_BLEND_STATE_CREATE_INFO;
-    colorBlending.logicOpEnable = VK_FALSE;
-    colorBlending.attachmentCount = 1;
-    colorBlending.pAttachments = &colorBlendAttachment;
-    
-    // Dynamic states
-    VkDynamicState dynamicStates[] = {
-        VK_DYNAMIC_STATE_VIEWPORT,
-        VK_DYNAMIC_STATE_SCISSOR
-    };
-    
-    VkPipelineDynamicStateCreateInfo dynamicState = {};
-    dynamicState.sType = VK_STRUCTURE_TYPE_PIPELINE_DYNAMIC_STATE_CREATE_INFO;
-    dynamicState.dynamicStateCount = 2;
-    dynamicState.pDynamicStates = dynamicStates;
-    
-    // 深度测试状态
-    VkPipelineDepthStencilStateCreateInfo depthStencil = {};
-    depthStencil.sType = VK_STRUCTURE_TYPE_PIPELINE_DEPTH_STENCIL_STATE_CREATE_INFO;
-    depthStencil.depthTestEnable = VK_FALSE;
-    depthStencil.depthWriteEnable = VK_FALSE;
-    depthStencil.depthCompareOp = VK_COMPARE_OP_ALWAYS;
-    depthStencil.depthBoundsTestEnable = VK_FALSE;
-    depthStencil.stencilTestEnable = VK_FALSE;
-    
-    // Push constants: position(2) + size(2) + screenSize(2) + color(4) = 10 floats
-    VkPushConstantRange pushConstantRange = {};
-    pushConstantRange.stageFlags = VK_SHADER_STAGE_FRAGMENT_BIT;
-    pushConstantRange.offset = 0;
-    pushConstantRange.size = sizeof(float) * 10;
-    
-    // Pipeline layout
-    VkPipelineLayoutCreateInfo pipelineLayoutInfo = {};
-    pipelineLayoutInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
-    pipelineLayoutInfo.setLayoutCount = 0;
-    pipelineLayoutInfo.pushConstantRangeCount = 1;
-    pipelineLayoutInfo.pPushConstantRanges = &pushConstantRange;
-    
-    VkPipelineLayout vkPipelineLayout = VK_NULL_HANDLE;
-    if (vkCreatePipelineLayout(vkDevice, &pipelineLayoutInfo, nullptr, &vkPipelineLayout) != VK_SUCCESS) {
-        vkDestroyShaderModule(vkDevice, vertShaderModule, nullptr);
-        vkDestroyShaderModule(vkDevice, fragShaderModule, nullptr);
-        Window::ShowError("Failed to create pure shader pipeline layout for slider!");
-        return false;
-    }
-    m_pureShaderPipelineLayout = vkPipelineLayout;
-    
-    // 创建管线
-    VkGraphicsPipelineCreateInfo pipelineInfo = {};
-    pipelineInfo.sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO;
-    pipelineInfo.stageCount = 2;
-    pipelineInfo.pStages = shaderStages;
-    pipelineInfo.pVertexInputState = &vertexInputInfo;
-    pipelineInfo.pInputAssemblyState = &inputAssembly;
-    pipelineInfo.pViewportState = &viewportState;
-    pipelineInfo.pRasterizationState = &rasterizer;
-    pipelineInfo.pMultisampleState = &multisampling;
-    pipelineInfo.pDepthStencilState = &depthStencil;
-    pipelineInfo.pColorBlendState = &colorBlending;
-    pipelineInfo.pDynamicState = &dynamicState;
-    pipelineInfo.layout = vkPipelineLayout;
-    pipelineInfo.renderPass = vkRenderPass;
-    pipelineInfo.subpass = 0;
-    
-    VkPipeline vkPipeline = VK_NULL_HANDLE;
-    VkResult result = vkCreateGraphicsPipelines(vkDevice, VK_NULL_HANDLE, 1, &pipelineInfo, nullptr, &vkPipeline);
-    
-    vkDestroyShaderModule(vkDevice, vertShaderModule, nullptr);
-    vkDestroyShaderModule(vkDevice, fragShaderModule, nullptr);
-    
-    if (result != VK_SUCCESS) {
+    // 复用按钮的纯shader管线描述（推送常量范围覆盖滑块的10个float）
+    GraphicsPipelineDesc desc = Button::GetPipelineDesc(true, false, renderPass);
+    if (!VulkanPipelineRegistry::Acquire(m_pipelineRegistry, vkDevice, static_cast<VkPipelineCache>(m_pipelineCache), desc, m_pureShaderPipeline)) {
         Window::ShowError("Failed to create pure shader graphics pipeline for slider!");
         return false;
     }
-    m_pureShaderPipeline = vkPipeline;
     
     return true;
 }
@@ -1126,11 +639,11 @@ void Slider::Render(CommandBufferHandle commandBuffer, Extent2D extent) {
     
     if (m_usePureShader) {
         // 纯shader方式渲染
-        if (m_pureShaderPipeline == nullptr || m_fullscreenQuadBuffer == nullptr) return;
+        if (!m_pureShaderPipeline.IsValid() || m_fullscreenQuadBuffer == nullptr) return;
         
         // 将抽象类型转换为 Vulkan 类型
-        VkPipeline vkPipeline = static_cast<VkPipeline>(m_pureShaderPipeline);
-        VkPipelineLayout vkPipelineLayout = static_cast<VkPipelineLayout>(m_pureShaderPipelineLayout);
+        VkPipeline vkPipeline = static_cast<VkPipeline>(m_pureShaderPipeline.pipeline);
+        VkPipelineLayout vkPipelineLayout = static_cast<VkPipelineLayout>(m_pureShaderPipeline.layout);
         VkBuffer vkBuffer = static_cast<VkBuffer>(m_fullscreenQuadBuffer);
         
         // 绑定管线
@@ -1198,13 +711,13 @@ void Slider::Render(CommandBufferHandle commandBuffer, Extent2D extent) {
         vkCmdDraw(vkCommandBuffer, 6, 1, 0, 0);
     } else {
         // 传统方式渲染
-        if (m_graphicsPipeline == nullptr || 
+        if (!m_pipeline.IsValid() || 
             m_trackVertexBuffer == nullptr || 
             m_fillVertexBuffer == nullptr) return;
         
         // 将抽象类型转换为 Vulkan 类型
-        VkPipeline vkPipeline = static_cast<VkPipeline>(m_graphicsPipeline);
-        VkPipelineLayout vkPipelineLayout = static_cast<VkPipelineLayout>(m_pipelineLayout);
+        VkPipeline vkPipeline = static_cast<VkPipeline>(m_pipeline.pipeline);
+        VkPipelineLayout vkPipelineLayout = static_cast<VkPipelineLayout>(m_pipeline.layout);
         VkBuffer vkTrackBuffer = static_cast<VkBuffer>(m_trackVertexBuffer);
         VkBuffer vkFillBuffer = static_cast<VkBuffer>(m_fillVertexBuffer);
         
@@ -1294,3 +807,45 @@ void Slider::Render(CommandBufferHandle commandBuffer, Extent2D extent) {
         m_thumbButton->Render(commandBuffer, extent);
     }
 }
+
+bool Slider::AppendToBatch(UIQuadBatch& batch, Extent2D extent) const {
+    if (!m_visible) return true;
+    
+    // 纯shader方式使用全屏四边形和自己的视口，保持逐滑块渲染
+    if (m_usePureShader || !m_initialized || !m_pipeline.IsValid()) return false;
+    
+    // 与 Render() 相同的坐标转换（Scaled模式：逻辑坐标 -> 屏幕坐标）
+    float renderX = m_x;
+    float renderY = m_y;
+    float renderWidth = m_width;
+    float renderHeight = m_height;
+    float renderScreenWidth = (float)extent.width;
+    float renderScreenHeight = (float)extent.height;
+    
+    if (m_stretchParams) {
+        renderX = m_x * m_stretchParams->m_stretchScaleX + m_stretchParams->m_marginX;
+        renderY = m_y * m_stretchParams->m_stretchScaleY + m_stretchParams->m_marginY;
+        renderWidth = m_width * m_stretchParams->m_stretchScaleX;
+        renderHeight = m_height * m_stretchParams->m_stretchScaleY;
+        renderScreenWidth = m_stretchParams->m_screenWidth;
+        renderScreenHeight = m_stretchParams->m_screenHeight;
+    }
+    
+    // 轨道
+    UIQuadInstance track(renderX, renderY, renderWidth, renderHeight, renderScreenWidth, renderScreenHeight);
+    track.SetColor(m_trackColorR, m_trackColorG, m_trackColorB, m_trackColorA);
+    batch.Add(track);
+    
+    // 填充区域（从轨道左端开始，宽度按归一化值缩放）
+    float fillWidth = GetNormalizedValue() * renderWidth;
+    UIQuadInstance fill(renderX, renderY, fillWidth, renderHeight, renderScreenWidth, renderScreenHeight);
+    fill.SetColor(m_fillColorR, m_fillColorG, m_fillColorB, m_fillColorA);
+    batch.Add(fill);
+    
+    // 拖动点按钮与滑块使用相同的渲染方式，同样可以批量渲染
+    if (m_thumbButton) {
+        m_thumbButton->AppendToBatch(batch, extent);
+    }
+    
+    return true;
+}
@@ -4,12 +4,15 @@
 #include <memory>         // 2. 系统头文件
 #include <string>         // 2. 系统头文件
 
+#include "core/interfaces/imemory_allocator.h"  // 4. 项目头文件（接口）
+#include "core/interfaces/ipipeline_registry.h"  // 4. 项目头文件（接口）
 #include "core/interfaces/islider.h"  // 4. 项目头文件（接口）
 #include "core/types/render_types.h"  // 4. 项目头文件（类型）
 
 // 前向声明
 class Button;
 class IRenderContext;
+class UIQuadBatch;
 
 // 滑块配置结构体
 struct SliderConfig {
@@ -211,6 +214,10 @@ public:
     // 渲染滑块到命令缓冲区
     void Render(CommandBufferHandle commandBuffer, Extent2D extent) override;
     
+    // 把轨道、填充区域和拖动点追加到UI批量渲染器（与 Render() 的传统方式输出相同）
+    // 返回：已追加或滑块不可见返回true；纯shader模式或资源未就绪返回false，调用方应改用 Render()
+    bool AppendToBatch(UIQuadBatch& batch, Extent2D extent) const;
+    
     // 设置值变化回调函数
     void SetOnValueChangedCallback(std::function<void(float)> callback) override {
         m_onValueChangedCallback = callback;
@@ -254,9 +261,6 @@ private:
     // 更新填充缓冲区（当颜色或值改变时）
     void UpdateFillBuffer();
     
-    // 查找内存类型
-    uint32_t FindMemoryType(uint32_t typeFilter, MemoryPropertyFlag properties);
-    
     // 创建图形管线
     bool CreatePipeline(RenderPassHandle renderPass);
     
@@ -269,6 +273,15 @@ private:
     // 渲染上下文（新接口）
     IRenderContext* m_renderContext = nullptr;
     
+    // 共享内存分配器（初始化时从渲染上下文复制，[BORROW] 由渲染器拥有，为空时独立分配）
+    IMemoryAllocator* m_memoryAllocator = nullptr;
+    
+    // 共享管线缓存（初始化时从渲染上下文复制，[BORROW] 由渲染器拥有，可为 nullptr）
+    PipelineCacheHandle m_pipelineCache = nullptr;
+    
+    // 共享管线注册表（初始化时从渲染上下文复制，[BORROW] 由渲染器拥有，为空时独立创建管线）
+    IPipelineRegistry* m_pipelineRegistry = nullptr;
+    
     // 渲染设备对象（使用抽象类型，在实现层转换为Vulkan类型）
     DeviceHandle m_device = nullptr;
     PhysicalDeviceHandle m_physicalDevice = nullptr;
@@ -328,17 +341,15 @@ private:
     // 注意：以下成员变量在 .cpp 文件中使用 Vulkan 类型，头文件中使用不透明指针
     // 使用不透明指针避免头文件直接依赖 Vulkan 实现
     void* m_trackVertexBuffer = nullptr;
-    void* m_trackVertexBufferMemory = nullptr;
+    MemoryAllocation m_trackVertexBufferAllocation;
     void* m_fillVertexBuffer = nullptr;
-    void* m_fillVertexBufferMemory = nullptr;
-    void* m_graphicsPipeline = nullptr;
-    void* m_pipelineLayout = nullptr;
+    MemoryAllocation m_fillVertexBufferAllocation;
+    SharedPipeline m_pipeline;  // 与按钮共享的管线和管线布局
     
     // 纯shader渲染资源
     void* m_fullscreenQuadBuffer = nullptr;
-    void* m_fullscreenQuadBufferMemory = nullptr;
-    void* m_pureShaderPipeline = nullptr;
-    void* m_pureShaderPipelineLayout = nullptr;
+    MemoryAllocation m_fullscreenQuadBufferAllocation;
+    SharedPipeline m_pureShaderPipeline;
     
     // 值变化回调
     std::function<void(float)> m_onValueChangedCallback;
@@ -0,0 +1,655 @@
+#include "renderer/vulkan/vulkan_compute_scene.h"  // 1. 对应头文件
+
+#include <algorithm>  // 2. 系统头文件
+#include <stdio.h>  // 2. 系统头文件
+
+#include "core/config/render_constants.h"  // 4. 项目头文件（配置）
+#include "renderer/vulkan/vulkan_memory_allocator.h"  // 4. 项目头文件（Vulkan）
+#include "shader/shader_loader.h"  // 4. 项目头文件（着色器）
+
+namespace {
+
+// 存储图像格式（规范保证 R8G8B8A8_UNORM 支持存储图像用途；与交换链格式无关，合成时由颜色附件完成格式转换）
+const VkFormat STORAGE_FORMAT = VK_FORMAT_R8G8B8A8_UNORM;
+
+// 计算着色器的推送常量（与 shader.comp / loading_cubes.comp 的 ComputeRegion 一致）
+struct ComputeScenePushConstants {
+    float viewportOrigin[2];   // 图形路径的视口左上角（像素）
+    float viewportSize[2];     // 图形路径的视口尺寸（像素）
+    int32_t regionOrigin[2];   // 调度区域左上角
+    int32_t regionExtent[2];   // 调度区域尺寸
+};
+
+// 合成着色器的推送常量（复用 upscale.frag，与其 UpscaleParams 一致）
+struct CompositePushConstants {
+    float uvScale[2];
+    float uvMax[2];
+    float texelSize[2];
+    float sharpness;
+    float padding;
+};
+
+VkShaderModule CreateModule(VkDevice device, const std::vector<char>& code) {
+    return static_cast<VkShaderModule>(
+        renderer::shader::ShaderLoader::CreateShaderModuleFromSPIRV(static_cast<DeviceHandle>(device), code));
+}
+
+} // namespace
+
+VulkanComputeScene::VulkanComputeScene() {
+}
+
+VulkanComputeScene::~VulkanComputeScene() {
+    Cleanup();
+}
+
+bool VulkanComputeScene::Initialize(VkDevice device, VkPhysicalDevice physicalDevice, IMemoryAllocator* allocator,
+                                    VkDescriptorSetLayout sceneSetLayout, VkRenderPass outputRenderPass, VkPipelineCache pipelineCache,
+                                    const std::string& compositeVertPath, const std::string& compositeFragPath) {
+    if (m_initialized) {
+        return true;
+    }
+    
+    if (device == VK_NULL_HANDLE || physicalDevice == VK_NULL_HANDLE ||
+        sceneSetLayout == VK_NULL_HANDLE || outputRenderPass == VK_NULL_HANDLE) {
+        return false;
+    }
+    
+    m_device = device;
+    m_physicalDevice = physicalDevice;
+    m_allocator = allocator;
+    m_initialized = true;
+    
+    // 失败时由 Cleanup 销毁已创建的部分
+    if (!CreateDescriptorResources(sceneSetLayout)) {
+        printf("[COMPUTE_SCENE] Failed to create descriptor resources\n");
+        Cleanup();
+        return false;
+    }
+    
+    if (!CreateCompositePipeline(outputRenderPass, pipelineCache, compositeVertPath, compositeFragPath)) {
+        Cleanup();
+        return false;
+    }
+    
+    return true;
+}
+
+void VulkanComputeScene::Cleanup() {
+    if (!m_initialized) {
+        return;
+    }
+    
+    DestroyTarget(m_target);
+    m_retiredTargets.ReleaseAll([this](Target& target) { DestroyTarget(target); });
+    
+    for (VkPipeline& pipeline : m_pipelines) {
+        if (pipeline != VK_NULL_HANDLE) {
+            vkDestroyPipeline(m_device, pipeline, nullptr);
+            pipeline = VK_NULL_HANDLE;
+        }
+    }
+    
+    if (m_compositePipeline != VK_NULL_HANDLE) {
+        vkDestroyPipeline(m_device, m_compositePipeline, nullptr);
+        m_compositePipeline = VK_NULL_HANDLE;
+    }
+    
+    VkPipelineLayout* layouts[] = { &m_computeLayout, &m_compositeLayout };
+    for (VkPipelineLayout* layout : layouts) {
+        if (*layout != VK_NULL_HANDLE) {
+            vkDestroyPipelineLayout(m_device, *layout, nullptr);
+            *layout = VK_NULL_HANDLE;
+        }
+    }
+    
+    if (m_descriptorPool != VK_NULL_HANDLE) {
+        vkDestroyDescriptorPool(m_device, m_descriptorPool, nullptr);
+        m_descriptorPool = VK_NULL_HANDLE;
+    }
+    
+    VkDescriptorSetLayout* setLayouts[] = { &m_storageSetLayout, &m_sampledSetLayout };
+    for (VkDescriptorSetLayout* setLayout : setLayouts) {
+        if (*setLayout != VK_NULL_HANDLE) {
+            vkDestroyDescriptorSetLayout(m_device, *setLayout, nullptr);
+            *setLayout = VK_NULL_HANDLE;
+        }
+    }
+    
+    if (m_sampler != VK_NULL_HANDLE) {
+        vkDestroySampler(m_device, m_sampler, nullptr);
+        m_sampler = VK_NULL_HANDLE;
+    }
+    
+    m_allocator = nullptr;
+    m_device = VK_NULL_HANDLE;
+    m_initialized = false;
+}
+
+bool VulkanComputeScene::CreateDescriptorResources(VkDescriptorSetLayout sceneSetLayout) {
+    // set 1：计算着色器写入的存储图像
+    VkDescriptorSetLayoutBinding storageBinding = {};
+    storageBinding.binding = 0;
+    storageBinding.descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_IMAGE;
+    storageBinding.descriptorCount = 1;
+    storageBinding.stageFlags = VK_SHADER_STAGE_COMPUTE_BIT;
+    
+    VkDescriptorSetLayoutCreateInfo layoutInfo = {};
+    layoutInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
+    layoutInfo.bindingCount = 1;
+    layoutInfo.pBindings = &storageBinding;
+    
+    if (vkCreateDescriptorSetLayout(m_device, &layoutInfo, nullptr, &m_storageSetLayout) != VK_SUCCESS) {
+        m_storageSetLayout = VK_NULL_HANDLE;
+        return false;
+    }
+    
+    // 合成通道以采样器读取同一图像（逐像素采样像素中心，等价于直接读取）
+    VkDescriptorSetLayoutBinding sampledBinding = {};
+    sampledBinding.binding = 0;
+    sampledBinding.descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+    sampledBinding.descriptorCount = 1;
+    sampledBinding.stageFlags = VK_SHADER_STAGE_FRAGMENT_BIT;
+    
+    layoutInfo.pBindings = &sampledBinding;
+    if (vkCreateDescriptorSetLayout(m_device, &layoutInfo, nullptr, &m_sampledSetLayout) != VK_SUCCESS) {
+        m_sampledSetLayout = VK_NULL_HANDLE;
+        return false;
+    }
+    
+    VkDescriptorPoolSize poolSizes[2] = {};
+    poolSizes[0].type = VK_DESCRIPTOR_TYPE_STORAGE_IMAGE;
+    poolSizes[0].descriptorCount = RetireQueue<Target>::MAX_LIVE_RESOURCES;
+    poolSizes[1].type = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+    poolSizes[1].descriptorCount = RetireQueue<Target>::MAX_LIVE_RESOURCES;
+    
+    // 每个存储图像两个描述符集，图像销毁时单独释放
+    VkDescriptorPoolCreateInfo poolInfo = {};
+    poolInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
+    poolInfo.flags = VK_DESCRIPTOR_POOL_CREATE_FREE_DESCRIPTOR_SET_BIT;
+    poolInfo.maxSets = RetireQueue<Target>::MAX_LIVE_RESOURCES * 2;
+    poolInfo.poolSizeCount = 2;
+    poolInfo.pPoolSizes = poolSizes;
+    
+    if (vkCreateDescriptorPool(m_device, &poolInfo, nullptr, &m_descriptorPool) != VK_SUCCESS) {
+        m_descriptorPool = VK_NULL_HANDLE;
+        return false;
+    }
+    
+    VkSamplerCreateInfo samplerInfo = {};
+    samplerInfo.sType = VK_STRUCTURE_TYPE_SAMPLER_CREATE_INFO;
+    samplerInfo.magFilter = VK_FILTER_NEAREST;
+    samplerInfo.minFilter = VK_FILTER_NEAREST;
+    samplerInfo.mipmapMode = VK_SAMPLER_MIPMAP_MODE_NEAREST;
+    samplerInfo.addressModeU = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE;
+    samplerInfo.addressModeV = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE;
+    samplerInfo.addressModeW = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE;
+    samplerInfo.maxLod = 0.0f;
+    samplerInfo.borderColor = VK_BORDER_COLOR_INT_OPAQUE_BLACK;
+    
+    if (vkCreateSampler(m_device, &samplerInfo, nullptr, &m_sampler) != VK_SUCCESS) {
+        m_sampler = VK_NULL_HANDLE;
+        return false;
+    }
+    
+    // 计算管线布局：set 0 为场景参数和立方体数据，set 1 为输出图像
+    VkDescriptorSetLayout computeSetLayouts[] = { sceneSetLayout, m_storageSetLayout };
+    
+    VkPushConstantRange computeRange = {};
+    computeRange.stageFlags = VK_SHADER_STAGE_COMPUTE_BIT;
+    computeRange.offset = 0;
+    computeRange.size = sizeof(ComputeScenePushConstants);
+    
+    VkPipelineLayoutCreateInfo pipelineLayoutInfo = {};
+    pipelineLayoutInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
+    pipelineLayoutInfo.setLayoutCount = 2;
+    pipelineLayoutInfo.pSetLayouts = computeSetLayouts;
+    pipelineLayoutInfo.pushConstantRangeCount = 1;
+    pipelineLayoutInfo.pPushConstantRanges = &computeRange;
+    
+    if (vkCreatePipelineLayout(m_device, &pipelineLayoutInfo, nullptr, &m_computeLayout) != VK_SUCCESS) {
+        m_computeLayout = VK_NULL_HANDLE;
+        return false;
+    }
+    
+    VkPushConstantRange compositeRange = {};
+    compositeRange.stageFlags = VK_SHADER_STAGE_FRAGMENT_BIT;
+    compositeRange.offset = 0;
+    compositeRange.size = sizeof(CompositePushConstants);
+    
+    pipelineLayoutInfo.setLayoutCount = 1;
+    pipelineLayoutInfo.pSetLayouts = &m_sampledSetLayout;
+    pipelineLayoutInfo.pPushConstantRanges = &compositeRange;
+    
+    if (vkCreatePipelineLayout(m_device, &pipelineLayoutInfo, nullptr, &m_compositeLayout) != VK_SUCCESS) {
+        m_compositeLayout = VK_NULL_HANDLE;
+        return false;
+    }
+    
+    return true;
+}
+
+bool VulkanComputeScene::CreateCompositePipeline(VkRenderPass outputRenderPass, VkPipelineCache pipelineCache,
+                                                 const std::string& vertShaderPath, const std::string& fragShaderPath) {
+    std::vector<char> vertShaderCode = renderer::shader::ShaderLoader::LoadShaderCode(vertShaderPath, ShaderStage::Vertex);
+    std::vector<char> fragShaderCode = renderer::shader::ShaderLoader::LoadShaderCode(fragShaderPath, ShaderStage::Fragment);
+    if (vertShaderCode.empty() || fragShaderCode.empty()) {
+        printf("[COMPUTE_SCENE] Failed to load composite shaders: %s, %s\n", vertShaderPath.c_str(), fragShaderPath.c_str());
+        return false;
+    }
+    
+    VkShaderModule vertShaderModule = CreateModule(m_device, vertShaderCode);
+    VkShaderModule fragShaderModule = CreateModule(m_device, fragShaderCode);
+    if (vertShaderModule == VK_NULL_HANDLE || fragShaderModule == VK_NULL_HANDLE) {
+        if (vertShaderModule != VK_NULL_HANDLE) {
+            vkDestroyShaderModule(m_device, vertShaderModule, nullptr);
+        }
+        if (fragShaderModule != VK_NULL_HANDLE) {
+            vkDestroyShaderModule(m_device, fragShaderModule, nullptr);
+        }
+        printf("[COMPUTE_SCENE] Failed to create composite shader modules\n");
+        return false;
+    }
+    
+    VkPipelineShaderStageCreateInfo shaderStages[2] = {};
+    shaderStages[0].sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+    shaderStages[0].stage = VK_SHADER_STAGE_VERTEX_BIT;
+    shaderStages[0].module = vertShaderModule;
+    shaderStages[0].pName = "main";
+    shaderStages[1].sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+    shaderStages[1].stage = VK_SHADER_STAGE_FRAGMENT_BIT;
+    shaderStages[1].module = fragShaderModule;
+    shaderStages[1].pName = "main";
+    
+    // 全屏三角形的顶点由 gl_VertexIndex 生成
+    VkPipelineVertexInputStateCreateInfo vertexInputInfo = {};
+    vertexInputInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO;
+    
+    VkPipelineInputAssemblyStateCreateInfo inputAssembly = {};
+    inputAssembly.sType = VK_STRUCTURE_TYPE_PIPELINE_INPUT_ASSEMBLY_STATE_CREATE_INFO;
+    inputAssembly.topology = VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
+    inputAssembly.primitiveRestartEnable = VK_FALSE;
+    
+    VkPipelineViewportStateCreateInfo viewportState = {};
+    viewportState.sType = VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_STATE_CREATE_INFO;
+    viewportState.viewportCount = 1;
+    viewportState.scissorCount = 1;
+    
+    VkPipelineRasterizationStateCreateInfo rasterizer = {};
+    rasterizer.sType = VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_STATE_CREATE_INFO;
+    rasterizer.depthClampEnable = VK_FALSE;
+    rasterizer.rasterizerDiscardEnable = VK_FALSE;
+    rasterizer.polygonMode = VK_POLYGON_MODE_FILL;
+    rasterizer.lineWidth = 1.0f;
+    rasterizer.cullMode = VK_CULL_MODE_NONE;
+    rasterizer.frontFace = VK_FRONT_FACE_CLOCKWISE;
+    rasterizer.depthBiasEnable = VK_FALSE;
+    
+    VkPipelineMultisampleStateCreateInfo multisampling = {};
+    multisampling.sType = VK_STRUCTURE_TYPE_PIPELINE_MULTISAMPLE_STATE_CREATE_INFO;
+    multisampling.sampleShadingEnable = VK_FALSE;
+    multisampling.rasterizationSamples = VK_SAMPLE_COUNT_1_BIT;
+    
+    VkPipelineColorBlendAttachmentState colorBlendAttachment = {};
+    colorBlendAttachment.colorWriteMask = VK_COLOR_COMPONENT_R_BIT | VK_COLOR_COMPONENT_G_BIT | VK_COLOR_COMPONENT_B_BIT | VK_COLOR_COMPONENT_A_BIT;
+    colorBlendAttachment.blendEnable = VK_FALSE;
+    
+    VkPipelineColorBlendStateCreateInfo colorBlending = {};
+    colorBlending.sType = VK_STRUCTURE_TYPE_PIPELINE_COLOR_BLEND_STATE_CREATE_INFO;
+    colorBlending.logicOpEnable = VK_FALSE;
+    colorBlending.attachmentCount = 1;
+    colorBlending.pAttachments = &colorBlendAttachment;
+    
+    VkDynamicState dynamicStates[] = { VK_DYNAMIC_STATE_VIEWPORT, VK_DYNAMIC_STATE_SCISSOR };
+    VkPipelineDynamicStateCreateInfo dynamicState = {};
+    dynamicState.sType = VK_STRUCTURE_TYPE_PIPELINE_DYNAMIC_STATE_CREATE_INFO;
+    dynamicState.dynamicStateCount = 2;
+    dynamicState.pDynamicStates = dynamicStates;
+    
+    VkGraphicsPipelineCreateInfo pipelineInfo = {};
+    pipelineInfo.sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO;
+    pipelineInfo.stageCount = 2;
+    pipelineInfo.pStages = shaderStages;
+    pipelineInfo.pVertexInputState = &vertexInputInfo;
+    pipelineInfo.pInputAssemblyState = &inputAssembly;
+    pipelineInfo.pViewportState = &viewportState;
+    pipelineInfo.pRasterizationState = &rasterizer;
+    pipelineInfo.pMultisampleState = &multisampling;
+    pipelineInfo.pColorBlendState = &colorBlending;
+    pipelineInfo.pDynamicState = &dynamicState;
+    pipelineInfo.layout = m_compositeLayout;
+    pipelineInfo.renderPass = outputRenderPass;
+    pipelineInfo.subpass = 0;
+    
+    VkResult result = vkCreateGraphicsPipelines(m_device, pipelineCache, 1, &pipelineInfo, nullptr, &m_compositePipeline);
+    
+    vkDestroyShaderModule(m_device, fragShaderModule, nullptr);
+    vkDestroyShaderModule(m_device, vertShaderModule, nullptr);
+    
+    if (result != VK_SUCCESS) {
+        m_compositePipeline = VK_NULL_HANDLE;
+        printf("[COMPUTE_SCENE] Failed to create composite pipeline: %d\n", result);
+        return false;
+    }
+    
+    return true;
+}
+
+bool VulkanComputeScene::CreatePipeline(ScenePipelineType type, VkPipelineCache pipelineCache, const std::string& compShaderPath) {
+    size_t index = PipelineIndex(type);
+    if (!m_initialized || m_pipelines[index] != VK_NULL_HANDLE) {
+        return m_pipelines[index] != VK_NULL_HANDLE;
+    }
+    
+    std::vector<char> compShaderCode = renderer::shader::ShaderLoader::LoadShaderCode(compShaderPath, ShaderStage::Compute);
+    if (compShaderCode.empty()) {
+        printf("[COMPUTE_SCENE] Failed to load compute shader: %s\n", compShaderPath.c_str());
+        return false;
+    }
+    
+    VkShaderModule compShaderModule = CreateModule(m_device, compShaderCode);
+    if (compShaderModule == VK_NULL_HANDLE) {
+        printf("[COMPUTE_SCENE] Failed to create compute shader module\n");
+        return false;
+    }
+    
+    // 工作组尺寸以特化常量传入（constant_id 0 / 1 对应 local_size_x_id / local_size_y_id）
+    uint32_t groupSize[2];
+    if (type == ScenePipelineType::LoadingCubes) {
+        groupSize[0] = config::COMPUTE_SCENE_CUBES_GROUP_WIDTH;
+        groupSize[1] = config::COMPUTE_SCENE_CUBES_GROUP_HEIGHT;
+    } else {
+        groupSize[0] = config::COMPUTE_SCENE_SHADER_GROUP_WIDTH;
+        groupSize[1] = config::COMPUTE_SCENE_SHADER_GROUP_HEIGHT;
+    }
+    
+    VkSpecializationMapEntry specEntries[2] = {};
+    specEntries[0].constantID = 0;
+    specEntries[0].offset = 0;
+    specEntries[0].size = sizeof(uint32_t);
+    specEntries[1].constantID = 1;
+    specEntries[1].offset = sizeof(uint32_t);
+    specEntries[1].size = sizeof(uint32_t);
+    
+    VkSpecializationInfo specInfo = {};
+    specInfo.mapEntryCount = 2;
+    specInfo.pMapEntries = specEntries;
+    specInfo.dataSize = sizeof(groupSize);
+    specInfo.pData = groupSize;
+    
+    VkComputePipelineCreateInfo pipelineInfo = {};
+    pipelineInfo.sType = VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_CREATE_INFO;
+    pipelineInfo.stage.sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+    pipelineInfo.stage.stage = VK_SHADER_STAGE_COMPUTE_BIT;
+    pipelineInfo.stage.module = compShaderModule;
+    pipelineInfo.stage.pName = "main";
+    pipelineInfo.stage.pSpecializationInfo = &specInfo;
+    pipelineInfo.layout = m_computeLayout;
+    
+    VkResult result = vkCreateComputePipelines(m_device, pipelineCache, 1, &pipelineInfo, nullptr, &m_pipelines[index]);
+    vkDestroyShaderModule(m_device, compShaderModule, nullptr);
+    
+    if (result != VK_SUCCESS) {
+        m_pipelines[index] = VK_NULL_HANDLE;
+        printf("[COMPUTE_SCENE] Failed to create compute pipeline: %d\n", result);
+        return false;
+    }
+    
+    return true;
+}
+
+bool VulkanComputeScene::EnsureTarget(VkExtent2D extent) {
+    if (!m_initialized || m_targetFailed) {
+        return false;
+    }
+    
+    if (m_target.view != VK_NULL_HANDLE) {
+        return true;
+    }
+    
+    // 存储图像只在首次使用计算路径时创建
+    m_target.extent = extent;
+    
+    VkImageCreateInfo imageInfo = {};
+    imageInfo.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
+    imageInfo.imageType = VK_IMAGE_TYPE_2D;
+    imageInfo.format = STORAGE_FORMAT;
+    imageInfo.extent.width = extent.width;
+    imageInfo.extent.height = extent.height;
+    imageInfo.extent.depth = 1;
+    imageInfo.mipLevels = 1;
+    imageInfo.arrayLayers = 1;
+    imageInfo.samples = VK_SAMPLE_COUNT_1_BIT;
+    imageInfo.tiling = VK_IMAGE_TILING_OPTIMAL;
+    imageInfo.usage = VK_IMAGE_USAGE_STORAGE_BIT | VK_IMAGE_USAGE_SAMPLED_BIT;
+    imageInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+    imageInfo.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+    
+    bool created = vkCreateImage(m_device, &imageInfo, nullptr, &m_target.image) == VK_SUCCESS;
+    if (!created) {
+        m_target.image = VK_NULL_HANDLE;
+    }
+    
+    if (created) {
+        created = VulkanMemoryAllocator::AllocateImage(m_allocator, m_device, m_physicalDevice, m_target.image,
+                                                       MemoryPropertyFlag::DeviceLocal, m_target.allocation);
+    }
+    
+    if (created) {
+        VkImageViewCreateInfo viewInfo = {};
+        viewInfo.sType = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO;
+        viewInfo.image = m_target.image;
+        viewInfo.viewType = VK_IMAGE_VIEW_TYPE_2D;
+        viewInfo.format = STORAGE_FORMAT;
+        viewInfo.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+        viewInfo.subresourceRange.baseMipLevel = 0;
+        viewInfo.subresourceRange.levelCount = 1;
+        viewInfo.subresourceRange.baseArrayLayer = 0;
+        viewInfo.subresourceRange.layerCount = 1;
+        
+        created = vkCreateImageView(m_device, &viewInfo, nullptr, &m_target.view) == VK_SUCCESS;
+        if (!created) {
+            m_target.view = VK_NULL_HANDLE;
+        }
+    }
+    
+    if (created) {
+        VkDescriptorSetLayout setLayouts[] = { m_storageSetLayout, m_sampledSetLayout };
+        VkDescriptorSet sets[2] = { VK_NULL_HANDLE, VK_NULL_HANDLE };
+        
+        VkDescriptorSetAllocateInfo allocInfo = {};
+        allocInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
+        allocInfo.descriptorPool = m_descriptorPool;
+        allocInfo.descriptorSetCount = 2;
+        allocInfo.pSetLayouts = setLayouts;
+        
+        created = vkAllocateDescriptorSets(m_device, &allocInfo, sets) == VK_SUCCESS;
+        if (created) {
+            m_target.storageSet = sets[0];
+            m_target.sampledSet = sets[1];
+        }
+    }
+    
+    if (!created) {
+        printf("[COMPUTE_SCENE] Failed to create %ux%u storage image\n", extent.width, extent.height);
+        DestroyTarget(m_target);
+        m_targetFailed = true;
+        return false;
+    }
+    
+    // 图像始终处于 GENERAL 布局：计算着色器写入和合成通道采样之间只需要内存屏障
+    VkDescriptorImageInfo storageInfo = {};
+    storageInfo.imageView = m_target.view;
+    storageInfo.imageLayout = VK_IMAGE_LAYOUT_GENERAL;
+    
+    VkDescriptorImageInfo sampledInfo = {};
+    sampledInfo.sampler = m_sampler;
+    sampledInfo.imageView = m_target.view;
+    sampledInfo.imageLayout = VK_IMAGE_LAYOUT_GENERAL;
+    
+    VkWriteDescriptorSet writes[2] = {};
+    writes[0].sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+    writes[0].dstSet = m_target.storageSet;
+    writes[0].dstBinding = 0;
+    writes[0].descriptorCount = 1;
+    writes[0].descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_IMAGE;
+    writes[0].pImageInfo = &storageInfo;
+    writes[1].sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+    writes[1].dstSet = m_target.sampledSet;
+    writes[1].dstBinding = 0;
+    writes[1].descriptorCount = 1;
+    writes[1].descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+    writes[1].pImageInfo = &sampledInfo;
+    vkUpdateDescriptorSets(m_device, 2, writes, 0, nullptr);
+    
+    return true;
+}
+
+void VulkanComputeScene::RetireTarget(uint64_t lastSubmitSerial) {
+    m_targetFailed = false;
+    if (!m_initialized || m_target.view == VK_NULL_HANDLE) {
+        return;
+    }
+    
+    m_retiredTargets.Retire(m_target, lastSubmitSerial);
+    m_target = Target();
+}
+
+void VulkanComputeScene::ReleaseRetiredTargets(uint64_t completedSerial) {
+    m_retiredTargets.Release(completedSerial, [this](Target& target) { DestroyTarget(target); });
+}
+
+void VulkanComputeScene::DestroyTarget(Target& target) {
+    VkDescriptorSet* sets[] = { &target.storageSet, &target.sampledSet };
+    for (VkDescriptorSet* set : sets) {
+        if (*set != VK_NULL_HANDLE) {
+            vkFreeDescriptorSets(m_device, m_descriptorPool, 1, set);
+            *set = VK_NULL_HANDLE;
+        }
+    }
+    
+    if (target.view != VK_NULL_HANDLE) {
+        vkDestroyImageView(m_device, target.view, nullptr);
+        target.view = VK_NULL_HANDLE;
+    }
+    
+    if (target.image != VK_NULL_HANDLE) {
+        vkDestroyImage(m_device, target.image, nullptr);
+        target.image = VK_NULL_HANDLE;
+        VulkanMemoryAllocator::Release(m_allocator, m_device, target.allocation);
+    }
+}
+
+VkRect2D VulkanComputeScene::ClampToTarget(const VkRect2D& rect) const {
+    // 视口可能超出交换链（窗口小于逻辑尺寸时偏移为负），只处理图像内的部分
+    int32_t left = std::max(0, rect.offset.x);
+    int32_t top = std::max(0, rect.offset.y);
+    int32_t right = std::min((int32_t)m_target.extent.width, rect.offset.x + (int32_t)rect.extent.width);
+    int32_t bottom = std::min((int32_t)m_target.extent.height, rect.offset.y + (int32_t)rect.extent.height);
+    
+    VkRect2D clamped = {};
+    clamped.offset.x = left;
+    clamped.offset.y = top;
+    clamped.extent.width = (uint32_t)std::max(0, right - left);
+    clamped.extent.height = (uint32_t)std::max(0, bottom - top);
+    return clamped;
+}
+
+void VulkanComputeScene::RecordDispatch(VkCommandBuffer commandBuffer, ScenePipelineType type, VkDescriptorSet sceneDescriptorSet,
+                                        const VkViewport& viewport, const VkRect2D& scissor) {
+    VkPipeline pipeline = m_pipelines[PipelineIndex(type)];
+    if (pipeline == VK_NULL_HANDLE || m_target.view == VK_NULL_HANDLE) {
+        return;
+    }
+    
+    // 存储图像所有帧共用：等待之前提交的合成通道读取完成，旧内容直接丢弃
+    VkImageMemoryBarrier barrier = {};
+    barrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+    barrier.srcAccessMask = 0;
+    barrier.dstAccessMask = VK_ACCESS_SHADER_WRITE_BIT;
+    barrier.oldLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+    barrier.newLayout = VK_IMAGE_LAYOUT_GENERAL;
+    barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    barrier.image = m_target.image;
+    barrier.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+    barrier.subresourceRange.baseMipLevel = 0;
+    barrier.subresourceRange.levelCount = 1;
+    barrier.subresourceRange.baseArrayLayer = 0;
+    barrier.subresourceRange.layerCount = 1;
+    vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+                         0, 0, nullptr, 0, nullptr, 1, &barrier);
+    
+    VkRect2D region = ClampToTarget(scissor);
+    if (region.extent.width > 0 && region.extent.height > 0) {
+        ComputeScenePushConstants constants = {};
+        constants.viewportOrigin[0] = viewport.x;
+        constants.viewportOrigin[1] = viewport.y;
+        constants.viewportSize[0] = viewport.width;
+        constants.viewportSize[1] = viewport.height;
+        constants.regionOrigin[0] = region.offset.x;
+        constants.regionOrigin[1] = region.offset.y;
+        constants.regionExtent[0] = (int32_t)region.extent.width;
+        constants.regionExtent[1] = (int32_t)region.extent.height;
+        
+        uint32_t groupWidth = type == ScenePipelineType::LoadingCubes ? config::COMPUTE_SCENE_CUBES_GROUP_WIDTH
+                                                                      : config::COMPUTE_SCENE_SHADER_GROUP_WIDTH;
+        uint32_t groupHeight = type == ScenePipelineType::LoadingCubes ? config::COMPUTE_SCENE_CUBES_GROUP_HEIGHT
+                                                                       : config::COMPUTE_SCENE_SHADER_GROUP_HEIGHT;
+        
+        VkDescriptorSet sets[] = { sceneDescriptorSet, m_target.storageSet };
+        vkCmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, pipeline);
+        vkCmdBindDescriptorSets(commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, m_computeLayout, 0, 2, sets, 0, nullptr);
+        vkCmdPushConstants(commandBuffer, m_computeLayout, VK_SHADER_STAGE_COMPUTE_BIT, 0, sizeof(ComputeScenePushConstants), &constants);
+        vkCmdDispatch(commandBuffer, (region.extent.width + groupWidth - 1) / groupWidth,
+                      (region.extent.height + groupHeight - 1) / groupHeight, 1);
+    }
+    
+    // 计算着色器的写入对合成通道的片段着色器采样可见
+    barrier.srcAccessMask = VK_ACCESS_SHADER_WRITE_BIT;
+    barrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
+    barrier.oldLayout = VK_IMAGE_LAYOUT_GENERAL;
+    barrier.newLayout = VK_IMAGE_LAYOUT_GENERAL;
+    vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT,
+                         0, 0, nullptr, 0, nullptr, 1, &barrier);
+}
+
+void VulkanComputeScene::RecordComposite(VkCommandBuffer commandBuffer, const VkRect2D& scissor) {
+    if (m_compositePipeline == VK_NULL_HANDLE || m_target.view == VK_NULL_HANDLE) {
+        return;
+    }
+    
+    VkRect2D region = ClampToTarget(scissor);
+    if (region.extent.width == 0 || region.extent.height == 0) {
+        return;
+    }
+    
+    // 全屏三角形覆盖整个图像，裁剪到调度区域；UV 与像素一一对应，最近邻采样像素中心
+    float width = (float)m_target.extent.width;
+    float height = (float)m_target.extent.height;
+    
+    CompositePushConstants constants = {};
+    constants.uvScale[0] = 1.0f;
+    constants.uvScale[1] = 1.0f;
+    constants.uvMax[0] = 1.0f;
+    constants.uvMax[1] = 1.0f;
+    constants.texelSize[0] = 1.0f / width;
+    constants.texelSize[1] = 1.0f / height;
+    constants.sharpness = 0.0f;
+    
+    VkViewport viewport = {};
+    viewport.x = 0.0f;
+    viewport.y = 0.0f;
+    viewport.width = width;
+    viewport.height = height;
+    viewport.minDepth = 0.0f;
+    viewport.maxDepth = 1.0f;
+    
+    vkCmdSetViewport(commandBuffer, 0, 1, &viewport);
+    vkCmdSetScissor(commandBuffer, 0, 1, &region);
+    
+    vkCmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, m_compositePipeline);
+    vkCmdBindDescriptorSets(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, m_compositeLayout, 0, 1, &m_target.sampledSet, 0, nullptr);
+    vkCmdPushConstants(commandBuffer, m_compositeLayout, VK_SHADER_STAGE_FRAGMENT_BIT, 0, sizeof(CompositePushConstants), &constants);
+    vkCmdDraw(commandBuffer, 3, 1, 0, 0);
+}
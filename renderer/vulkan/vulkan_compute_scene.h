@@ -0,0 +1,162 @@
+#pragma once
+
+#ifdef _WIN32
+#define VK_USE_PLATFORM_WIN32_KHR
+#endif
+#include <vulkan/vulkan.h>  // 3. 第三方库头文件
+
+#include <string>  // 2. 系统头文件
+#include <vector>  // 2. 系统头文件
+
+#include "core/interfaces/imemory_allocator.h"  // 4. 项目头文件（接口）
+#include "core/interfaces/ipipeline_manager.h"  // 4. 项目头文件（接口）
+#include "renderer/vulkan/vulkan_retire_queue.h"  // 4. 项目头文件（Vulkan）
+
+/**
+ * Vulkan 计算着色器场景 - 全屏场景（shader.frag、loading_cubes.frag）的计算着色器执行路径
+ * 
+ * 计算变体按工作组写入一个与交换链同尺寸的存储图像，工作组尺寸可按着色器调整（以特化常量传入），
+ * 并可使用组共享内存（loading_cubes.comp 在组内协作剔除立方体）；也没有全屏四边形两个三角形接缝处
+ * 2x2 像素块的重复着色。交换链图像只支持颜色附件用途，因此结果不能直接写入或复制到交换链，
+ * 而是在主渲染通道中以一个全屏三角形逐像素合成（复用动态分辨率的放大着色器，比例为 1 且不锐化）。
+ * 
+ * 调度区域与图形路径的视口和裁剪矩形一致，拉伸模式的黑边仍由主渲染通道的清除颜色填充。
+ * 计算管线使用场景描述符集（set 0）加上存储图像描述符集（set 1），两个场景共用一个管线布局。
+ * 
+ * 存储图像所有交换链图像共用，首次使用时创建；交换链重建时旧图像随旧交换链一起退役，
+ * 等引用它们的提交完成后再销毁。
+ * 
+ * 使用方式：
+ * 1. 渲染通道和场景描述符集布局创建后调用 Initialize()（创建描述符集布局和合成管线）
+ * 2. 在场景管线预编译线程上调用 CreatePipeline()，在发布对应场景管线就绪之前完成
+ * 3. 每帧录制前调用 EnsureTarget()，成功后在主渲染通道之前调用 RecordDispatch()，
+ *    在主渲染通道内调用 RecordComposite()
+ * 4. 交换链重建时调用 RetireTarget()，栅栏触发后调用 ReleaseRetiredTargets()
+ * 5. 设备空闲后调用 Cleanup()
+ */
+class VulkanComputeScene {
+public:
+    VulkanComputeScene();
+    ~VulkanComputeScene();
+    
+    /**
+     * 初始化计算场景
+     * 
+     * @param device Vulkan设备句柄
+     * @param physicalDevice 物理设备句柄（用于分配存储图像内存）
+     * @param allocator 共享内存分配器（可为 nullptr）
+     * @param sceneSetLayout 场景描述符集布局（两个场景共用，必须包含计算着色器阶段）
+     * @param outputRenderPass 合成通道所在的主渲染通道
+     * @param pipelineCache 管线缓存（可为 VK_NULL_HANDLE）
+     * @param compositeVertPath 合成顶点着色器路径（.spv 或 GLSL 源文件）
+     * @param compositeFragPath 合成片段着色器路径（.spv 或 GLSL 源文件）
+     * @return 成功返回 true，失败返回 false（调用方应只使用图形管线）
+     */
+    bool Initialize(VkDevice device, VkPhysicalDevice physicalDevice, IMemoryAllocator* allocator,
+                    VkDescriptorSetLayout sceneSetLayout, VkRenderPass outputRenderPass, VkPipelineCache pipelineCache,
+                    const std::string& compositeVertPath, const std::string& compositeFragPath);
+    
+    /**
+     * 销毁所有资源（调用前 GPU 必须已完成所有使用它们的提交）
+     */
+    void Cleanup();
+    
+    /**
+     * 创建场景的计算管线（两个场景可在同一线程上依次创建）
+     * 
+     * @param type 场景类型
+     * @param pipelineCache 管线缓存（可为 VK_NULL_HANDLE）
+     * @param compShaderPath 计算着色器路径（.spv 或 GLSL 源文件）
+     * @return 成功返回 true，失败返回 false
+     */
+    bool CreatePipeline(ScenePipelineType type, VkPipelineCache pipelineCache, const std::string& compShaderPath);
+    
+    /**
+     * 场景的计算管线是否已创建（只能在对应场景管线就绪发布之后调用）
+     */
+    bool HasPipeline(ScenePipelineType type) const { return m_pipelines[PipelineIndex(type)] != VK_NULL_HANDLE; }
+    
+    /**
+     * 确保存在与交换链同尺寸的存储图像（已存在时直接返回）
+     * 
+     * @param extent 交换链尺寸
+     * @return 成功返回 true，失败返回 false（本帧应使用图形管线）
+     */
+    bool EnsureTarget(VkExtent2D extent);
+    
+    /**
+     * 退役当前存储图像（交换链重建时调用，下次 EnsureTarget 重新创建）
+     * 
+     * @param lastSubmitSerial 最后一次可能引用该图像的提交序号
+     */
+    void RetireTarget(uint64_t lastSubmitSerial);
+    
+    /**
+     * 销毁已完成提交不再引用的退役存储图像
+     * 
+     * @param completedSerial 已完成的最大提交序号
+     */
+    void ReleaseRetiredTargets(uint64_t completedSerial);
+    
+    /**
+     * 录制计算调度（必须在渲染通道之外调用，结束后图像对片段着色器采样可见）
+     * 
+     * @param commandBuffer 主命令缓冲区
+     * @param type 场景类型
+     * @param sceneDescriptorSet 该交换链图像的场景描述符集
+     * @param viewport 图形路径使用的视口
+     * @param scissor 图形路径使用的裁剪矩形（决定调度区域）
+     */
+    void RecordDispatch(VkCommandBuffer commandBuffer, ScenePipelineType type, VkDescriptorSet sceneDescriptorSet,
+                        const VkViewport& viewport, const VkRect2D& scissor);
+    
+    /**
+     * 把调度区域合成到输出图像（在主渲染通道内调用，会改变视口和裁剪矩形）
+     * 
+     * @param commandBuffer 主命令缓冲区
+     * @param scissor 与 RecordDispatch() 相同的裁剪矩形
+     */
+    void RecordComposite(VkCommandBuffer commandBuffer, const VkRect2D& scissor);
+
+private:
+    // 禁止拷贝和赋值
+    VulkanComputeScene(const VulkanComputeScene&) = delete;
+    VulkanComputeScene& operator=(const VulkanComputeScene&) = delete;
+    
+    // 一个与交换链尺寸匹配的存储图像
+    struct Target {
+        VkExtent2D extent = {0, 0};
+        VkImage image = VK_NULL_HANDLE;
+        MemoryAllocation allocation;
+        VkImageView view = VK_NULL_HANDLE;
+        VkDescriptorSet storageSet = VK_NULL_HANDLE;    // 计算着色器写入
+        VkDescriptorSet sampledSet = VK_NULL_HANDLE;    // 合成通道采样
+    };
+    
+    static size_t PipelineIndex(ScenePipelineType type) { return type == ScenePipelineType::LoadingCubes ? 1 : 0; }
+    
+    bool CreateDescriptorResources(VkDescriptorSetLayout sceneSetLayout);
+    bool CreateCompositePipeline(VkRenderPass outputRenderPass, VkPipelineCache pipelineCache,
+                                 const std::string& vertShaderPath, const std::string& fragShaderPath);
+    VkRect2D ClampToTarget(const VkRect2D& rect) const;
+    void DestroyTarget(Target& target);
+    
+    VkDevice m_device = VK_NULL_HANDLE;
+    VkPhysicalDevice m_physicalDevice = VK_NULL_HANDLE;
+    IMemoryAllocator* m_allocator = nullptr;  // [BORROW] 由渲染器拥有
+    
+    VkDescriptorSetLayout m_storageSetLayout = VK_NULL_HANDLE;
+    VkDescriptorSetLayout m_sampledSetLayout = VK_NULL_HANDLE;
+    VkDescriptorPool m_descriptorPool = VK_NULL_HANDLE;
+    VkSampler m_sampler = VK_NULL_HANDLE;
+    VkPipelineLayout m_computeLayout = VK_NULL_HANDLE;
+    VkPipelineLayout m_compositeLayout = VK_NULL_HANDLE;
+    VkPipeline m_compositePipeline = VK_NULL_HANDLE;
+    VkPipeline m_pipelines[2] = { VK_NULL_HANDLE, VK_NULL_HANDLE };  // 按 PipelineIndex 索引
+    
+    Target m_target;                  // 当前交换链的存储图像（view 为空表示尚未创建）
+    bool m_targetFailed = false;      // 当前交换链尺寸下创建失败（不再每帧重试，交换链重建后重置）
+    RetireQueue<Target> m_retiredTargets;
+    
+    bool m_initialized = false;
+};
@@ -0,0 +1,447 @@
+#include "renderer/vulkan/vulkan_cube_rasterizer.h"  // 1. 对应头文件
+
+#include <stdio.h>  // 2. 系统头文件
+
+#include "renderer/vulkan/vulkan_memory_allocator.h"  // 4. 项目头文件（Vulkan）
+#include "shader/shader_loader.h"  // 4. 项目头文件（着色器）
+
+namespace {
+
+// 多重采样数（规范保证颜色和深度附件都支持 4 倍采样）
+const VkSampleCountFlagBits SAMPLE_COUNT = VK_SAMPLE_COUNT_4_BIT;
+
+// 每个立方体实例的顶点数（6 个面，每面两个三角形，顶点在着色器中由 gl_VertexIndex 生成）
+const uint32_t VERTICES_PER_CUBE = 36;
+
+// 按优先级选择支持作为深度附件的格式
+VkFormat FindDepthFormat(VkPhysicalDevice physicalDevice) {
+    const VkFormat candidates[] = { VK_FORMAT_D32_SFLOAT, VK_FORMAT_D32_SFLOAT_S8_UINT, VK_FORMAT_D24_UNORM_S8_UINT };
+    for (VkFormat format : candidates) {
+        VkFormatProperties properties;
+        vkGetPhysicalDeviceFormatProperties(physicalDevice, format, &properties);
+        if (properties.optimalTilingFeatures & VK_FORMAT_FEATURE_DEPTH_STENCIL_ATTACHMENT_BIT) {
+            return format;
+        }
+    }
+    return VK_FORMAT_UNDEFINED;
+}
+
+} // namespace
+
+VulkanCubeRasterizer::VulkanCubeRasterizer() {
+}
+
+VulkanCubeRasterizer::~VulkanCubeRasterizer() {
+    Cleanup();
+}
+
+bool VulkanCubeRasterizer::Initialize(VkDevice device, VkPhysicalDevice physicalDevice, IMemoryAllocator* allocator, VkFormat colorFormat) {
+    if (m_initialized) {
+        return true;
+    }
+    
+    if (device == VK_NULL_HANDLE || physicalDevice == VK_NULL_HANDLE) {
+        return false;
+    }
+    
+    m_depthFormat = FindDepthFormat(physicalDevice);
+    if (m_depthFormat == VK_FORMAT_UNDEFINED) {
+        printf("[CUBE_RASTER] No supported depth format\n");
+        return false;
+    }
+    
+    m_device = device;
+    m_physicalDevice = physicalDevice;
+    m_allocator = allocator;
+    m_colorFormat = colorFormat;
+    
+    if (!CreateRenderPass(colorFormat)) {
+        printf("[CUBE_RASTER] Failed to create render pass\n");
+        return false;
+    }
+    
+    m_initialized = true;
+    return true;
+}
+
+void VulkanCubeRasterizer::Cleanup() {
+    if (!m_initialized) {
+        return;
+    }
+    
+    DestroyTargets(m_targets);
+    m_retiredTargets.ReleaseAll([this](Targets& targets) { DestroyTargets(targets); });
+    
+    if (m_pipeline != VK_NULL_HANDLE) {
+        vkDestroyPipeline(m_device, m_pipeline, nullptr);
+        m_pipeline = VK_NULL_HANDLE;
+    }
+    
+    if (m_renderPass != VK_NULL_HANDLE) {
+        vkDestroyRenderPass(m_device, m_renderPass, nullptr);
+        m_renderPass = VK_NULL_HANDLE;
+    }
+    
+    m_allocator = nullptr;
+    m_device = VK_NULL_HANDLE;
+    m_initialized = false;
+}
+
+bool VulkanCubeRasterizer::CreateRenderPass(VkFormat colorFormat) {
+    // 0：多重采样颜色；1：多重采样深度；2：解析目标（交换链图像）
+    // 多重采样附件只在通道内使用，不需要写回内存
+    VkAttachmentDescription attachments[3] = {};
+    attachments[0].format = colorFormat;
+    attachments[0].samples = SAMPLE_COUNT;
+    attachments[0].loadOp = VK_ATTACHMENT_LOAD_OP_CLEAR;
+    attachments[0].storeOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
+    attachments[0].stencilLoadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
+    attachments[0].stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
+    attachments[0].initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+    attachments[0].finalLayout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
+    
+    attachments[1].format = m_depthFormat;
+    attachments[1].samples = SAMPLE_COUNT;
+    attachments[1].loadOp = VK_ATTACHMENT_LOAD_OP_CLEAR;
+    attachments[1].storeOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
+    attachments[1].stencilLoadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
+    attachments[1].stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
+    attachments[1].initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+    attachments[1].finalLayout = VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL;
+    
+    // 解析结果保持在颜色附件布局，由随后的 LOAD 主渲染通道继续绘制
+    attachments[2].format = colorFormat;
+    attachments[2].samples = VK_SAMPLE_COUNT_1_BIT;
+    attachments[2].loadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
+    attachments[2].storeOp = VK_ATTACHMENT_STORE_OP_STORE;
+    attachments[2].stencilLoadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
+    attachments[2].stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
+    attachments[2].initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+    attachments[2].finalLayout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
+    
+    VkAttachmentReference colorRef = { 0, VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL };
+    VkAttachmentReference depthRef = { 1, VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL };
+    VkAttachmentReference resolveRef = { 2, VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL };
+    
+    VkSubpassDescription subpass = {};
+    subpass.pipelineBindPoint = VK_PIPELINE_BIND_POINT_GRAPHICS;
+    subpass.colorAttachmentCount = 1;
+    subpass.pColorAttachments = &colorRef;
+    subpass.pResolveAttachments = &resolveRef;
+    subpass.pDepthStencilAttachment = &depthRef;
+    
+    // 多重采样图像所有帧共用：等待之前提交对颜色和深度附件的写入完成后再清除
+    VkSubpassDependency dependency = {};
+    dependency.srcSubpass = VK_SUBPASS_EXTERNAL;
+    dependency.dstSubpass = 0;
+    dependency.srcStageMask = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT | VK_PIPELINE_STAGE_LATE_FRAGMENT_TESTS_BIT;
+    dependency.srcAccessMask = VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT | VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT;
+    dependency.dstStageMask = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT | VK_PIPELINE_STAGE_EARLY_FRAGMENT_TESTS_BIT;
+    dependency.dstAccessMask = VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT | VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT;
+    
+    VkRenderPassCreateInfo renderPassInfo = {};
+    renderPassInfo.sType = VK_STRUCTURE_TYPE_RENDER_PASS_CREATE_INFO;
+    renderPassInfo.attachmentCount = 3;
+    renderPassInfo.pAttachments = attachments;
+    renderPassInfo.subpassCount = 1;
+    renderPassInfo.pSubpasses = &subpass;
+    renderPassInfo.dependencyCount = 1;
+    renderPassInfo.pDependencies = &dependency;
+    
+    return vkCreateRenderPass(m_device, &renderPassInfo, nullptr, &m_renderPass) == VK_SUCCESS;
+}
+
+bool VulkanCubeRasterizer::CreatePipeline(VkPipelineLayout pipelineLayout, VkPipelineCache pipelineCache,
+                                          const std::string& vertShaderPath, const std::string& fragShaderPath) {
+    if (!m_initialized || m_pipeline != VK_NULL_HANDLE) {
+        return m_pipeline != VK_NULL_HANDLE;
+    }
+    
+    std::vector<char> vertShaderCode = renderer::shader::ShaderLoader::LoadShaderCode(vertShaderPath, ShaderStage::Vertex);
+    std::vector<char> fragShaderCode = renderer::shader::ShaderLoader::LoadShaderCode(fragShaderPath, ShaderStage::Fragment);
+    if (vertShaderCode.empty() || fragShaderCode.empty()) {
+        printf("[CUBE_RASTER] Failed to load shaders: %s, %s\n", vertShaderPath.c_str(), fragShaderPath.c_str());
+        return false;
+    }
+    
+    VkShaderModule vertShaderModule = static_cast<VkShaderModule>(
+        renderer::shader::ShaderLoader::CreateShaderModuleFromSPIRV(static_cast<DeviceHandle>(m_device), vertShaderCode));
+    VkShaderModule fragShaderModule = static_cast<VkShaderModule>(
+        renderer::shader::ShaderLoader::CreateShaderModuleFromSPIRV(static_cast<DeviceHandle>(m_device), fragShaderCode));
+    if (vertShaderModule == VK_NULL_HANDLE || fragShaderModule == VK_NULL_HANDLE) {
+        if (vertShaderModule != VK_NULL_HANDLE) {
+            vkDestroyShaderModule(m_device, vertShaderModule, nullptr);
+        }
+        if (fragShaderModule != VK_NULL_HANDLE) {
+            vkDestroyShaderModule(m_device, fragShaderModule, nullptr);
+        }
+        printf("[CUBE_RASTER] Failed to create shader modules\n");
+        return false;
+    }
+    
+    VkPipelineShaderStageCreateInfo shaderStages[2] = {};
+    shaderStages[0].sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+    shaderStages[0].stage = VK_SHADER_STAGE_VERTEX_BIT;
+    shaderStages[0].module = vertShaderModule;
+    shaderStages[0].pName = "main";
+    shaderStages[1].sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+    shaderStages[1].stage = VK_SHADER_STAGE_FRAGMENT_BIT;
+    shaderStages[1].module = fragShaderModule;
+    shaderStages[1].pName = "main";
+    
+    // 顶点和实例数据都从存储缓冲区和 gl_VertexIndex / gl_InstanceIndex 得到
+    VkPipelineVertexInputStateCreateInfo vertexInputInfo = {};
+    vertexInputInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO;
+    
+    VkPipelineInputAssemblyStateCreateInfo inputAssembly = {};
+    inputAssembly.sType = VK_STRUCTURE_TYPE_PIPELINE_INPUT_ASSEMBLY_STATE_CREATE_INFO;
+    inputAssembly.topology = VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
+    inputAssembly.primitiveRestartEnable = VK_FALSE;
+    
+    VkPipelineViewportStateCreateInfo viewportState = {};
+    viewportState.sType = VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_STATE_CREATE_INFO;
+    viewportState.viewportCount = 1;
+    viewportState.scissorCount = 1;
+    
+    // 不剔除背面：立方体数量很少，被遮挡的面由深度测试丢弃
+    VkPipelineRasterizationStateCreateInfo rasterizer = {};
+    rasterizer.sType = VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_STATE_CREATE_INFO;
+    rasterizer.depthClampEnable = VK_FALSE;
+    rasterizer.rasterizerDiscardEnable = VK_FALSE;
+    rasterizer.polygonMode = VK_POLYGON_MODE_FILL;
+    rasterizer.lineWidth = 1.0f;
+    rasterizer.cullMode = VK_CULL_MODE_NONE;
+    rasterizer.frontFace = VK_FRONT_FACE_CLOCKWISE;
+    rasterizer.depthBiasEnable = VK_FALSE;
+    
+    VkPipelineMultisampleStateCreateInfo multisampling = {};
+    multisampling.sType = VK_STRUCTURE_TYPE_PIPELINE_MULTISAMPLE_STATE_CREATE_INFO;
+    multisampling.sampleShadingEnable = VK_FALSE;
+    multisampling.rasterizationSamples = SAMPLE_COUNT;
+    
+    VkPipelineDepthStencilStateCreateInfo depthStencil = {};
+    depthStencil.sType = VK_STRUCTURE_TYPE_PIPELINE_DEPTH_STENCIL_STATE_CREATE_INFO;
+    depthStencil.depthTestEnable = VK_TRUE;
+    depthStencil.depthWriteEnable = VK_TRUE;
+    depthStencil.depthCompareOp = VK_COMPARE_OP_LESS;
+    depthStencil.depthBoundsTestEnable = VK_FALSE;
+    depthStencil.stencilTestEnable = VK_FALSE;
+    
+    VkPipelineColorBlendAttachmentState colorBlendAttachment = {};
+    colorBlendAttachment.colorWriteMask = VK_COLOR_COMPONENT_R_BIT | VK_COLOR_COMPONENT_G_BIT | VK_COLOR_COMPONENT_B_BIT | VK_COLOR_COMPONENT_A_BIT;
+    colorBlendAttachment.blendEnable = VK_FALSE;
+    
+    VkPipelineColorBlendStateCreateInfo colorBlending = {};
+    colorBlending.sType = VK_STRUCTURE_TYPE_PIPELINE_COLOR_BLEND_STATE_CREATE_INFO;
+    colorBlending.logicOpEnable = VK_FALSE;
+    colorBlending.attachmentCount = 1;
+    colorBlending.pAttachments = &colorBlendAttachment;
+    
+    VkDynamicState dynamicStates[] = { VK_DYNAMIC_STATE_VIEWPORT, VK_DYNAMIC_STATE_SCISSOR };
+    VkPipelineDynamicStateCreateInfo dynamicState = {};
+    dynamicState.sType = VK_STRUCTURE_TYPE_PIPELINE_DYNAMIC_STATE_CREATE_INFO;
+    dynamicState.dynamicStateCount = 2;
+    dynamicState.pDynamicStates = dynamicStates;
+    
+    VkGraphicsPipelineCreateInfo pipelineInfo = {};
+    pipelineInfo.sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO;
+    pipelineInfo.stageCount = 2;
+    pipelineInfo.pStages = shaderStages;
+    pipelineInfo.pVertexInputState = &vertexInputInfo;
+    pipelineInfo.pInputAssemblyState = &inputAssembly;
+    pipelineInfo.pViewportState = &viewportState;
+    pipelineInfo.pRasterizationState = &rasterizer;
+    pipelineInfo.pMultisampleState = &multisampling;
+    pipelineInfo.pDepthStencilState = &depthStencil;
+    pipelineInfo.pColorBlendState = &colorBlending;
+    pipelineInfo.pDynamicState = &dynamicState;
+    pipelineInfo.layout = pipelineLayout;
+    pipelineInfo.renderPass = m_renderPass;
+    pipelineInfo.subpass = 0;
+    
+    VkResult result = vkCreateGraphicsPipelines(m_device, pipelineCache, 1, &pipelineInfo, nullptr, &m_pipeline);
+    
+    vkDestroyShaderModule(m_device, fragShaderModule, nullptr);
+    vkDestroyShaderModule(m_device, vertShaderModule, nullptr);
+    
+    if (result != VK_SUCCESS) {
+        m_pipeline = VK_NULL_HANDLE;
+        printf("[CUBE_RASTER] Failed to create graphics pipeline: %d\n", result);
+        return false;
+    }
+    
+    return true;
+}
+
+bool VulkanCubeRasterizer::CreateAttachment(VkExtent2D extent, VkFormat format, VkImageUsageFlags usage, VkImageAspectFlags aspect,
+                                            VkImage& image, MemoryAllocation& allocation, VkImageView& view) {
+    VkImageCreateInfo imageInfo = {};
+    imageInfo.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
+    imageInfo.imageType = VK_IMAGE_TYPE_2D;
+    imageInfo.format = format;
+    imageInfo.extent.width = extent.width;
+    imageInfo.extent.height = extent.height;
+    imageInfo.extent.depth = 1;
+    imageInfo.mipLevels = 1;
+    imageInfo.arrayLayers = 1;
+    imageInfo.samples = SAMPLE_COUNT;
+    imageInfo.tiling = VK_IMAGE_TILING_OPTIMAL;
+    imageInfo.usage = usage | VK_IMAGE_USAGE_TRANSIENT_ATTACHMENT_BIT;
+    imageInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+    imageInfo.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+    
+    if (vkCreateImage(m_device, &imageInfo, nullptr, &image) != VK_SUCCESS) {
+        image = VK_NULL_HANDLE;
+        return false;
+    }
+    
+    if (!VulkanMemoryAllocator::AllocateImage(m_allocator, m_device, m_physicalDevice, image,
+                                              MemoryPropertyFlag::DeviceLocal, allocation)) {
+        return false;
+    }
+    
+    VkImageViewCreateInfo viewInfo = {};
+    viewInfo.sType = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO;
+    viewInfo.image = image;
+    viewInfo.viewType = VK_IMAGE_VIEW_TYPE_2D;
+    viewInfo.format = format;
+    viewInfo.subresourceRange.aspectMask = aspect;
+    viewInfo.subresourceRange.baseMipLevel = 0;
+    viewInfo.subresourceRange.levelCount = 1;
+    viewInfo.subresourceRange.baseArrayLayer = 0;
+    viewInfo.subresourceRange.layerCount = 1;
+    
+    if (vkCreateImageView(m_device, &viewInfo, nullptr, &view) != VK_SUCCESS) {
+        view = VK_NULL_HANDLE;
+        return false;
+    }
+    
+    return true;
+}
+
+bool VulkanCubeRasterizer::EnsureTargets(VkExtent2D extent, const std::vector<VkImageView>& swapchainImageViews) {
+    if (!m_initialized || m_targetsFailed || swapchainImageViews.empty()) {
+        return false;
+    }
+    
+    if (!m_targets.framebuffers.empty()) {
+        return true;
+    }
+    
+    // 多重采样图像只在首次使用光栅化路径时创建（4 倍采样的颜色和深度图像占用较多显存）
+    m_targets.extent = extent;
+    if (!CreateAttachment(extent, m_colorFormat, VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT, VK_IMAGE_ASPECT_COLOR_BIT,
+                          m_targets.colorImage, m_targets.colorAllocation, m_targets.colorView) ||
+        !CreateAttachment(extent, m_depthFormat, VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT, VK_IMAGE_ASPECT_DEPTH_BIT,
+                          m_targets.depthImage, m_targets.depthAllocation, m_targets.depthView)) {
+        printf("[CUBE_RASTER] Failed to create %ux%u render targets\n", extent.width, extent.height);
+        DestroyTargets(m_targets);
+        m_targetsFailed = true;
+        return false;
+    }
+    
+    for (VkImageView swapchainView : swapchainImageViews) {
+        VkImageView attachments[] = { m_targets.colorView, m_targets.depthView, swapchainView };
+        
+        VkFramebufferCreateInfo framebufferInfo = {};
+        framebufferInfo.sType = VK_STRUCTURE_TYPE_FRAMEBUFFER_CREATE_INFO;
+        framebufferInfo.renderPass = m_renderPass;
+        framebufferInfo.attachmentCount = 3;
+        framebufferInfo.pAttachments = attachments;
+        framebufferInfo.width = extent.width;
+        framebufferInfo.height = extent.height;
+        framebufferInfo.layers = 1;
+        
+        VkFramebuffer framebuffer = VK_NULL_HANDLE;
+        if (vkCreateFramebuffer(m_device, &framebufferInfo, nullptr, &framebuffer) != VK_SUCCESS) {
+            printf("[CUBE_RASTER] Failed to create framebuffer\n");
+            DestroyTargets(m_targets);
+            m_targetsFailed = true;
+            return false;
+        }
+        m_targets.framebuffers.push_back(framebuffer);
+    }
+    
+    return true;
+}
+
+void VulkanCubeRasterizer::RetireTargets(uint64_t lastSubmitSerial) {
+    m_targetsFailed = false;
+    if (!m_initialized || m_targets.framebuffers.empty()) {
+        return;
+    }
+    
+    m_retiredTargets.Retire(std::move(m_targets), lastSubmitSerial);
+    m_targets = Targets();
+}
+
+void VulkanCubeRasterizer::ReleaseRetiredTargets(uint64_t completedSerial) {
+    m_retiredTargets.Release(completedSerial, [this](Targets& targets) { DestroyTargets(targets); });
+}
+
+void VulkanCubeRasterizer::DestroyTargets(Targets& targets) {
+    for (VkFramebuffer framebuffer : targets.framebuffers) {
+        vkDestroyFramebuffer(m_device, framebuffer, nullptr);
+    }
+    targets.framebuffers.clear();
+    
+    VkImageView* views[] = { &targets.colorView, &targets.depthView };
+    VkImage* images[] = { &targets.colorImage, &targets.depthImage };
+    MemoryAllocation* allocations[] = { &targets.colorAllocation, &targets.depthAllocation };
+    for (size_t i = 0; i < 2; i++) {
+        if (*views[i] != VK_NULL_HANDLE) {
+            vkDestroyImageView(m_device, *views[i], nullptr);
+            *views[i] = VK_NULL_HANDLE;
+        }
+        if (*images[i] != VK_NULL_HANDLE) {
+            vkDestroyImage(m_device, *images[i], nullptr);
+            *images[i] = VK_NULL_HANDLE;
+            VulkanMemoryAllocator::Release(m_allocator, m_device, *allocations[i]);
+        }
+    }
+}
+
+void VulkanCubeRasterizer::Record(VkCommandBuffer commandBuffer, uint32_t imageIndex, VkPipelineLayout pipelineLayout,
+                                  VkDescriptorSet descriptorSet, uint32_t cubeCount, const VkClearColorValue& clearColor) {
+    if (m_pipeline == VK_NULL_HANDLE || imageIndex >= (uint32_t)m_targets.framebuffers.size()) {
+        return;
+    }
+    
+    VkClearValue clearValues[2] = {};
+    clearValues[0].color = clearColor;
+    clearValues[1].depthStencil.depth = 1.0f;
+    clearValues[1].depthStencil.stencil = 0;
+    
+    VkRenderPassBeginInfo renderPassInfo = {};
+    renderPassInfo.sType = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO;
+    renderPassInfo.renderPass = m_renderPass;
+    renderPassInfo.framebuffer = m_targets.framebuffers[imageIndex];
+    renderPassInfo.renderArea.offset = {0, 0};
+    renderPassInfo.renderArea.extent = m_targets.extent;
+    renderPassInfo.clearValueCount = 2;
+    renderPassInfo.pClearValues = clearValues;
+    
+    vkCmdBeginRenderPass(commandBuffer, &renderPassInfo, VK_SUBPASS_CONTENTS_INLINE);
+    
+    // 与光线投射路径相同，全屏显示
+    VkViewport viewport = {};
+    viewport.x = 0.0f;
+    viewport.y = 0.0f;
+    viewport.width = (float)m_targets.extent.width;
+    viewport.height = (float)m_targets.extent.height;
+    viewport.minDepth = 0.0f;
+    viewport.maxDepth = 1.0f;
+    
+    VkRect2D scissor = {};
+    scissor.offset = {0, 0};
+    scissor.extent = m_targets.extent;
+    
+    vkCmdSetViewport(commandBuffer, 0, 1, &viewport);
+    vkCmdSetScissor(commandBuffer, 0, 1, &scissor);
+    
+    vkCmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, m_pipeline);
+    vkCmdBindDescriptorSets(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, pipelineLayout, 0, 1, &descriptorSet, 0, nullptr);
+    vkCmdDraw(commandBuffer, VERTICES_PER_CUBE, cubeCount, 0, 0);
+    
+    vkCmdEndRenderPass(commandBuffer);
+}
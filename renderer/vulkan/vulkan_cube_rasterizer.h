@@ -0,0 +1,145 @@
+#pragma once
+
+#ifdef _WIN32
+#define VK_USE_PLATFORM_WIN32_KHR
+#endif
+#include <vulkan/vulkan.h>  // 3. 第三方库头文件
+
+#include <string>  // 2. 系统头文件
+#include <vector>  // 2. 系统头文件
+
+#include "core/interfaces/imemory_allocator.h"  // 4. 项目头文件（接口）
+#include "renderer/vulkan/vulkan_retire_queue.h"  // 4. 项目头文件（Vulkan）
+
+/**
+ * Vulkan 立方体光栅化器 - loading_cubes 场景的实例化立方体几何渲染路径
+ * 
+ * 与 loading_cubes.frag 的逐像素光线投射相对：每个立方体作为一个实例绘制 36 个顶点，
+ * 实例变换直接读取场景描述符集中 CPU 每帧计算的立方体数据（与光线投射使用同一份动画），
+ * 光照与光线投射一致，逐像素开销只剩一次着色。
+ * 
+ * 主渲染通道只有颜色附件，为了不影响其他管线，立方体在独立的渲染通道中绘制：
+ * 多重采样颜色 + 深度附件（替代光线投射的 3x3 超采样），解析到交换链图像。
+ * 之后主渲染通道需以 LOAD 方式继续在该图像上绘制 UI（由调用方选择兼容的 LOAD 渲染通道）。
+ * 
+ * 多重采样颜色和深度图像所有交换链图像共用，首次使用时按交换链尺寸创建；
+ * 交换链重建时旧目标随旧交换链一起退役，等引用它们的提交完成后再销毁。
+ * 
+ * 使用方式：
+ * 1. 设备创建后调用 Initialize()（创建渲染通道）
+ * 2. 在场景管线预编译线程上调用 CreatePipeline()，在发布管线就绪之前完成
+ * 3. 每帧录制前调用 EnsureTargets()，成功后在主渲染通道之前调用 Record()
+ * 4. 交换链重建时调用 RetireTargets()，栅栏触发后调用 ReleaseRetiredTargets()
+ * 5. 设备空闲后调用 Cleanup()
+ */
+class VulkanCubeRasterizer {
+public:
+    VulkanCubeRasterizer();
+    ~VulkanCubeRasterizer();
+    
+    /**
+     * 初始化光栅化器（选择深度格式并创建渲染通道）
+     * 
+     * @param device Vulkan设备句柄
+     * @param physicalDevice 物理设备句柄（用于选择深度格式）
+     * @param allocator 共享内存分配器（可为 nullptr）
+     * @param colorFormat 交换链图像格式
+     * @return 成功返回 true，失败返回 false（调用方应只使用光线投射路径）
+     */
+    bool Initialize(VkDevice device, VkPhysicalDevice physicalDevice, IMemoryAllocator* allocator, VkFormat colorFormat);
+    
+    /**
+     * 销毁管线、渲染通道和所有渲染目标（调用前 GPU 必须已完成所有使用它们的提交）
+     */
+    void Cleanup();
+    
+    /**
+     * 创建实例化立方体图形管线
+     * 
+     * @param pipelineLayout 场景管线布局（包含场景参数和立方体数据的描述符集）
+     * @param pipelineCache 管线缓存（可为 VK_NULL_HANDLE）
+     * @param vertShaderPath 顶点着色器路径（.spv 或 GLSL 源文件）
+     * @param fragShaderPath 片段着色器路径（.spv 或 GLSL 源文件）
+     * @return 成功返回 true，失败返回 false
+     */
+    bool CreatePipeline(VkPipelineLayout pipelineLayout, VkPipelineCache pipelineCache,
+                        const std::string& vertShaderPath, const std::string& fragShaderPath);
+    
+    /**
+     * 管线是否已创建（只能在场景管线就绪发布之后调用）
+     */
+    bool HasPipeline() const { return m_pipeline != VK_NULL_HANDLE; }
+    
+    /**
+     * 确保存在与交换链匹配的渲染目标和帧缓冲（已存在时直接返回）
+     * 
+     * @param extent 交换链尺寸
+     * @param swapchainImageViews 交换链图像视图（多重采样颜色的解析目标）
+     * @return 成功返回 true，失败返回 false（本帧应使用光线投射路径）
+     */
+    bool EnsureTargets(VkExtent2D extent, const std::vector<VkImageView>& swapchainImageViews);
+    
+    /**
+     * 退役当前渲染目标（交换链重建时调用，下次 EnsureTargets 重新创建）
+     * 
+     * @param lastSubmitSerial 最后一次可能引用这些目标的提交序号
+     */
+    void RetireTargets(uint64_t lastSubmitSerial);
+    
+    /**
+     * 销毁已完成提交不再引用的退役渲染目标
+     * 
+     * @param completedSerial 已完成的最大提交序号
+     */
+    void ReleaseRetiredTargets(uint64_t completedSerial);
+    
+    /**
+     * 录制立方体渲染通道（必须在主渲染通道之外调用，结束后交换链图像处于 COLOR_ATTACHMENT_OPTIMAL 布局）
+     * 
+     * @param commandBuffer 主命令缓冲区
+     * @param imageIndex 交换链图像索引
+     * @param pipelineLayout 场景管线布局
+     * @param descriptorSet 该图像的场景描述符集
+     * @param cubeCount 立方体数量（实例数量）
+     * @param clearColor 背景颜色
+     */
+    void Record(VkCommandBuffer commandBuffer, uint32_t imageIndex, VkPipelineLayout pipelineLayout,
+                VkDescriptorSet descriptorSet, uint32_t cubeCount, const VkClearColorValue& clearColor);
+
+private:
+    // 禁止拷贝和赋值
+    VulkanCubeRasterizer(const VulkanCubeRasterizer&) = delete;
+    VulkanCubeRasterizer& operator=(const VulkanCubeRasterizer&) = delete;
+    
+    // 一组与交换链尺寸匹配的渲染目标
+    struct Targets {
+        VkExtent2D extent = {0, 0};
+        VkImage colorImage = VK_NULL_HANDLE;
+        MemoryAllocation colorAllocation;
+        VkImageView colorView = VK_NULL_HANDLE;
+        VkImage depthImage = VK_NULL_HANDLE;
+        MemoryAllocation depthAllocation;
+        VkImageView depthView = VK_NULL_HANDLE;
+        std::vector<VkFramebuffer> framebuffers;  // 每个交换链图像一个
+    };
+    
+    bool CreateRenderPass(VkFormat colorFormat);
+    bool CreateAttachment(VkExtent2D extent, VkFormat format, VkImageUsageFlags usage, VkImageAspectFlags aspect,
+                          VkImage& image, MemoryAllocation& allocation, VkImageView& view);
+    void DestroyTargets(Targets& targets);
+    
+    VkDevice m_device = VK_NULL_HANDLE;
+    VkPhysicalDevice m_physicalDevice = VK_NULL_HANDLE;
+    IMemoryAllocator* m_allocator = nullptr;  // [BORROW] 由渲染器拥有
+    
+    VkFormat m_colorFormat = VK_FORMAT_UNDEFINED;
+    VkFormat m_depthFormat = VK_FORMAT_UNDEFINED;
+    VkRenderPass m_renderPass = VK_NULL_HANDLE;
+    VkPipeline m_pipeline = VK_NULL_HANDLE;
+    
+    Targets m_targets;                   // 当前交换链的渲染目标（framebuffers 为空表示尚未创建）
+    bool m_targetsFailed = false;        // 当前交换链尺寸下创建失败（不再每帧重试，交换链重建后重置）
+    RetireQueue<Targets> m_retiredTargets;
+    
+    bool m_initialized = false;
+};
@@ -0,0 +1,259 @@
+#include "renderer/vulkan/vulkan_gpu_profiler.h"  // 1. 对应头文件
+
+#include <stdio.h>  // 2. 系统头文件
+
+#include "core/config/render_constants.h"  // 4. 项目头文件（配置）
+
+namespace {
+
+// 阶段名称（叠加文本和 CSV 列名，顺序与 GpuProfilerPass 一致）
+const char* const PASS_NAMES[(size_t)GpuProfilerPass::Count] = {
+    "frame", "scene", "culling", "upscale", "composite", "taa", "background", "loading", "buttons", "sliders", "text"
+};
+
+uint32_t BeginQuery(GpuProfilerPass pass) { return (uint32_t)pass * 2; }
+uint32_t EndQuery(GpuProfilerPass pass) { return (uint32_t)pass * 2 + 1; }
+
+} // namespace
+
+VulkanGpuProfiler::VulkanGpuProfiler() {
+}
+
+VulkanGpuProfiler::~VulkanGpuProfiler() {
+    Cleanup();
+}
+
+bool VulkanGpuProfiler::Initialize(VkDevice device, VkPhysicalDevice physicalDevice, uint32_t queueFamilyIndex,
+                                   uint32_t slotCount, const std::string& csvPath) {
+    if (m_initialized) {
+        return true;
+    }
+    
+    if (device == VK_NULL_HANDLE || physicalDevice == VK_NULL_HANDLE) {
+        return false;
+    }
+    
+    // 队列族的时间戳有效位数为0时不支持时间戳查询
+    uint32_t queueFamilyCount = 0;
+    vkGetPhysicalDeviceQueueFamilyProperties(physicalDevice, &queueFamilyCount, nullptr);
+    std::vector<VkQueueFamilyProperties> queueFamilies(queueFamilyCount);
+    vkGetPhysicalDeviceQueueFamilyProperties(physicalDevice, &queueFamilyCount, queueFamilies.data());
+    if (queueFamilyIndex >= queueFamilyCount || queueFamilies[queueFamilyIndex].timestampValidBits == 0) {
+        printf("[GPU_PROFILER] Queue family does not support timestamps\n");
+        return false;
+    }
+    
+    uint32_t validBits = queueFamilies[queueFamilyIndex].timestampValidBits;
+    m_timestampMask = validBits >= 64 ? ~0ull : ((1ull << validBits) - 1);
+    
+    VkPhysicalDeviceProperties properties;
+    vkGetPhysicalDeviceProperties(physicalDevice, &properties);
+    m_timestampPeriodNs = (double)properties.limits.timestampPeriod;
+    
+    m_device = device;
+    m_initialized = true;  // EnsureSlotCount 和 Cleanup 依赖该标志
+    
+    if (!EnsureSlotCount(slotCount)) {
+        Cleanup();
+        return false;
+    }
+    
+    // CSV 打开失败不影响叠加文本
+    if (!csvPath.empty()) {
+        m_csvFile = std::make_unique<std::ofstream>(csvPath, std::ios::out | std::ios::trunc);
+        if (!m_csvFile->is_open()) {
+            printf("[GPU_PROFILER] Failed to open CSV file: %s\n", csvPath.c_str());
+            m_csvFile.reset();
+        } else {
+            *m_csvFile << "frame";
+            for (const char* name : PASS_NAMES) {
+                *m_csvFile << "," << name << "_ms";
+            }
+            *m_csvFile << "\n";
+        }
+    }
+    
+    printf("[GPU_PROFILER] Enabled (timestamp period %.3f ns, %u valid bits)\n", m_timestampPeriodNs, validBits);
+    return true;
+}
+
+void VulkanGpuProfiler::Cleanup() {
+    if (!m_initialized) {
+        return;
+    }
+    
+    for (VkQueryPool pool : m_queryPools) {
+        if (pool != VK_NULL_HANDLE) {
+            vkDestroyQueryPool(m_device, pool, nullptr);
+        }
+    }
+    m_queryPools.clear();
+    m_submitted.clear();
+    
+    if (m_csvFile) {
+        m_csvFile->close();
+        m_csvFile.reset();
+    }
+    
+    m_overlayLines.clear();
+    m_device = VK_NULL_HANDLE;
+    m_initialized = false;
+}
+
+bool VulkanGpuProfiler::EnsureSlotCount(uint32_t count) {
+    if (!m_initialized) {
+        return false;
+    }
+    
+    VkQueryPoolCreateInfo poolInfo = {};
+    poolInfo.sType = VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO;
+    poolInfo.queryType = VK_QUERY_TYPE_TIMESTAMP;
+    poolInfo.queryCount = QUERIES_PER_SLOT;
+    
+    // 新查询池在首次使用前由 CmdBeginFrame 重置
+    while ((uint32_t)m_queryPools.size() < count) {
+        VkQueryPool pool = VK_NULL_HANDLE;
+        if (vkCreateQueryPool(m_device, &poolInfo, nullptr, &pool) != VK_SUCCESS) {
+            printf("[GPU_PROFILER] Failed to create timestamp query pool\n");
+            return false;
+        }
+        m_queryPools.push_back(pool);
+        m_submitted.push_back(false);
+    }
+    
+    return true;
+}
+
+bool VulkanGpuProfiler::CollectResults(uint32_t slot) {
+    if (!m_initialized || slot >= (uint32_t)m_queryPools.size() || !m_submitted[slot]) {
+        return false;
+    }
+    m_submitted[slot] = false;
+    
+    // 每个查询两个值：时间戳和可用性
+    uint64_t results[QUERIES_PER_SLOT * 2] = {};
+    VkResult result = vkGetQueryPoolResults(m_device, m_queryPools[slot], 0, QUERIES_PER_SLOT,
+                                            sizeof(results), results, sizeof(uint64_t) * 2,
+                                            VK_QUERY_RESULT_64_BIT | VK_QUERY_RESULT_WITH_AVAILABILITY_BIT);
+    // 本帧未录制的阶段查询不可用，此时返回 VK_NOT_READY，其余查询的结果仍然有效
+    if (result != VK_SUCCESS && result != VK_NOT_READY) {
+        return false;
+    }
+    
+    double passMs[(size_t)GpuProfilerPass::Count] = {};
+    bool measured[(size_t)GpuProfilerPass::Count] = {};
+    for (size_t i = 0; i < (size_t)GpuProfilerPass::Count; i++) {
+        GpuProfilerPass pass = (GpuProfilerPass)i;
+        const uint64_t* begin = &results[BeginQuery(pass) * 2];
+        const uint64_t* end = &results[EndQuery(pass) * 2];
+        if (begin[1] == 0 || end[1] == 0) {
+            m_lastMs[i] = 0.0;
+            m_framesSinceMeasured[i]++;
+            continue;
+        }
+        
+        // 掩码处理时间戳回绕
+        uint64_t ticks = (end[0] - begin[0]) & m_timestampMask;
+        passMs[i] = (double)ticks * m_timestampPeriodNs / 1000000.0;
+        measured[i] = true;
+        m_lastMs[i] = passMs[i];
+        
+        if (m_hasSample[i]) {
+            m_smoothedMs[i] += (passMs[i] - m_smoothedMs[i]) * config::GPU_PROFILER_SMOOTHING;
+        } else {
+            m_smoothedMs[i] = passMs[i];
+            m_hasSample[i] = true;
+        }
+        m_framesSinceMeasured[i] = 0;
+    }
+    
+    m_collectedFrames++;
+    WriteCsvRow(passMs, measured);
+    
+    if (m_overlayEnabled &&
+        (m_overlayLines.empty() || m_collectedFrames % config::GPU_PROFILER_OVERLAY_REFRESH_FRAMES == 0)) {
+        UpdateOverlay();
+    }
+    return true;
+}
+
+void VulkanGpuProfiler::MarkSubmitted(uint32_t slot) {
+    if (m_initialized && slot < (uint32_t)m_submitted.size()) {
+        m_submitted[slot] = true;
+    }
+}
+
+void VulkanGpuProfiler::CmdBeginFrame(VkCommandBuffer commandBuffer, uint32_t slot) {
+    if (!m_initialized || slot >= (uint32_t)m_queryPools.size()) {
+        return;
+    }
+    
+    vkCmdResetQueryPool(commandBuffer, m_queryPools[slot], 0, QUERIES_PER_SLOT);
+    vkCmdWriteTimestamp(commandBuffer, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, m_queryPools[slot], BeginQuery(GpuProfilerPass::Frame));
+}
+
+void VulkanGpuProfiler::CmdEndFrame(VkCommandBuffer commandBuffer, uint32_t slot) {
+    if (!m_initialized || slot >= (uint32_t)m_queryPools.size()) {
+        return;
+    }
+    
+    vkCmdWriteTimestamp(commandBuffer, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, m_queryPools[slot], EndQuery(GpuProfilerPass::Frame));
+}
+
+void VulkanGpuProfiler::CmdBeginPass(VkCommandBuffer commandBuffer, uint32_t slot, GpuProfilerPass pass) {
+    if (!m_initialized || slot >= (uint32_t)m_queryPools.size()) {
+        return;
+    }
+    
+    vkCmdWriteTimestamp(commandBuffer, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, m_queryPools[slot], BeginQuery(pass));
+}
+
+void VulkanGpuProfiler::CmdEndPass(VkCommandBuffer commandBuffer, uint32_t slot, GpuProfilerPass pass) {
+    if (!m_initialized || slot >= (uint32_t)m_queryPools.size()) {
+        return;
+    }
+    
+    vkCmdWriteTimestamp(commandBuffer, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, m_queryPools[slot], EndQuery(pass));
+}
+
+void VulkanGpuProfiler::UpdateOverlay() {
+    // 只显示最近一个刷新周期内测到的阶段（切换场景后不再显示旧场景的阶段）
+    std::vector<std::string> lines;
+    for (size_t i = 0; i < (size_t)GpuProfilerPass::Count; i++) {
+        if (!m_hasSample[i] || m_framesSinceMeasured[i] >= (uint32_t)config::GPU_PROFILER_OVERLAY_REFRESH_FRAMES) {
+            continue;
+        }
+        
+        char line[64];
+        if ((GpuProfilerPass)i == GpuProfilerPass::Frame) {
+            snprintf(line, sizeof(line), "GPU: %.2f ms", m_smoothedMs[i]);
+        } else {
+            snprintf(line, sizeof(line), "  %s: %.2f ms", PASS_NAMES[i], m_smoothedMs[i]);
+        }
+        lines.push_back(line);
+    }
+    
+    // 文本不变时不递增版本号，避免无谓地重新录制
+    if (lines != m_overlayLines) {
+        m_overlayLines = std::move(lines);
+        m_overlayVersion++;
+    }
+}
+
+void VulkanGpuProfiler::WriteCsvRow(const double* passMs, const bool* measured) {
+    if (!m_csvFile) {
+        return;
+    }
+    
+    // 本帧未测到的阶段留空
+    *m_csvFile << m_collectedFrames;
+    for (size_t i = 0; i < (size_t)GpuProfilerPass::Count; i++) {
+        *m_csvFile << ",";
+        if (measured[i]) {
+            char value[32];
+            snprintf(value, sizeof(value), "%.4f", passMs[i]);
+            *m_csvFile << value;
+        }
+    }
+    *m_csvFile << "\n";
+}
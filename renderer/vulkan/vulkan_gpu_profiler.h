@@ -0,0 +1,154 @@
+#pragma once
+
+#ifdef _WIN32
+#define VK_USE_PLATFORM_WIN32_KHR
+#endif
+#include <vulkan/vulkan.h>  // 3. 第三方库头文件
+
+#include <fstream>  // 2. 系统头文件
+#include <memory>  // 2. 系统头文件
+#include <string>  // 2. 系统头文件
+#include <vector>  // 2. 系统头文件
+
+#include "core/config/enums.h"  // 4. 项目头文件（配置）
+
+/**
+ * Vulkan GPU 时间戳分析器
+ * 
+ * 用 VkQueryPool 时间戳包围一帧内的各个逻辑渲染阶段（场景、立方体剔除、背景、加载动画、按钮、滑块、文本），
+ * 统计每个阶段的 GPU 耗时，平滑后生成叠加文本，并可选地把每帧结果写入 CSV 文件。
+ * 
+ * 查询按槽位分组，每个槽位对应一个交换链图像（场景的命令缓冲区按图像录制并重复提交，
+ * 时间戳命令随之重复执行）。读取发生在该图像下一次被获取之后：此时上一次使用该图像的提交
+ * 已经完成，结果不带 WAIT 标志读取，不会阻塞，延迟为交换链图像数量帧。
+ * 
+ * 时间戳可以写在二级命令缓冲区中（加载界面并行录制的各阶段），但查询重置必须在主命令缓冲区的
+ * 渲染通道之外。某个阶段本帧没有录制时（如没有背景纹理），其查询保持不可用，该帧不计入统计。
+ * 
+ * 使用方式：
+ * 1. 设备创建后调用 Initialize()，交换链图像数量变化时调用 EnsureSlotCount()
+ * 2. 获取图像后调用 CollectResults(imageIndex)
+ * 3. 录制时在渲染通道之前调用 CmdBeginFrame()，各阶段前后调用 CmdBeginPass()/CmdEndPass()，
+ *    渲染通道结束后调用 CmdEndFrame()
+ * 4. 提交成功后调用 MarkSubmitted(imageIndex)
+ * 5. 设备空闲后调用 Cleanup()
+ */
+class VulkanGpuProfiler {
+public:
+    VulkanGpuProfiler();
+    ~VulkanGpuProfiler();
+    
+    /**
+     * 初始化分析器（检查时间戳支持并创建查询池）
+     * 
+     * @param device Vulkan设备句柄
+     * @param physicalDevice 物理设备句柄（用于查询时间戳周期）
+     * @param queueFamilyIndex 执行命令缓冲区的队列族（用于查询时间戳有效位数）
+     * @param slotCount 槽位数量（交换链图像数量）
+     * @param csvPath CSV 输出路径（为空时不输出）
+     * @return 成功返回 true，队列不支持时间戳或创建失败返回 false（调用方应不使用分析器）
+     */
+    bool Initialize(VkDevice device, VkPhysicalDevice physicalDevice, uint32_t queueFamilyIndex,
+                    uint32_t slotCount, const std::string& csvPath);
+    
+    /**
+     * 销毁查询池并关闭 CSV 文件（调用前 GPU 必须已完成所有写入时间戳的提交）
+     */
+    void Cleanup();
+    
+    /**
+     * 确保至少有 count 个槽位（交换链重建后图像数量可能增加）
+     * 
+     * @param count 需要的槽位数量
+     * @return 成功返回 true，失败返回 false
+     */
+    bool EnsureSlotCount(uint32_t count);
+    
+    /**
+     * 读取该槽位上一次提交的结果（调用前该槽位上一次提交必须已完成，不会等待）
+     * 
+     * @param slot 槽位索引（交换链图像索引）
+     * @return 读回了该槽位的结果时返回 true（此时 GetLastPassMs() 已更新）
+     */
+    bool CollectResults(uint32_t slot);
+    
+    /**
+     * 标记该槽位的命令缓冲区已提交（下次 CollectResults 时读取）
+     * 
+     * @param slot 槽位索引（交换链图像索引）
+     */
+    void MarkSubmitted(uint32_t slot);
+    
+    /**
+     * 重置该槽位的查询并写入整帧开始时间戳（必须在渲染通道之外、主命令缓冲区中调用）
+     */
+    void CmdBeginFrame(VkCommandBuffer commandBuffer, uint32_t slot);
+    
+    /**
+     * 写入整帧结束时间戳（在渲染通道结束之后调用）
+     */
+    void CmdEndFrame(VkCommandBuffer commandBuffer, uint32_t slot);
+    
+    /**
+     * 写入阶段开始/结束时间戳（可在渲染通道内和二级命令缓冲区中调用，不同阶段可在不同线程上录制）
+     */
+    void CmdBeginPass(VkCommandBuffer commandBuffer, uint32_t slot, GpuProfilerPass pass);
+    void CmdEndPass(VkCommandBuffer commandBuffer, uint32_t slot, GpuProfilerPass pass);
+    
+    /**
+     * 获取最近一次读回的阶段耗时（未平滑）
+     * 
+     * @return 耗时（毫秒），该阶段在最近一次读回的帧中没有录制时返回 0
+     */
+    double GetLastPassMs(GpuProfilerPass pass) const { return m_lastMs[(size_t)pass]; }
+    
+    /**
+     * 设置是否生成叠加文本（只为动态分辨率读取耗时时关闭，默认开启）
+     */
+    void SetOverlayEnabled(bool enabled) { m_overlayEnabled = enabled; }
+    
+    /**
+     * 获取叠加文本（每 config::GPU_PROFILER_OVERLAY_REFRESH_FRAMES 个已读回的帧刷新一次）
+     * 
+     * @return 每行一个阶段的平滑耗时，尚无结果时为空
+     */
+    const std::vector<std::string>& GetOverlayLines() const { return m_overlayLines; }
+    
+    /**
+     * 获取叠加文本版本号（叠加文本每次刷新时递增，用于判断已录制的文本是否过期）
+     */
+    uint64_t GetOverlayVersion() const { return m_overlayVersion; }
+
+private:
+    // 禁止拷贝和赋值
+    VulkanGpuProfiler(const VulkanGpuProfiler&) = delete;
+    VulkanGpuProfiler& operator=(const VulkanGpuProfiler&) = delete;
+    
+    // 每个阶段占用开始和结束两个查询
+    static const uint32_t QUERIES_PER_SLOT = (uint32_t)GpuProfilerPass::Count * 2;
+    
+    void UpdateOverlay();
+    void WriteCsvRow(const double* passMs, const bool* measured);
+    
+    VkDevice m_device = VK_NULL_HANDLE;
+    std::vector<VkQueryPool> m_queryPools;  // 每个槽位一个
+    std::vector<bool> m_submitted;          // 槽位是否有未读取的提交
+    
+    double m_timestampPeriodNs = 1.0;       // 每个时间戳单位的纳秒数
+    uint64_t m_timestampMask = ~0ull;       // 时间戳有效位掩码
+    
+    // 每个阶段的平滑耗时（毫秒），以及距最近一次测到该阶段经过的已读回帧数
+    double m_smoothedMs[(size_t)GpuProfilerPass::Count] = {};
+    uint32_t m_framesSinceMeasured[(size_t)GpuProfilerPass::Count] = {};
+    bool m_hasSample[(size_t)GpuProfilerPass::Count] = {};
+    double m_lastMs[(size_t)GpuProfilerPass::Count] = {};  // 最近一次读回的耗时（未测到为 0）
+    
+    uint64_t m_collectedFrames = 0;
+    std::vector<std::string> m_overlayLines;
+    uint64_t m_overlayVersion = 0;
+    bool m_overlayEnabled = true;
+    
+    std::unique_ptr<std::ofstream> m_csvFile;  // 为空时不输出 CSV
+    
+    bool m_initialized = false;
+};
@@ -0,0 +1,460 @@
+#include "renderer/vulkan/vulkan_memory_allocator.h"  // 1. 对应头文件
+
+#include <algorithm>  // 2. 系统头文件
+#include <cstring>  // 2. 系统头文件
+#include <iterator>  // 2. 系统头文件
+#include <stdio.h>  // 2. 系统头文件
+
+#include "core/config/render_constants.h"  // 4. 项目头文件（配置）
+
+VulkanMemoryAllocator::VulkanMemoryAllocator() {
+}
+
+VulkanMemoryAllocator::~VulkanMemoryAllocator() {
+    Cleanup();
+}
+
+bool VulkanMemoryAllocator::Initialize(VkDevice device, VkPhysicalDevice physicalDevice) {
+    if (m_initialized) {
+        return true;
+    }
+    
+    if (device == VK_NULL_HANDLE || physicalDevice == VK_NULL_HANDLE) {
+        return false;
+    }
+    
+    m_device = device;
+    m_physicalDevice = physicalDevice;
+    vkGetPhysicalDeviceMemoryProperties(m_physicalDevice, &m_memoryProperties);
+    
+    m_initialized = true;
+    return true;
+}
+
+void VulkanMemoryAllocator::Cleanup() {
+    if (!m_initialized) {
+        return;
+    }
+    
+    std::lock_guard<std::mutex> lock(m_mutex);
+    
+    if (m_allocationCount > 0) {
+        printf("[MEMORY] WARNING: %u allocations still alive at allocator cleanup\n", m_allocationCount);
+    }
+    
+    for (auto& block : m_blocks) {
+        DestroyBlock(*block);
+    }
+    m_blocks.clear();
+    m_allocationCount = 0;
+    m_usedBytes = 0;
+    
+    m_device = VK_NULL_HANDLE;
+    m_physicalDevice = VK_NULL_HANDLE;
+    m_initialized = false;
+}
+
+bool VulkanMemoryAllocator::AllocateBufferMemory(BufferHandle buffer, MemoryPropertyFlag properties, MemoryAllocation& allocation) {
+    VkBuffer vkBuffer = static_cast<VkBuffer>(buffer);
+    if (!m_initialized || vkBuffer == VK_NULL_HANDLE) {
+        return false;
+    }
+    
+    VkMemoryRequirements requirements;
+    vkGetBufferMemoryRequirements(m_device, vkBuffer, &requirements);
+    
+    if (!Allocate(requirements, properties, true, allocation)) {
+        return false;
+    }
+    
+    if (vkBindBufferMemory(m_device, vkBuffer, static_cast<VkDeviceMemory>(allocation.memory), allocation.offset) != VK_SUCCESS) {
+        Free(allocation);
+        return false;
+    }
+    
+    return true;
+}
+
+bool VulkanMemoryAllocator::AllocateImageMemory(ImageHandle image, MemoryPropertyFlag properties, MemoryAllocation& allocation) {
+    VkImage vkImage = static_cast<VkImage>(image);
+    if (!m_initialized || vkImage == VK_NULL_HANDLE) {
+        return false;
+    }
+    
+    VkMemoryRequirements requirements;
+    vkGetImageMemoryRequirements(m_device, vkImage, &requirements);
+    
+    if (!Allocate(requirements, properties, false, allocation)) {
+        return false;
+    }
+    
+    if (vkBindImageMemory(m_device, vkImage, static_cast<VkDeviceMemory>(allocation.memory), allocation.offset) != VK_SUCCESS) {
+        Free(allocation);
+        return false;
+    }
+    
+    return true;
+}
+
+bool VulkanMemoryAllocator::Allocate(const VkMemoryRequirements& requirements, MemoryPropertyFlag properties,
+                                     bool linear, MemoryAllocation& allocation) {
+    uint32_t memoryTypeIndex = FindMemoryType(requirements.memoryTypeBits, ToVkMemoryProperties(properties));
+    if (memoryTypeIndex == UINT32_MAX) {
+        printf("[MEMORY] No memory type matches filter 0x%x, properties 0x%x\n",
+               requirements.memoryTypeBits, static_cast<uint32_t>(properties));
+        return false;
+    }
+    
+    std::lock_guard<std::mutex> lock(m_mutex);
+    
+    MemoryBlock* targetBlock = nullptr;
+    VkDeviceSize offset = 0;
+    
+    if (requirements.size > config::MEMORY_DEDICATED_THRESHOLD) {
+        // 大资源（背景纹理、字体图集、暂存缓冲区）单独分配，避免占满共享块
+        targetBlock = CreateBlock(memoryTypeIndex, requirements.size, linear, true);
+        if (!targetBlock) {
+            return false;
+        }
+        targetBlock->freeRanges.clear();
+    } else {
+        for (auto& block : m_blocks) {
+            if (block->dedicated || block->memoryTypeIndex != memoryTypeIndex || block->linear != linear) {
+                continue;
+            }
+            if (SuballocateFromBlock(*block, requirements.size, requirements.alignment, offset)) {
+                targetBlock = block.get();
+                break;
+            }
+        }
+        
+        if (!targetBlock) {
+            targetBlock = CreateBlock(memoryTypeIndex, config::MEMORY_BLOCK_SIZE, linear, false);
+            if (!targetBlock || !SuballocateFromBlock(*targetBlock, requirements.size, requirements.alignment, offset)) {
+                return false;
+            }
+        }
+    }
+    
+    targetBlock->allocationCount++;
+    m_allocationCount++;
+    m_usedBytes += requirements.size;
+    
+    allocation.memory = static_cast<DeviceMemoryHandle>(targetBlock->memory);
+    allocation.offset = offset;
+    allocation.size = requirements.size;
+    allocation.mappedData = targetBlock->mappedData ? static_cast<char*>(targetBlock->mappedData) + offset : nullptr;
+    allocation.blockHandle = targetBlock;
+    return true;
+}
+
+bool VulkanMemoryAllocator::SuballocateFromBlock(MemoryBlock& block, VkDeviceSize size, VkDeviceSize alignment, VkDeviceSize& offset) {
+    if (alignment == 0) {
+        alignment = 1;
+    }
+    
+    // 首次适配：空闲区间按偏移排序，取第一个对齐后仍能容纳的区间
+    for (auto it = block.freeRanges.begin(); it != block.freeRanges.end(); ++it) {
+        VkDeviceSize rangeOffset = it->first;
+        VkDeviceSize rangeSize = it->second;
+        VkDeviceSize alignedOffset = (rangeOffset + alignment - 1) / alignment * alignment;
+        VkDeviceSize padding = alignedOffset - rangeOffset;
+        if (padding + size > rangeSize) {
+            continue;
+        }
+        
+        block.freeRanges.erase(it);
+        // 对齐产生的前部间隙和剩余尾部重新放回空闲表
+        if (padding > 0) {
+            block.freeRanges[rangeOffset] = padding;
+        }
+        VkDeviceSize tailSize = rangeSize - padding - size;
+        if (tailSize > 0) {
+            block.freeRanges[alignedOffset + size] = tailSize;
+        }
+        
+        offset = alignedOffset;
+        return true;
+    }
+    
+    return false;
+}
+
+void VulkanMemoryAllocator::Free(MemoryAllocation& allocation) {
+    if (!allocation.IsValid()) {
+        return;
+    }
+    
+    std::lock_guard<std::mutex> lock(m_mutex);
+    
+    MemoryBlock* block = static_cast<MemoryBlock*>(allocation.blockHandle);
+    auto blockIt = std::find_if(m_blocks.begin(), m_blocks.end(),
+                                [block](const std::unique_ptr<MemoryBlock>& candidate) { return candidate.get() == block; });
+    if (blockIt == m_blocks.end()) {
+        printf("[MEMORY] WARNING: Free called with an allocation not owned by this allocator\n");
+        allocation = MemoryAllocation();
+        return;
+    }
+    
+    block->allocationCount--;
+    m_allocationCount--;
+    m_usedBytes -= allocation.size;
+    
+    if (block->dedicated) {
+        DestroyBlock(*block);
+        m_blocks.erase(blockIt);
+        allocation = MemoryAllocation();
+        return;
+    }
+    
+    // 归还区间并与前后相邻空闲区间合并
+    VkDeviceSize offset = allocation.offset;
+    VkDeviceSize size = allocation.size;
+    auto next = block->freeRanges.lower_bound(offset);
+    if (next != block->freeRanges.end() && offset + size == next->first) {
+        size += next->second;
+        next = block->freeRanges.erase(next);
+    }
+    if (next != block->freeRanges.begin()) {
+        auto prev = std::prev(next);
+        if (prev->first + prev->second == offset) {
+            offset = prev->first;
+            size += prev->second;
+            block->freeRanges.erase(prev);
+        }
+    }
+    block->freeRanges[offset] = size;
+    
+    allocation = MemoryAllocation();
+}
+
+void VulkanMemoryAllocator::TrimEmptyBlocks() {
+    if (!m_initialized) {
+        return;
+    }
+    
+    std::lock_guard<std::mutex> lock(m_mutex);
+    
+    // 不移动已绑定的分配（Vulkan 资源无法重新绑定到其他内存），只回收空块：
+    // 每个池保留一个空块以避免场景切换时反复申请，其余空块归还驱动
+    uint32_t releasedBlocks = 0;
+    std::vector<std::pair<uint32_t, bool>> keptEmptyPools;
+    for (auto it = m_blocks.begin(); it != m_blocks.end();) {
+        MemoryBlock& block = **it;
+        if (block.dedicated || block.allocationCount > 0) {
+            ++it;
+            continue;
+        }
+        
+        // 空块的空闲表应只剩一个覆盖整块的区间，这里重置以消除累积误差
+        block.freeRanges.clear();
+        block.freeRanges[0] = block.size;
+        
+        std::pair<uint32_t, bool> poolKey(block.memoryTypeIndex, block.linear);
+        if (std::find(keptEmptyPools.begin(), keptEmptyPools.end(), poolKey) == keptEmptyPools.end()) {
+            keptEmptyPools.push_back(poolKey);
+            ++it;
+            continue;
+        }
+        
+        DestroyBlock(block);
+        it = m_blocks.erase(it);
+        releasedBlocks++;
+    }
+    
+    if (releasedBlocks > 0) {
+        printf("[MEMORY] Trim released %u empty blocks, %zu blocks remain\n", releasedBlocks, m_blocks.size());
+    }
+}
+
+MemoryAllocatorStats VulkanMemoryAllocator::GetStats() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    
+    MemoryAllocatorStats stats;
+    for (const auto& block : m_blocks) {
+        if (block->dedicated) {
+            stats.dedicatedCount++;
+        } else {
+            stats.blockCount++;
+        }
+        stats.reservedBytes += block->size;
+    }
+    stats.allocationCount = m_allocationCount;
+    stats.usedBytes = m_usedBytes;
+    return stats;
+}
+
+VulkanMemoryAllocator::MemoryBlock* VulkanMemoryAllocator::CreateBlock(uint32_t memoryTypeIndex, VkDeviceSize size, bool linear, bool dedicated) {
+    VkMemoryAllocateInfo allocInfo = {};
+    allocInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+    allocInfo.allocationSize = size;
+    allocInfo.memoryTypeIndex = memoryTypeIndex;
+    
+    VkDeviceMemory memory = VK_NULL_HANDLE;
+    VkResult result = vkAllocateMemory(m_device, &allocInfo, nullptr, &memory);
+    if (result != VK_SUCCESS) {
+        printf("[MEMORY] vkAllocateMemory failed (%llu bytes, type %u): %d\n",
+               static_cast<unsigned long long>(size), memoryTypeIndex, result);
+        return nullptr;
+    }
+    
+    auto block = std::make_unique<MemoryBlock>();
+    block->memory = memory;
+    block->size = size;
+    block->memoryTypeIndex = memoryTypeIndex;
+    block->linear = linear;
+    block->dedicated = dedicated;
+    block->freeRanges[0] = size;
+    
+    // 主机可见块整块持久映射，子分配直接使用偏移后的指针（同一块不能被多次映射）
+    if (m_memoryProperties.memoryTypes[memoryTypeIndex].propertyFlags & VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT) {
+        if (vkMapMemory(m_device, memory, 0, VK_WHOLE_SIZE, 0, &block->mappedData) != VK_SUCCESS) {
+            block->mappedData = nullptr;
+        }
+    }
+    
+    m_blocks.push_back(std::move(block));
+    return m_blocks.back().get();
+}
+
+void VulkanMemoryAllocator::DestroyBlock(MemoryBlock& block) {
+    if (block.memory == VK_NULL_HANDLE) {
+        return;
+    }
+    
+    if (block.mappedData) {
+        vkUnmapMemory(m_device, block.memory);
+        block.mappedData = nullptr;
+    }
+    vkFreeMemory(m_device, block.memory, nullptr);
+    block.memory = VK_NULL_HANDLE;
+}
+
+uint32_t VulkanMemoryAllocator::FindMemoryType(uint32_t typeFilter, VkMemoryPropertyFlags properties) const {
+    for (uint32_t i = 0; i < m_memoryProperties.memoryTypeCount; i++) {
+        if ((typeFilter & (1 << i)) && (m_memoryProperties.memoryTypes[i].propertyFlags & properties) == properties) {
+            return i;
+        }
+    }
+    return UINT32_MAX;
+}
+
+VkMemoryPropertyFlags VulkanMemoryAllocator::ToVkMemoryProperties(MemoryPropertyFlag properties) {
+    VkMemoryPropertyFlags vkProperties = 0;
+    if ((properties & MemoryPropertyFlag::DeviceLocal) != MemoryPropertyFlag::None) {
+        vkProperties |= VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT;
+    }
+    if ((properties & MemoryPropertyFlag::HostVisible) != MemoryPropertyFlag::None) {
+        vkProperties |= VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT;
+    }
+    if ((properties & MemoryPropertyFlag::HostCoherent) != MemoryPropertyFlag::None) {
+        vkProperties |= VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
+    }
+    if ((properties & MemoryPropertyFlag::HostCached) != MemoryPropertyFlag::None) {
+        vkProperties |= VK_MEMORY_PROPERTY_HOST_CACHED_BIT;
+    }
+    return vkProperties;
+}
+
+uint32_t VulkanMemoryAllocator::FindMemoryType(VkPhysicalDevice physicalDevice, uint32_t typeFilter, VkMemoryPropertyFlags properties) {
+    VkPhysicalDeviceMemoryProperties memProperties;
+    vkGetPhysicalDeviceMemoryProperties(physicalDevice, &memProperties);
+    
+    for (uint32_t i = 0; i < memProperties.memoryTypeCount; i++) {
+        if ((typeFilter & (1 << i)) && (memProperties.memoryTypes[i].propertyFlags & properties) == properties) {
+            return i;
+        }
+    }
+    return UINT32_MAX;
+}
+
+bool VulkanMemoryAllocator::AllocateBuffer(IMemoryAllocator* allocator, VkDevice device, VkPhysicalDevice physicalDevice,
+                                           VkBuffer buffer, MemoryPropertyFlag properties, MemoryAllocation& allocation) {
+    if (allocator) {
+        return allocator->AllocateBufferMemory(static_cast<BufferHandle>(buffer), properties, allocation);
+    }
+    
+    VkMemoryRequirements requirements;
+    vkGetBufferMemoryRequirements(device, buffer, &requirements);
+    
+    VkMemoryAllocateInfo allocInfo = {};
+    allocInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+    allocInfo.allocationSize = requirements.size;
+    allocInfo.memoryTypeIndex = FindMemoryType(physicalDevice, requirements.memoryTypeBits, ToVkMemoryProperties(properties));
+    if (allocInfo.memoryTypeIndex == UINT32_MAX) {
+        return false;
+    }
+    
+    VkDeviceMemory memory = VK_NULL_HANDLE;
+    if (vkAllocateMemory(device, &allocInfo, nullptr, &memory) != VK_SUCCESS) {
+        return false;
+    }
+    vkBindBufferMemory(device, buffer, memory, 0);
+    
+    allocation = MemoryAllocation();
+    allocation.memory = static_cast<DeviceMemoryHandle>(memory);
+    allocation.size = requirements.size;
+    return true;
+}
+
+bool VulkanMemoryAllocator::AllocateImage(IMemoryAllocator* allocator, VkDevice device, VkPhysicalDevice physicalDevice,
+                                          VkImage image, MemoryPropertyFlag properties, MemoryAllocation& allocation) {
+    if (allocator) {
+        return allocator->AllocateImageMemory(static_cast<ImageHandle>(image), properties, allocation);
+    }
+    
+    VkMemoryRequirements requirements;
+    vkGetImageMemoryRequirements(device, image, &requirements);
+    
+    VkMemoryAllocateInfo allocInfo = {};
+    allocInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+    allocInfo.allocationSize = requirements.size;
+    allocInfo.memoryTypeIndex = FindMemoryType(physicalDevice, requirements.memoryTypeBits, ToVkMemoryProperties(properties));
+    if (allocInfo.memoryTypeIndex == UINT32_MAX) {
+        return false;
+    }
+    
+    VkDeviceMemory memory = VK_NULL_HANDLE;
+    if (vkAllocateMemory(device, &allocInfo, nullptr, &memory) != VK_SUCCESS) {
+        return false;
+    }
+    vkBindImageMemory(device, image, memory, 0);
+    
+    allocation = MemoryAllocation();
+    allocation.memory = static_cast<DeviceMemoryHandle>(memory);
+    allocation.size = requirements.size;
+    return true;
+}
+
+void VulkanMemoryAllocator::Write(VkDevice device, const MemoryAllocation& allocation, const void* data, VkDeviceSize size, VkDeviceSize offset) {
+    if (!allocation.IsValid() || !data || size == 0) {
+        return;
+    }
+    
+    if (allocation.mappedData) {
+        memcpy(static_cast<char*>(allocation.mappedData) + offset, data, (size_t)size);
+        return;
+    }
+    
+    VkDeviceMemory memory = static_cast<VkDeviceMemory>(allocation.memory);
+    void* mapped = nullptr;
+    if (vkMapMemory(device, memory, allocation.offset + offset, size, 0, &mapped) != VK_SUCCESS) {
+        return;
+    }
+    memcpy(mapped, data, (size_t)size);
+    vkUnmapMemory(device, memory);
+}
+
+void VulkanMemoryAllocator::Release(IMemoryAllocator* allocator, VkDevice device, MemoryAllocation& allocation) {
+    if (!allocation.IsValid()) {
+        return;
+    }
+    
+    if (allocation.blockHandle && allocator) {
+        allocator->Free(allocation);
+        return;
+    }
+    
+    vkFreeMemory(device, static_cast<VkDeviceMemory>(allocation.memory), nullptr);
+    allocation = MemoryAllocation();
+}
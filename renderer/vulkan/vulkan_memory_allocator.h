@@ -0,0 +1,134 @@
+#pragma once
+
+#ifdef _WIN32
+#define VK_USE_PLATFORM_WIN32_KHR
+#endif
+#include <vulkan/vulkan.h>  // 3. 第三方库头文件
+
+#include <map>  // 2. 系统头文件
+#include <memory>  // 2. 系统头文件
+#include <mutex>  // 2. 系统头文件
+#include <vector>  // 2. 系统头文件
+#include "core/interfaces/imemory_allocator.h"  // 4. 项目头文件（接口）
+#include "core/types/render_types.h"  // 4. 项目头文件（类型）
+
+/**
+ * Vulkan 设备内存分配器 - 实现 IMemoryAllocator 接口
+ * 
+ * 每个内存类型维护两个块池（线性资源/缓冲区与最优排列资源/图像分开，避免 bufferImageGranularity 冲突），
+ * 块内使用按偏移排序的空闲区间表进行首次适配子分配，释放时与相邻区间合并。
+ * 超过 config::MEMORY_DEDICATED_THRESHOLD 的资源单独分配，主机可见块在创建时持久映射。
+ * 
+ * 静态辅助函数在分配器为空时退回到每资源独立 vkAllocateMemory，供仍可能在无分配器环境下初始化的组件使用。
+ */
+class VulkanMemoryAllocator : public IMemoryAllocator {
+public:
+    VulkanMemoryAllocator();
+    ~VulkanMemoryAllocator();
+    
+    /**
+     * 初始化分配器
+     * 
+     * @param device Vulkan设备句柄
+     * @param physicalDevice Vulkan物理设备句柄
+     * @return 成功返回 true，失败返回 false
+     */
+    bool Initialize(VkDevice device, VkPhysicalDevice physicalDevice);
+    
+    /**
+     * 清理分配器，释放所有内存块（调用前所有资源应已归还）
+     */
+    void Cleanup();
+    
+    // IMemoryAllocator 接口实现
+    bool AllocateBufferMemory(BufferHandle buffer, MemoryPropertyFlag properties, MemoryAllocation& allocation) override;
+    bool AllocateImageMemory(ImageHandle image, MemoryPropertyFlag properties, MemoryAllocation& allocation) override;
+    void Free(MemoryAllocation& allocation) override;
+    void TrimEmptyBlocks() override;
+    MemoryAllocatorStats GetStats() const override;
+    
+    /**
+     * 为缓冲区分配并绑定内存（allocator 为空时退回到独立分配）
+     * 
+     * @param allocator 共享分配器（可为 nullptr）
+     * @param device Vulkan设备句柄
+     * @param physicalDevice Vulkan物理设备句柄（独立分配时用于查找内存类型）
+     * @param buffer 缓冲区
+     * @param properties 所需内存属性
+     * @param allocation 输出分配结果
+     * @return 成功返回 true，失败返回 false
+     */
+    static bool AllocateBuffer(IMemoryAllocator* allocator, VkDevice device, VkPhysicalDevice physicalDevice,
+                               VkBuffer buffer, MemoryPropertyFlag properties, MemoryAllocation& allocation);
+    
+    /**
+     * 为图像分配并绑定内存（allocator 为空时退回到独立分配）
+     * 
+     * @param allocator 共享分配器（可为 nullptr）
+     * @param device Vulkan设备句柄
+     * @param physicalDevice Vulkan物理设备句柄（独立分配时用于查找内存类型）
+     * @param image 图像
+     * @param properties 所需内存属性
+     * @param allocation 输出分配结果
+     * @return 成功返回 true，失败返回 false
+     */
+    static bool AllocateImage(IMemoryAllocator* allocator, VkDevice device, VkPhysicalDevice physicalDevice,
+                              VkImage image, MemoryPropertyFlag properties, MemoryAllocation& allocation);
+    
+    /**
+     * 写入主机可见内存（已持久映射时直接复制，否则临时映射）
+     * 
+     * @param device Vulkan设备句柄
+     * @param allocation 目标分配
+     * @param data 源数据
+     * @param size 写入字节数
+     * @param offset 相对分配起点的偏移
+     */
+    static void Write(VkDevice device, const MemoryAllocation& allocation, const void* data, VkDeviceSize size, VkDeviceSize offset = 0);
+    
+    /**
+     * 释放分配（经分配器分配的归还给分配器，独立分配的直接 vkFreeMemory），调用后 allocation 被重置
+     * 
+     * @param allocator 共享分配器（可为 nullptr）
+     * @param device Vulkan设备句柄
+     * @param allocation 要释放的分配
+     */
+    static void Release(IMemoryAllocator* allocator, VkDevice device, MemoryAllocation& allocation);
+
+private:
+    // 禁止拷贝和赋值
+    VulkanMemoryAllocator(const VulkanMemoryAllocator&) = delete;
+    VulkanMemoryAllocator& operator=(const VulkanMemoryAllocator&) = delete;
+    
+    // 设备内存块（共享块或独立分配）
+    struct MemoryBlock {
+        VkDeviceMemory memory = VK_NULL_HANDLE;
+        VkDeviceSize size = 0;
+        uint32_t memoryTypeIndex = UINT32_MAX;
+        bool linear = true;       // 线性资源（缓冲区）块或最优排列资源（图像）块
+        bool dedicated = false;   // 独立分配，仅承载一个资源
+        void* mappedData = nullptr;
+        std::map<VkDeviceSize, VkDeviceSize> freeRanges;  // 空闲区间：偏移 -> 大小
+        uint32_t allocationCount = 0;
+    };
+    
+    bool Allocate(const VkMemoryRequirements& requirements, MemoryPropertyFlag properties, bool linear, MemoryAllocation& allocation);
+    bool SuballocateFromBlock(MemoryBlock& block, VkDeviceSize size, VkDeviceSize alignment, VkDeviceSize& offset);
+    MemoryBlock* CreateBlock(uint32_t memoryTypeIndex, VkDeviceSize size, bool linear, bool dedicated);
+    void DestroyBlock(MemoryBlock& block);
+    uint32_t FindMemoryType(uint32_t typeFilter, VkMemoryPropertyFlags properties) const;
+    
+    static VkMemoryPropertyFlags ToVkMemoryProperties(MemoryPropertyFlag properties);
+    static uint32_t FindMemoryType(VkPhysicalDevice physicalDevice, uint32_t typeFilter, VkMemoryPropertyFlags properties);
+    
+    VkDevice m_device = VK_NULL_HANDLE;
+    VkPhysicalDevice m_physicalDevice = VK_NULL_HANDLE;
+    VkPhysicalDeviceMemoryProperties m_memoryProperties = {};
+    
+    std::vector<std::unique_ptr<MemoryBlock>> m_blocks;
+    uint32_t m_allocationCount = 0;
+    VkDeviceSize m_usedBytes = 0;
+    mutable std::mutex m_mutex;  // 保护块表，允许从工作线程分配
+    
+    bool m_initialized = false;  // 初始化状态标志，防止重复初始化
+};
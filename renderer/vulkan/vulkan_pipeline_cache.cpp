@@ -0,0 +1,200 @@
+#include "renderer/vulkan/vulkan_pipeline_cache.h"  // 1. 对应头文件
+
+#include <cstdio>  // 2. 系统头文件
+#include <cstring>  // 2. 系统头文件
+#include <fstream>  // 2. 系统头文件
+
+namespace {
+
+// 文件标识 "VKPC"
+const uint32_t PIPELINE_CACHE_FILE_MAGIC = 0x43504B56u;
+
+// 驱动缓存数据自带的头部（VK_PIPELINE_CACHE_HEADER_VERSION_ONE 格式）
+struct VulkanCacheDataHeader {
+    uint32_t headerSize;
+    uint32_t headerVersion;
+    uint32_t vendorID;
+    uint32_t deviceID;
+    uint8_t pipelineCacheUUID[VK_UUID_SIZE];
+};
+
+} // namespace
+
+VulkanPipelineCache::VulkanPipelineCache() {
+}
+
+VulkanPipelineCache::~VulkanPipelineCache() {
+    Cleanup();
+}
+
+bool VulkanPipelineCache::Initialize(VkDevice device, VkPhysicalDevice physicalDevice, const std::string& filePath) {
+    if (m_initialized) {
+        return true;
+    }
+    
+    if (device == VK_NULL_HANDLE || physicalDevice == VK_NULL_HANDLE) {
+        return false;
+    }
+    
+    m_device = device;
+    m_filePath = filePath;
+    vkGetPhysicalDeviceProperties(physicalDevice, &m_deviceProperties);
+    
+    std::vector<char> initialData;
+    bool loaded = LoadCacheData(initialData);
+    
+    VkPipelineCacheCreateInfo createInfo = {};
+    createInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO;
+    createInfo.initialDataSize = loaded ? initialData.size() : 0;
+    createInfo.pInitialData = loaded ? initialData.data() : nullptr;
+    
+    VkResult result = vkCreatePipelineCache(m_device, &createInfo, nullptr, &m_pipelineCache);
+    if (result != VK_SUCCESS && loaded) {
+        // 驱动拒绝旧数据时退回到空缓存，不影响启动
+        printf("[PIPELINE_CACHE] Driver rejected cached data (%d), starting with empty cache\n", result);
+        createInfo.initialDataSize = 0;
+        createInfo.pInitialData = nullptr;
+        loaded = false;
+        result = vkCreatePipelineCache(m_device, &createInfo, nullptr, &m_pipelineCache);
+    }
+    
+    if (result != VK_SUCCESS) {
+        printf("[PIPELINE_CACHE] Failed to create pipeline cache: %d\n", result);
+        m_pipelineCache = VK_NULL_HANDLE;
+        m_device = VK_NULL_HANDLE;
+        return false;
+    }
+    
+    if (loaded) {
+        printf("[PIPELINE_CACHE] Loaded %zu bytes from %s\n", initialData.size(), m_filePath.c_str());
+    }
+    
+    m_initialized = true;
+    return true;
+}
+
+bool VulkanPipelineCache::Save() const {
+    if (!m_initialized || m_pipelineCache == VK_NULL_HANDLE || m_filePath.empty()) {
+        return false;
+    }
+    
+    size_t dataSize = 0;
+    if (vkGetPipelineCacheData(m_device, m_pipelineCache, &dataSize, nullptr) != VK_SUCCESS || dataSize == 0) {
+        return false;
+    }
+    
+    std::vector<char> data(dataSize);
+    if (vkGetPipelineCacheData(m_device, m_pipelineCache, &dataSize, data.data()) != VK_SUCCESS) {
+        return false;
+    }
+    
+    FileHeader header = {};
+    header.magic = PIPELINE_CACHE_FILE_MAGIC;
+    header.headerSize = sizeof(FileHeader);
+    header.vendorID = m_deviceProperties.vendorID;
+    header.deviceID = m_deviceProperties.deviceID;
+    header.driverVersion = m_deviceProperties.driverVersion;
+    memcpy(header.pipelineCacheUUID, m_deviceProperties.pipelineCacheUUID, VK_UUID_SIZE);
+    header.dataSize = dataSize;
+    
+    // 先写临时文件再替换，避免进程中途退出留下截断的缓存
+    std::string tempPath = m_filePath + ".tmp";
+    {
+        std::ofstream file(tempPath, std::ios::binary | std::ios::trunc);
+        if (!file.is_open()) {
+            printf("[PIPELINE_CACHE] Failed to open %s for writing\n", tempPath.c_str());
+            return false;
+        }
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        file.write(data.data(), (std::streamsize)dataSize);
+        if (!file.good()) {
+            printf("[PIPELINE_CACHE] Failed to write %s\n", tempPath.c_str());
+            file.close();
+            std::remove(tempPath.c_str());
+            return false;
+        }
+    }
+    
+    std::remove(m_filePath.c_str());
+    if (std::rename(tempPath.c_str(), m_filePath.c_str()) != 0) {
+        printf("[PIPELINE_CACHE] Failed to replace %s\n", m_filePath.c_str());
+        std::remove(tempPath.c_str());
+        return false;
+    }
+    
+    printf("[PIPELINE_CACHE] Saved %zu bytes to %s\n", dataSize, m_filePath.c_str());
+    return true;
+}
+
+void VulkanPipelineCache::Cleanup() {
+    if (!m_initialized) {
+        return;
+    }
+    
+    Save();
+    
+    if (m_pipelineCache != VK_NULL_HANDLE) {
+        vkDestroyPipelineCache(m_device, m_pipelineCache, nullptr);
+        m_pipelineCache = VK_NULL_HANDLE;
+    }
+    
+    m_device = VK_NULL_HANDLE;
+    m_initialized = false;
+}
+
+bool VulkanPipelineCache::LoadCacheData(std::vector<char>& data) const {
+    std::ifstream file(m_filePath, std::ios::binary | std::ios::ate);
+    if (!file.is_open()) {
+        return false;  // 首次启动，没有缓存文件
+    }
+    
+    std::streamsize fileSize = file.tellg();
+    if (fileSize < (std::streamsize)sizeof(FileHeader)) {
+        printf("[PIPELINE_CACHE] Cache file too small, ignored\n");
+        return false;
+    }
+    file.seekg(0);
+    
+    FileHeader header = {};
+    file.read(reinterpret_cast<char*>(&header), sizeof(header));
+    if (!file.good() || !IsHeaderCompatible(header)) {
+        printf("[PIPELINE_CACHE] Cache file was written by a different device or driver, ignored\n");
+        return false;
+    }
+    
+    if (header.dataSize != (uint64_t)(fileSize - (std::streamsize)sizeof(FileHeader)) ||
+        header.dataSize < sizeof(VulkanCacheDataHeader)) {
+        printf("[PIPELINE_CACHE] Cache file size mismatch, ignored\n");
+        return false;
+    }
+    
+    data.resize((size_t)header.dataSize);
+    file.read(data.data(), (std::streamsize)header.dataSize);
+    if (!file.good()) {
+        data.clear();
+        return false;
+    }
+    
+    // 驱动数据头部也需与当前设备一致
+    VulkanCacheDataHeader dataHeader = {};
+    memcpy(&dataHeader, data.data(), sizeof(dataHeader));
+    if (dataHeader.headerVersion != VK_PIPELINE_CACHE_HEADER_VERSION_ONE ||
+        dataHeader.vendorID != m_deviceProperties.vendorID ||
+        dataHeader.deviceID != m_deviceProperties.deviceID ||
+        memcmp(dataHeader.pipelineCacheUUID, m_deviceProperties.pipelineCacheUUID, VK_UUID_SIZE) != 0) {
+        printf("[PIPELINE_CACHE] Driver cache header mismatch, ignored\n");
+        data.clear();
+        return false;
+    }
+    
+    return true;
+}
+
+bool VulkanPipelineCache::IsHeaderCompatible(const FileHeader& header) const {
+    return header.magic == PIPELINE_CACHE_FILE_MAGIC &&
+           header.headerSize == sizeof(FileHeader) &&
+           header.vendorID == m_deviceProperties.vendorID &&
+           header.deviceID == m_deviceProperties.deviceID &&
+           header.driverVersion == m_deviceProperties.driverVersion &&
+           memcmp(header.pipelineCacheUUID, m_deviceProperties.pipelineCacheUUID, VK_UUID_SIZE) == 0;
+}
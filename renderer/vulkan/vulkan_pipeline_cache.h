@@ -0,0 +1,78 @@
+#pragma once
+
+#ifdef _WIN32
+#define VK_USE_PLATFORM_WIN32_KHR
+#endif
+#include <vulkan/vulkan.h>  // 3. 第三方库头文件
+
+#include <string>  // 2. 系统头文件
+#include <vector>  // 2. 系统头文件
+#include "core/types/render_types.h"  // 4. 项目头文件（类型）
+
+/**
+ * Vulkan 管线缓存 - 跨进程持久化的 VkPipelineCache
+ * 
+ * 启动时从磁盘读取缓存数据创建 VkPipelineCache，所有管线创建点共享同一个缓存，关闭时写回磁盘。
+ * 文件头记录 vendorID/deviceID/driverVersion/pipelineCacheUUID，任一项与当前物理设备不符时丢弃旧数据，
+ * 避免驱动升级或更换显卡后把不兼容的缓存交给驱动。
+ * 
+ * 使用方式：
+ * 1. 逻辑设备创建后调用 Initialize()
+ * 2. 通过 GetHandle() 获取句柄传给 vkCreateGraphicsPipelines
+ * 3. 设备销毁前调用 Cleanup()（自动保存）
+ */
+class VulkanPipelineCache {
+public:
+    VulkanPipelineCache();
+    ~VulkanPipelineCache();
+    
+    /**
+     * 初始化管线缓存（读取磁盘数据，校验失败时创建空缓存）
+     * 
+     * @param device Vulkan设备句柄
+     * @param physicalDevice Vulkan物理设备句柄（用于校验缓存来源）
+     * @param filePath 缓存文件路径
+     * @return 成功返回 true，失败返回 false
+     */
+    bool Initialize(VkDevice device, VkPhysicalDevice physicalDevice, const std::string& filePath);
+    
+    /**
+     * 将当前缓存内容写入磁盘
+     * 
+     * @return 成功返回 true，失败返回 false
+     */
+    bool Save() const;
+    
+    /**
+     * 保存并销毁管线缓存
+     */
+    void Cleanup();
+    
+    VkPipelineCache GetHandle() const { return m_pipelineCache; }
+
+private:
+    // 禁止拷贝和赋值
+    VulkanPipelineCache(const VulkanPipelineCache&) = delete;
+    VulkanPipelineCache& operator=(const VulkanPipelineCache&) = delete;
+    
+    // 缓存文件头（位于驱动缓存数据之前）
+    struct FileHeader {
+        uint32_t magic;
+        uint32_t headerSize;
+        uint32_t vendorID;
+        uint32_t deviceID;
+        uint32_t driverVersion;
+        uint8_t pipelineCacheUUID[VK_UUID_SIZE];
+        uint64_t dataSize;
+    };
+    
+    bool LoadCacheData(std::vector<char>& data) const;
+    bool IsHeaderCompatible(const FileHeader& header) const;
+    
+    VkDevice m_device = VK_NULL_HANDLE;
+    VkPhysicalDeviceProperties m_deviceProperties = {};
+    VkPipelineCache m_pipelineCache = VK_NULL_HANDLE;
+    std::string m_filePath;
+    
+    bool m_initialized = false;  // 初始化状态标志，防止重复初始化
+};
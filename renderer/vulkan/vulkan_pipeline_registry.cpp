@@ -0,0 +1,511 @@
+#include "renderer/vulkan/vulkan_pipeline_registry.h"  // 1. 对应头文件
+
+#include <sstream>  // 2. 系统头文件
+#include <stdio.h>  // 2. 系统头文件
+
+#include "shader/shader_loader.h"  // 4. 项目头文件
+
+namespace {
+
+VkFormat ToVkFormat(VertexAttributeFormat format) {
+    switch (format) {
+        case VertexAttributeFormat::Float3: return VK_FORMAT_R32G32B32_SFLOAT;
+        case VertexAttributeFormat::Float4: return VK_FORMAT_R32G32B32A32_SFLOAT;
+        case VertexAttributeFormat::Float2:
+        default: return VK_FORMAT_R32G32_SFLOAT;
+    }
+}
+
+} // namespace
+
+VulkanPipelineRegistry::VulkanPipelineRegistry() {
+}
+
+VulkanPipelineRegistry::~VulkanPipelineRegistry() {
+    Cleanup();
+}
+
+bool VulkanPipelineRegistry::Initialize(VkDevice device, VkPipelineCache pipelineCache) {
+    if (m_initialized) {
+        return true;
+    }
+    
+    if (device == VK_NULL_HANDLE) {
+        return false;
+    }
+    
+    m_device = device;
+    m_pipelineCache = pipelineCache;
+    
+    m_initialized = true;
+    return true;
+}
+
+void VulkanPipelineRegistry::Cleanup() {
+    if (!m_initialized) {
+        return;
+    }
+    
+    std::lock_guard<std::mutex> lock(m_mutex);
+    
+    if (!m_entries.empty()) {
+        printf("[PIPELINE_REGISTRY] WARNING: %zu pipelines still referenced at registry cleanup\n", m_entries.size());
+    }
+    
+    for (auto& pair : m_entries) {
+        PipelineEntry& entry = *pair.second;
+        if (entry.pipeline != VK_NULL_HANDLE) {
+            vkDestroyPipeline(m_device, entry.pipeline, nullptr);
+        }
+        if (entry.layout != VK_NULL_HANDLE) {
+            vkDestroyPipelineLayout(m_device, entry.layout, nullptr);
+        }
+    }
+    m_entries.clear();
+    
+    m_retiredPipelines.ReleaseAll([this](RetiredPipeline& retired) { DestroyRetired(retired); });
+    
+    for (auto& pair : m_setLayouts) {
+        vkDestroyDescriptorSetLayout(m_device, pair.second, nullptr);
+    }
+    m_setLayouts.clear();
+    
+    m_cacheHits = 0;
+    m_lastSubmitSerial = 0;
+    m_device = VK_NULL_HANDLE;
+    m_pipelineCache = VK_NULL_HANDLE;
+    m_initialized = false;
+}
+
+bool VulkanPipelineRegistry::Acquire(const GraphicsPipelineDesc& desc, SharedPipeline& pipeline) {
+    if (!m_initialized) {
+        return false;
+    }
+    
+    std::string key = BuildKey(desc);
+    
+    VkDescriptorSetLayout descriptorSetLayout = VK_NULL_HANDLE;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        
+        auto it = m_entries.find(key);
+        if (it != m_entries.end()) {
+            it->second->refCount++;
+            m_cacheHits++;
+            ExportEntry(*it->second, pipeline);
+            return true;
+        }
+        
+        if (desc.textureSamplerCount > 0) {
+            descriptorSetLayout = GetSamplerSetLayout(desc.textureSamplerCount);
+            if (descriptorSetLayout == VK_NULL_HANDLE) {
+                return false;
+            }
+        }
+    }
+    
+    // 在锁外读取着色器并编译管线，编译期间其他线程仍可查找已有管线
+    VkPipelineLayout layout = VK_NULL_HANDLE;
+    VkPipeline vkPipeline = VK_NULL_HANDLE;
+    if (!CreatePipeline(m_device, m_pipelineCache, desc, descriptorSetLayout, layout, vkPipeline)) {
+        return false;
+    }
+    
+    std::lock_guard<std::mutex> lock(m_mutex);
+    
+    // 编译期间其他线程已创建了相同描述的管线：使用已有条目，丢弃本次结果
+    auto it = m_entries.find(key);
+    if (it != m_entries.end()) {
+        vkDestroyPipeline(m_device, vkPipeline, nullptr);
+        vkDestroyPipelineLayout(m_device, layout, nullptr);
+        it->second->refCount++;
+        m_cacheHits++;
+        ExportEntry(*it->second, pipeline);
+        return true;
+    }
+    
+    auto entry = std::make_unique<PipelineEntry>();
+    entry->key = key;
+    entry->pipeline = vkPipeline;
+    entry->layout = layout;
+    entry->descriptorSetLayout = descriptorSetLayout;
+    entry->refCount = 1;
+    
+    printf("[PIPELINE_REGISTRY] Created pipeline %s + %s (%zu total)\n",
+           desc.vertShaderPath.c_str(), desc.fragShaderPath.c_str(), m_entries.size() + 1);
+    
+    ExportEntry(*entry, pipeline);
+    m_entries[key] = std::move(entry);
+    return true;
+}
+
+void VulkanPipelineRegistry::Release(SharedPipeline& pipeline) {
+    if (!m_initialized || pipeline.entryHandle == nullptr) {
+        pipeline = SharedPipeline();
+        return;
+    }
+    
+    std::lock_guard<std::mutex> lock(m_mutex);
+    
+    PipelineEntry* entry = static_cast<PipelineEntry*>(pipeline.entryHandle);
+    pipeline = SharedPipeline();
+    
+    auto it = m_entries.find(entry->key);
+    if (it == m_entries.end() || it->second.get() != entry) {
+        return;
+    }
+    
+    if (entry->refCount > 1) {
+        entry->refCount--;
+        return;
+    }
+    
+    // 最后一个引用：在途帧（以及当前帧已录制、尚未提交的命令缓冲）可能仍引用该管线，
+    // 按下一次提交的序号退役，该提交完成后再销毁
+    RetiredPipeline retired;
+    retired.pipeline = entry->pipeline;
+    retired.layout = entry->layout;
+    m_retiredPipelines.Retire(retired, m_lastSubmitSerial + 1);
+    m_entries.erase(it);
+}
+
+void VulkanPipelineRegistry::OnFrameSubmitted(uint64_t submitSerial) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_lastSubmitSerial = submitSerial;
+}
+
+void VulkanPipelineRegistry::ReleaseRetired(uint64_t completedSerial) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_retiredPipelines.Release(completedSerial, [this](RetiredPipeline& retired) { DestroyRetired(retired); });
+}
+
+PipelineRegistryStats VulkanPipelineRegistry::GetStats() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    
+    PipelineRegistryStats stats;
+    stats.pipelineCount = (uint32_t)m_entries.size();
+    for (const auto& pair : m_entries) {
+        stats.referenceCount += pair.second->refCount;
+    }
+    stats.cacheHits = m_cacheHits;
+    return stats;
+}
+
+void VulkanPipelineRegistry::ExportEntry(PipelineEntry& entry, SharedPipeline& pipeline) {
+    pipeline.pipeline = static_cast<PipelineHandle>(entry.pipeline);
+    pipeline.layout = static_cast<PipelineLayoutHandle>(entry.layout);
+    pipeline.descriptorSetLayout = static_cast<DescriptorSetLayoutHandle>(entry.descriptorSetLayout);
+    pipeline.entryHandle = &entry;
+}
+
+void VulkanPipelineRegistry::DestroyRetired(RetiredPipeline& retired) {
+    vkDestroyPipeline(m_device, retired.pipeline, nullptr);
+    vkDestroyPipelineLayout(m_device, retired.layout, nullptr);
+}
+
+bool VulkanPipelineRegistry::Acquire(IPipelineRegistry* registry, VkDevice device, VkPipelineCache pipelineCache,
+                                     const GraphicsPipelineDesc& desc, SharedPipeline& pipeline) {
+    if (registry) {
+        return registry->Acquire(desc, pipeline);
+    }
+    
+    // 无注册表：独立创建，描述符集布局也由调用方独占
+    VkDescriptorSetLayout descriptorSetLayout = VK_NULL_HANDLE;
+    if (desc.textureSamplerCount > 0) {
+        descriptorSetLayout = CreateSamplerSetLayout(device, desc.textureSamplerCount);
+        if (descriptorSetLayout == VK_NULL_HANDLE) {
+            return false;
+        }
+    }
+    
+    VkPipelineLayout layout = VK_NULL_HANDLE;
+    VkPipeline vkPipeline = VK_NULL_HANDLE;
+    if (!CreatePipeline(device, pipelineCache, desc, descriptorSetLayout, layout, vkPipeline)) {
+        if (descriptorSetLayout != VK_NULL_HANDLE) {
+            vkDestroyDescriptorSetLayout(device, descriptorSetLayout, nullptr);
+        }
+        return false;
+    }
+    
+    pipeline.pipeline = static_cast<PipelineHandle>(vkPipeline);
+    pipeline.layout = static_cast<PipelineLayoutHandle>(layout);
+    pipeline.descriptorSetLayout = static_cast<DescriptorSetLayoutHandle>(descriptorSetLayout);
+    pipeline.entryHandle = nullptr;
+    return true;
+}
+
+void VulkanPipelineRegistry::Release(IPipelineRegistry* registry, VkDevice device, SharedPipeline& pipeline) {
+    if (pipeline.entryHandle != nullptr) {
+        if (registry) {
+            registry->Release(pipeline);
+        }
+        pipeline = SharedPipeline();
+        return;
+    }
+    
+    if (pipeline.pipeline != nullptr) {
+        vkDestroyPipeline(device, static_cast<VkPipeline>(pipeline.pipeline), nullptr);
+    }
+    if (pipeline.layout != nullptr) {
+        vkDestroyPipelineLayout(device, static_cast<VkPipelineLayout>(pipeline.layout), nullptr);
+    }
+    if (pipeline.descriptorSetLayout != nullptr) {
+        vkDestroyDescriptorSetLayout(device, static_cast<VkDescriptorSetLayout>(pipeline.descriptorSetLayout), nullptr);
+    }
+    pipeline = SharedPipeline();
+}
+
+VkDescriptorSetLayout VulkanPipelineRegistry::GetSamplerSetLayout(uint32_t samplerCount) {
+    auto it = m_setLayouts.find(samplerCount);
+    if (it != m_setLayouts.end()) {
+        return it->second;
+    }
+    
+    VkDescriptorSetLayout layout = CreateSamplerSetLayout(m_device, samplerCount);
+    if (layout != VK_NULL_HANDLE) {
+        m_setLayouts[samplerCount] = layout;
+    }
+    return layout;
+}
+
+std::string VulkanPipelineRegistry::BuildKey(const GraphicsPipelineDesc& desc) {
+    std::ostringstream key;
+    key << desc.vertShaderPath << '|' << desc.fragShaderPath
+        << "|s" << desc.vertexStride;
+    for (const VertexAttributeDesc& attribute : desc.vertexAttributes) {
+        key << "|a" << attribute.location << ':' << (uint32_t)attribute.format << ':' << attribute.offset;
+    }
+    key << "|i" << desc.instanceStride;
+    for (const VertexAttributeDesc& attribute : desc.instanceAttributes) {
+        key << "|a" << attribute.location << ':' << (uint32_t)attribute.format << ':' << attribute.offset;
+    }
+    key << "|b" << (uint32_t)desc.blendMode
+        << "|p" << desc.pushConstantStages << ':' << desc.pushConstantSize
+        << "|t" << desc.textureSamplerCount
+        << "|r" << desc.renderPass;
+    return key.str();
+}
+
+VkDescriptorSetLayout VulkanPipelineRegistry::CreateSamplerSetLayout(VkDevice device, uint32_t samplerCount) {
+    std::vector<VkDescriptorSetLayoutBinding> bindings(samplerCount);
+    for (uint32_t i = 0; i < samplerCount; i++) {
+        bindings[i] = {};
+        bindings[i].binding = i;
+        bindings[i].descriptorCount = 1;
+        bindings[i].descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+        bindings[i].pImmutableSamplers = nullptr;
+        bindings[i].stageFlags = VK_SHADER_STAGE_FRAGMENT_BIT;
+    }
+    
+    VkDescriptorSetLayoutCreateInfo layoutInfo = {};
+    layoutInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
+    layoutInfo.bindingCount = samplerCount;
+    layoutInfo.pBindings = bindings.data();
+    
+    VkDescriptorSetLayout layout = VK_NULL_HANDLE;
+    if (vkCreateDescriptorSetLayout(device, &layoutInfo, nullptr, &layout) != VK_SUCCESS) {
+        printf("[PIPELINE_REGISTRY] Failed to create descriptor set layout (%u samplers)\n", samplerCount);
+        return VK_NULL_HANDLE;
+    }
+    return layout;
+}
+
+bool VulkanPipelineRegistry::CreatePipeline(VkDevice device, VkPipelineCache pipelineCache, const GraphicsPipelineDesc& desc,
+                                            VkDescriptorSetLayout descriptorSetLayout, VkPipelineLayout& layout, VkPipeline& pipeline) {
+    std::vector<char> vertCode = renderer::shader::ShaderLoader::LoadShaderCode(desc.vertShaderPath, ShaderStage::Vertex);
+    std::vector<char> fragCode = renderer::shader::ShaderLoader::LoadShaderCode(desc.fragShaderPath, ShaderStage::Fragment);
+    if (vertCode.empty() || fragCode.empty()) {
+        printf("[PIPELINE_REGISTRY] Failed to load shaders %s / %s\n", desc.vertShaderPath.c_str(), desc.fragShaderPath.c_str());
+        return false;
+    }
+    
+    VkShaderModule vertShaderModule = static_cast<VkShaderModule>(
+        renderer::shader::ShaderLoader::CreateShaderModuleFromSPIRV(static_cast<DeviceHandle>(device), vertCode));
+    VkShaderModule fragShaderModule = static_cast<VkShaderModule>(
+        renderer::shader::ShaderLoader::CreateShaderModuleFromSPIRV(static_cast<DeviceHandle>(device), fragCode));
+    if (vertShaderModule == VK_NULL_HANDLE || fragShaderModule == VK_NULL_HANDLE) {
+        if (vertShaderModule != VK_NULL_HANDLE) vkDestroyShaderModule(device, vertShaderModule, nullptr);
+        if (fragShaderModule != VK_NULL_HANDLE) vkDestroyShaderModule(device, fragShaderModule, nullptr);
+        printf("[PIPELINE_REGISTRY] Failed to create shader modules for %s / %s\n", desc.vertShaderPath.c_str(), desc.fragShaderPath.c_str());
+        return false;
+    }
+    
+    // Shader阶段
+    VkPipelineShaderStageCreateInfo shaderStages[2] = {};
+    shaderStages[0].sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+    shaderStages[0].stage = VK_SHADER_STAGE_VERTEX_BIT;
+    shaderStages[0].module = vertShaderModule;
+    shaderStages[0].pName = "main";
+    shaderStages[1].sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+    shaderStages[1].stage = VK_SHADER_STAGE_FRAGMENT_BIT;
+    shaderStages[1].module = fragShaderModule;
+    shaderStages[1].pName = "main";
+    
+    // 顶点输入（绑定 0 逐顶点，绑定 1 逐实例）
+    std::vector<VkVertexInputBindingDescription> bindingDescriptions;
+    std::vector<VkVertexInputAttributeDescription> attributeDescriptions;
+    if (desc.vertexStride > 0) {
+        VkVertexInputBindingDescription bindingDescription = {};
+        bindingDescription.binding = 0;
+        bindingDescription.stride = desc.vertexStride;
+        bindingDescription.inputRate = VK_VERTEX_INPUT_RATE_VERTEX;
+        bindingDescriptions.push_back(bindingDescription);
+    }
+    if (desc.instanceStride > 0) {
+        VkVertexInputBindingDescription bindingDescription = {};
+        bindingDescription.binding = 1;
+        bindingDescription.stride = desc.instanceStride;
+        bindingDescription.inputRate = VK_VERTEX_INPUT_RATE_INSTANCE;
+        bindingDescriptions.push_back(bindingDescription);
+    }
+    for (const VertexAttributeDesc& attribute : desc.vertexAttributes) {
+        VkVertexInputAttributeDescription attributeDescription = {};
+        attributeDescription.binding = 0;
+        attributeDescription.location = attribute.location;
+        attributeDescription.format = ToVkFormat(attribute.format);
+        attributeDescription.offset = attribute.offset;
+        attributeDescriptions.push_back(attributeDescription);
+    }
+    for (const VertexAttributeDesc& attribute : desc.instanceAttributes) {
+        VkVertexInputAttributeDescription attributeDescription = {};
+        attributeDescription.binding = 1;
+        attributeDescription.location = attribute.location;
+        attributeDescription.format = ToVkFormat(attribute.format);
+        attributeDescription.offset = attribute.offset;
+        attributeDescriptions.push_back(attributeDescription);
+    }
+    
+    VkPipelineVertexInputStateCreateInfo vertexInputInfo = {};
+    vertexInputInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO;
+    vertexInputInfo.vertexBindingDescriptionCount = (uint32_t)bindingDescriptions.size();
+    vertexInputInfo.pVertexBindingDescriptions = bindingDescriptions.empty() ? nullptr : bindingDescriptions.data();
+    vertexInputInfo.vertexAttributeDescriptionCount = (uint32_t)attributeDescriptions.size();
+    vertexInputInfo.pVertexAttributeDescriptions = attributeDescriptions.empty() ? nullptr : attributeDescriptions.data();
+    
+    // 输入装配
+    VkPipelineInputAssemblyStateCreateInfo inputAssembly = {};
+    inputAssembly.sType = VK_STRUCTURE_TYPE_PIPELINE_INPUT_ASSEMBLY_STATE_CREATE_INFO;
+    inputAssembly.topology = VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
+    inputAssembly.primitiveRestartEnable = VK_FALSE;
+    
+    // 视口（使用动态状态，在渲染时设置）
+    VkPipelineViewportStateCreateInfo viewportState = {};
+    viewportState.sType = VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_STATE_CREATE_INFO;
+    viewportState.viewportCount = 1;
+    viewportState.scissorCount = 1;
+    
+    // 光栅化
+    VkPipelineRasterizationStateCreateInfo rasterizer = {};
+    rasterizer.sType = VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_STATE_CREATE_INFO;
+    rasterizer.depthClampEnable = VK_FALSE;
+    rasterizer.rasterizerDiscardEnable = VK_FALSE;
+    rasterizer.polygonMode = VK_POLYGON_MODE_FILL;
+    rasterizer.lineWidth = 1.0f;
+    rasterizer.cullMode = VK_CULL_MODE_NONE;
+    rasterizer.frontFace = VK_FRONT_FACE_COUNTER_CLOCKWISE;
+    rasterizer.depthBiasEnable = VK_FALSE;
+    
+    // 多重采样
+    VkPipelineMultisampleStateCreateInfo multisampling = {};
+    multisampling.sType = VK_STRUCTURE_TYPE_PIPELINE_MULTISAMPLE_STATE_CREATE_INFO;
+    multisampling.sampleShadingEnable = VK_FALSE;
+    multisampling.rasterizationSamples = VK_SAMPLE_COUNT_1_BIT;
+    
+    // 颜色混合（alpha：resultAlpha = srcAlpha + dstAlpha * (1 - srcAlpha)，透明控件不会清除目标alpha）
+    VkPipelineColorBlendAttachmentState colorBlendAttachment = {};
+    colorBlendAttachment.colorWriteMask = VK_COLOR_COMPONENT_R_BIT | VK_COLOR_COMPONENT_G_BIT |
+                                          VK_COLOR_COMPONENT_B_BIT | VK_COLOR_COMPONENT_A_BIT;
+    if (desc.blendMode == PipelineBlendMode::AlphaBlend) {
+        colorBlendAttachment.blendEnable = VK_TRUE;
+        colorBlendAttachment.srcColorBlendFactor = VK_BLEND_FACTOR_SRC_ALPHA;
+        colorBlendAttachment.dstColorBlendFactor = VK_BLEND_FACTOR_ONE_MINUS_SRC_ALPHA;
+        colorBlendAttachment.colorBlendOp = VK_BLEND_OP_ADD;
+        colorBlendAttachment.srcAlphaBlendFactor = VK_BLEND_FACTOR_ONE;
+        colorBlendAttachment.dstAlphaBlendFactor = VK_BLEND_FACTOR_ONE_MINUS_SRC_ALPHA;
+        colorBlendAttachment.alphaBlendOp = VK_BLEND_OP_ADD;
+    } else {
+        colorBlendAttachment.blendEnable = VK_FALSE;
+    }
+    
+    VkPipelineColorBlendStateCreateInfo colorBlending = {};
+    colorBlending.sType = VK_STRUCTURE_TYPE_PIPELINE_COLOR_BLEND_STATE_CREATE_INFO;
+    colorBlending.logicOpEnable = VK_FALSE;
+    colorBlending.attachmentCount = 1;
+    colorBlending.pAttachments = &colorBlendAttachment;
+    
+    // Dynamic states (viewport and scissor)
+    VkDynamicState dynamicStates[] = {
+        VK_DYNAMIC_STATE_VIEWPORT,
+        VK_DYNAMIC_STATE_SCISSOR
+    };
+    
+    VkPipelineDynamicStateCreateInfo dynamicState = {};
+    dynamicState.sType = VK_STRUCTURE_TYPE_PIPELINE_DYNAMIC_STATE_CREATE_INFO;
+    dynamicState.dynamicStateCount = 2;
+    dynamicState.pDynamicStates = dynamicStates;
+    
+    // 深度测试状态（禁用深度测试，因为渲染通道没有深度附件）
+    VkPipelineDepthStencilStateCreateInfo depthStencil = {};
+    depthStencil.sType = VK_STRUCTURE_TYPE_PIPELINE_DEPTH_STENCIL_STATE_CREATE_INFO;
+    depthStencil.depthTestEnable = VK_FALSE;
+    depthStencil.depthWriteEnable = VK_FALSE;
+    depthStencil.depthCompareOp = VK_COMPARE_OP_ALWAYS;
+    depthStencil.depthBoundsTestEnable = VK_FALSE;
+    depthStencil.stencilTestEnable = VK_FALSE;
+    
+    // Pipeline layout
+    VkPushConstantRange pushConstantRange = {};
+    pushConstantRange.stageFlags = static_cast<VkShaderStageFlags>(desc.pushConstantStages);
+    pushConstantRange.offset = 0;
+    pushConstantRange.size = desc.pushConstantSize;
+    
+    VkPipelineLayoutCreateInfo pipelineLayoutInfo = {};
+    pipelineLayoutInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
+    pipelineLayoutInfo.setLayoutCount = (descriptorSetLayout != VK_NULL_HANDLE) ? 1 : 0;
+    pipelineLayoutInfo.pSetLayouts = (descriptorSetLayout != VK_NULL_HANDLE) ? &descriptorSetLayout : nullptr;
+    pipelineLayoutInfo.pushConstantRangeCount = desc.pushConstantSize > 0 ? 1 : 0;
+    pipelineLayoutInfo.pPushConstantRanges = desc.pushConstantSize > 0 ? &pushConstantRange : nullptr;
+    
+    layout = VK_NULL_HANDLE;
+    if (vkCreatePipelineLayout(device, &pipelineLayoutInfo, nullptr, &layout) != VK_SUCCESS) {
+        vkDestroyShaderModule(device, vertShaderModule, nullptr);
+        vkDestroyShaderModule(device, fragShaderModule, nullptr);
+        printf("[PIPELINE_REGISTRY] Failed to create pipeline layout for %s / %s\n", desc.vertShaderPath.c_str(), desc.fragShaderPath.c_str());
+        layout = VK_NULL_HANDLE;
+        return false;
+    }
+    
+    // 创建管线
+    VkGraphicsPipelineCreateInfo pipelineInfo = {};
+    pipelineInfo.sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO;
+    pipelineInfo.stageCount = 2;
+    pipelineInfo.pStages = shaderStages;
+    pipelineInfo.pVertexInputState = &vertexInputInfo;
+    pipelineInfo.pInputAssemblyState = &inputAssembly;
+    pipelineInfo.pViewportState = &viewportState;
+    pipelineInfo.pRasterizationState = &rasterizer;
+    pipelineInfo.pMultisampleState = &multisampling;
+    pipelineInfo.pDepthStencilState = &depthStencil;
+    pipelineInfo.pColorBlendState = &colorBlending;
+    pipelineInfo.pDynamicState = &dynamicState;
+    pipelineInfo.layout = layout;
+    pipelineInfo.renderPass = static_cast<VkRenderPass>(desc.renderPass);
+    pipelineInfo.subpass = 0;
+    
+    pipeline = VK_NULL_HANDLE;
+    VkResult result = vkCreateGraphicsPipelines(device, pipelineCache, 1, &pipelineInfo, nullptr, &pipeline);
+    
+    vkDestroyShaderModule(device, vertShaderModule, nullptr);
+    vkDestroyShaderModule(device, fragShaderModule, nullptr);
+    
+    if (result != VK_SUCCESS) {
+        printf("[PIPELINE_REGISTRY] Failed to create graphics pipeline for %s / %s: %d\n",
+               desc.vertShaderPath.c_str(), desc.fragShaderPath.c_str(), result);
+        vkDestroyPipelineLayout(device, layout, nullptr);
+        layout = VK_NULL_HANDLE;
+        pipeline = VK_NULL_HANDLE;
+        return false;
+    }
+    
+    return true;
+}
@@ -0,0 +1,129 @@
+#pragma once
+
+#ifdef _WIN32
+#define VK_USE_PLATFORM_WIN32_KHR
+#endif
+#include <vulkan/vulkan.h>  // 3. 第三方库头文件
+
+#include <map>  // 2. 系统头文件
+#include <memory>  // 2. 系统头文件
+#include <mutex>  // 2. 系统头文件
+#include <string>  // 2. 系统头文件
+#include <vector>  // 2. 系统头文件
+#include "core/interfaces/ipipeline_registry.h"  // 4. 项目头文件（接口）
+#include "core/types/render_types.h"  // 4. 项目头文件（类型）
+#include "renderer/vulkan/vulkan_retire_queue.h"  // 4. 项目头文件（Vulkan）
+
+/**
+ * Vulkan 管线注册表 - 实现 IPipelineRegistry 接口
+ * 
+ * 以 GraphicsPipelineDesc 序列化后的字符串为键保存管线条目，条目持有管线和管线布局并记录引用计数。
+ * 描述符集布局按采样器数量共享，生命周期与注册表相同。
+ * 管线在锁外编译，编译期间其他线程的查找不被阻塞；最后一个引用归还后管线先退役，
+ * 渲染器确认引用它的提交完成后（ReleaseRetired）才销毁，控件切换管线变体时不会销毁在途帧仍在使用的管线。
+ * 着色器只在首次创建某条管线时读取，之后相同描述的控件直接复用，启动耗时和显存随控件类型数量增长而非实例数量。
+ * 
+ * 静态辅助函数在注册表为空时退回到每个调用方独立创建管线，供仍可能在无注册表环境下初始化的组件使用。
+ */
+class VulkanPipelineRegistry : public IPipelineRegistry {
+public:
+    VulkanPipelineRegistry();
+    ~VulkanPipelineRegistry();
+    
+    /**
+     * 初始化注册表
+     * 
+     * @param device Vulkan设备句柄
+     * @param pipelineCache 共享管线缓存（可为 VK_NULL_HANDLE）
+     * @return 成功返回 true，失败返回 false
+     */
+    bool Initialize(VkDevice device, VkPipelineCache pipelineCache);
+    
+    /**
+     * 销毁所有管线和描述符集布局（调用前所有控件应已归还引用）
+     */
+    void Cleanup();
+    
+    // IPipelineRegistry 接口实现
+    bool Acquire(const GraphicsPipelineDesc& desc, SharedPipeline& pipeline) override;
+    void Release(SharedPipeline& pipeline) override;
+    PipelineRegistryStats GetStats() const override;
+    
+    /**
+     * 记录最近一次提交的序号（渲染器每次提交帧后调用），用于标记退役管线
+     * 
+     * @param submitSerial 刚提交的帧的序号
+     */
+    void OnFrameSubmitted(uint64_t submitSerial);
+    
+    /**
+     * 销毁已不再被任何提交引用的退役管线（帧栅栏触发后调用）
+     * 
+     * @param completedSerial 已完成的最大提交序号
+     */
+    void ReleaseRetired(uint64_t completedSerial);
+    
+    /**
+     * 获取共享管线（registry 为空时退回到独立创建）
+     * 
+     * @param registry 共享注册表（可为 nullptr）
+     * @param device Vulkan设备句柄（独立创建时使用）
+     * @param pipelineCache 管线缓存（独立创建时使用，可为 VK_NULL_HANDLE）
+     * @param desc 管线描述
+     * @param pipeline 输出共享管线
+     * @return 成功返回 true，失败返回 false
+     */
+    static bool Acquire(IPipelineRegistry* registry, VkDevice device, VkPipelineCache pipelineCache,
+                        const GraphicsPipelineDesc& desc, SharedPipeline& pipeline);
+    
+    /**
+     * 归还管线（经注册表获取的归还引用，独立创建的直接销毁），调用后 pipeline 被重置
+     * 
+     * @param registry 共享注册表（可为 nullptr）
+     * @param device Vulkan设备句柄
+     * @param pipeline 要归还的管线
+     */
+    static void Release(IPipelineRegistry* registry, VkDevice device, SharedPipeline& pipeline);
+
+private:
+    // 禁止拷贝和赋值
+    VulkanPipelineRegistry(const VulkanPipelineRegistry&) = delete;
+    VulkanPipelineRegistry& operator=(const VulkanPipelineRegistry&) = delete;
+    
+    // 注册表条目（一条管线及其布局）
+    struct PipelineEntry {
+        std::string key;
+        VkPipeline pipeline = VK_NULL_HANDLE;
+        VkPipelineLayout layout = VK_NULL_HANDLE;
+        VkDescriptorSetLayout descriptorSetLayout = VK_NULL_HANDLE;  // [BORROW] 由 m_setLayouts 拥有
+        uint32_t refCount = 0;
+    };
+    
+    // 引用归还完毕、等待在途提交完成的管线
+    struct RetiredPipeline {
+        VkPipeline pipeline = VK_NULL_HANDLE;
+        VkPipelineLayout layout = VK_NULL_HANDLE;
+    };
+    
+    VkDescriptorSetLayout GetSamplerSetLayout(uint32_t samplerCount);
+    void DestroyRetired(RetiredPipeline& retired);
+    
+    static void ExportEntry(PipelineEntry& entry, SharedPipeline& pipeline);
+    
+    static std::string BuildKey(const GraphicsPipelineDesc& desc);
+    static VkDescriptorSetLayout CreateSamplerSetLayout(VkDevice device, uint32_t samplerCount);
+    static bool CreatePipeline(VkDevice device, VkPipelineCache pipelineCache, const GraphicsPipelineDesc& desc,
+                               VkDescriptorSetLayout descriptorSetLayout, VkPipelineLayout& layout, VkPipeline& pipeline);
+    
+    VkDevice m_device = VK_NULL_HANDLE;
+    VkPipelineCache m_pipelineCache = VK_NULL_HANDLE;  // [BORROW] 由渲染器拥有
+    
+    std::map<std::string, std::unique_ptr<PipelineEntry>> m_entries;
+    std::map<uint32_t, VkDescriptorSetLayout> m_setLayouts;  // 采样器数量 -> 描述符集布局
+    RetireQueue<RetiredPipeline> m_retiredPipelines;
+    uint64_t m_lastSubmitSerial = 0;  // 最近一次提交的序号
+    uint32_t m_cacheHits = 0;
+    mutable std::mutex m_mutex;  // 保护条目表和退役队列，允许从工作线程获取和归还管线
+    
+    bool m_initialized = false;  // 初始化状态标志，防止重复初始化
+};
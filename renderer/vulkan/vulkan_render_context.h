@@ -1,6 +1,8 @@
 #pragma once
 
+#ifdef _WIN32
 #define VK_USE_PLATFORM_WIN32_KHR
+#endif
 #include <vulkan/vulkan.h>  // 3. 第三方库头文件
 
 #include "core/interfaces/irender_context.h"  // 4. 项目头文件（接口）
@@ -24,19 +26,28 @@ public:
      * @param graphicsQueue Vulkan图形队列句柄
      * @param renderPass Vulkan渲染通道句柄
      * @param swapchainExtent Vulkan交换链尺寸
+     * @param memoryAllocator 共享设备内存分配器（[BORROW] 可为 nullptr）
+     * @param pipelineCache 共享管线缓存（[BORROW] 可为 VK_NULL_HANDLE）
+     * @param pipelineRegistry 共享管线注册表（[BORROW] 可为 nullptr）
      */
     VulkanRenderContext(VkDevice device, 
                        VkPhysicalDevice physicalDevice,
                        VkCommandPool commandPool,
                        VkQueue graphicsQueue,
                        VkRenderPass renderPass,
-                       VkExtent2D swapchainExtent)
+                       VkExtent2D swapchainExtent,
+                       IMemoryAllocator* memoryAllocator = nullptr,
+                       VkPipelineCache pipelineCache = VK_NULL_HANDLE,
+                       IPipelineRegistry* pipelineRegistry = nullptr)
         : m_device(device)
         , m_physicalDevice(physicalDevice)
         , m_commandPool(commandPool)
         , m_graphicsQueue(graphicsQueue)
         , m_renderPass(renderPass)
-        , m_swapchainExtent(swapchainExtent) {}
+        , m_swapchainExtent(swapchainExtent)
+        , m_memoryAllocator(memoryAllocator)
+        , m_pipelineCache(pipelineCache)
+        , m_pipelineRegistry(pipelineRegistry) {}
     
     virtual ~VulkanRenderContext() = default;
     
@@ -100,6 +111,27 @@ public:
      */
     uint32_t FindMemoryType(uint32_t typeFilter, MemoryPropertyFlag properties) const override;
     
+    /**
+     * 获取共享设备内存分配器
+     * 
+     * @return 分配器指针（不拥有所有权，可能为 nullptr）
+     */
+    IMemoryAllocator* GetMemoryAllocator() const override { return m_memoryAllocator; }
+    
+    /**
+     * 获取共享管线缓存
+     * 
+     * @return 管线缓存句柄（抽象类型，可能为 nullptr）
+     */
+    PipelineCacheHandle GetPipelineCache() const override { return static_cast<PipelineCacheHandle>(m_pipelineCache); }
+    
+    /**
+     * 获取共享管线注册表
+     * 
+     * @return 注册表指针（不拥有所有权，可能为 nullptr）
+     */
+    IPipelineRegistry* GetPipelineRegistry() const override { return m_pipelineRegistry; }
+    
 private:
     VkDevice m_device;
     VkPhysicalDevice m_physicalDevice;
@@ -107,5 +139,8 @@ private:
     VkQueue m_graphicsQueue;
     VkRenderPass m_renderPass;
     VkExtent2D m_swapchainExtent;
+    IMemoryAllocator* m_memoryAllocator;  // [BORROW] 由渲染设备拥有
+    VkPipelineCache m_pipelineCache;  // [BORROW] 由渲染设备拥有
+    IPipelineRegistry* m_pipelineRegistry;  // [BORROW] 由渲染设备拥有
 };
 
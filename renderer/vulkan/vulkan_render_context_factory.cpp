@@ -1,6 +1,8 @@
 #include "renderer/vulkan/vulkan_render_context_factory.h"  // 1. 对应头文件
 
+#ifdef _WIN32
 #define VK_USE_PLATFORM_WIN32_KHR
+#endif
 #include <vulkan/vulkan.h>  // 3. 第三方库头文件
 
 #include "core/types/render_types.h"  // 4. 项目头文件（类型）
@@ -16,7 +18,10 @@ std::unique_ptr<IRenderContext> VulkanRenderContextFactory::CreateRenderContext(
     CommandPoolHandle commandPool,
     QueueHandle graphicsQueue,
     RenderPassHandle renderPass,
-    Extent2D swapchainExtent) {
+    Extent2D swapchainExtent,
+    IMemoryAllocator* memoryAllocator,
+    PipelineCacheHandle pipelineCache,
+    IPipelineRegistry* pipelineRegistry) {
     // 将抽象类型转换为 Vulkan 类型（工厂函数内部进行转换，隐藏实现细节）
     return std::make_unique<VulkanRenderContext>(
         static_cast<VkDevice>(device),
@@ -24,7 +29,10 @@ std::unique_ptr<IRenderContext> VulkanRenderContextFactory::CreateRenderContext(
         static_cast<VkCommandPool>(commandPool),
         static_cast<VkQueue>(graphicsQueue),
         static_cast<VkRenderPass>(renderPass),
-        VkExtent2D{ swapchainExtent.width, swapchainExtent.height }
+        VkExtent2D{ swapchainExtent.width, swapchainExtent.height },
+        memoryAllocator,
+        static_cast<VkPipelineCache>(pipelineCache),
+        pipelineRegistry
     );
 }
 
@@ -38,10 +46,13 @@ std::unique_ptr<IRenderContext> CreateVulkanRenderContext(
     CommandPoolHandle commandPool,
     QueueHandle graphicsQueue,
     RenderPassHandle renderPass,
-    Extent2D swapchainExtent) {
+    Extent2D swapchainExtent,
+    IMemoryAllocator* memoryAllocator,
+    PipelineCacheHandle pipelineCache,
+    IPipelineRegistry* pipelineRegistry) {
     static VulkanRenderContextFactory factory;
     return factory.CreateRenderContext(
-        device, physicalDevice, commandPool, graphicsQueue, renderPass, swapchainExtent
+        device, physicalDevice, commandPool, graphicsQueue, renderPass, swapchainExtent, memoryAllocator, pipelineCache, pipelineRegistry
     );
 }
 
@@ -26,6 +26,9 @@ public:
      * @param graphicsQueue 图形队列句柄（抽象类型）
      * @param renderPass 渲染通道句柄（抽象类型）
      * @param swapchainExtent 交换链尺寸（抽象类型）
+     * @param memoryAllocator 共享设备内存分配器（[BORROW] 可为 nullptr）
+     * @param pipelineCache 共享管线缓存（[BORROW] 可为 nullptr）
+     * @param pipelineRegistry 共享管线注册表（[BORROW] 可为 nullptr）
      * @return std::unique_ptr<IRenderContext> 渲染上下文接口指针，调用者获得所有权
      */
     std::unique_ptr<IRenderContext> CreateRenderContext(
@@ -34,7 +37,10 @@ public:
         CommandPoolHandle commandPool,
         QueueHandle graphicsQueue,
         RenderPassHandle renderPass,
-        Extent2D swapchainExtent) override;
+        Extent2D swapchainExtent,
+        IMemoryAllocator* memoryAllocator,
+        PipelineCacheHandle pipelineCache,
+        IPipelineRegistry* pipelineRegistry) override;
 };
 
 /**
@@ -48,6 +54,9 @@ public:
  * @param graphicsQueue 图形队列句柄（抽象类型）
  * @param renderPass 渲染通道句柄（抽象类型）
  * @param swapchainExtent 交换链尺寸（抽象类型）
+ * @param memoryAllocator 共享设备内存分配器（[BORROW] 可选，为 nullptr 时组件退回到独立分配）
+ * @param pipelineCache 共享管线缓存（[BORROW] 可选，为 nullptr 时不使用缓存）
+ * @param pipelineRegistry 共享管线注册表（[BORROW] 可选，为 nullptr 时组件独立创建管线）
  * @return std::unique_ptr<IRenderContext> 渲染上下文接口指针，调用者获得所有权
  */
 std::unique_ptr<IRenderContext> CreateVulkanRenderContext(
@@ -56,4 +65,7 @@ std::unique_ptr<IRenderContext> CreateVulkanRenderContext(
     CommandPoolHandle commandPool,
     QueueHandle graphicsQueue,
     RenderPassHandle renderPass,
-    Extent2D swapchainExtent);
+    Extent2D swapchainExtent,
+    IMemoryAllocator* memoryAllocator = nullptr,
+    PipelineCacheHandle pipelineCache = nullptr,
+    IPipelineRegistry* pipelineRegistry = nullptr);
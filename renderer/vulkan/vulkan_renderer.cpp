@@ -1,13 +1,17 @@
 #include "vulkan/vulkan_renderer.h"  // 1. 对应头文件
 
 #include <algorithm>                 // 2. 系统头文件
+#include <chrono>                    // 2. 系统头文件
 #include <cmath>                     // 2. 系统头文件
+#include <cstddef>                   // 2. 系统头文件
 #include <cstring>                   // 2. 系统头文件
 #include <memory>                    // 2. 系统头文件
 #include <set>                       // 2. 系统头文件
 #include <stdio.h>                   // 2. 系统头文件
 #include <vector>                    // 2. 系统头文件
+#ifdef _WIN32
 #include <windows.h>                 // 2. 系统头文件
+#endif
 
 #include <vulkan/vulkan.h>           // 3. 第三方库头文件
 
@@ -15,16 +19,37 @@
 #include "core/config/stretch_params.h"
 #include "core/types/render_types.h"  // 抽象类型定义
 #include "renderer/vulkan/vulkan_render_context_factory.h"  // Vulkan 渲染上下文工厂
+#include "renderer/vulkan/vulkan_memory_allocator.h"  // Vulkan 设备内存分配器
+#include "renderer/vulkan/vulkan_pipeline_cache.h"  // Vulkan 持久化管线缓存
+#include "renderer/vulkan/vulkan_pipeline_registry.h"  // Vulkan 控件管线注册表
+#include "renderer/vulkan/vulkan_secondary_recorder.h"  // Vulkan 二级命令缓冲区并行录制器
+#include "renderer/vulkan/vulkan_gpu_profiler.h"  // Vulkan GPU 时间戳分析器
+#include "renderer/vulkan/vulkan_cube_rasterizer.h"  // loading_cubes 实例化光栅化
+#include "renderer/vulkan/vulkan_resolution_scaler.h"  // 动态分辨率离屏目标和放大通道
+#include "renderer/vulkan/vulkan_compute_scene.h"  // 全屏场景的计算着色器执行路径
+#include "renderer/vulkan/vulkan_temporal_resolver.h"  // loading_cubes 时间抗锯齿
 #include "core/utils/render_command_buffer.h"  // 在 .cpp 中包含实现
+#include "core/utils/frame_tracer.h"  // CPU 帧阶段追踪
+#include "core/utils/dynamic_resolution.h"  // 动态分辨率控制器
 #include "shader/shader_loader.h"
 #include "texture/texture.h"
 #include "image/image_loader.h"
 #include "loading/loading_animation.h"
 #include "text/text_renderer.h"
 #include "ui/button/button.h"
+#include "ui/quad_batch/ui_quad_batch.h"
 #include "ui/slider/slider.h"
 #include "window/window.h"
 
+namespace {
+
+// 从 start 到现在经过的毫秒数（统计每帧阻塞等待 GPU 和交换链的时长）
+double MillisecondsSince(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+} // namespace
+
 // pimpl 实现细节
 struct VulkanRenderer::Impl {
     std::unique_ptr<RenderCommandBuffer> commandBuffer;
@@ -56,6 +81,9 @@ bool VulkanRenderer::Initialize(HWND hwnd, HINSTANCE hInstance) {
     if (!CreateSurface(hwnd, hInstance)) return false;
     if (!SelectPhysicalDevice()) return false;
     if (!CreateLogicalDevice()) return false;
+    if (!CreateMemoryAllocator()) return false;
+    CreatePipelineCache();
+    if (!CreatePipelineRegistry()) return false;
     if (!CreateSwapchain()) return false;
     if (!CreateImageViews()) return false;
     if (!CreateRenderPass()) return false;
@@ -63,6 +91,57 @@ bool VulkanRenderer::Initialize(HWND hwnd, HINSTANCE hInstance) {
     if (!CreateCommandPool()) return false;
     if (!CreateCommandBuffers()) return false;
     if (!CreateSyncObjects()) return false;
+    if (!CreateSceneUniforms()) return false;
+    CreateUIQuadBatch();
+    CreateSecondaryRecorder();
+    CreateGpuProfiler();
+    CreateCubeRasterizer();
+    CreateResolutionScaler();
+    CreateComputeScene();
+    CreateTemporalResolver();
+    
+    m_initialized = true;
+    return true;
+}
+
+bool VulkanRenderer::InitializeHeadless(uint32_t width, uint32_t height) {
+    if (m_initialized) {
+        return true;  // 已初始化，直接返回
+    }
+    
+    if (width == 0 || height == 0) {
+        printf("[HEADLESS] Invalid offscreen target size: %ux%u\n", width, height);
+        return false;
+    }
+    
+    m_headless = true;
+    m_hwnd = nullptr;
+    m_swapchainExtent = { width, height };
+    
+    // 与Initialize相同的创建顺序，以离屏目标替代表面和交换链
+    if (!CreateInstance()) return false;
+    if (!SelectPhysicalDevice()) return false;
+    if (!CreateLogicalDevice()) return false;
+    if (!CreateMemoryAllocator()) return false;
+    CreatePipelineCache();
+    if (!CreatePipelineRegistry()) return false;
+    if (!CreateOffscreenTargets()) return false;
+    if (!CreateImageViews()) return false;
+    if (!CreateRenderPass()) return false;
+    if (!CreateFramebuffers()) return false;
+    if (!CreateCommandPool()) return false;
+    if (!CreateCommandBuffers()) return false;
+    if (!CreateSyncObjects()) return false;
+    if (!CreateSceneUniforms()) return false;
+    CreateUIQuadBatch();
+    CreateSecondaryRecorder();
+    CreateGpuProfiler();
+    CreateCubeRasterizer();
+    CreateResolutionScaler();
+    CreateComputeScene();
+    CreateTemporalResolver();
+    
+    printf("[HEADLESS] Offscreen render targets created: %u x %ux%u\n", m_swapchainImageCount, width, height);
     
     m_initialized = true;
     return true;
@@ -73,6 +152,11 @@ void VulkanRenderer::Cleanup() {
         return;  // 未初始化，无需清理
     }
     
+    // 等待场景管线预编译线程结束（线程使用设备和渲染通道）
+    if (m_scenePipelineThread.joinable()) {
+        m_scenePipelineThread.join();
+    }
+    
     if (m_device != VK_NULL_HANDLE) {
         VkResult result = vkDeviceWaitIdle(m_device);
         if (result != VK_SUCCESS) {
@@ -93,6 +177,18 @@ void VulkanRenderer::Cleanup() {
         }
     }
     
+    // 销毁时间戳查询池并关闭CSV文件
+    if (m_gpuProfiler) {
+        m_gpuProfiler->Cleanup();
+        m_gpuProfiler.reset();
+    }
+    
+    // 结束录制线程并销毁二级命令缓冲区的命令池
+    if (m_secondaryRecorder) {
+        m_secondaryRecorder->Cleanup();
+        m_secondaryRecorder.reset();
+    }
+    
     // 清理命令池
     if (m_commandPool != VK_NULL_HANDLE) {
         vkDestroyCommandPool(m_device, m_commandPool, nullptr);
@@ -102,6 +198,12 @@ void VulkanRenderer::Cleanup() {
     // 清理背景纹理
     CleanupBackgroundTexture();
     
+    // 清理UI批量渲染器（归还共享管线）
+    if (m_uiQuadBatch) {
+        m_uiQuadBatch->Cleanup();
+        m_uiQuadBatch.reset();
+    }
+    
     // 清理图形管线
     if (m_graphicsPipeline != VK_NULL_HANDLE) {
         vkDestroyPipeline(m_device, m_graphicsPipeline, nullptr);
@@ -119,11 +221,26 @@ void VulkanRenderer::Cleanup() {
         m_loadingCubesPipeline = VK_NULL_HANDLE;
     }
     
+    if (m_loadingCubesCullPipeline != VK_NULL_HANDLE) {
+        vkDestroyPipeline(m_device, m_loadingCubesCullPipeline, nullptr);
+        m_loadingCubesCullPipeline = VK_NULL_HANDLE;
+    }
+    
     if (m_loadingCubesPipelineLayout != VK_NULL_HANDLE) {
         vkDestroyPipelineLayout(m_device, m_loadingCubesPipelineLayout, nullptr);
         m_loadingCubesPipelineLayout = VK_NULL_HANDLE;
     }
     
+    m_shaderPipelineState.store(ScenePipelineState::NotStarted);
+    m_loadingCubesPipelineState.store(ScenePipelineState::NotStarted);
+    m_shaderPipelineError.clear();
+    m_loadingCubesPipelineError.clear();
+    m_scenePipelineErrorsReported[0] = false;
+    m_scenePipelineErrorsReported[1] = false;
+    
+    // 清理场景参数统一缓冲区（管线布局已销毁）
+    CleanupSceneUniforms();
+    
     // 清理光线追踪管线
     if (m_rayTracingPipeline != VK_NULL_HANDLE) {
         vkDestroyPipeline(m_device, m_rayTracingPipeline, nullptr);
@@ -140,7 +257,59 @@ void VulkanRenderer::Cleanup() {
         m_rayTracingDescriptorSetLayout = VK_NULL_HANDLE;
     }
     
+    // 光栅化立方体的帧缓冲引用交换链图像视图，先于交换链销毁
+    if (m_cubeRasterizer) {
+        m_cubeRasterizer->Cleanup();
+        m_cubeRasterizer.reset();
+    }
+    
+    if (m_resolutionScaler) {
+        m_resolutionScaler->Cleanup();
+        m_resolutionScaler.reset();
+    }
+    m_resolutionController.reset();
+    
+    if (m_computeScene) {
+        m_computeScene->Cleanup();
+        m_computeScene.reset();
+    }
+    
+    if (m_temporalResolver) {
+        m_temporalResolver->Cleanup();
+        m_temporalResolver.reset();
+    }
+    
+    if (m_renderPassLoad != VK_NULL_HANDLE) {
+        vkDestroyRenderPass(m_device, m_renderPassLoad, nullptr);
+        m_renderPassLoad = VK_NULL_HANDLE;
+    }
+    
     CleanupSwapchain();
+    ReleaseRetiredSwapchains(true);
+    
+    // 销毁控件管线注册表（所有控件已归还管线）
+    if (m_pipelineRegistry) {
+        PipelineRegistryStats stats = m_pipelineRegistry->GetStats();
+        printf("[PIPELINE_REGISTRY] Registry at shutdown: %u pipelines, %u references, %u cache hits\n",
+               stats.pipelineCount, stats.referenceCount, stats.cacheHits);
+        m_pipelineRegistry->Cleanup();
+        m_pipelineRegistry.reset();
+    }
+    
+    // 保存并销毁管线缓存（所有组件的管线已在此之前创建完毕）
+    if (m_pipelineCache) {
+        m_pipelineCache->Cleanup();
+        m_pipelineCache.reset();
+    }
+    
+    // 清理设备内存分配器（所有组件已归还内存，此处释放剩余内存块）
+    if (m_memoryAllocator) {
+        MemoryAllocatorStats stats = m_memoryAllocator->GetStats();
+        printf("[MEMORY] Allocator at shutdown: %u blocks, %u dedicated, %u live allocations\n",
+               stats.blockCount, stats.dedicatedCount, stats.allocationCount);
+        m_memoryAllocator->Cleanup();
+        m_memoryAllocator.reset();
+    }
     
     // 清理设备
     if (m_device != VK_NULL_HANDLE) {
@@ -160,6 +329,7 @@ void VulkanRenderer::Cleanup() {
         m_instance = VK_NULL_HANDLE;
     }
     
+    m_headless = false;
     m_initialized = false;
 }
 
@@ -172,16 +342,20 @@ bool VulkanRenderer::CreateInstance() {
     appInfo.engineVersion = VK_MAKE_VERSION(1, 0, 0);
     appInfo.apiVersion = VK_API_VERSION_1_0;
     
-    std::vector<const char*> extensions = {
-        VK_KHR_SURFACE_EXTENSION_NAME,
-        VK_KHR_WIN32_SURFACE_EXTENSION_NAME
-    };
+    // headless模式不创建表面，不需要任何窗口系统扩展
+    std::vector<const char*> extensions;
+    if (!m_headless) {
+        extensions.push_back(VK_KHR_SURFACE_EXTENSION_NAME);
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+        extensions.push_back(VK_KHR_WIN32_SURFACE_EXTENSION_NAME);
+#endif
+    }
     
     VkInstanceCreateInfo createInfo = {};
     createInfo.sType = VK_STRUCTURE_TYPE_INSTANCE_CREATE_INFO;
     createInfo.pApplicationInfo = &appInfo;
     createInfo.enabledExtensionCount = extensions.size();
-    createInfo.ppEnabledExtensionNames = extensions.data();
+    createInfo.ppEnabledExtensionNames = extensions.empty() ? nullptr : extensions.data();
     
     VkResult result = vkCreateInstance(&createInfo, nullptr, &m_instance);
     if (result != VK_SUCCESS) {
@@ -193,6 +367,7 @@ bool VulkanRenderer::CreateInstance() {
 }
 
 bool VulkanRenderer::CreateSurface(HWND hwnd, HINSTANCE hInstance) {
+#ifdef VK_USE_PLATFORM_WIN32_KHR
     VkWin32SurfaceCreateInfoKHR surfaceCreateInfo = {};
     surfaceCreateInfo.sType = VK_STRUCTURE_TYPE_WIN32_SURFACE_CREATE_INFO_KHR;
     surfaceCreateInfo.hwnd = hwnd;
@@ -205,6 +380,23 @@ bool VulkanRenderer::CreateSurface(HWND hwnd, HINSTANCE hInstance) {
     }
     
     return true;
+#else
+    // 其他平台只支持headless模式（InitializeHeadless），没有窗口表面实现
+    (void)hwnd;
+    (void)hInstance;
+    Window::ShowError("Window surfaces are only supported on Windows, use headless mode on this platform");
+    return false;
+#endif
+}
+
+VkExtent2D VulkanRenderer::GetWindowClientExtent() const {
+#ifdef _WIN32
+    RECT clientRect;
+    GetClientRect(m_hwnd, &clientRect);
+    return { (uint32_t)(clientRect.right - clientRect.left), (uint32_t)(clientRect.bottom - clientRect.top) };
+#else
+    return m_swapchainExtent;
+#endif
 }
 
 bool VulkanRenderer::SelectPhysicalDevice() {
@@ -237,6 +429,15 @@ bool VulkanRenderer::CreateLogicalDevice() {
             m_graphicsQueueFamily = i;
         }
         
+        // headless模式不呈现，呈现队列与图形队列相同
+        if (m_headless) {
+            m_presentQueueFamily = m_graphicsQueueFamily;
+            if (m_graphicsQueueFamily != UINT32_MAX) {
+                break;
+            }
+            continue;
+        }
+        
         VkBool32 presentSupport = false;
         vkGetPhysicalDeviceSurfaceSupportKHR(m_physicalDevice, i, m_surface, &presentSupport);
         if (presentSupport) {
@@ -268,7 +469,10 @@ bool VulkanRenderer::CreateLogicalDevice() {
     }
     
     // 检查并启用光线追踪扩展
-    std::vector<const char*> deviceExtensions = { VK_KHR_SWAPCHAIN_EXTENSION_NAME };
+    std::vector<const char*> deviceExtensions;
+    if (!m_headless) {
+        deviceExtensions.push_back(VK_KHR_SWAPCHAIN_EXTENSION_NAME);
+    }
     
     // 检查光线追踪支持
     m_rayTracingSupported = CheckRayTracingSupport();
@@ -288,7 +492,7 @@ bool VulkanRenderer::CreateLogicalDevice() {
     deviceCreateInfo.sType = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO;
     deviceCreateInfo.pQueueCreateInfos = queueCreateInfos.data();
     deviceCreateInfo.queueCreateInfoCount = queueCreateInfos.size();
-    deviceCreateInfo.ppEnabledExtensionNames = deviceExtensions.data();
+    deviceCreateInfo.ppEnabledExtensionNames = deviceExtensions.empty() ? nullptr : deviceExtensions.data();
     deviceCreateInfo.enabledExtensionCount = deviceExtensions.size();
     
     VkResult result = vkCreateDevice(m_physicalDevice, &deviceCreateInfo, nullptr, &m_device);
@@ -303,7 +507,7 @@ bool VulkanRenderer::CreateLogicalDevice() {
     return true;
 }
 
-bool VulkanRenderer::CreateSwapchain() {
+bool VulkanRenderer::CreateSwapchain(VkSwapchainKHR oldSwapchain) {
     VkSurfaceCapabilitiesKHR capabilities;
     vkGetPhysicalDeviceSurfaceCapabilitiesKHR(m_physicalDevice, m_surface, &capabilities);
     
@@ -344,8 +548,10 @@ bool VulkanRenderer::CreateSwapchain() {
     
     swapchainCreateInfo.preTransform = capabilities.currentTransform;
     swapchainCreateInfo.compositeAlpha = VK_COMPOSITE_ALPHA_OPAQUE_BIT_KHR;
-    swapchainCreateInfo.presentMode = VK_PRESENT_MODE_FIFO_KHR;
+    swapchainCreateInfo.presentMode = ChoosePresentMode();
     swapchainCreateInfo.clipped = VK_TRUE;
+    // 交接旧交换链：呈现引擎可以复用其资源，旧交换链已获取的图像仍可继续呈现
+    swapchainCreateInfo.oldSwapchain = oldSwapchain;
     
     VkResult result = vkCreateSwapchainKHR(m_device, &swapchainCreateInfo, nullptr, &m_swapchain);
     if (result != VK_SUCCESS) {
@@ -360,6 +566,185 @@ bool VulkanRenderer::CreateSwapchain() {
     return true;
 }
 
+VkPresentModeKHR VulkanRenderer::ChoosePresentMode() const {
+    // FIFO 是所有实现都必须支持的模式
+    if (m_framePacingMode == FramePacingMode::VSync) {
+        return VK_PRESENT_MODE_FIFO_KHR;
+    }
+    
+    uint32_t presentModeCount = 0;
+    vkGetPhysicalDeviceSurfacePresentModesKHR(m_physicalDevice, m_surface, &presentModeCount, nullptr);
+    std::vector<VkPresentModeKHR> presentModes(presentModeCount);
+    vkGetPhysicalDeviceSurfacePresentModesKHR(m_physicalDevice, m_surface, &presentModeCount, presentModes.data());
+    
+    auto isSupported = [&presentModes](VkPresentModeKHR mode) {
+        return std::find(presentModes.begin(), presentModes.end(), mode) != presentModes.end();
+    };
+    
+    // 低延迟模式优先 MAILBOX（不撕裂）；限帧模式由帧节奏器控制帧率，优先 IMMEDIATE 避免呈现队列阻塞
+    const VkPresentModeKHR lowLatencyOrder[] = { VK_PRESENT_MODE_MAILBOX_KHR, VK_PRESENT_MODE_IMMEDIATE_KHR };
+    const VkPresentModeKHR cappedOrder[] = { VK_PRESENT_MODE_IMMEDIATE_KHR, VK_PRESENT_MODE_MAILBOX_KHR };
+    const VkPresentModeKHR* order = (m_framePacingMode == FramePacingMode::LowLatency) ? lowLatencyOrder : cappedOrder;
+    for (int i = 0; i < 2; i++) {
+        if (isSupported(order[i])) {
+            return order[i];
+        }
+    }
+    
+    printf("[SWAPCHAIN] Requested present mode not supported, falling back to FIFO\n");
+    return VK_PRESENT_MODE_FIFO_KHR;
+}
+
+bool VulkanRenderer::CreateOffscreenTargets() {
+    // 使用与帧并发数相同的图像数量，每个帧槽位独占一个渲染目标
+    m_swapchainImageFormat = VK_FORMAT_R8G8B8A8_UNORM;
+    m_swapchainImageCount = config::MAX_FRAMES_IN_FLIGHT;
+    m_swapchainImages.assign(m_swapchainImageCount, VK_NULL_HANDLE);
+    m_offscreenImageAllocations.assign(m_swapchainImageCount, MemoryAllocation());
+    
+    for (uint32_t i = 0; i < m_swapchainImageCount; i++) {
+        VkImageCreateInfo imageInfo = {};
+        imageInfo.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
+        imageInfo.imageType = VK_IMAGE_TYPE_2D;
+        imageInfo.format = m_swapchainImageFormat;
+        imageInfo.extent.width = m_swapchainExtent.width;
+        imageInfo.extent.height = m_swapchainExtent.height;
+        imageInfo.extent.depth = 1;
+        imageInfo.mipLevels = 1;
+        imageInfo.arrayLayers = 1;
+        imageInfo.samples = VK_SAMPLE_COUNT_1_BIT;
+        imageInfo.tiling = VK_IMAGE_TILING_OPTIMAL;
+        // TRANSFER_SRC 允许后续将渲染结果复制回主机内存
+        imageInfo.usage = VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | VK_IMAGE_USAGE_TRANSFER_SRC_BIT;
+        imageInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+        imageInfo.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+        
+        VkResult result = vkCreateImage(m_device, &imageInfo, nullptr, &m_swapchainImages[i]);
+        if (result != VK_SUCCESS) {
+            printf("[HEADLESS] Failed to create offscreen image %u: %d\n", i, result);
+            return false;
+        }
+        
+        if (!m_memoryAllocator->AllocateImageMemory(static_cast<ImageHandle>(m_swapchainImages[i]),
+                                                    MemoryPropertyFlag::DeviceLocal, m_offscreenImageAllocations[i])) {
+            printf("[HEADLESS] Failed to allocate offscreen image memory\n");
+            return false;
+        }
+    }
+    
+    return true;
+}
+
+bool VulkanRenderer::CreateMemoryAllocator() {
+    m_memoryAllocator = std::make_unique<VulkanMemoryAllocator>();
+    if (!m_memoryAllocator->Initialize(m_device, m_physicalDevice)) {
+        Window::ShowError("Failed to create device memory allocator!");
+        m_memoryAllocator.reset();
+        return false;
+    }
+    
+    return true;
+}
+
+IMemoryAllocator* VulkanRenderer::GetMemoryAllocator() const {
+    return m_memoryAllocator.get();
+}
+
+void VulkanRenderer::CreatePipelineCache() {
+    // 管线缓存只影响启动速度，创建失败时以 VK_NULL_HANDLE 继续
+    m_pipelineCache = std::make_unique<VulkanPipelineCache>();
+    if (!m_pipelineCache->Initialize(m_device, m_physicalDevice, config::PIPELINE_CACHE_FILE_PATH)) {
+        printf("[PIPELINE_CACHE] Pipeline cache unavailable, pipelines will be compiled without cache\n");
+        m_pipelineCache.reset();
+    }
+}
+
+PipelineCacheHandle VulkanRenderer::GetPipelineCache() const {
+    return m_pipelineCache ? static_cast<PipelineCacheHandle>(m_pipelineCache->GetHandle()) : nullptr;
+}
+
+bool VulkanRenderer::CreatePipelineRegistry() {
+    m_pipelineRegistry = std::make_unique<VulkanPipelineRegistry>();
+    if (!m_pipelineRegistry->Initialize(m_device, static_cast<VkPipelineCache>(GetPipelineCache()))) {
+        Window::ShowError("Failed to create pipeline registry!");
+        m_pipelineRegistry.reset();
+        return false;
+    }
+    
+    return true;
+}
+
+IPipelineRegistry* VulkanRenderer::GetPipelineRegistry() const {
+    return m_pipelineRegistry.get();
+}
+
+void VulkanRenderer::CreateUIQuadBatch() {
+    // 批量渲染只影响CPU录制开销，创建失败（如缺少着色器）时退回到逐控件渲染
+    std::unique_ptr<IRenderContext> renderContext(CreateVulkanRenderContext(
+        static_cast<DeviceHandle>(m_device),
+        static_cast<PhysicalDeviceHandle>(m_physicalDevice),
+        static_cast<CommandPoolHandle>(m_commandPool),
+        static_cast<QueueHandle>(m_graphicsQueue),
+        static_cast<RenderPassHandle>(m_renderPass),
+        Extent2D(m_swapchainExtent.width, m_swapchainExtent.height),
+        m_memoryAllocator.get(),
+        GetPipelineCache(),
+        m_pipelineRegistry.get()
+    ));
+    
+    m_uiQuadBatch = std::make_unique<UIQuadBatch>();
+    if (!renderContext || !m_uiQuadBatch->Initialize(renderContext.get(), config::MAX_FRAMES_IN_FLIGHT)) {
+        printf("[UI_BATCH] UI quad batch unavailable, widgets will be rendered individually\n");
+        m_uiQuadBatch.reset();
+    }
+}
+
+void VulkanRenderer::CreateSecondaryRecorder() {
+    // 调用线程也录制一个通道，工作线程数不超过其余CPU核心数；单核时并行录制没有收益
+    unsigned int hardwareThreads = std::thread::hardware_concurrency();
+    uint32_t workerCount = hardwareThreads > 1 ? (std::min)(hardwareThreads - 1, config::PARALLEL_RECORD_MAX_WORKERS) : 0;
+    if (workerCount == 0) {
+        printf("[SECONDARY_RECORDER] Single core system, UI passes will be recorded inline\n");
+        return;
+    }
+    
+    m_secondaryRecorder = std::make_unique<VulkanSecondaryRecorder>();
+    if (!m_secondaryRecorder->Initialize(m_device, m_graphicsQueueFamily, config::MAX_FRAMES_IN_FLIGHT, workerCount)) {
+        printf("[SECONDARY_RECORDER] Parallel recording unavailable, UI passes will be recorded inline\n");
+        m_secondaryRecorder.reset();
+    }
+}
+
+void VulkanRenderer::CreateGpuProfiler() {
+    // 动态分辨率也依赖时间戳读回的GPU帧耗时，此时只在启用分析器时生成叠加文本
+    if (!m_gpuProfilerEnabled && !m_dynamicResolutionEnabled) {
+        return;
+    }
+    
+    // 分析器只用于诊断，队列不支持时间戳或创建失败时继续渲染
+    m_gpuProfiler = std::make_unique<VulkanGpuProfiler>();
+    if (!m_gpuProfiler->Initialize(m_device, m_physicalDevice, m_graphicsQueueFamily, m_swapchainImageCount, m_gpuProfilerCsvPath)) {
+        printf("[GPU_PROFILER] GPU profiler unavailable\n");
+        m_gpuProfiler.reset();
+        return;
+    }
+    m_gpuProfiler->SetOverlayEnabled(m_gpuProfilerEnabled);
+}
+
+void VulkanRenderer::CreateCubeRasterizer() {
+    // 光栅化路径只是 loading_cubes 的可选渲染方式，创建失败时继续使用光线投射
+    if (!CreateLoadRenderPass()) {
+        printf("[CUBE_RASTER] Failed to create load render pass, raster cubes unavailable\n");
+        return;
+    }
+    
+    m_cubeRasterizer = std::make_unique<VulkanCubeRasterizer>();
+    if (!m_cubeRasterizer->Initialize(m_device, m_physicalDevice, m_memoryAllocator.get(), m_swapchainImageFormat)) {
+        printf("[CUBE_RASTER] Cube rasterizer unavailable, loading cubes will be ray cast\n");
+        m_cubeRasterizer.reset();
+    }
+}
+
 bool VulkanRenderer::CreateImageViews() {
     m_swapchainImageViews.resize(m_swapchainImageCount);
     for (uint32_t i = 0; i < m_swapchainImageCount; i++) {
@@ -397,7 +782,8 @@ bool VulkanRenderer::CreateRenderPass() {
     colorAttachment.stencilLoadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
     colorAttachment.stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
     colorAttachment.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
-    colorAttachment.finalLayout = VK_IMAGE_LAYOUT_PRESENT_SRC_KHR;
+    // headless模式没有交换链扩展，PRESENT_SRC布局不可用，改为可供复制读回的布局
+    colorAttachment.finalLayout = m_headless ? VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL : VK_IMAGE_LAYOUT_PRESENT_SRC_KHR;
     
     VkAttachmentReference colorAttachmentRef = {};
     colorAttachmentRef.attachment = 0;
@@ -424,16 +810,61 @@ bool VulkanRenderer::CreateRenderPass() {
     return true;
 }
 
+bool VulkanRenderer::CreateLoadRenderPass() {
+    // 与 m_renderPass 只有加载操作和初始布局不同（渲染通道兼容），可直接使用交换链帧缓冲和所有已创建的管线
+    VkAttachmentDescription colorAttachment = {};
+    colorAttachment.format = m_swapchainImageFormat;
+    colorAttachment.samples = VK_SAMPLE_COUNT_1_BIT;
+    colorAttachment.loadOp = VK_ATTACHMENT_LOAD_OP_LOAD;
+    colorAttachment.storeOp = VK_ATTACHMENT_STORE_OP_STORE;
+    colorAttachment.stencilLoadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
+    colorAttachment.stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
+    colorAttachment.initialLayout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
+    colorAttachment.finalLayout = m_headless ? VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL : VK_IMAGE_LAYOUT_PRESENT_SRC_KHR;
+    
+    VkAttachmentReference colorAttachmentRef = {};
+    colorAttachmentRef.attachment = 0;
+    colorAttachmentRef.layout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
+    
+    VkSubpassDescription subpass = {};
+    subpass.pipelineBindPoint = VK_PIPELINE_BIND_POINT_GRAPHICS;
+    subpass.colorAttachmentCount = 1;
+    subpass.pColorAttachments = &colorAttachmentRef;
+    
+    // 前一个渲染通道（光栅化立方体的多重采样解析）写入的内容在本通道读取和混合之前可见
+    VkSubpassDependency dependency = {};
+    dependency.srcSubpass = VK_SUBPASS_EXTERNAL;
+    dependency.dstSubpass = 0;
+    dependency.srcStageMask = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
+    dependency.srcAccessMask = VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT;
+    dependency.dstStageMask = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
+    dependency.dstAccessMask = VK_ACCESS_COLOR_ATTACHMENT_READ_BIT | VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT;
+    
+    VkRenderPassCreateInfo renderPassInfo = {};
+    renderPassInfo.sType = VK_STRUCTURE_TYPE_RENDER_PASS_CREATE_INFO;
+    renderPassInfo.attachmentCount = 1;
+    renderPassInfo.pAttachments = &colorAttachment;
+    renderPassInfo.subpassCount = 1;
+    renderPassInfo.pSubpasses = &subpass;
+    renderPassInfo.dependencyCount = 1;
+    renderPassInfo.pDependencies = &dependency;
+    
+    return vkCreateRenderPass(m_device, &renderPassInfo, nullptr, &m_renderPassLoad) == VK_SUCCESS;
+}
+
 bool VulkanRenderer::CreateGraphicsPipeline(const std::string& vertShaderPath, const std::string& fragShaderPath) {
+    // 已发布或已创建时不重建，否则会覆盖并泄漏预编译线程创建的管线布局和管线
+    if (m_shaderPipelineState.load(std::memory_order_acquire) == ScenePipelineState::Ready ||
+        m_pipelineLayout != VK_NULL_HANDLE) {
+        return m_graphicsPipeline != VK_NULL_HANDLE;
+    }
+    
     // 创建管道布局
+    // 场景参数（time + aspect）通过统一缓冲区传入，不使用推送常量
     VkPipelineLayoutCreateInfo pipelineLayoutInfo = {};
     pipelineLayoutInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
-    VkPushConstantRange pushConstantRange = {};
-    pushConstantRange.stageFlags = VK_SHADER_STAGE_FRAGMENT_BIT;
-    pushConstantRange.offset = 0;
-    pushConstantRange.size = sizeof(float) * 2; // time + aspect
-    pipelineLayoutInfo.pushConstantRangeCount = 1;
-    pipelineLayoutInfo.pPushConstantRanges = &pushConstantRange;
+    pipelineLayoutInfo.setLayoutCount = 1;
+    pipelineLayoutInfo.pSetLayouts = &m_sceneDescriptorSetLayout;
     
     VkResult result = vkCreatePipelineLayout(m_device, &pipelineLayoutInfo, nullptr, &m_pipelineLayout);
     if (result != VK_SUCCESS) {
@@ -442,24 +873,8 @@ bool VulkanRenderer::CreateGraphicsPipeline(const std::string& vertShaderPath, c
     }
     
     // 加载shader（支持SPIR-V文件或GLSL文件）
-    std::vector<char> vertShaderCode;
-    std::vector<char> fragShaderCode;
-    
-    // 尝试加载SPIR-V文件或编译GLSL文件
-    size_t vertExtPos = vertShaderPath.find_last_of('.');
-    if (vertExtPos != std::string::npos && vertShaderPath.substr(vertExtPos) == ".spv") {
-        vertShaderCode = renderer::shader::ShaderLoader::LoadSPIRV(vertShaderPath);
-    } else {
-        // 尝试从GLSL编译
-        vertShaderCode = renderer::shader::ShaderLoader::CompileGLSLFromFile(vertShaderPath, ShaderStage::Vertex);
-    }
-    
-    size_t fragExtPos = fragShaderPath.find_last_of('.');
-    if (fragExtPos != std::string::npos && fragShaderPath.substr(fragExtPos) == ".spv") {
-        fragShaderCode = renderer::shader::ShaderLoader::LoadSPIRV(fragShaderPath);
-    } else {
-        fragShaderCode = renderer::shader::ShaderLoader::CompileGLSLFromFile(fragShaderPath, ShaderStage::Fragment);
-    }
+    std::vector<char> vertShaderCode = renderer::shader::ShaderLoader::LoadShaderCode(vertShaderPath, ShaderStage::Vertex);
+    std::vector<char> fragShaderCode = renderer::shader::ShaderLoader::LoadShaderCode(fragShaderPath, ShaderStage::Fragment);
     
     if (vertShaderCode.empty() || fragShaderCode.empty()) {
         Window::ShowError("Failed to load shaders! Make sure " + vertShaderPath + " and " + fragShaderPath + " exist.");
@@ -575,7 +990,7 @@ bool VulkanRenderer::CreateGraphicsPipeline(const std::string& vertShaderPath, c
     pipelineInfo.renderPass = m_renderPass;
     pipelineInfo.subpass = 0;
     
-    result = vkCreateGraphicsPipelines(m_device, VK_NULL_HANDLE, 1, &pipelineInfo, nullptr, &m_graphicsPipeline);
+    result = vkCreateGraphicsPipelines(m_device, static_cast<VkPipelineCache>(GetPipelineCache()), 1, &pipelineInfo, nullptr, &m_graphicsPipeline);
     
     // 清理shader模块
     vkDestroyShaderModule(m_device, fragShaderModule, nullptr);
@@ -586,19 +1001,28 @@ bool VulkanRenderer::CreateGraphicsPipeline(const std::string& vertShaderPath, c
         return false;
     }
     
+    // 计算管线变体随 Ready 发布；创建失败时 F7 / --scene=compute 退回到图形管线
+    if (m_computeScene && !CreateDefaultComputeScenePipeline(ScenePipelineType::Shader)) {
+        printf("[PIPELINE] Shader compute variant unavailable, scene will use the graphics pipeline\n");
+    }
+    
+    m_shaderPipelineState.store(ScenePipelineState::Ready, std::memory_order_release);
     return true;
 }
 
 bool VulkanRenderer::CreateLoadingCubesPipeline(const std::string& vertShaderPath, const std::string& fragShaderPath) {
+    // 已发布或已创建时不重建（同 CreateGraphicsPipeline）
+    if (m_loadingCubesPipelineState.load(std::memory_order_acquire) == ScenePipelineState::Ready ||
+        m_loadingCubesPipelineLayout != VK_NULL_HANDLE) {
+        return m_loadingCubesPipeline != VK_NULL_HANDLE;
+    }
+    
     // 创建管道布局（与主pipeline相同）
+    // 场景参数（time + aspect + 相机姿态）通过统一缓冲区传入
     VkPipelineLayoutCreateInfo pipelineLayoutInfo = {};
     pipelineLayoutInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
-    VkPushConstantRange pushConstantRange = {};
-    pushConstantRange.stageFlags = VK_SHADER_STAGE_FRAGMENT_BIT;
-    pushConstantRange.offset = 0;
-    pushConstantRange.size = sizeof(float) * 7; // time + aspect + cameraYaw + cameraPitch + cameraPosX + cameraPosY + cameraPosZ
-    pipelineLayoutInfo.pushConstantRangeCount = 1;
-    pipelineLayoutInfo.pPushConstantRanges = &pushConstantRange;
+    pipelineLayoutInfo.setLayoutCount = 1;
+    pipelineLayoutInfo.pSetLayouts = &m_sceneDescriptorSetLayout;
     
     VkResult result = vkCreatePipelineLayout(m_device, &pipelineLayoutInfo, nullptr, &m_loadingCubesPipelineLayout);
     if (result != VK_SUCCESS) {
@@ -607,24 +1031,8 @@ bool VulkanRenderer::CreateLoadingCubesPipeline(const std::string& vertShaderPat
     }
     
     // 加载shader（支持SPIR-V文件或GLSL文件）
-    std::vector<char> vertShaderCode;
-    std::vector<char> fragShaderCode;
-    
-    // 尝试加载SPIR-V文件或编译GLSL文件
-    size_t vertExtPos = vertShaderPath.find_last_of('.');
-    if (vertExtPos != std::string::npos && vertShaderPath.substr(vertExtPos) == ".spv") {
-        vertShaderCode = renderer::shader::ShaderLoader::LoadSPIRV(vertShaderPath);
-    } else {
-        // 尝试从GLSL编译
-        vertShaderCode = renderer::shader::ShaderLoader::CompileGLSLFromFile(vertShaderPath, ShaderStage::Vertex);
-    }
-    
-    size_t fragExtPos = fragShaderPath.find_last_of('.');
-    if (fragExtPos != std::string::npos && fragShaderPath.substr(fragExtPos) == ".spv") {
-        fragShaderCode = renderer::shader::ShaderLoader::LoadSPIRV(fragShaderPath);
-    } else {
-        fragShaderCode = renderer::shader::ShaderLoader::CompileGLSLFromFile(fragShaderPath, ShaderStage::Fragment);
-    }
+    std::vector<char> vertShaderCode = renderer::shader::ShaderLoader::LoadShaderCode(vertShaderPath, ShaderStage::Vertex);
+    std::vector<char> fragShaderCode = renderer::shader::ShaderLoader::LoadShaderCode(fragShaderPath, ShaderStage::Fragment);
     
     if (vertShaderCode.empty() || fragShaderCode.empty()) {
         Window::ShowError("Failed to load loading cubes shaders! Make sure " + vertShaderPath + " and " + fragShaderPath + " exist.");
@@ -739,7 +1147,7 @@ bool VulkanRenderer::CreateLoadingCubesPipeline(const std::string& vertShaderPat
     pipelineInfo.renderPass = m_renderPass;
     pipelineInfo.subpass = 0;
     
-    result = vkCreateGraphicsPipelines(m_device, VK_NULL_HANDLE, 1, &pipelineInfo, nullptr, &m_loadingCubesPipeline);
+    result = vkCreateGraphicsPipelines(m_device, static_cast<VkPipelineCache>(GetPipelineCache()), 1, &pipelineInfo, nullptr, &m_loadingCubesPipeline);
     
     // 清理shader模块
     vkDestroyShaderModule(m_device, fragShaderModule, nullptr);
@@ -750,9 +1158,90 @@ bool VulkanRenderer::CreateLoadingCubesPipeline(const std::string& vertShaderPat
         return false;
     }
     
+    // 剔除管线句柄随 Ready 一起发布；创建失败不影响绘制
+    if (!CreateLoadingCubesCullPipeline()) {
+        printf("[PIPELINE] Loading cubes tile culling unavailable, testing all cubes per pixel\n");
+    }
+    
+    // 光栅化管线同样随 Ready 发布；创建失败时 F8 / --cubes=raster 退回到光线投射
+    if (m_cubeRasterizer && !CreateLoadingCubesRasterPipeline()) {
+        printf("[PIPELINE] Loading cubes raster pipeline unavailable, cubes will be ray cast\n");
+    }
+    
+    if (m_computeScene && !CreateDefaultComputeScenePipeline(ScenePipelineType::LoadingCubes)) {
+        printf("[PIPELINE] Loading cubes compute variant unavailable, scene will use the graphics pipeline\n");
+    }
+    
+    // 时间抗锯齿与超采样光线投射共用顶点着色器和管线布局；创建失败时 F8 / --cubes=taa 退回到超采样光线投射
+    if (m_temporalResolver && !CreateLoadingCubesTemporalPipeline(vertShaderPath)) {
+        printf("[PIPELINE] Loading cubes temporal pipeline unavailable, cubes will be supersampled\n");
+    }
+    
+    m_loadingCubesPipelineState.store(ScenePipelineState::Ready, std::memory_order_release);
+    return true;
+}
+
+bool VulkanRenderer::PrecompileScenePipelines(const std::string& shaderVertPath, const std::string& shaderFragPath,
+                                              const std::string& loadingCubesVertPath, const std::string& loadingCubesFragPath) {
+    if (m_device == VK_NULL_HANDLE || m_renderPass == VK_NULL_HANDLE) {
+        return false;
+    }
+    
+    // 已启动或已完成时不再重复编译
+    if (m_scenePipelineThread.joinable() ||
+        m_shaderPipelineState.load() != ScenePipelineState::NotStarted ||
+        m_loadingCubesPipelineState.load() != ScenePipelineState::NotStarted) {
+        return true;
+    }
+    
+    m_shaderPipelineState.store(ScenePipelineState::Compiling);
+    m_loadingCubesPipelineState.store(ScenePipelineState::Compiling);
+    
+    // 管线缓存和设备对象创建是线程安全的，渲染线程只在观察到 Ready 后才读取管线句柄
+    // 路径按值捕获，.spv 文件不存在时由 ShaderLoader::LoadShaderCode 退回到同名GLSL源文件
+    m_scenePipelineThread = std::thread([this, shaderVertPath, shaderFragPath, loadingCubesVertPath, loadingCubesFragPath]() {
+        // 工作线程不弹出模态对话框：收集 ShowError 的消息，失败时随 Failed 状态交给渲染线程报告，
+        // 成功时（只是可选变体创建失败）只写入日志
+        Window::ErrorCapture errorCapture;
+        if (!CreateGraphicsPipeline(shaderVertPath, shaderFragPath)) {
+            printf("[PIPELINE] Failed to precompile shader pipeline\n");
+            m_shaderPipelineError = errorCapture.TakeErrors();
+            m_shaderPipelineState.store(ScenePipelineState::Failed, std::memory_order_release);
+        } else if (errorCapture.HasErrors()) {
+            printf("[PIPELINE] %s\n", errorCapture.TakeErrors().c_str());
+        }
+        if (!CreateLoadingCubesPipeline(loadingCubesVertPath, loadingCubesFragPath)) {
+            printf("[PIPELINE] Failed to precompile loading cubes pipeline\n");
+            m_loadingCubesPipelineError = errorCapture.TakeErrors();
+            m_loadingCubesPipelineState.store(ScenePipelineState::Failed, std::memory_order_release);
+        } else if (errorCapture.HasErrors()) {
+            printf("[PIPELINE] %s\n", errorCapture.TakeErrors().c_str());
+        }
+    });
+    
     return true;
 }
 
+void VulkanRenderer::ReportScenePipelineErrors() {
+    if (!m_scenePipelineErrorsReported[0] &&
+        m_shaderPipelineState.load(std::memory_order_acquire) == ScenePipelineState::Failed) {
+        m_scenePipelineErrorsReported[0] = true;
+        Window::ShowError(m_shaderPipelineError.empty() ? std::string("Failed to create graphics pipeline!") : m_shaderPipelineError);
+    }
+    if (!m_scenePipelineErrorsReported[1] &&
+        m_loadingCubesPipelineState.load(std::memory_order_acquire) == ScenePipelineState::Failed) {
+        m_scenePipelineErrorsReported[1] = true;
+        Window::ShowError(m_loadingCubesPipelineError.empty() ? std::string("Failed to create loading cubes graphics pipeline!") : m_loadingCubesPipelineError);
+    }
+}
+
+ScenePipelineState VulkanRenderer::GetScenePipelineState(ScenePipelineType type) const {
+    if (type == ScenePipelineType::LoadingCubes) {
+        return m_loadingCubesPipelineState.load(std::memory_order_acquire);
+    }
+    return m_shaderPipelineState.load(std::memory_order_acquire);
+}
+
 bool VulkanRenderer::CreateFramebuffers() {
     m_swapchainFramebuffers.resize(m_swapchainImageCount);
     for (size_t i = 0; i < m_swapchainImageCount; i++) {
@@ -806,6 +1295,9 @@ bool VulkanRenderer::CreateCommandBuffers() {
         return false;
     }
     
+    m_imagesInFlight.assign(m_swapchainImageCount, VK_NULL_HANDLE);
+    m_recordedFrames.assign(m_swapchainImageCount, RecordedFrameState());
+    
     return true;
 }
 
@@ -813,6 +1305,7 @@ bool VulkanRenderer::CreateSyncObjects() {
     m_imageAvailableSemaphores.resize(config::MAX_FRAMES_IN_FLIGHT);
     m_renderFinishedSemaphores.resize(config::MAX_FRAMES_IN_FLIGHT);
     m_inFlightFences.resize(config::MAX_FRAMES_IN_FLIGHT);
+    m_frameSubmitSerials.assign(config::MAX_FRAMES_IN_FLIGHT, 0);
     
     VkSemaphoreCreateInfo semaphoreInfo = {};
     semaphoreInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
@@ -835,58 +1328,830 @@ bool VulkanRenderer::CreateSyncObjects() {
     return true;
 }
 
-void VulkanRenderer::CleanupSwapchain() {
-    for (auto framebuffer : m_swapchainFramebuffers) {
-        vkDestroyFramebuffer(m_device, framebuffer, nullptr);
-    }
-    m_swapchainFramebuffers.clear();
-    
-    for (auto imageView : m_swapchainImageViews) {
-        vkDestroyImageView(m_device, imageView, nullptr);
-    }
-    m_swapchainImageViews.clear();
-    
-    if (m_swapchain != VK_NULL_HANDLE) {
-        vkDestroySwapchainKHR(m_device, m_swapchain, nullptr);
-        m_swapchain = VK_NULL_HANDLE;
-    }
-}
+namespace {
 
-void VulkanRenderer::RecreateSwapchain() {
-    VkResult result = vkDeviceWaitIdle(m_device);
-    if (result != VK_SUCCESS) {
-        Window::ShowError("Failed to wait for device idle during swapchain recreation!");
-        return;
-    }
-    
-    CleanupSwapchain();
-    
-    if (!CreateSwapchain()) {
-        Window::ShowError("Failed to recreate swapchain!");
-        return;
-    }
-    
-    if (!CreateImageViews()) {
-        Window::ShowError("Failed to recreate swapchain image views!");
-        CleanupSwapchain();
-        return;
-    }
-    
-    if (!CreateFramebuffers()) {
-        Window::ShowError("Failed to recreate swapchain framebuffers!");
-        CleanupSwapchain();
-        return;
-    }
-}
+// loading_cubes 的立方体网格边长和立方体数量（着色器从 SceneParams.cubeCount 读取数量）
+const int LOADING_CUBE_GRID = 8;
+const int LOADING_CUBE_COUNT = LOADING_CUBE_GRID * LOADING_CUBE_GRID;
 
-void VulkanRenderer::RecordCommandBuffer(VkCommandBuffer commandBuffer, uint32_t imageIndex, float time, bool useLoadingCubes, ITextRenderer* textRenderer, float fps) {
-    VkCommandBufferBeginInfo beginInfo = {};
-    beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
-    
+// 屏幕分块剔除的分块网格边长和每块可记录的立方体数量（与 loading_cubes_cull.comp / loading_cubes.frag 的
+// TILE_GRID / TILE_CAPACITY 一致）。分块按标准化屏幕坐标划分，缓冲区大小与分辨率无关
+const uint32_t LOADING_CUBE_TILE_GRID = 64;
+const uint32_t LOADING_CUBE_TILE_CAPACITY = 64;
+const uint32_t LOADING_CUBE_TILE_COUNT = LOADING_CUBE_TILE_GRID * LOADING_CUBE_TILE_GRID;
+
+// 剔除计算着色器的工作组大小（与 loading_cubes_cull.comp 的 local_size_x 一致）
+const uint32_t LOADING_CUBE_CULL_GROUP_SIZE = 64;
+
+// 剔除计算着色器路径（.spv 不存在时退回到GLSL源文件）
+const char* const LOADING_CUBE_CULL_SHADER_PATH = "renderer/loading/loading_cubes_cull.comp.spv";
+
+// 实例化光栅化着色器路径（.spv 不存在时退回到GLSL源文件）
+const char* const LOADING_CUBE_RASTER_VERT_SHADER_PATH = "renderer/loading/loading_cubes_raster.vert.spv";
+const char* const LOADING_CUBE_RASTER_FRAG_SHADER_PATH = "renderer/loading/loading_cubes_raster.frag.spv";
+
+// 动态分辨率放大着色器路径（.spv 不存在时退回到GLSL源文件）
+const char* const UPSCALE_VERT_SHADER_PATH = "renderer/shader/upscale.vert.spv";
+const char* const UPSCALE_FRAG_SHADER_PATH = "renderer/shader/upscale.frag.spv";
+
+// 全屏场景的计算着色器路径（.spv 不存在时退回到GLSL源文件）
+const char* const SHADER_COMPUTE_SHADER_PATH = "renderer/shader/shader.comp.spv";
+const char* const LOADING_CUBES_COMPUTE_SHADER_PATH = "renderer/loading/loading_cubes.comp.spv";
+
+// loading_cubes 时间抗锯齿着色器路径（.spv 不存在时退回到GLSL源文件；解析和合成通道复用放大顶点着色器）
+const char* const LOADING_CUBES_TAA_FRAG_SHADER_PATH = "renderer/loading/loading_cubes_taa.frag.spv";
+const char* const TAA_RESOLVE_FRAG_SHADER_PATH = "renderer/loading/taa_resolve.frag.spv";
+
+// 单个立方体的逐帧数据（与 loading_cubes.frag / loading_cubes_cull.comp 的 CubeData 一致，每个成员为 vec4）
+struct LoadingCubeUniform {
+    float rotation[3][4];   // 世界空间到立方体局部空间的旋转（mat3 的三列，w 未使用）
+    float localOrigin[4];   // 相机位置在立方体局部空间中的坐标（w 未使用）
+    float halfSize[4];      // 立方体半边长（w 未使用）
+    float color[4];         // 立方体颜色（已做伽马校正，w 未使用）
+    float bounds[4];        // 世界空间包围球（xyz 球心，w 半径），用于屏幕分块剔除
+};
+
+// 场景参数统一缓冲区布局（与 shader.frag / loading_cubes.frag 的 SceneParams 一致，std140 下标量紧密排列）
+// shader.frag 只声明前面的浮点数，loading_cubes.frag 不声明时间抗锯齿参数
+struct SceneUniforms {
+    float time;
+    float aspect;
+    float cameraYaw;
+    float cameraPitch;
+    float cameraPosX;
+    float cameraPosY;
+    float cameraPosZ;
+    uint32_t cubeCount;    // 立方体存储缓冲区中的有效立方体数量
+    uint32_t tileCulling;  // 非0时片段着色器只测试所在分块列表中的立方体
+    float prevCameraYaw;   // 上一帧的相机状态（时间抗锯齿重投影历史）
+    float prevCameraPitch;
+    float prevCameraPosX;
+    float prevCameraPosY;
+    float prevCameraPosZ;
+    float jitterX;         // 本帧子像素抖动（标准化坐标）
+    float jitterY;
+    float historyWeight;   // 历史权重（0 表示历史无效）
+};
+
+// 分块列表缓冲区布局：先是每块的立方体数量，然后是每块 TILE_CAPACITY 个立方体索引
+const VkDeviceSize LOADING_CUBE_TILE_BUFFER_SIZE =
+    sizeof(uint32_t) * LOADING_CUBE_TILE_COUNT * (1 + LOADING_CUBE_TILE_CAPACITY);
+
+// 场景参数描述符池可容纳的交换链图像数量上限
+const uint32_t SCENE_UNIFORM_MAX_IMAGES = 8;
+
+// Halton 低差异序列（时间抗锯齿的子像素抖动，index 从 1 开始）
+float HaltonSequence(uint32_t index, uint32_t base) {
+    float result = 0.0f;
+    float fraction = 1.0f;
+    while (index > 0) {
+        fraction /= (float)base;
+        result += fraction * (float)(index % base);
+        index /= base;
+    }
+    return result;
+}
+
+// 立方体的不随时间变化的参数（由网格位置的哈希决定）
+struct LoadingCubeSeed {
+    float baseAngle[3];   // 初始旋转角（X、Y、Z，弧度）
+    float spin[3];        // 旋转角速度（弧度/秒）
+    float color[3];
+};
+
+// 与着色器原先的 hash() 相同的伪随机函数（单精度计算）
+float LoadingCubeHash(float n) {
+    float value = std::sin(n) * 43758.5453123f;
+    return value - std::floor(value);
+}
+
+float LoadingCubeHash(float x, float y) {
+    float px = x * 127.1f + y * 311.7f;
+    float py = x * 269.5f + y * 183.3f;
+    return LoadingCubeHash(px + py);
+}
+
+const LoadingCubeSeed* GetLoadingCubeSeeds() {
+    static const std::vector<LoadingCubeSeed> seeds = []() {
+        const float seed = 123456.0f;
+        const float speed = 3.0f;
+        const float degToRad = (float)(config::PI / 180.0);
+        
+        std::vector<LoadingCubeSeed> result(LOADING_CUBE_COUNT);
+        for (int i = 0; i < LOADING_CUBE_GRID; i++) {
+            for (int j = 0; j < LOADING_CUBE_GRID; j++) {
+                LoadingCubeSeed& cube = result[i * LOADING_CUBE_GRID + j];
+                float seedX = (float)i + seed * 100.0f;
+                float seedY = (float)j + seed * 100.0f;
+                float axisSeeds[3] = { seedX, seedY, seedX + seedY };
+                for (int axis = 0; axis < 3; axis++) {
+                    cube.baseAngle[axis] = LoadingCubeHash(axisSeeds[axis] * 20.0f) * 360.0f * degToRad;
+                    cube.spin[axis] = speed * (LoadingCubeHash(axisSeeds[axis] * 21.0f) * 2.0f - 1.0f) * 0.1f;
+                }
+                
+                float h = LoadingCubeHash(seedX + 1000.0f, seedY + 1000.0f);
+                float rgb[3] = { LoadingCubeHash(h), LoadingCubeHash(h * 1.1f), LoadingCubeHash(h * 1.2f) };
+                for (int c = 0; c < 3; c++) {
+                    cube.color[c] = std::pow(rgb[c], 1.0f / 1.8f);
+                }
+            }
+        }
+        return result;
+    }();
+    return seeds.data();
+}
+
+// 3x3 矩阵（与 GLSL mat3 相同按列存储：m[列][行]）
+struct Mat3 {
+    float m[3][3];
+};
+
+// 按 GLSL 构造函数的参数顺序（逐列）构造
+Mat3 MakeMat3(float c0x, float c0y, float c0z, float c1x, float c1y, float c1z, float c2x, float c2y, float c2z) {
+    Mat3 result = {{ { c0x, c0y, c0z }, { c1x, c1y, c1z }, { c2x, c2y, c2z } }};
+    return result;
+}
+
+Mat3 MultiplyMat3(const Mat3& a, const Mat3& b) {
+    Mat3 result = {};
+    for (int col = 0; col < 3; col++) {
+        for (int row = 0; row < 3; row++) {
+            result.m[col][row] = a.m[0][row] * b.m[col][0] + a.m[1][row] * b.m[col][1] + a.m[2][row] * b.m[col][2];
+        }
+    }
+    return result;
+}
+
+// 与着色器原先的 rotateX / rotateY / rotateZ 相同
+Mat3 RotateX(float angle) {
+    float c = std::cos(angle);
+    float s = std::sin(angle);
+    return MakeMat3(1.0f, 0.0f, 0.0f, 0.0f, c, -s, 0.0f, s, c);
+}
+
+Mat3 RotateY(float angle) {
+    float c = std::cos(angle);
+    float s = std::sin(angle);
+    return MakeMat3(c, 0.0f, s, 0.0f, 1.0f, 0.0f, -s, 0.0f, c);
+}
+
+Mat3 RotateZ(float angle) {
+    float c = std::cos(angle);
+    float s = std::sin(angle);
+    return MakeMat3(c, -s, 0.0f, s, c, 0.0f, 0.0f, 0.0f, 1.0f);
+}
+
+// 计算每个立方体本帧的旋转、局部空间相机位置、大小和颜色
+// （这些量对整帧所有像素都相同，片段着色器只需做射线与盒子的求交）
+void FillLoadingCubes(LoadingCubeUniform* cubes, float time, float cameraX, float cameraY, float cameraZ) {
+    const LoadingCubeSeed* seeds = GetLoadingCubeSeeds();
+    const float halfSize = (1.0f / (float)LOADING_CUBE_GRID) * 0.65f;
+    
+    for (int i = 0; i < LOADING_CUBE_GRID; i++) {
+        for (int j = 0; j < LOADING_CUBE_GRID; j++) {
+            int index = i * LOADING_CUBE_GRID + j;
+            const LoadingCubeSeed& seed = seeds[index];
+            LoadingCubeUniform& cube = cubes[index];
+            
+            // 与着色器原先的 rotateX(x) * rotateY(y) * rotateZ(z) 相同
+            float angleX = seed.baseAngle[0] + time * seed.spin[0];
+            float angleY = seed.baseAngle[1] + time * seed.spin[1];
+            float angleZ = seed.baseAngle[2] + time * seed.spin[2];
+            Mat3 rotation = MultiplyMat3(MultiplyMat3(RotateX(angleX), RotateY(angleY)), RotateZ(angleZ));
+            for (int col = 0; col < 3; col++) {
+                for (int row = 0; row < 3; row++) {
+                    cube.rotation[col][row] = rotation.m[col][row];
+                }
+                cube.rotation[col][3] = 0.0f;
+            }
+            
+            // 立方体中心位于 z = 0 平面上的网格
+            float centerX = (((float)i - LOADING_CUBE_GRID * 0.5f + 0.5f) / LOADING_CUBE_GRID) * 1.3f;
+            float centerY = (((float)j - LOADING_CUBE_GRID * 0.5f + 0.5f) / LOADING_CUBE_GRID) * 1.3f;
+            float offset[3] = { cameraX - centerX, cameraY - centerY, cameraZ };
+            for (int row = 0; row < 3; row++) {
+                cube.localOrigin[row] = cube.rotation[0][row] * offset[0] + cube.rotation[1][row] * offset[1] + cube.rotation[2][row] * offset[2];
+                cube.halfSize[row] = halfSize;
+                cube.color[row] = seed.color[row];
+            }
+            cube.localOrigin[3] = 0.0f;
+            cube.halfSize[3] = 0.0f;
+            cube.color[3] = 0.0f;
+            
+            cube.bounds[0] = centerX;
+            cube.bounds[1] = centerY;
+            cube.bounds[2] = 0.0f;
+            cube.bounds[3] = halfSize * std::sqrt(3.0f);
+        }
+    }
+}
+
+} // namespace
+
+bool VulkanRenderer::CreateSceneUniforms() {
+    // 描述符集布局在场景管线预编译之前创建，工作线程创建管线布局时直接使用
+    // binding 0：场景参数；binding 1：loading_cubes 的立方体数据；binding 2：loading_cubes 的屏幕分块列表
+    // 剔除计算着色器、片段着色器和光栅化路径的顶点着色器共用同一个描述符集
+    VkDescriptorSetLayoutBinding bindings[3] = {};
+    bindings[0].binding = 0;
+    bindings[0].descriptorCount = 1;
+    bindings[0].descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+    bindings[0].pImmutableSamplers = nullptr;
+    bindings[0].stageFlags = VK_SHADER_STAGE_VERTEX_BIT | VK_SHADER_STAGE_FRAGMENT_BIT | VK_SHADER_STAGE_COMPUTE_BIT;
+    
+    for (uint32_t i = 1; i < 3; i++) {
+        bindings[i].binding = i;
+        bindings[i].descriptorCount = 1;
+        bindings[i].descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+        bindings[i].pImmutableSamplers = nullptr;
+        bindings[i].stageFlags = VK_SHADER_STAGE_VERTEX_BIT | VK_SHADER_STAGE_FRAGMENT_BIT | VK_SHADER_STAGE_COMPUTE_BIT;
+    }
+    
+    VkDescriptorSetLayoutCreateInfo layoutInfo = {};
+    layoutInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
+    layoutInfo.bindingCount = 3;
+    layoutInfo.pBindings = bindings;
+    
+    if (vkCreateDescriptorSetLayout(m_device, &layoutInfo, nullptr, &m_sceneDescriptorSetLayout) != VK_SUCCESS) {
+        Window::ShowError("Failed to create scene descriptor set layout!");
+        return false;
+    }
+    
+    VkDescriptorPoolSize poolSizes[2] = {};
+    poolSizes[0].type = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+    poolSizes[0].descriptorCount = SCENE_UNIFORM_MAX_IMAGES;
+    poolSizes[1].type = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+    poolSizes[1].descriptorCount = SCENE_UNIFORM_MAX_IMAGES * 2;
+    
+    VkDescriptorPoolCreateInfo poolInfo = {};
+    poolInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
+    poolInfo.poolSizeCount = 2;
+    poolInfo.pPoolSizes = poolSizes;
+    poolInfo.maxSets = SCENE_UNIFORM_MAX_IMAGES;
+    
+    if (vkCreateDescriptorPool(m_device, &poolInfo, nullptr, &m_sceneDescriptorPool) != VK_SUCCESS) {
+        Window::ShowError("Failed to create scene descriptor pool!");
+        return false;
+    }
+    
+    return EnsureSceneUniformCount(m_swapchainImageCount);
+}
+
+bool VulkanRenderer::CreateSceneBuffer(VkDeviceSize size, VkBufferUsageFlags usage, MemoryPropertyFlag properties,
+                                       VkBuffer& buffer, MemoryAllocation& allocation) {
+    VkBufferCreateInfo bufferInfo = {};
+    bufferInfo.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+    bufferInfo.size = size;
+    bufferInfo.usage = usage;
+    bufferInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+    
+    if (vkCreateBuffer(m_device, &bufferInfo, nullptr, &buffer) != VK_SUCCESS) {
+        buffer = VK_NULL_HANDLE;
+        return false;
+    }
+    
+    if (!VulkanMemoryAllocator::AllocateBuffer(m_memoryAllocator.get(), m_device, m_physicalDevice, buffer,
+                                               properties, allocation)) {
+        vkDestroyBuffer(m_device, buffer, nullptr);
+        buffer = VK_NULL_HANDLE;
+        return false;
+    }
+    
+    return true;
+}
+
+void VulkanRenderer::DestroySceneUniformBuffer(SceneUniformBuffer& uniform) {
+    VkBuffer* buffers[] = { &uniform.buffer, &uniform.cubeBuffer, &uniform.tileBuffer };
+    MemoryAllocation* allocations[] = { &uniform.allocation, &uniform.cubeAllocation, &uniform.tileAllocation };
+    for (size_t i = 0; i < 3; i++) {
+        if (*buffers[i] != VK_NULL_HANDLE) {
+            vkDestroyBuffer(m_device, *buffers[i], nullptr);
+            *buffers[i] = VK_NULL_HANDLE;
+            VulkanMemoryAllocator::Release(m_memoryAllocator.get(), m_device, *allocations[i]);
+        }
+    }
+}
+
+bool VulkanRenderer::EnsureSceneUniformCount(uint32_t count) {
+    if (m_sceneUniforms.size() >= count) {
+        return true;
+    }
+    
+    if (count > SCENE_UNIFORM_MAX_IMAGES) {
+        Window::ShowError("Too many swapchain images for scene uniform buffers!");
+        return false;
+    }
+    
+    while (m_sceneUniforms.size() < count) {
+        SceneUniformBuffer uniform;
+        
+        // 场景参数和立方体数据每帧由 CPU 写入，使用持久映射的主机可见内存；
+        // 分块列表只由剔除计算着色器写入、片段着色器读取，使用设备本地内存
+        MemoryPropertyFlag hostVisible = MemoryPropertyFlag::HostVisible | MemoryPropertyFlag::HostCoherent;
+        if (!CreateSceneBuffer(sizeof(SceneUniforms), VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT, hostVisible,
+                               uniform.buffer, uniform.allocation) ||
+            !CreateSceneBuffer(sizeof(LoadingCubeUniform) * LOADING_CUBE_COUNT, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT, hostVisible,
+                               uniform.cubeBuffer, uniform.cubeAllocation) ||
+            !CreateSceneBuffer(LOADING_CUBE_TILE_BUFFER_SIZE, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT,
+                               MemoryPropertyFlag::DeviceLocal, uniform.tileBuffer, uniform.tileAllocation)) {
+            DestroySceneUniformBuffer(uniform);
+            Window::ShowError("Failed to create scene uniform buffers!");
+            return false;
+        }
+        
+        VkDescriptorSetAllocateInfo allocInfo = {};
+        allocInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
+        allocInfo.descriptorPool = m_sceneDescriptorPool;
+        allocInfo.descriptorSetCount = 1;
+        allocInfo.pSetLayouts = &m_sceneDescriptorSetLayout;
+        
+        if (vkAllocateDescriptorSets(m_device, &allocInfo, &uniform.descriptorSet) != VK_SUCCESS) {
+            DestroySceneUniformBuffer(uniform);
+            Window::ShowError("Failed to allocate scene descriptor set!");
+            return false;
+        }
+        
+        VkDescriptorBufferInfo bufferDescriptors[3] = {};
+        bufferDescriptors[0].buffer = uniform.buffer;
+        bufferDescriptors[0].offset = 0;
+        bufferDescriptors[0].range = sizeof(SceneUniforms);
+        bufferDescriptors[1].buffer = uniform.cubeBuffer;
+        bufferDescriptors[1].offset = 0;
+        bufferDescriptors[1].range = VK_WHOLE_SIZE;
+        bufferDescriptors[2].buffer = uniform.tileBuffer;
+        bufferDescriptors[2].offset = 0;
+        bufferDescriptors[2].range = VK_WHOLE_SIZE;
+        
+        VkWriteDescriptorSet descriptorWrites[3] = {};
+        for (uint32_t i = 0; i < 3; i++) {
+            descriptorWrites[i].sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+            descriptorWrites[i].dstSet = uniform.descriptorSet;
+            descriptorWrites[i].dstBinding = i;
+            descriptorWrites[i].dstArrayElement = 0;
+            descriptorWrites[i].descriptorType = (i == 0) ? VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER : VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+            descriptorWrites[i].descriptorCount = 1;
+            descriptorWrites[i].pBufferInfo = &bufferDescriptors[i];
+        }
+        
+        vkUpdateDescriptorSets(m_device, 3, descriptorWrites, 0, nullptr);
+        
+        m_sceneUniforms.push_back(uniform);
+    }
+    
+    return true;
+}
+
+void VulkanRenderer::CleanupSceneUniforms() {
+    for (SceneUniformBuffer& uniform : m_sceneUniforms) {
+        DestroySceneUniformBuffer(uniform);
+    }
+    m_sceneUniforms.clear();
+    
+    // 描述符集随描述符池一起释放
+    if (m_sceneDescriptorPool != VK_NULL_HANDLE) {
+        vkDestroyDescriptorPool(m_device, m_sceneDescriptorPool, nullptr);
+        m_sceneDescriptorPool = VK_NULL_HANDLE;
+    }
+    
+    if (m_sceneDescriptorSetLayout != VK_NULL_HANDLE) {
+        vkDestroyDescriptorSetLayout(m_device, m_sceneDescriptorSetLayout, nullptr);
+        m_sceneDescriptorSetLayout = VK_NULL_HANDLE;
+    }
+}
+
+void VulkanRenderer::UpdateSceneUniforms(uint32_t imageIndex, float time, bool useLoadingCubes, bool temporalCubes) {
+    // loading_cubes 全屏显示，使用窗口宽高比；其他场景的视口保持基准宽高比
+    float aspect = (float)config::WINDOW_WIDTH / (float)config::WINDOW_HEIGHT;
+    if (useLoadingCubes) {
+        aspect = (float)m_swapchainExtent.width / (float)m_swapchainExtent.height;
+    }
+    
+    // 剔除管线与 loading_cubes 管线一起创建，只有管线就绪后才读取其句柄
+    // （本帧录制的命令缓冲区没有剔除调度时，片段着色器退回到测试所有立方体）
+    bool tileCulling = useLoadingCubes &&
+                       m_loadingCubesPipelineState.load(std::memory_order_acquire) == ScenePipelineState::Ready &&
+                       m_loadingCubesCullPipeline != VK_NULL_HANDLE;
+    
+    // 时间抗锯齿：每帧按 Halton(2, 3) 偏移子像素采样位置，历史按上一帧相机重投影
+    // 上一帧不是时间抗锯齿路径、历史图像刚创建或相机跳变（重投影误差过大）时丢弃历史
+    float jitterX = 0.0f;
+    float jitterY = 0.0f;
+    float historyWeight = 0.0f;
+    if (temporalCubes) {
+        uint32_t sample = m_temporalFrameIndex % config::TEMPORAL_AA_JITTER_SAMPLES + 1;
+        m_temporalFrameIndex++;
+        jitterX = (HaltonSequence(sample, 2) - 0.5f) * 2.0f / (float)m_swapchainExtent.width;
+        jitterY = (HaltonSequence(sample, 3) - 0.5f) * 2.0f / (float)m_swapchainExtent.height;
+        
+        float deltaX = m_cameraPosX - m_prevCameraPosX;
+        float deltaY = m_cameraPosY - m_prevCameraPosY;
+        float deltaZ = m_cameraPosZ - m_prevCameraPosZ;
+        bool cameraCut = std::fabs(m_cameraYaw - m_prevCameraYaw) > config::TEMPORAL_AA_CAMERA_CUT_ANGLE ||
+                         std::fabs(m_cameraPitch - m_prevCameraPitch) > config::TEMPORAL_AA_CAMERA_CUT_ANGLE ||
+                         std::sqrt(deltaX * deltaX + deltaY * deltaY + deltaZ * deltaZ) > config::TEMPORAL_AA_CAMERA_CUT_DISTANCE;
+        if (m_temporalHistoryValid && m_temporalResolver->IsHistoryInitialized() && !cameraCut) {
+            historyWeight = config::TEMPORAL_AA_HISTORY_WEIGHT;
+        }
+    }
+    
+    SceneUniforms uniforms = {
+        time, aspect,
+        m_cameraYaw, m_cameraPitch,
+        m_cameraPosX, m_cameraPosY, m_cameraPosZ,
+        (uint32_t)LOADING_CUBE_COUNT, tileCulling ? 1u : 0u,
+        m_prevCameraYaw, m_prevCameraPitch,
+        m_prevCameraPosX, m_prevCameraPosY, m_prevCameraPosZ,
+        jitterX, jitterY, historyWeight
+    };
+    
+    m_prevCameraYaw = m_cameraYaw;
+    m_prevCameraPitch = m_cameraPitch;
+    m_prevCameraPosX = m_cameraPosX;
+    m_prevCameraPosY = m_cameraPosY;
+    m_prevCameraPosZ = m_cameraPosZ;
+    m_temporalHistoryValid = temporalCubes;
+    
+    // 调用前已等待使用该图像的上一帧完成
+    VulkanMemoryAllocator::Write(m_device, m_sceneUniforms[imageIndex].allocation, &uniforms, sizeof(uniforms));
+    
+    // 其他场景的着色器不读取立方体数据
+    if (useLoadingCubes) {
+        LoadingCubeUniform cubes[LOADING_CUBE_COUNT];
+        FillLoadingCubes(cubes, time, m_cameraPosX, m_cameraPosY, m_cameraPosZ);
+        VulkanMemoryAllocator::Write(m_device, m_sceneUniforms[imageIndex].cubeAllocation, cubes, sizeof(cubes));
+    }
+}
+
+bool VulkanRenderer::CreateLoadingCubesCullPipeline() {
+    const std::string compShaderPath = LOADING_CUBE_CULL_SHADER_PATH;
+    
+    std::vector<char> compShaderCode = renderer::shader::ShaderLoader::LoadShaderCode(compShaderPath, ShaderStage::Compute);
+    
+    if (compShaderCode.empty()) {
+        printf("[PIPELINE] Failed to load loading cubes culling shader: %s\n", compShaderPath.c_str());
+        return false;
+    }
+    
+    ShaderModuleHandle compShaderModuleHandle = renderer::shader::ShaderLoader::CreateShaderModuleFromSPIRV(static_cast<DeviceHandle>(m_device), compShaderCode);
+    VkShaderModule compShaderModule = static_cast<VkShaderModule>(compShaderModuleHandle);
+    if (compShaderModule == VK_NULL_HANDLE) {
+        printf("[PIPELINE] Failed to create loading cubes culling shader module\n");
+        return false;
+    }
+    
+    // 与 loading_cubes 图形管线共用管线布局（同一个场景描述符集）
+    VkComputePipelineCreateInfo pipelineInfo = {};
+    pipelineInfo.sType = VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_CREATE_INFO;
+    pipelineInfo.stage.sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+    pipelineInfo.stage.stage = VK_SHADER_STAGE_COMPUTE_BIT;
+    pipelineInfo.stage.module = compShaderModule;
+    pipelineInfo.stage.pName = "main";
+    pipelineInfo.layout = m_loadingCubesPipelineLayout;
+    
+    VkResult result = vkCreateComputePipelines(m_device, static_cast<VkPipelineCache>(GetPipelineCache()), 1, &pipelineInfo, nullptr, &m_loadingCubesCullPipeline);
+    vkDestroyShaderModule(m_device, compShaderModule, nullptr);
+    
+    if (result != VK_SUCCESS) {
+        m_loadingCubesCullPipeline = VK_NULL_HANDLE;
+        printf("[PIPELINE] Failed to create loading cubes culling pipeline\n");
+        return false;
+    }
+    
+    return true;
+}
+
+bool VulkanRenderer::CreateLoadingCubesRasterPipeline() {
+    // 与 loading_cubes 图形管线共用管线布局（顶点着色器读取同一个描述符集中的立方体数据）
+    return m_cubeRasterizer->CreatePipeline(m_loadingCubesPipelineLayout, static_cast<VkPipelineCache>(GetPipelineCache()),
+                                            LOADING_CUBE_RASTER_VERT_SHADER_PATH, LOADING_CUBE_RASTER_FRAG_SHADER_PATH);
+}
+
+bool VulkanRenderer::CreateLoadingCubesTemporalPipeline(const std::string& vertShaderPath) {
+    return m_temporalResolver->CreatePipeline(m_loadingCubesPipelineLayout, static_cast<VkPipelineCache>(GetPipelineCache()),
+                                              vertShaderPath, LOADING_CUBES_TAA_FRAG_SHADER_PATH);
+}
+
+void VulkanRenderer::CreateResolutionScaler() {
+    if (!m_dynamicResolutionEnabled) {
+        return;
+    }
+    
+    // 比例由时间戳读回的GPU帧耗时驱动，没有分析器时无法调整
+    if (!m_gpuProfiler) {
+        printf("[DYNAMIC_RES] GPU timestamps unavailable, dynamic resolution disabled\n");
+        return;
+    }
+    
+    // 放大通道在主渲染通道中绘制；创建失败时场景始终以原生分辨率渲染
+    m_resolutionScaler = std::make_unique<VulkanResolutionScaler>();
+    if (!m_resolutionScaler->Initialize(m_device, m_physicalDevice, m_memoryAllocator.get(), m_swapchainImageFormat, m_renderPass,
+                                        static_cast<VkPipelineCache>(GetPipelineCache()),
+                                        UPSCALE_VERT_SHADER_PATH, UPSCALE_FRAG_SHADER_PATH)) {
+        printf("[DYNAMIC_RES] Resolution scaler unavailable, dynamic resolution disabled\n");
+        m_resolutionScaler.reset();
+        return;
+    }
+    
+    m_resolutionController = std::make_unique<DynamicResolutionController>();
+    m_resolutionController->Initialize(m_gpuBudgetMs);
+    printf("[DYNAMIC_RES] Dynamic resolution enabled, GPU budget %.2f ms\n", m_gpuBudgetMs);
+}
+
+void VulkanRenderer::CreateComputeScene() {
+    // 执行路径可在运行时切换（F7），因此总是创建；合成通道复用放大着色器，在主渲染通道中绘制
+    m_computeScene = std::make_unique<VulkanComputeScene>();
+    if (!m_computeScene->Initialize(m_device, m_physicalDevice, m_memoryAllocator.get(), m_sceneDescriptorSetLayout, m_renderPass,
+                                    static_cast<VkPipelineCache>(GetPipelineCache()),
+                                    UPSCALE_VERT_SHADER_PATH, UPSCALE_FRAG_SHADER_PATH)) {
+        printf("[COMPUTE_SCENE] Compute scene unavailable, scenes will use the graphics pipeline\n");
+        m_computeScene.reset();
+    }
+}
+
+bool VulkanRenderer::CreateComputeScenePipeline(ScenePipelineType type, const std::string& compShaderPath) {
+    if (!m_computeScene) {
+        return false;
+    }
+    return m_computeScene->CreatePipeline(type, static_cast<VkPipelineCache>(GetPipelineCache()), compShaderPath);
+}
+
+bool VulkanRenderer::CreateDefaultComputeScenePipeline(ScenePipelineType type) {
+    const char* path = type == ScenePipelineType::LoadingCubes ? LOADING_CUBES_COMPUTE_SHADER_PATH : SHADER_COMPUTE_SHADER_PATH;
+    return CreateComputeScenePipeline(type, path);
+}
+
+bool VulkanRenderer::IsComputeScenePipelineAvailable(ScenePipelineType type) const {
+    return m_computeScene && GetScenePipelineState(type) == ScenePipelineState::Ready && m_computeScene->HasPipeline(type);
+}
+
+void VulkanRenderer::CreateTemporalResolver() {
+    // 立方体渲染模式可在运行时切换（F8），因此总是创建；合成通道复用放大着色器，在主渲染通道中绘制
+    m_temporalResolver = std::make_unique<VulkanTemporalResolver>();
+    if (!m_temporalResolver->Initialize(m_device, m_physicalDevice, m_memoryAllocator.get(), m_sceneDescriptorSetLayout, m_renderPass,
+                                        static_cast<VkPipelineCache>(GetPipelineCache()),
+                                        UPSCALE_VERT_SHADER_PATH, TAA_RESOLVE_FRAG_SHADER_PATH, UPSCALE_FRAG_SHADER_PATH)) {
+        printf("[TAA] Temporal resolver unavailable, cubes will be supersampled\n");
+        m_temporalResolver.reset();
+    }
+}
+
+void VulkanRenderer::RecordLoadingCubesCulling(VkCommandBuffer commandBuffer, uint32_t imageIndex) {
+    const SceneUniformBuffer& uniform = m_sceneUniforms[imageIndex];
+    
+    // 上一次使用该分块缓冲区的提交已完成（调用方已等待该图像的栅栏），只需清空每块的计数
+    vkCmdFillBuffer(commandBuffer, uniform.tileBuffer, 0, sizeof(uint32_t) * LOADING_CUBE_TILE_COUNT, 0);
+    
+    VkMemoryBarrier clearBarrier = {};
+    clearBarrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+    clearBarrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+    clearBarrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT;
+    vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+                         0, 1, &clearBarrier, 0, nullptr, 0, nullptr);
+    
+    // 每个线程投影一个立方体的包围球，并把它追加到覆盖的每个分块的列表中
+    vkCmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, m_loadingCubesCullPipeline);
+    vkCmdBindDescriptorSets(commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, m_loadingCubesPipelineLayout,
+                            0, 1, &uniform.descriptorSet, 0, nullptr);
+    uint32_t groupCount = ((uint32_t)LOADING_CUBE_COUNT + LOADING_CUBE_CULL_GROUP_SIZE - 1) / LOADING_CUBE_CULL_GROUP_SIZE;
+    vkCmdDispatch(commandBuffer, groupCount, 1, 1);
+    
+    VkMemoryBarrier cullBarrier = {};
+    cullBarrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+    cullBarrier.srcAccessMask = VK_ACCESS_SHADER_WRITE_BIT;
+    cullBarrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
+    vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT,
+                         0, 1, &cullBarrier, 0, nullptr, 0, nullptr);
+}
+
+void VulkanRenderer::InvalidateRecordedFrames() {
+    m_recordGeneration++;
+}
+
+void VulkanRenderer::CleanupSwapchain() {
+    for (auto framebuffer : m_swapchainFramebuffers) {
+        vkDestroyFramebuffer(m_device, framebuffer, nullptr);
+    }
+    m_swapchainFramebuffers.clear();
+    
+    for (auto imageView : m_swapchainImageViews) {
+        vkDestroyImageView(m_device, imageView, nullptr);
+    }
+    m_swapchainImageViews.clear();
+    
+    if (m_swapchain != VK_NULL_HANDLE) {
+        vkDestroySwapchainKHR(m_device, m_swapchain, nullptr);
+        m_swapchain = VK_NULL_HANDLE;
+    }
+    
+    // headless模式的离屏图像由渲染器自行创建，需要显式销毁
+    if (m_headless) {
+        for (auto image : m_swapchainImages) {
+            if (image != VK_NULL_HANDLE) {
+                vkDestroyImage(m_device, image, nullptr);
+            }
+        }
+        for (auto& allocation : m_offscreenImageAllocations) {
+            if (m_memoryAllocator) {
+                m_memoryAllocator->Free(allocation);
+            }
+        }
+        m_swapchainImages.clear();
+        m_offscreenImageAllocations.clear();
+    }
+}
+
+void VulkanRenderer::RecreateSwapchain() {
+    if (m_headless) {
+        return;  // 离屏目标尺寸固定，不随窗口变化
+    }
+    
+    // 窗口最小化时表面尺寸为0，无法创建交换链，保持待重建状态直到窗口恢复
+    VkSurfaceCapabilitiesKHR capabilities;
+    vkGetPhysicalDeviceSurfaceCapabilitiesKHR(m_physicalDevice, m_surface, &capabilities);
+    if (capabilities.currentExtent.width == 0 || capabilities.currentExtent.height == 0) {
+        m_swapchainSuboptimal = true;
+        return;
+    }
+    
+    // 不等待设备空闲：旧的图像视图和帧缓冲可能仍被在途帧使用，先退役，栅栏触发后再销毁
+    RetiredSwapchain retired;
+    retired.swapchain = m_swapchain;
+    retired.imageViews = std::move(m_swapchainImageViews);
+    retired.framebuffers = std::move(m_swapchainFramebuffers);
+    m_swapchainImageViews.clear();
+    m_swapchainFramebuffers.clear();
+    m_swapchain = VK_NULL_HANDLE;
+    
+    // 光栅化立方体的渲染目标按交换链尺寸创建、帧缓冲引用旧图像视图，一起退役，下次使用时重新创建
+    if (m_cubeRasterizer) {
+        m_cubeRasterizer->RetireTargets(m_submitSerial);
+    }
+    if (m_resolutionScaler) {
+        m_resolutionScaler->RetireTarget(m_submitSerial);
+    }
+    if (m_computeScene) {
+        m_computeScene->RetireTarget(m_submitSerial);
+    }
+    if (m_temporalResolver) {
+        m_temporalResolver->RetireTarget(m_submitSerial);
+    }
+    m_temporalHistoryValid = false;
+    
+    // 旧交换链作为 oldSwapchain 传入后即被退役（即使创建失败）
+    bool created = CreateSwapchain(retired.swapchain);
+    m_retiredSwapchains.Retire(std::move(retired), m_submitSerial);
+    
+    if (!created) {
+        Window::ShowError("Failed to recreate swapchain!");
+        return;
+    }
+    
+    if (!CreateImageViews()) {
+        Window::ShowError("Failed to recreate swapchain image views!");
+        CleanupSwapchain();
+        return;
+    }
+    
+    if (!CreateFramebuffers()) {
+        Window::ShowError("Failed to recreate swapchain framebuffers!");
+        CleanupSwapchain();
+        return;
+    }
+    
+    // 新交换链的图像数量可能多于原来的命令缓冲区数量
+    if (!EnsureCommandBufferCount(m_swapchainImageCount) || !EnsureSceneUniformCount(m_swapchainImageCount)) {
+        CleanupSwapchain();
+        return;
+    }
+    
+    // 分析器的查询池按图像分配（失败时新增的图像不计时，已有查询池可能仍被在途帧使用，不能销毁）
+    if (m_gpuProfiler) {
+        m_gpuProfiler->EnsureSlotCount(m_swapchainImageCount);
+    }
+    
+    // 已录制的命令缓冲区引用旧的帧缓冲
+    InvalidateRecordedFrames();
+    m_swapchainSuboptimal = false;
+}
+
+bool VulkanRenderer::PrepareSwapchainForFrame() {
+    if (m_headless) {
+        return true;
+    }
+    
+    // 上次重建失败（如窗口最小化期间），重试
+    if (m_swapchain == VK_NULL_HANDLE) {
+        RecreateSwapchain();
+        return m_swapchain != VK_NULL_HANDLE;
+    }
+    
+    if (m_swapchainSuboptimal) {
+        VkExtent2D clientExtent = GetWindowClientExtent();
+        auto now = std::chrono::steady_clock::now();
+        
+        if (clientExtent.width != m_pendingResizeExtent.width || clientExtent.height != m_pendingResizeExtent.height) {
+            // 尺寸仍在变化（拖动中），继续使用当前交换链
+            m_pendingResizeExtent = clientExtent;
+            m_pendingResizeTime = now;
+        } else if (now - m_pendingResizeTime >= std::chrono::milliseconds(config::SWAPCHAIN_RESIZE_DEBOUNCE_MS)) {
+            RecreateSwapchain();
+        }
+    }
+    
+    return true;
+}
+
+void VulkanRenderer::MarkSwapchainSuboptimal() {
+    if (m_swapchainSuboptimal) {
+        return;
+    }
+    
+    m_swapchainSuboptimal = true;
+    m_pendingResizeExtent = m_swapchainExtent;
+    m_pendingResizeTime = std::chrono::steady_clock::now();
+}
+
+void VulkanRenderer::ReleaseRetiredSwapchains(bool waitAll) {
+    if (waitAll) {
+        // 调用方已等待设备空闲
+        m_completedSerial = m_submitSerial;
+    } else if (!m_frameSubmitSerials.empty() && m_frameSubmitSerials[m_currentFrame] > m_completedSerial) {
+        // 当前帧槽位的栅栏已触发：同一队列上更早提交的工作也都已完成
+        m_completedSerial = m_frameSubmitSerials[m_currentFrame];
+    }
+    
+    m_retiredSwapchains.Release(m_completedSerial, [this](RetiredSwapchain& retired) {
+        for (VkFramebuffer framebuffer : retired.framebuffers) {
+            vkDestroyFramebuffer(m_device, framebuffer, nullptr);
+        }
+        for (VkImageView imageView : retired.imageViews) {
+            vkDestroyImageView(m_device, imageView, nullptr);
+        }
+        if (retired.swapchain != VK_NULL_HANDLE) {
+            vkDestroySwapchainKHR(m_device, retired.swapchain, nullptr);
+        }
+    });
+    
+    if (m_cubeRasterizer) {
+        m_cubeRasterizer->ReleaseRetiredTargets(m_completedSerial);
+    }
+    if (m_resolutionScaler) {
+        m_resolutionScaler->ReleaseRetiredTargets(m_completedSerial);
+    }
+    if (m_computeScene) {
+        m_computeScene->ReleaseRetiredTargets(m_completedSerial);
+    }
+    if (m_temporalResolver) {
+        m_temporalResolver->ReleaseRetiredTargets(m_completedSerial);
+    }
+    if (m_pipelineRegistry) {
+        m_pipelineRegistry->ReleaseRetired(m_completedSerial);
+    }
+}
+
+bool VulkanRenderer::EnsureCommandBufferCount(uint32_t count) {
+    if (m_commandBuffers.size() >= count) {
+        return true;
+    }
+    
+    uint32_t oldCount = (uint32_t)m_commandBuffers.size();
+    m_commandBuffers.resize(count);
+    
+    VkCommandBufferAllocateInfo allocInfo = {};
+    allocInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+    allocInfo.commandPool = m_commandPool;
+    allocInfo.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+    allocInfo.commandBufferCount = count - oldCount;
+    
+    VkResult result = vkAllocateCommandBuffers(m_device, &allocInfo, m_commandBuffers.data() + oldCount);
+    if (result != VK_SUCCESS) {
+        m_commandBuffers.resize(oldCount);
+        Window::ShowError("Failed to allocate command buffers!");
+        return false;
+    }
+    
+    m_imagesInFlight.resize(count, VK_NULL_HANDLE);
+    m_recordedFrames.resize(count);
+    
+    return true;
+}
+
+bool VulkanRenderer::RecordCommandBuffer(VkCommandBuffer commandBuffer, uint32_t imageIndex, bool useLoadingCubes, bool pipelineReady,
+                                         bool rasterCubes, float renderScale, bool computeScene, bool temporalCubes,
+                                         ITextRenderer* textRenderer, const std::string& fpsText) {
+    // 不使用 ONE_TIME_SUBMIT：录制结果在内容不变时被重复提交
+    VkCommandBufferBeginInfo beginInfo = {};
+    beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+    
     VkResult result = vkBeginCommandBuffer(commandBuffer, &beginInfo);
     if (result != VK_SUCCESS) {
         Window::ShowError("Failed to begin recording command buffer!");
-        return;
+        return false;
+    }
+    
+    // 查询重置必须在渲染通道之外
+    if (m_gpuProfiler) {
+        m_gpuProfiler->CmdBeginFrame(commandBuffer, imageIndex);
     }
     
     VkRenderPassBeginInfo renderPassInfo = {};
@@ -913,15 +2178,36 @@ void VulkanRenderer::RecordCommandBuffer(VkCommandBuffer commandBuffer, uint32_t
     renderPassInfo.clearValueCount = 1;
     renderPassInfo.pClearValues = &clearColor;
     
-    vkCmdBeginRenderPass(commandBuffer, &renderPassInfo, VK_SUBPASS_CONTENTS_INLINE);
+    // 光栅化立方体在独立的渲染通道（多重采样 + 深度）中绘制并解析到交换链图像，主渲染通道保留该内容继续绘制UI
+    if (rasterCubes) {
+        renderPassInfo.renderPass = m_renderPassLoad;
+        renderPassInfo.clearValueCount = 0;
+        renderPassInfo.pClearValues = nullptr;
+        
+        if (m_gpuProfiler) {
+            m_gpuProfiler->CmdBeginPass(commandBuffer, imageIndex, GpuProfilerPass::Scene);
+        }
+        m_cubeRasterizer->Record(commandBuffer, imageIndex, m_loadingCubesPipelineLayout, m_sceneUniforms[imageIndex].descriptorSet,
+                                 (uint32_t)LOADING_CUBE_COUNT, clearColor.color);
+        if (m_gpuProfiler) {
+            m_gpuProfiler->CmdEndPass(commandBuffer, imageIndex, GpuProfilerPass::Scene);
+        }
+    }
     
-    // 根据状态选择pipeline
-    if (useLoadingCubes) {
-        vkCmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, m_loadingCubesPipeline);
-    } else {
-        vkCmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, m_graphicsPipeline);
+    // loading_cubes 的屏幕分块剔除（计算调度必须在渲染通道之外；光栅化路径不需要，计算路径在每个工作组内剔除）
+    if (pipelineReady && useLoadingCubes && !rasterCubes && !computeScene && m_loadingCubesCullPipeline != VK_NULL_HANDLE) {
+        if (m_gpuProfiler) {
+            m_gpuProfiler->CmdBeginPass(commandBuffer, imageIndex, GpuProfilerPass::CubeCulling);
+        }
+        RecordLoadingCubesCulling(commandBuffer, imageIndex);
+        if (m_gpuProfiler) {
+            m_gpuProfiler->CmdEndPass(commandBuffer, imageIndex, GpuProfilerPass::CubeCulling);
+        }
     }
     
+    // 管线仍在后台编译时只清屏，光栅化路径已在上面绘制场景
+    bool drawScene = pipelineReady && !rasterCubes;
+    
     // Calculate viewport and scissor with stretch mode and aspect ratio scaling (like Godot)
     // Reference: Godot's window.cpp _update_viewport_size() and viewport.cpp _set_size()
     const float baseWidth = (float)config::WINDOW_WIDTH;   // desired_res (target resolution)
@@ -931,7 +2217,6 @@ void VulkanRenderer::RecordCommandBuffer(VkCommandBuffer commandBuffer, uint32_t
     
     VkViewport viewport = {};
     VkRect2D scissor = {};
-    float aspect = 1.0f;  // Aspect ratio for shader
     
     // loading_cubes shader全屏显示，忽略stretch mode
     if (useLoadingCubes) {
@@ -944,8 +2229,6 @@ void VulkanRenderer::RecordCommandBuffer(VkCommandBuffer commandBuffer, uint32_t
         
         scissor.offset = {0, 0};
         scissor.extent = m_swapchainExtent;
-        
-        aspect = (float)m_swapchainExtent.width / (float)m_swapchainExtent.height;
     } else {
         // 其他shader使用原来的stretch mode逻辑
         switch (m_stretchMode) {
@@ -963,7 +2246,6 @@ void VulkanRenderer::RecordCommandBuffer(VkCommandBuffer commandBuffer, uint32_t
             scissor.offset.y = (int32_t)offsetY;
             scissor.extent.width = (uint32_t)baseWidth;
             scissor.extent.height = (uint32_t)baseHeight;
-            aspect = targetAspect;
             break;
         }
         case StretchMode::Scaled: {
@@ -999,9 +2281,6 @@ void VulkanRenderer::RecordCommandBuffer(VkCommandBuffer commandBuffer, uint32_t
             scissor.offset.y = (int32_t)offsetY;
             scissor.extent.width = (uint32_t)viewportWidth;
             scissor.extent.height = (uint32_t)viewportHeight;
-            
-            // aspect 设置为目标宽高比（1.0），与 Disabled 模式保持一致
-            aspect = targetAspect;
             break;
         }
         case StretchMode::Fit: {
@@ -1039,7 +2318,6 @@ void VulkanRenderer::RecordCommandBuffer(VkCommandBuffer commandBuffer, uint32_t
                 scissor.extent.width = (uint32_t)viewportWidth;
                 scissor.extent.height = (uint32_t)viewportHeight;
             }
-            aspect = targetAspect;
             break;
         }
         }  // 结束 switch 语句
@@ -1048,29 +2326,76 @@ void VulkanRenderer::RecordCommandBuffer(VkCommandBuffer commandBuffer, uint32_t
         viewport.maxDepth = 1.0f;
     }
     
-    // Set dynamic viewport and scissor (like Godot)
-    vkCmdSetViewport(commandBuffer, 0, 1, &viewport);
-    vkCmdSetScissor(commandBuffer, 0, 1, &scissor);
+    // 计算路径：场景在渲染通道之外写入存储图像，之后在主渲染通道开头合成到交换链图像
+    bool graphicsScene = drawScene && !computeScene && !temporalCubes;
+    if (drawScene && computeScene) {
+        ScenePipelineType sceneType = useLoadingCubes ? ScenePipelineType::LoadingCubes : ScenePipelineType::Shader;
+        if (m_gpuProfiler) {
+            m_gpuProfiler->CmdBeginPass(commandBuffer, imageIndex, GpuProfilerPass::Scene);
+        }
+        m_computeScene->RecordDispatch(commandBuffer, sceneType, m_sceneUniforms[imageIndex].descriptorSet, viewport, scissor);
+        if (m_gpuProfiler) {
+            m_gpuProfiler->CmdEndPass(commandBuffer, imageIndex, GpuProfilerPass::Scene);
+        }
+    }
     
-    // 推送常量
-    VkPipelineLayout currentPipelineLayout = useLoadingCubes ? m_loadingCubesPipelineLayout : m_pipelineLayout;
-    if (useLoadingCubes) {
-        // loading_cubes shader需要7个参数：time + aspect + cameraYaw + cameraPitch + cameraPosX + cameraPosY + cameraPosZ
-        float pushConstants[7] = {
-            time, aspect,
-            m_cameraYaw, m_cameraPitch,
-            m_cameraPosX, m_cameraPosY, m_cameraPosZ
-        };
-        vkCmdPushConstants(commandBuffer, currentPipelineLayout, VK_SHADER_STAGE_FRAGMENT_BIT, 0, sizeof(float) * 7, pushConstants);
+    // 时间抗锯齿路径：单采样场景和历史解析在渲染通道之外完成，之后在主渲染通道开头合成到交换链图像
+    if (drawScene && temporalCubes) {
+        if (m_gpuProfiler) {
+            m_gpuProfiler->CmdBeginPass(commandBuffer, imageIndex, GpuProfilerPass::Scene);
+        }
+        m_temporalResolver->RecordScene(commandBuffer, m_loadingCubesPipelineLayout, m_sceneUniforms[imageIndex].descriptorSet, clearColor);
+        if (m_gpuProfiler) {
+            m_gpuProfiler->CmdEndPass(commandBuffer, imageIndex, GpuProfilerPass::Scene);
+            m_gpuProfiler->CmdBeginPass(commandBuffer, imageIndex, GpuProfilerPass::TemporalResolve);
+        }
+        m_temporalResolver->RecordResolve(commandBuffer, m_sceneUniforms[imageIndex].descriptorSet);
+        if (m_gpuProfiler) {
+            m_gpuProfiler->CmdEndPass(commandBuffer, imageIndex, GpuProfilerPass::TemporalResolve);
+        }
+    }
+    
+    // 动态分辨率：场景以缩小的视口渲染到离屏目标，之后在主渲染通道开头放大到交换链图像
+    bool scaledScene = graphicsScene && renderScale < 1.0f;
+    VkViewport sceneViewport = viewport;
+    VkRect2D sceneScissor = scissor;
+    if (scaledScene) {
+        m_resolutionScaler->ScaleViewport(renderScale, sceneViewport, sceneScissor);
+        m_resolutionScaler->BeginScenePass(commandBuffer, renderScale, clearColor);
     } else {
-        // 普通shader只需要2个参数：time + aspect
-        float pushConstants[2] = {time, aspect};
-        vkCmdPushConstants(commandBuffer, currentPipelineLayout, VK_SHADER_STAGE_FRAGMENT_BIT, 0, sizeof(float) * 2, pushConstants);
+        vkCmdBeginRenderPass(commandBuffer, &renderPassInfo, VK_SUBPASS_CONTENTS_INLINE);
+    }
+    
+    // 根据状态选择pipeline
+    if (graphicsScene) {
+        if (useLoadingCubes) {
+            vkCmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, m_loadingCubesPipeline);
+        } else {
+            vkCmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, m_graphicsPipeline);
+        }
+    }
+    
+    // Set dynamic viewport and scissor (like Godot)
+    vkCmdSetViewport(commandBuffer, 0, 1, &sceneViewport);
+    vkCmdSetScissor(commandBuffer, 0, 1, &sceneScissor);
+    
+    // 场景参数（time、aspect、相机）绑定该图像的统一缓冲区，由 UpdateSceneUniforms 每帧更新
+    if (graphicsScene) {
+        VkPipelineLayout currentPipelineLayout = useLoadingCubes ? m_loadingCubesPipelineLayout : m_pipelineLayout;
+        vkCmdBindDescriptorSets(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, currentPipelineLayout,
+                                0, 1, &m_sceneUniforms[imageIndex].descriptorSet, 0, nullptr);
+    }
+    
+    bool profileScene = (m_gpuProfiler != nullptr && graphicsScene);
+    if (profileScene) {
+        m_gpuProfiler->CmdBeginPass(commandBuffer, imageIndex, GpuProfilerPass::Scene);
     }
     
     // 如果支持硬件光线追踪且pipeline已创建，使用硬件光追
     // 否则使用软件ray casting（当前实现）
-    if (useLoadingCubes && m_rayTracingSupported && m_rayTracingPipeline != VK_NULL_HANDLE) {
+    if (!graphicsScene) {
+        // 场景管线仍在编译（本帧只清屏），或场景已由光栅化渲染通道 / 计算着色器 / 时间抗锯齿通道绘制
+    } else if (useLoadingCubes && m_rayTracingSupported && m_rayTracingPipeline != VK_NULL_HANDLE) {
         // 硬件光线追踪渲染路径
         // 注意：这需要完整的实现，包括：
         // - Acceleration structures已构建（BVH树等）
@@ -1116,46 +2441,75 @@ void VulkanRenderer::RecordCommandBuffer(VkCommandBuffer commandBuffer, uint32_t
         vkCmdDraw(commandBuffer, 6, 1, 0, 0);
     }
     
-    // 渲染帧率文本（左上角）
-    if (textRenderer && fps > 0.0f) {
-        char fpsText[32];
-        sprintf_s(fpsText, "FPS: %.1f", fps);
+    if (profileScene) {
+        m_gpuProfiler->CmdEndPass(commandBuffer, imageIndex, GpuProfilerPass::Scene);
+    }
+    
+    // 放大覆盖整个交换链图像（包括黑边区域），UI在原生分辨率下继续绘制
+    if (scaledScene) {
+        vkCmdEndRenderPass(commandBuffer);
+        vkCmdBeginRenderPass(commandBuffer, &renderPassInfo, VK_SUBPASS_CONTENTS_INLINE);
         
+        if (m_gpuProfiler) {
+            m_gpuProfiler->CmdBeginPass(commandBuffer, imageIndex, GpuProfilerPass::Upscale);
+        }
+        m_resolutionScaler->RecordUpscale(commandBuffer, renderScale);
+        if (m_gpuProfiler) {
+            m_gpuProfiler->CmdEndPass(commandBuffer, imageIndex, GpuProfilerPass::Upscale);
+        }
+        
+        vkCmdSetViewport(commandBuffer, 0, 1, &viewport);
+        vkCmdSetScissor(commandBuffer, 0, 1, &scissor);
+    }
+    
+    // 合成只覆盖场景视口（黑边保持清屏颜色），之后恢复UI使用的视口
+    if (drawScene && computeScene) {
+        if (m_gpuProfiler) {
+            m_gpuProfiler->CmdBeginPass(commandBuffer, imageIndex, GpuProfilerPass::Composite);
+        }
+        m_computeScene->RecordComposite(commandBuffer, scissor);
+        if (m_gpuProfiler) {
+            m_gpuProfiler->CmdEndPass(commandBuffer, imageIndex, GpuProfilerPass::Composite);
+        }
+        
+        vkCmdSetViewport(commandBuffer, 0, 1, &viewport);
+        vkCmdSetScissor(commandBuffer, 0, 1, &scissor);
+    }
+    
+    // 时间抗锯齿的解析结果与交换链同尺寸，覆盖整个图像
+    if (drawScene && temporalCubes) {
+        if (m_gpuProfiler) {
+            m_gpuProfiler->CmdBeginPass(commandBuffer, imageIndex, GpuProfilerPass::Composite);
+        }
+        m_temporalResolver->RecordComposite(commandBuffer);
+        if (m_gpuProfiler) {
+            m_gpuProfiler->CmdEndPass(commandBuffer, imageIndex, GpuProfilerPass::Composite);
+        }
+        
+        vkCmdSetViewport(commandBuffer, 0, 1, &viewport);
+        vkCmdSetScissor(commandBuffer, 0, 1, &scissor);
+    }
+    
+    // 渲染帧率文本（左上角），GPU分析器的叠加文本逐行显示在其下方
+    if (textRenderer && !fpsText.empty()) {
         // 计算左上角位置（在视口坐标系中）
         float textX = 10.0f;  // 距离左边10像素
         float textY = 10.0f;  // 距离顶部10像素
+        float offsetX = 0.0f, offsetY = 0.0f;
         
-        // 根据不同的stretch mode调整文本位置
-        if (useLoadingCubes) {
-            // loading_cubes模式：使用全屏坐标系
-            textRenderer->RenderText(static_cast<CommandBufferHandle>(commandBuffer), fpsText, textX, textY, 
-                                    (float)m_swapchainExtent.width, (float)m_swapchainExtent.height,
-                                    1.0f, 1.0f, 0.0f, 1.0f);  // 黄色文本
-        } else {
-            // 其他模式：需要考虑视口偏移
+        // 根据不同的stretch mode调整文本位置（loading_cubes模式使用全屏坐标系，不需要偏移）
+        if (!useLoadingCubes) {
             switch (m_stretchMode) {
-            case StretchMode::Disabled: {
-                // Disabled模式：视口居中，需要加上偏移
-                float offsetX = ((float)m_swapchainExtent.width - baseWidth) * 0.5f;
-                float offsetY = ((float)m_swapchainExtent.height - baseHeight) * 0.5f;
-                textRenderer->RenderText(static_cast<CommandBufferHandle>(commandBuffer), fpsText, textX + offsetX, textY + offsetY,
-                                        (float)m_swapchainExtent.width, (float)m_swapchainExtent.height,
-                                        1.0f, 1.0f, 0.0f, 1.0f);  // 黄色文本
-                break;
-            }
+            case StretchMode::Disabled:
             case StretchMode::Scaled: {
-                // Scaled模式：视口居中，需要加上偏移
-                float offsetX = ((float)m_swapchainExtent.width - baseWidth) * 0.5f;
-                float offsetY = ((float)m_swapchainExtent.height - baseHeight) * 0.5f;
-                textRenderer->RenderText(static_cast<CommandBufferHandle>(commandBuffer), fpsText, textX + offsetX, textY + offsetY,
-                                        (float)m_swapchainExtent.width, (float)m_swapchainExtent.height,
-                                        1.0f, 1.0f, 0.0f, 1.0f);  // 黄色文本
+                // Disabled/Scaled模式：视口居中，需要加上偏移
+                offsetX = ((float)m_swapchainExtent.width - baseWidth) * 0.5f;
+                offsetY = ((float)m_swapchainExtent.height - baseHeight) * 0.5f;
                 break;
             }
             case StretchMode::Fit: {
                 // Fit模式：视口可能居中，需要加上偏移
                 const float currentAspect = (float)m_swapchainExtent.width / (float)m_swapchainExtent.height;
-                float offsetX = 0.0f, offsetY = 0.0f;
                 if (currentAspect > targetAspect) {
                     // 窗口宽高比大于目标宽高比时，在左右添加黑边以保持宽高比
                     float viewportHeight = (float)m_swapchainExtent.height;
@@ -1167,86 +2521,288 @@ void VulkanRenderer::RecordCommandBuffer(VkCommandBuffer commandBuffer, uint32_t
                     float viewportHeight = viewportWidth / targetAspect;
                     offsetY = ((float)m_swapchainExtent.height - viewportHeight) * 0.5f;
                 }
-                textRenderer->RenderText(static_cast<CommandBufferHandle>(commandBuffer), fpsText, textX + offsetX, textY + offsetY,
-                                        (float)m_swapchainExtent.width, (float)m_swapchainExtent.height,
-                                        1.0f, 1.0f, 0.0f, 1.0f);  // 黄色文本
                 break;
             }
             }
         }
+        
+        // 多行文本共用文本渲染器的顶点缓冲区，必须合并为一个批次绘制
+        CommandBufferHandle textCommandBuffer = static_cast<CommandBufferHandle>(commandBuffer);
+        float screenWidth = (float)m_swapchainExtent.width;
+        float screenHeight = (float)m_swapchainExtent.height;
+        
+        if (m_gpuProfiler) {
+            m_gpuProfiler->CmdBeginPass(commandBuffer, imageIndex, GpuProfilerPass::TextBatch);
+        }
+        
+        textRenderer->BeginTextBatch();
+        textRenderer->RenderText(textCommandBuffer, fpsText, textX + offsetX, textY + offsetY,
+                                 screenWidth, screenHeight, 1.0f, 1.0f, 0.0f, 1.0f);  // 黄色文本
+        if (m_gpuProfiler) {
+            float lineHeight = (float)textRenderer->GetFontSize() * 1.25f;
+            const std::vector<std::string>& overlayLines = m_gpuProfiler->GetOverlayLines();
+            for (size_t i = 0; i < overlayLines.size(); i++) {
+                textRenderer->RenderText(textCommandBuffer, overlayLines[i], textX + offsetX,
+                                         textY + offsetY + lineHeight * (float)(i + 1),
+                                         screenWidth, screenHeight, 0.6f, 1.0f, 0.6f, 1.0f);  // 浅绿色文本
+            }
+        }
+        textRenderer->EndTextBatch(textCommandBuffer, screenWidth, screenHeight, 0.0f, 0.0f);
+        
+        if (m_gpuProfiler) {
+            m_gpuProfiler->CmdEndPass(commandBuffer, imageIndex, GpuProfilerPass::TextBatch);
+        }
     }
     
     vkCmdEndRenderPass(commandBuffer);
     
+    if (m_gpuProfiler) {
+        m_gpuProfiler->CmdEndFrame(commandBuffer, imageIndex);
+    }
+    
     result = vkEndCommandBuffer(commandBuffer);
     if (result != VK_SUCCESS) {
         Window::ShowError("Failed to record command buffer!");
+        return false;
     }
+    
+    return true;
 }
 
-bool VulkanRenderer::DrawFrame(float time, bool useLoadingCubes, ITextRenderer* textRenderer, float fps) {
-    VkResult result = vkWaitForFences(m_device, 1, &m_inFlightFences[m_currentFrame], VK_TRUE, UINT64_MAX);
-    if (result != VK_SUCCESS) {
-        Window::ShowError("Failed to wait for fences!");
-        return false;
+VkResult VulkanRenderer::AcquireFrameImage(uint32_t* imageIndex) {
+    if (m_headless) {
+        // 离屏目标数量等于帧并发数，当前帧槽位的栅栏已等待完成，对应图像可直接复用
+        *imageIndex = m_currentFrame;
+        m_imagesInFlight[*imageIndex] = m_inFlightFences[m_currentFrame];
+        return VK_SUCCESS;
     }
     
-    uint32_t imageIndex;
-    result = vkAcquireNextImageKHR(m_device, m_swapchain, UINT64_MAX, m_imageAvailableSemaphores[m_currentFrame], VK_NULL_HANDLE, &imageIndex);
-    
-    if (result == VK_ERROR_OUT_OF_DATE_KHR || result == VK_SUBOPTIMAL_KHR) {
-        RecreateSwapchain();
-        // 重新获取窗口客户端区域尺寸，确保swapchain extent与窗口大小一致
-        RECT clientRect;
-        GetClientRect(m_hwnd, &clientRect);
-        m_swapchainExtent.width = clientRect.right - clientRect.left;
-        m_swapchainExtent.height = clientRect.bottom - clientRect.top;
-        return false;
-    } else if (result != VK_SUCCESS) {
-        Window::ShowError("Failed to acquire swap chain image!");
-        return false;
+    VkResult result = vkAcquireNextImageKHR(m_device, m_swapchain, UINT64_MAX, m_imageAvailableSemaphores[m_currentFrame], VK_NULL_HANDLE, imageIndex);
+    if (result == VK_SUCCESS || result == VK_SUBOPTIMAL_KHR) {
+        WaitForImageInFlight(*imageIndex);
     }
-    
-    vkResetFences(m_device, 1, &m_inFlightFences[m_currentFrame]);
-    
-    vkResetCommandBuffer(m_commandBuffers[imageIndex], 0);
-    RecordCommandBuffer(m_commandBuffers[imageIndex], imageIndex, time, useLoadingCubes, textRenderer, fps);
-    
+    return result;
+}
+
+void VulkanRenderer::WaitForImageInFlight(uint32_t imageIndex) {
+    // 图像的获取顺序不一定与帧槽位一致：该图像的命令缓冲区和统一缓冲区可能仍被另一个帧槽位的提交使用
+    VkFence imageFence = m_imagesInFlight[imageIndex];
+    if (imageFence != VK_NULL_HANDLE && imageFence != m_inFlightFences[m_currentFrame]) {
+        vkWaitForFences(m_device, 1, &imageFence, VK_TRUE, UINT64_MAX);
+    }
+    m_imagesInFlight[imageIndex] = m_inFlightFences[m_currentFrame];
+}
+
+bool VulkanRenderer::SubmitFrame(uint32_t imageIndex) {
     VkSubmitInfo submitInfo = {};
     submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
-    
-    VkSemaphore waitSemaphores[] = {m_imageAvailableSemaphores[m_currentFrame]};
-    VkPipelineStageFlags waitStages[] = {VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT};
-    submitInfo.waitSemaphoreCount = 1;
-    submitInfo.pWaitSemaphores = waitSemaphores;
-    submitInfo.pWaitDstStageMask = waitStages;
     submitInfo.commandBufferCount = 1;
     submitInfo.pCommandBuffers = &m_commandBuffers[imageIndex];
     
+    VkSemaphore waitSemaphores[] = {m_imageAvailableSemaphores[m_currentFrame]};
+    VkPipelineStageFlags waitStages[] = {VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT};
     VkSemaphore signalSemaphores[] = {m_renderFinishedSemaphores[m_currentFrame]};
-    submitInfo.signalSemaphoreCount = 1;
-    submitInfo.pSignalSemaphores = signalSemaphores;
     
-    result = vkQueueSubmit(m_graphicsQueue, 1, &submitInfo, m_inFlightFences[m_currentFrame]);
+    // headless模式没有获取/呈现操作，只依靠栅栏同步
+    if (!m_headless) {
+        submitInfo.waitSemaphoreCount = 1;
+        submitInfo.pWaitSemaphores = waitSemaphores;
+        submitInfo.pWaitDstStageMask = waitStages;
+        submitInfo.signalSemaphoreCount = 1;
+        submitInfo.pSignalSemaphores = signalSemaphores;
+    }
+    
+    VkResult result = vkQueueSubmit(m_graphicsQueue, 1, &submitInfo, m_inFlightFences[m_currentFrame]);
     if (result != VK_SUCCESS) {
         Window::ShowError("Failed to submit draw command buffer!");
         return false;
     }
     
+    // 记录提交序号，用于判断退役的交换链资源何时不再被使用
+    m_frameSubmitSerials[m_currentFrame] = ++m_submitSerial;
+    if (m_pipelineRegistry) {
+        m_pipelineRegistry->OnFrameSubmitted(m_submitSerial);
+    }
+    
+    if (m_gpuProfiler) {
+        m_gpuProfiler->MarkSubmitted(imageIndex);
+    }
+    
+    return true;
+}
+
+VkResult VulkanRenderer::PresentFrame(uint32_t imageIndex) {
+    if (m_headless) {
+        return VK_SUCCESS;
+    }
+    
     VkPresentInfoKHR presentInfo = {};
     presentInfo.sType = VK_STRUCTURE_TYPE_PRESENT_INFO_KHR;
     presentInfo.waitSemaphoreCount = 1;
-    presentInfo.pWaitSemaphores = signalSemaphores;
+    presentInfo.pWaitSemaphores = &m_renderFinishedSemaphores[m_currentFrame];
     
     VkSwapchainKHR swapChains[] = {m_swapchain};
     presentInfo.swapchainCount = 1;
     presentInfo.pSwapchains = swapChains;
     presentInfo.pImageIndices = &imageIndex;
     
-    result = vkQueuePresentKHR(m_presentQueue, &presentInfo);
+    return vkQueuePresentKHR(m_presentQueue, &presentInfo);
+}
+
+bool VulkanRenderer::DrawFrame(float time, bool useLoadingCubes, ITextRenderer* textRenderer, float fps) {
+    TraceScope drawScope("DrawFrame");
+    ReportScenePipelineErrors();
+    
+    TraceScope fenceScope("WaitForFences");
+    auto waitStart = std::chrono::steady_clock::now();
+    VkResult result = vkWaitForFences(m_device, 1, &m_inFlightFences[m_currentFrame], VK_TRUE, UINT64_MAX);
+    m_frameWaitMs = MillisecondsSince(waitStart);
+    fenceScope.End();
+    if (result != VK_SUCCESS) {
+        Window::ShowError("Failed to wait for fences!");
+        return false;
+    }
+    
+    // 该帧槽位的栅栏已触发，回收不再使用的旧交换链资源
+    ReleaseRetiredSwapchains(false);
+    if (!PrepareSwapchainForFrame()) {
+        return false;
+    }
+    
+    // 获取图像可能阻塞在 vkAcquireNextImageKHR 或等待该图像上一次提交的栅栏
+    uint32_t imageIndex;
+    TraceScope acquireScope("AcquireImage");
+    waitStart = std::chrono::steady_clock::now();
+    result = AcquireFrameImage(&imageIndex);
+    m_frameWaitMs += MillisecondsSince(waitStart);
+    acquireScope.End();
+    
+    if (result == VK_ERROR_OUT_OF_DATE_KHR) {
+        // 交换链已不可用，必须立即重建（没有获取到图像）
+        RecreateSwapchain();
+        return false;
+    } else if (result == VK_SUBOPTIMAL_KHR) {
+        // 图像已获取且仍可呈现，继续渲染本帧，尺寸稳定后再重建
+        MarkSwapchainSuboptimal();
+    } else if (result != VK_SUCCESS) {
+        Window::ShowError("Failed to acquire swap chain image!");
+        return false;
+    }
+    
+    vkResetFences(m_device, 1, &m_inFlightFences[m_currentFrame]);
+    
+    // 该图像上一次提交已完成（AcquireFrameImage 已等待），读取其时间戳不会阻塞
+    // 动态分辨率按读回的整帧GPU耗时调整场景比例（结果滞后交换链图像数量帧，控制器按间隔调整）
+    if (m_gpuProfiler && m_gpuProfiler->CollectResults(imageIndex) && m_resolutionController) {
+        if (m_resolutionController->Update(m_gpuProfiler->GetLastPassMs(GpuProfilerPass::Frame))) {
+            printf("[DYNAMIC_RES] Render scale %.2f (GPU %.2f ms, budget %.2f ms)\n", m_resolutionController->GetScale(),
+                   m_gpuProfiler->GetLastPassMs(GpuProfilerPass::Frame), m_resolutionController->GetBudgetMs());
+        }
+    }
+    
+    // FPS文本的顶点写入文本渲染器的共享顶点缓冲区，文本变化时所有图像都需要重新录制
+    std::string fpsText;
+    if (textRenderer && fps > 0.0f) {
+        char fpsBuffer[32];
+        snprintf(fpsBuffer, sizeof(fpsBuffer), "FPS: %.1f", fps);
+        fpsText = fpsBuffer;
+    }
+    uint64_t overlayVersion = m_gpuProfiler ? m_gpuProfiler->GetOverlayVersion() : 0;
+    // 字形被淘汰或图集重建后，已录制的文本顶点可能引用已被其他字形占用的图集单元；
+    // 顶点缓冲区换用后，已录制的绘制引用的顶点缓冲区会被回收复用
+    uint64_t atlasVersion = textRenderer ? textRenderer->GetAtlasVersion() : 0;
+    uint64_t textVertexVersion = textRenderer ? textRenderer->GetVertexBufferVersion() : 0;
+    if (fpsText != m_recordedFpsText || overlayVersion != m_recordedOverlayVersion || atlasVersion != m_recordedAtlasVersion ||
+        textVertexVersion != m_recordedTextVertexVersion) {
+        m_recordedFpsText = fpsText;
+        m_recordedOverlayVersion = overlayVersion;
+        m_recordedAtlasVersion = atlasVersion;
+        m_recordedTextVertexVersion = textVertexVersion;
+        InvalidateRecordedFrames();
+    }
+    
+    // 只有录制内容改变时才重新录制，否则直接重新提交该图像上次录制的命令缓冲区
+    bool pipelineReady = GetScenePipelineState(useLoadingCubes ? ScenePipelineType::LoadingCubes
+                                                               : ScenePipelineType::Shader) == ScenePipelineState::Ready;
+    
+    // 光栅化管线随 loading_cubes 管线一起发布；渲染目标在首次使用时创建，创建失败时本帧使用光线投射
+    bool rasterCubes = useLoadingCubes && pipelineReady && m_cubeRenderMode == CubeRenderMode::Raster &&
+                       m_cubeRasterizer && m_cubeRasterizer->HasPipeline() &&
+                       m_cubeRasterizer->EnsureTargets(m_swapchainExtent, m_swapchainImageViews);
+    
+    // 时间抗锯齿管线同样随 loading_cubes 管线发布；渲染目标在首次使用时创建，创建失败时本帧使用超采样光线投射
+    bool temporalCubes = useLoadingCubes && pipelineReady && !rasterCubes && m_cubeRenderMode == CubeRenderMode::Temporal &&
+                         m_temporalResolver && m_temporalResolver->HasPipeline() &&
+                         m_temporalResolver->EnsureTarget(m_swapchainExtent);
+    
+    // 计算管线变体随场景管线一起发布；存储图像在首次使用时创建，创建失败时本帧使用图形管线
+    ScenePipelineType sceneType = useLoadingCubes ? ScenePipelineType::LoadingCubes : ScenePipelineType::Shader;
+    bool computeScene = pipelineReady && !rasterCubes && !temporalCubes && m_sceneExecutionPath == SceneExecutionPath::Compute &&
+                        m_computeScene && m_computeScene->HasPipeline(sceneType) &&
+                        m_computeScene->EnsureTarget(m_swapchainExtent);
+    
+    // 动态分辨率只作用于图形管线的全屏着色器场景（光栅化立方体不受像素着色开销限制，时间抗锯齿的历史按交换链尺寸保存）；
+    // 比例为 1 时直接渲染到交换链图像
+    float renderScale = 1.0f;
+    if (m_resolutionController && pipelineReady && !rasterCubes && !temporalCubes && !computeScene &&
+        m_resolutionController->GetScale() < 1.0f && m_resolutionScaler->EnsureTarget(m_swapchainExtent)) {
+        renderScale = m_resolutionController->GetScale();
+    }
+    
+    // 逐帧变化的参数（时间、相机、抖动）写入该图像的统一缓冲区，不影响已录制的命令
+    UpdateSceneUniforms(imageIndex, time, useLoadingCubes, temporalCubes);
+    
+    // 历史图像的初始布局转换只能提交一次，之后需要重新录制不含转换的命令缓冲区
+    bool temporalHistoryInit = temporalCubes && !m_temporalResolver->IsHistoryInitialized();
+    
+    RecordedFrameState& recorded = m_recordedFrames[imageIndex];
+    if (recorded.generation != m_recordGeneration || recorded.useLoadingCubes != useLoadingCubes ||
+        recorded.pipelineReady != pipelineReady || recorded.rasterCubes != rasterCubes ||
+        recorded.renderScale != renderScale || recorded.computeScene != computeScene ||
+        recorded.temporalCubes != temporalCubes || recorded.temporalHistoryInit != temporalHistoryInit ||
+        recorded.textRenderer != textRenderer) {
+        TraceScope recordScope("RecordCommandBuffer");
+        vkResetCommandBuffer(m_commandBuffers[imageIndex], 0);
+        if (RecordCommandBuffer(m_commandBuffers[imageIndex], imageIndex, useLoadingCubes, pipelineReady, rasterCubes,
+                                renderScale, computeScene, temporalCubes, textRenderer, fpsText)) {
+            recorded.generation = m_recordGeneration;
+            recorded.useLoadingCubes = useLoadingCubes;
+            recorded.pipelineReady = pipelineReady;
+            recorded.rasterCubes = rasterCubes;
+            recorded.renderScale = renderScale;
+            recorded.computeScene = computeScene;
+            recorded.temporalCubes = temporalCubes;
+            recorded.temporalHistoryInit = temporalHistoryInit;
+            recorded.textRenderer = textRenderer;
+        } else {
+            recorded.generation = 0;
+        }
+    }
+    
+    // 录制期间新建的字形在本帧之前上传（上传在单独的提交中，先于本帧提交执行）
+    if (textRenderer) {
+        textRenderer->FlushGlyphUploads();
+    }
+    
+    TraceScope submitScope("Submit");
+    if (!SubmitFrame(imageIndex)) {
+        return false;
+    }
+    if (temporalCubes) {
+        m_temporalResolver->MarkHistoryInitialized();
+    }
+    submitScope.End();
+    
+    TraceScope presentScope("Present");
+    waitStart = std::chrono::steady_clock::now();
+    result = PresentFrame(imageIndex);
+    m_frameWaitMs += MillisecondsSince(waitStart);
+    presentScope.End();
     
-    if (result == VK_ERROR_OUT_OF_DATE_KHR || result == VK_SUBOPTIMAL_KHR) {
+    if (result == VK_ERROR_OUT_OF_DATE_KHR) {
         RecreateSwapchain();
+    } else if (result == VK_SUBOPTIMAL_KHR) {
+        MarkSwapchainSuboptimal();
     } else if (result != VK_SUCCESS) {
         Window::ShowError("Failed to present swap chain image!");
         return false;
@@ -1258,23 +2814,40 @@ bool VulkanRenderer::DrawFrame(float time, bool useLoadingCubes, ITextRenderer*
 }
 
 bool VulkanRenderer::DrawFrameWithLoading(const DrawFrameWithLoadingParams& params) {
+    TraceScope drawScope("DrawFrameWithLoading");
+    ReportScenePipelineErrors();
+    
+    TraceScope fenceScope("WaitForFences");
+    auto waitStart = std::chrono::steady_clock::now();
     VkResult result = vkWaitForFences(m_device, 1, &m_inFlightFences[m_currentFrame], VK_TRUE, UINT64_MAX);
+    m_frameWaitMs = MillisecondsSince(waitStart);
+    fenceScope.End();
     if (result != VK_SUCCESS) {
         Window::ShowError("Failed to wait for fences!");
         return false;
     }
     
-    uint32_t imageIndex;
-    result = vkAcquireNextImageKHR(m_device, m_swapchain, UINT64_MAX, m_imageAvailableSemaphores[m_currentFrame], VK_NULL_HANDLE, &imageIndex);
+    // 该帧槽位的栅栏已触发，回收不再使用的旧交换链资源
+    ReleaseRetiredSwapchains(false);
+    if (!PrepareSwapchainForFrame()) {
+        return false;
+    }
     
-    if (result == VK_ERROR_OUT_OF_DATE_KHR || result == VK_SUBOPTIMAL_KHR) {
+    // 获取图像可能阻塞在 vkAcquireNextImageKHR 或等待该图像上一次提交的栅栏
+    uint32_t imageIndex;
+    TraceScope acquireScope("AcquireImage");
+    waitStart = std::chrono::steady_clock::now();
+    result = AcquireFrameImage(&imageIndex);
+    m_frameWaitMs += MillisecondsSince(waitStart);
+    acquireScope.End();
+    
+    if (result == VK_ERROR_OUT_OF_DATE_KHR) {
+        // 交换链已不可用，必须立即重建（没有获取到图像）
         RecreateSwapchain();
-        // 重新获取窗口客户端区域尺寸，确保swapchain extent与窗口大小一致
-        RECT clientRect;
-        GetClientRect(m_hwnd, &clientRect);
-        m_swapchainExtent.width = clientRect.right - clientRect.left;
-        m_swapchainExtent.height = clientRect.bottom - clientRect.top;
         return false;
+    } else if (result == VK_SUBOPTIMAL_KHR) {
+        // 图像已获取且仍可呈现，继续渲染本帧，尺寸稳定后再重建
+        MarkSwapchainSuboptimal();
     } else if (result != VK_SUCCESS) {
         Window::ShowError("Failed to acquire swap chain image!");
         return false;
@@ -1282,7 +2855,16 @@ bool VulkanRenderer::DrawFrameWithLoading(const DrawFrameWithLoadingParams& para
     
     vkResetFences(m_device, 1, &m_inFlightFences[m_currentFrame]);
     
+    // 该图像上一次提交已完成（AcquireFrameImage 已等待），读取其时间戳不会阻塞
+    if (m_gpuProfiler) {
+        m_gpuProfiler->CollectResults(imageIndex);
+    }
+    
+    // 加载界面每帧重新录制（动画、悬停状态和文本每帧变化），同时覆盖了场景的录制结果
+    InvalidateRecordedFrames();
+    
     // 记录命令缓冲区（只渲染加载动画）
+    TraceScope recordScope("RecordCommandBuffer");
     VkCommandBufferBeginInfo beginInfo = {};
     beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
     
@@ -1292,6 +2874,11 @@ bool VulkanRenderer::DrawFrameWithLoading(const DrawFrameWithLoadingParams& para
         return false;
     }
     
+    // 查询重置必须在渲染通道之外
+    if (m_gpuProfiler) {
+        m_gpuProfiler->CmdBeginFrame(m_commandBuffers[imageIndex], imageIndex);
+    }
+    
     VkRenderPassBeginInfo renderPassInfo = {};
     renderPassInfo.sType = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO;
     renderPassInfo.renderPass = m_renderPass;
@@ -1304,7 +2891,10 @@ bool VulkanRenderer::DrawFrameWithLoading(const DrawFrameWithLoadingParams& para
     renderPassInfo.clearValueCount = 1;
     renderPassInfo.pClearValues = &clearColor;
     
-    vkCmdBeginRenderPass(m_commandBuffers[imageIndex], &renderPassInfo, VK_SUBPASS_CONTENTS_INLINE);
+    // 有并行录制器时各阶段录制到二级命令缓冲区，否则直接录制到主命令缓冲区
+    bool useSecondaryCommandBuffers = (m_secondaryRecorder != nullptr);
+    vkCmdBeginRenderPass(m_commandBuffers[imageIndex], &renderPassInfo,
+                         useSecondaryCommandBuffers ? VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS : VK_SUBPASS_CONTENTS_INLINE);
     
     // 根据不同的拉伸模式设置视口和坐标系
     // UI基准使用背景纹理的原始尺寸（唯一的耦合点）
@@ -1411,40 +3001,8 @@ bool VulkanRenderer::DrawFrameWithLoading(const DrawFrameWithLoadingParams& para
     viewport.minDepth = 0.0f;
     viewport.maxDepth = 1.0f;
     
-    // 先绘制背景纹理（在UI元素之前）
-    // 背景使用独立的viewport和scissor（全屏），完全独立于UI模式
-    if (HasBackgroundTexture()) {
-        // 背景使用全屏viewport和scissor，不受UI拉伸模式影响
-        VkViewport bgViewport = {};
-        bgViewport.x = 0.0f;
-        bgViewport.y = 0.0f;
-        bgViewport.width = (float)m_swapchainExtent.width;
-        bgViewport.height = (float)m_swapchainExtent.height;
-        bgViewport.minDepth = 0.0f;
-        bgViewport.maxDepth = 1.0f;
-        
-        VkRect2D bgScissor = {};
-        bgScissor.offset = {0, 0};
-        bgScissor.extent = m_swapchainExtent;
-        
-        vkCmdSetViewport(m_commandBuffers[imageIndex], 0, 1, &bgViewport);
-        vkCmdSetScissor(m_commandBuffers[imageIndex], 0, 1, &bgScissor);
-        
-        RenderBackgroundTexture(m_commandBuffers[imageIndex], m_swapchainExtent);
-    }
-    
-    // 设置UI的viewport和scissor（独立于背景）
-    vkCmdSetViewport(m_commandBuffers[imageIndex], 0, 1, &viewport);
-    vkCmdSetScissor(m_commandBuffers[imageIndex], 0, 1, &scissor);
-    
-    // 渲染加载动画（方块动画）
-    // UI使用固定的坐标系尺寸（uiExtent），这样UI位置始终正确
-    if (params.loadingAnim) {
-        // 将Vulkan类型转换为抽象类型
-        CommandBufferHandle commandBuffer = static_cast<CommandBufferHandle>(m_commandBuffers[imageIndex]);
-        Extent2D abstractUiExtent = { uiExtent.width, uiExtent.height };
-        params.loadingAnim->Render(commandBuffer, abstractUiExtent);
-    }
+    VkCommandBuffer primaryCommandBuffer = m_commandBuffers[imageIndex];
+    Extent2D abstractUiExtent = { uiExtent.width, uiExtent.height };
     
     // 收集所有按钮并按zIndex排序（数值越大越在上层）
     std::vector<Button*> buttons;
@@ -1480,116 +3038,12 @@ bool VulkanRenderer::DrawFrameWithLoading(const DrawFrameWithLoadingParams& para
               });
     
     // 根据不同的拉伸模式设置按钮渲染的 viewport
-    if (m_stretchMode == StretchMode::Fit || m_stretchMode == StretchMode::Disabled) {
-        // Fit模式：使用与上面相同的 viewport 和 scissor
-        VkViewport buttonViewport = viewport;
-        VkRect2D buttonScissor = scissor;
-        
-        // Set viewport and scissor BEFORE calling Render
-        vkCmdSetViewport(m_commandBuffers[imageIndex], 0, 1, &buttonViewport);
-        vkCmdSetScissor(m_commandBuffers[imageIndex], 0, 1, &buttonScissor);
-        
-        // 按层级顺序渲染所有按钮（先渲染按钮本身）
-        // 将 Vulkan 类型转换为抽象类型
-        Extent2D abstractUiExtent = { uiExtent.width, uiExtent.height };
-        for (Button* btn : buttons) {
-            btn->Render(static_cast<CommandBufferHandle>(m_commandBuffers[imageIndex]), abstractUiExtent);
-        }
-        
-        // 渲染滑块（如果有）
-        if (params.slider) {
-            static int sliderDebugCount = 0;
-            if (sliderDebugCount % 60 == 0) {
-                printf("[DRAWFRAME] Fit mode: Rendering slider: visible=%s, uiExtent=(%u, %u)\n",
-                       params.slider->IsVisible() ? "true" : "false", uiExtent.width, uiExtent.height);
-            }
-            sliderDebugCount++;
-            if (params.slider->IsVisible()) {
-                params.slider->Render(static_cast<CommandBufferHandle>(m_commandBuffers[imageIndex]), abstractUiExtent);
-            }
-        }
-        // 渲染额外的滑块（如果有）
-        if (params.additionalSliders) {
-            for (Slider* sld : *params.additionalSliders) {
-                if (sld && sld->IsVisible()) {
-                    sld->Render(static_cast<CommandBufferHandle>(m_commandBuffers[imageIndex]), abstractUiExtent);
-                }
-            }
-        }
-    
-        // 统一渲染所有按钮的文本（在所有按钮之后，只渲染一遍）
-        // 使用批量渲染API，避免文本相互覆盖
-        // 注意：由于Button类没有暴露文本相关的getter方法，这里暂时保留原有的逐个渲染方式
-        // 但使用批量渲染API来避免覆盖问题
-        if (params.textRenderer) {
-            params.textRenderer->BeginTextBatch();
-            
-            VkViewport textViewport = {};
-            textViewport.x = 0.0f;
-            textViewport.y = 0.0f;
-            textViewport.width = (float)m_swapchainExtent.width;
-            textViewport.height = (float)m_swapchainExtent.height;
-            textViewport.minDepth = 0.0f;
-            textViewport.maxDepth = 1.0f;
-            
-            VkRect2D textScissor = {};
-            textScissor.offset = {0, 0};
-            textScissor.extent = m_swapchainExtent;
-            
-            // 使用Button的RenderText方法，通过TextRenderer累积顶点实现批量渲染
-            // 批量渲染模式可减少draw call，提高文本渲染性能
-            Extent2D abstractUiExtent = { uiExtent.width, uiExtent.height };
-            for (Button* btn : textButtons) {
-                btn->RenderText(static_cast<CommandBufferHandle>(m_commandBuffers[imageIndex]), abstractUiExtent, &buttonViewport, &textScissor);
-            }
-            
-            // 添加FPS文本到批次
-            if (params.fps > 0.0f) {
-                char fpsText[32];
-                sprintf_s(fpsText, "FPS: %.1f", params.fps);
-                
-                float textX = 10.0f;
-                float textY = 10.0f;
-                float offsetX = 0.0f, offsetY = 0.0f;
-                
-                // Fit模式：需要考虑视口偏移
-                if (currentAspect > targetAspect) {
-                    float viewportHeight = (float)m_swapchainExtent.height;
-                    float viewportWidth = viewportHeight * targetAspect;
-                    offsetX = ((float)m_swapchainExtent.width - viewportWidth) * 0.5f;
-                } else {
-                    float viewportWidth = (float)m_swapchainExtent.width;
-                    float viewportHeight = viewportWidth / targetAspect;
-                    offsetY = ((float)m_swapchainExtent.height - viewportHeight) * 0.5f;
-                }
-                
-                float flippedY = (float)m_swapchainExtent.height - (textY + offsetY);
-                params.textRenderer->AddTextToBatch(fpsText, textX + offsetX, flippedY,
-                                            1.0f, 1.0f, 0.0f, 1.0f);
-            }
-            
-            // 一次性渲染所有累积的文本（包括按钮文本和FPS文本）
-            // Fit模式：完全参考Button::RenderText的做法
-            // Button::RenderText使用窗口大小作为screenSize，坐标已经是窗口坐标（已转换）
-            // 但字符大小（像素值）需要根据uiToViewportScale缩放
-            float textScreenWidth = (float)m_swapchainExtent.width;
-            float textScreenHeight = (float)m_swapchainExtent.height;
-            
-            // 计算UI到Viewport的缩放比例（和Button::RenderText中的uiToViewportScale一致）
-            float uiToViewportScaleX = buttonViewport.width / (float)uiExtent.width;
-            float uiToViewportScaleY = buttonViewport.height / (float)uiExtent.height;
-            
-            params.textRenderer->EndTextBatch(static_cast<CommandBufferHandle>(m_commandBuffers[imageIndex]), 
-                                      textScreenWidth, 
-                                      textScreenHeight,
-                                      0.0f, 0.0f,  // viewport偏移为0（使用全屏）
-                                      uiToViewportScaleX,  // 字符大小需要按这个比例缩放
-                                      uiToViewportScaleY); // 和Button坐标转换的比例一致
-        }
-    } else {
-        // Scaled 或其他模式：使用全屏 viewport（和example一致）
-        // Scaled模式下，UI使用实际窗口大小，不需要坐标转换
-        VkViewport buttonViewport = {};
+    // Fit/Disabled模式：使用与上面相同的 viewport 和 scissor
+    // Scaled 或其他模式：使用全屏 viewport（和example一致），UI使用实际窗口大小，不需要坐标转换
+    bool fitViewport = (m_stretchMode == StretchMode::Fit || m_stretchMode == StretchMode::Disabled);
+    VkViewport buttonViewport = viewport;
+    VkRect2D buttonScissor = scissor;
+    if (!fitViewport) {
         buttonViewport.x = 0.0f;
         buttonViewport.y = 0.0f;
         buttonViewport.width = (float)m_swapchainExtent.width;
@@ -1597,117 +3051,251 @@ bool VulkanRenderer::DrawFrameWithLoading(const DrawFrameWithLoadingParams& para
         buttonViewport.minDepth = 0.0f;
         buttonViewport.maxDepth = 1.0f;
         
-        VkRect2D buttonScissor = {};
         buttonScissor.offset = {0, 0};
         buttonScissor.extent = m_swapchainExtent;
-        
-        vkCmdSetViewport(m_commandBuffers[imageIndex], 0, 1, &buttonViewport);
-        vkCmdSetScissor(m_commandBuffers[imageIndex], 0, 1, &buttonScissor);
-        
-        // 按层级顺序渲染所有按钮（先渲染按钮本身，使用实际窗口大小）
-        // 将 Vulkan 类型转换为抽象类型
-        Extent2D abstractUiExtent = { uiExtent.width, uiExtent.height };
-        for (Button* btn : buttons) {
-            btn->Render(static_cast<CommandBufferHandle>(m_commandBuffers[imageIndex]), abstractUiExtent);
+    }
+    
+    if (params.slider) {
+        static int sliderDebugCount = 0;
+        if (sliderDebugCount % 60 == 0) {
+            printf("[DRAWFRAME] %s mode: Rendering slider: visible=%s, uiExtent=(%u, %u)\n",
+                   fitViewport ? "Fit" : "Scaled",
+                   params.slider->IsVisible() ? "true" : "false", uiExtent.width, uiExtent.height);
         }
-        
-        // 渲染滑块（如果有）
-        if (params.slider) {
-            static int sliderDebugCount2 = 0;
-            if (sliderDebugCount2 % 60 == 0) {
-                printf("[DRAWFRAME] Scaled mode: Rendering slider: visible=%s, uiExtent=(%u, %u)\n",
-                       params.slider->IsVisible() ? "true" : "false", uiExtent.width, uiExtent.height);
+        sliderDebugCount++;
+    }
+    
+    // 按层级顺序排列的渲染阶段：背景、加载动画、按钮和滑块、文本
+    // 各阶段访问的对象互不重叠，可以在不同线程上并行录制到二级命令缓冲区；
+    // 二级命令缓冲区不继承动态状态，每个阶段先设置自己的视口和裁剪区域
+    std::vector<VulkanSecondaryRecorder::RecordFunc> passes;
+    
+    // 先绘制背景纹理（在UI元素之前）
+    // 背景使用独立的viewport和scissor（全屏），完全独立于UI模式
+    if (HasBackgroundTexture()) {
+        passes.push_back([this, imageIndex](VkCommandBuffer commandBuffer) {
+            // 背景使用全屏viewport和scissor，不受UI拉伸模式影响
+            VkViewport bgViewport = {};
+            bgViewport.x = 0.0f;
+            bgViewport.y = 0.0f;
+            bgViewport.width = (float)m_swapchainExtent.width;
+            bgViewport.height = (float)m_swapchainExtent.height;
+            bgViewport.minDepth = 0.0f;
+            bgViewport.maxDepth = 1.0f;
+            
+            VkRect2D bgScissor = {};
+            bgScissor.offset = {0, 0};
+            bgScissor.extent = m_swapchainExtent;
+            
+            vkCmdSetViewport(commandBuffer, 0, 1, &bgViewport);
+            vkCmdSetScissor(commandBuffer, 0, 1, &bgScissor);
+            
+            if (m_gpuProfiler) {
+                m_gpuProfiler->CmdBeginPass(commandBuffer, imageIndex, GpuProfilerPass::Background);
             }
-            sliderDebugCount2++;
-            if (params.slider->IsVisible()) {
-                params.slider->Render(static_cast<CommandBufferHandle>(m_commandBuffers[imageIndex]), abstractUiExtent);
+            RenderBackgroundTexture(commandBuffer, m_swapchainExtent);
+            if (m_gpuProfiler) {
+                m_gpuProfiler->CmdEndPass(commandBuffer, imageIndex, GpuProfilerPass::Background);
             }
-        }
-        // 渲染额外的滑块（如果有）
-        if (params.additionalSliders) {
-            for (Slider* sld : *params.additionalSliders) {
-                if (sld && sld->IsVisible()) {
-                    sld->Render(static_cast<CommandBufferHandle>(m_commandBuffers[imageIndex]), abstractUiExtent);
-                }
+        });
+    }
+    
+    // 渲染加载动画（方块动画）
+    // UI使用固定的坐标系尺寸（uiExtent），这样UI位置始终正确
+    if (params.loadingAnim) {
+        passes.push_back([&](VkCommandBuffer commandBuffer) {
+            // 设置UI的viewport和scissor（独立于背景）
+            vkCmdSetViewport(commandBuffer, 0, 1, &viewport);
+            vkCmdSetScissor(commandBuffer, 0, 1, &scissor);
+            
+            if (m_gpuProfiler) {
+                m_gpuProfiler->CmdBeginPass(commandBuffer, imageIndex, GpuProfilerPass::LoadingAnimation);
             }
-        }
+            params.loadingAnim->Render(static_cast<CommandBufferHandle>(commandBuffer), abstractUiExtent);
+            if (m_gpuProfiler) {
+                m_gpuProfiler->CmdEndPass(commandBuffer, imageIndex, GpuProfilerPass::LoadingAnimation);
+            }
+        });
+    }
+    
+    // 按层级顺序渲染所有按钮和滑块（合并为实例化绘制）
+    passes.push_back([&](VkCommandBuffer commandBuffer) {
+        vkCmdSetViewport(commandBuffer, 0, 1, &buttonViewport);
+        vkCmdSetScissor(commandBuffer, 0, 1, &buttonScissor);
         
-        // 统一渲染所有按钮的文本（在所有按钮之后，只渲染一遍）
-        // 使用批量渲染API，避免文本相互覆盖
-        if (params.textRenderer) {
-            params.textRenderer->BeginTextBatch();
+        RenderUIQuads(commandBuffer, imageIndex, buttons, params, abstractUiExtent);
+    });
+    
+    // 统一渲染所有按钮的文本（在所有按钮之后，只渲染一遍）
+    // 使用批量渲染API，避免文本相互覆盖
+    if (params.textRenderer) {
+        passes.push_back([&](VkCommandBuffer commandBuffer) {
+            vkCmdSetViewport(commandBuffer, 0, 1, &buttonViewport);
+            vkCmdSetScissor(commandBuffer, 0, 1, &buttonScissor);
             
-            // 使用Button的RenderText方法，但会在TextRenderer中累积顶点
-            Extent2D abstractUiExtent = { uiExtent.width, uiExtent.height };
-            for (Button* btn : textButtons) {
-                btn->RenderText(static_cast<CommandBufferHandle>(m_commandBuffers[imageIndex]), abstractUiExtent);
+            CommandBufferHandle textCommandBuffer = static_cast<CommandBufferHandle>(commandBuffer);
+            if (m_gpuProfiler) {
+                m_gpuProfiler->CmdBeginPass(commandBuffer, imageIndex, GpuProfilerPass::TextBatch);
             }
+            params.textRenderer->BeginTextBatch();
             
-            // 添加FPS文本到批次
-            if (params.fps > 0.0f) {
-                char fpsText[32];
-                sprintf_s(fpsText, "FPS: %.1f", params.fps);
-                float textX = 10.0f;
-                float textY = 10.0f;
-                float flippedY = (float)m_swapchainExtent.height - textY;
-                params.textRenderer->AddTextToBatch(fpsText, textX, flippedY,
-                                            1.0f, 1.0f, 0.0f, 1.0f);
+            if (fitViewport) {
+                VkRect2D textScissor = {};
+                textScissor.offset = {0, 0};
+                textScissor.extent = m_swapchainExtent;
+                
+                // 使用Button的RenderText方法，通过TextRenderer累积顶点实现批量渲染
+                // 批量渲染模式可减少draw call，提高文本渲染性能
+                for (Button* btn : textButtons) {
+                    btn->RenderText(textCommandBuffer, abstractUiExtent, &buttonViewport, &textScissor);
+                }
+                
+                // 添加FPS文本到批次
+                if (params.fps > 0.0f) {
+                    char fpsText[32];
+                    snprintf(fpsText, sizeof(fpsText), "FPS: %.1f", params.fps);
+                    
+                    float textX = 10.0f;
+                    float textY = 10.0f;
+                    float offsetX = 0.0f, offsetY = 0.0f;
+                    
+                    // Fit模式：需要考虑视口偏移
+                    if (currentAspect > targetAspect) {
+                        float viewportHeight = (float)m_swapchainExtent.height;
+                        float viewportWidth = viewportHeight * targetAspect;
+                        offsetX = ((float)m_swapchainExtent.width - viewportWidth) * 0.5f;
+                    } else {
+                        float viewportWidth = (float)m_swapchainExtent.width;
+                        float viewportHeight = viewportWidth / targetAspect;
+                        offsetY = ((float)m_swapchainExtent.height - viewportHeight) * 0.5f;
+                    }
+                    
+                    float flippedY = (float)m_swapchainExtent.height - (textY + offsetY);
+                    params.textRenderer->AddTextToBatch(fpsText, textX + offsetX, flippedY,
+                                                1.0f, 1.0f, 0.0f, 1.0f);
+                    
+                    // GPU分析器叠加文本逐行显示在FPS文本下方（行距与字符一样按UI缩放比例缩放）
+                    if (m_gpuProfiler) {
+                        float lineHeight = (float)params.textRenderer->GetFontSize() * 1.25f *
+                                           (buttonViewport.height / (float)uiExtent.height);
+                        const std::vector<std::string>& overlayLines = m_gpuProfiler->GetOverlayLines();
+                        for (size_t i = 0; i < overlayLines.size(); i++) {
+                            params.textRenderer->AddTextToBatch(overlayLines[i], textX + offsetX,
+                                                                flippedY - lineHeight * (float)(i + 1),
+                                                                0.6f, 1.0f, 0.6f, 1.0f);
+                        }
+                    }
+                }
+                
+                // 一次性渲染所有累积的文本（包括按钮文本和FPS文本）
+                // Fit模式：完全参考Button::RenderText的做法
+                // Button::RenderText使用窗口大小作为screenSize，坐标已经是窗口坐标（已转换）
+                // 但字符大小（像素值）需要根据uiToViewportScale缩放
+                float textScreenWidth = (float)m_swapchainExtent.width;
+                float textScreenHeight = (float)m_swapchainExtent.height;
+                
+                // 计算UI到Viewport的缩放比例（和Button::RenderText中的uiToViewportScale一致）
+                float uiToViewportScaleX = buttonViewport.width / (float)uiExtent.width;
+                float uiToViewportScaleY = buttonViewport.height / (float)uiExtent.height;
+                
+                params.textRenderer->EndTextBatch(textCommandBuffer, 
+                                          textScreenWidth, 
+                                          textScreenHeight,
+                                          0.0f, 0.0f,  // viewport偏移为0（使用全屏）
+                                          uiToViewportScaleX,  // 字符大小需要按这个比例缩放
+                                          uiToViewportScaleY); // 和Button坐标转换的比例一致
+            } else {
+                // 使用Button的RenderText方法，但会在TextRenderer中累积顶点
+                for (Button* btn : textButtons) {
+                    btn->RenderText(textCommandBuffer, abstractUiExtent);
+                }
+                
+                // 添加FPS文本到批次
+                if (params.fps > 0.0f) {
+                    char fpsText[32];
+                    snprintf(fpsText, sizeof(fpsText), "FPS: %.1f", params.fps);
+                    float textX = 10.0f;
+                    float textY = 10.0f;
+                    float flippedY = (float)m_swapchainExtent.height - textY;
+                    params.textRenderer->AddTextToBatch(fpsText, textX, flippedY,
+                                                1.0f, 1.0f, 0.0f, 1.0f);
+                    
+                    // GPU分析器叠加文本逐行显示在FPS文本下方
+                    if (m_gpuProfiler) {
+                        float lineHeight = (float)params.textRenderer->GetFontSize() * 1.25f;
+                        const std::vector<std::string>& overlayLines = m_gpuProfiler->GetOverlayLines();
+                        for (size_t i = 0; i < overlayLines.size(); i++) {
+                            params.textRenderer->AddTextToBatch(overlayLines[i], textX,
+                                                                flippedY - lineHeight * (float)(i + 1),
+                                                                0.6f, 1.0f, 0.6f, 1.0f);
+                        }
+                    }
+                }
+                
+                // 一次性渲染所有累积的文本（包括按钮文本和FPS文本）
+                // Scaled模式：使用整个窗口大小，viewport无偏移
+                params.textRenderer->EndTextBatch(textCommandBuffer, 
+                                          (float)m_swapchainExtent.width, 
+                                          (float)m_swapchainExtent.height,
+                                          0.0f, 0.0f);
             }
             
-            // 一次性渲染所有累积的文本（包括按钮文本和FPS文本）
-            // Scaled模式：使用整个窗口大小，viewport无偏移
-            params.textRenderer->EndTextBatch(static_cast<CommandBufferHandle>(m_commandBuffers[imageIndex]), 
-                                      (float)m_swapchainExtent.width, 
-                                      (float)m_swapchainExtent.height,
-                                      0.0f, 0.0f);
-        }
+            if (m_gpuProfiler) {
+                m_gpuProfiler->CmdEndPass(commandBuffer, imageIndex, GpuProfilerPass::TextBatch);
+            }
+        });
     }
     
     // FPS文本已经在批量渲染批次中处理，这里不再单独渲染
     
+    if (useSecondaryCommandBuffers) {
+        // 并行录制各阶段，再按层级顺序在主命令缓冲区中执行
+        std::vector<VkCommandBuffer> secondaryCommandBuffers;
+        if (m_secondaryRecorder->Record(m_currentFrame, m_renderPass, m_swapchainFramebuffers[imageIndex],
+                                        passes, secondaryCommandBuffers)) {
+            vkCmdExecuteCommands(primaryCommandBuffer, (uint32_t)secondaryCommandBuffers.size(), secondaryCommandBuffers.data());
+        } else {
+            printf("[DRAWFRAME] Failed to record secondary command buffers, skipping UI this frame\n");
+        }
+    } else {
+        for (const VulkanSecondaryRecorder::RecordFunc& pass : passes) {
+            pass(primaryCommandBuffer);
+        }
+    }
+    
     vkCmdEndRenderPass(m_commandBuffers[imageIndex]);
     
+    if (m_gpuProfiler) {
+        m_gpuProfiler->CmdEndFrame(m_commandBuffers[imageIndex], imageIndex);
+    }
+    
     result = vkEndCommandBuffer(m_commandBuffers[imageIndex]);
+    recordScope.End();
     if (result != VK_SUCCESS) {
         Window::ShowError("Failed to record command buffer!");
         return false;
     }
     
-    VkSubmitInfo submitInfo = {};
-    submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
-    
-    VkSemaphore waitSemaphores[] = {m_imageAvailableSemaphores[m_currentFrame]};
-    VkPipelineStageFlags waitStages[] = {VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT};
-    submitInfo.waitSemaphoreCount = 1;
-    submitInfo.pWaitSemaphores = waitSemaphores;
-    submitInfo.pWaitDstStageMask = waitStages;
-    submitInfo.commandBufferCount = 1;
-    submitInfo.pCommandBuffers = &m_commandBuffers[imageIndex];
-    
-    VkSemaphore signalSemaphores[] = {m_renderFinishedSemaphores[m_currentFrame]};
-    submitInfo.signalSemaphoreCount = 1;
-    submitInfo.pSignalSemaphores = signalSemaphores;
+    // 录制期间新建的字形在本帧之前上传
+    if (params.textRenderer) {
+        params.textRenderer->FlushGlyphUploads();
+    }
     
-    result = vkQueueSubmit(m_graphicsQueue, 1, &submitInfo, m_inFlightFences[m_currentFrame]);
-    if (result != VK_SUCCESS) {
-        Window::ShowError("Failed to submit draw command buffer!");
+    TraceScope submitScope("Submit");
+    if (!SubmitFrame(imageIndex)) {
         return false;
     }
+    submitScope.End();
     
-    VkPresentInfoKHR presentInfo = {};
-    presentInfo.sType = VK_STRUCTURE_TYPE_PRESENT_INFO_KHR;
-    presentInfo.waitSemaphoreCount = 1;
-    presentInfo.pWaitSemaphores = signalSemaphores;
-    
-    VkSwapchainKHR swapChains[] = {m_swapchain};
-    presentInfo.swapchainCount = 1;
-    presentInfo.pSwapchains = swapChains;
-    presentInfo.pImageIndices = &imageIndex;
-    
-    result = vkQueuePresentKHR(m_presentQueue, &presentInfo);
-    if (result == VK_ERROR_OUT_OF_DATE_KHR || result == VK_SUBOPTIMAL_KHR) {
+    TraceScope presentScope("Present");
+    waitStart = std::chrono::steady_clock::now();
+    result = PresentFrame(imageIndex);
+    m_frameWaitMs += MillisecondsSince(waitStart);
+    presentScope.End();
+    if (result == VK_ERROR_OUT_OF_DATE_KHR) {
         RecreateSwapchain();
-        return false;
+    } else if (result == VK_SUBOPTIMAL_KHR) {
+        MarkSwapchainSuboptimal();
     } else if (result != VK_SUCCESS) {
         Window::ShowError("Failed to present swap chain image!");
         return false;
@@ -1718,6 +3306,76 @@ bool VulkanRenderer::DrawFrameWithLoading(const DrawFrameWithLoadingParams& para
     return true;
 }
 
+void VulkanRenderer::RenderUIQuads(VkCommandBuffer commandBuffer, uint32_t imageIndex, const std::vector<Button*>& buttons,
+                                   const DrawFrameWithLoadingParams& params, Extent2D uiExtent) {
+    CommandBufferHandle abstractCommandBuffer = static_cast<CommandBufferHandle>(commandBuffer);
+    
+    // 收集可见滑块（按钮之后渲染，与原有顺序一致）
+    std::vector<Slider*> sliders;
+    if (params.slider && params.slider->IsVisible()) sliders.push_back(params.slider);
+    if (params.additionalSliders) {
+        for (Slider* sld : *params.additionalSliders) {
+            if (sld && sld->IsVisible()) sliders.push_back(sld);
+        }
+    }
+    
+    // 批量渲染器不可用时逐个渲染
+    if (!m_uiQuadBatch) {
+        if (m_gpuProfiler) {
+            m_gpuProfiler->CmdBeginPass(commandBuffer, imageIndex, GpuProfilerPass::Buttons);
+        }
+        for (Button* btn : buttons) {
+            btn->Render(abstractCommandBuffer, uiExtent);
+        }
+        if (m_gpuProfiler) {
+            m_gpuProfiler->CmdEndPass(commandBuffer, imageIndex, GpuProfilerPass::Buttons);
+            m_gpuProfiler->CmdBeginPass(commandBuffer, imageIndex, GpuProfilerPass::Sliders);
+        }
+        for (Slider* sld : sliders) {
+            sld->Render(abstractCommandBuffer, uiExtent);
+        }
+        if (m_gpuProfiler) {
+            m_gpuProfiler->CmdEndPass(commandBuffer, imageIndex, GpuProfilerPass::Sliders);
+        }
+        return;
+    }
+    
+    // 调用前已等待 m_currentFrame 的栅栏，该帧槽位的实例缓冲区可以重写
+    m_uiQuadBatch->BeginFrame(m_currentFrame);
+    
+    if (m_gpuProfiler) {
+        m_gpuProfiler->CmdBeginPass(commandBuffer, imageIndex, GpuProfilerPass::Buttons);
+    }
+    
+    // 无法批量渲染的控件（纯着色器模式）先提交已累积的实例再单独渲染，保持层级顺序
+    for (Button* btn : buttons) {
+        if (!btn->AppendToBatch(*m_uiQuadBatch, uiExtent)) {
+            m_uiQuadBatch->Flush(abstractCommandBuffer);
+            btn->Render(abstractCommandBuffer, uiExtent);
+        }
+    }
+    
+    // 分别计时时按钮和滑块不能合并到同一次绘制，在两者之间提交一次
+    if (m_gpuProfiler) {
+        m_uiQuadBatch->Flush(abstractCommandBuffer);
+        m_gpuProfiler->CmdEndPass(commandBuffer, imageIndex, GpuProfilerPass::Buttons);
+        m_gpuProfiler->CmdBeginPass(commandBuffer, imageIndex, GpuProfilerPass::Sliders);
+    }
+    
+    for (Slider* sld : sliders) {
+        if (!sld->AppendToBatch(*m_uiQuadBatch, uiExtent)) {
+            m_uiQuadBatch->Flush(abstractCommandBuffer);
+            sld->Render(abstractCommandBuffer, uiExtent);
+        }
+    }
+    
+    m_uiQuadBatch->Flush(abstractCommandBuffer);
+    
+    if (m_gpuProfiler) {
+        m_gpuProfiler->CmdEndPass(commandBuffer, imageIndex, GpuProfilerPass::Sliders);
+    }
+}
+
 bool VulkanRenderer::LoadBackgroundTexture(const std::string& filepath) {
     CleanupBackgroundTexture();
     
@@ -1735,11 +3393,14 @@ bool VulkanRenderer::LoadBackgroundTexture(const std::string& filepath) {
     // 使用Button来绘制全屏背景（简化实现）
     m_backgroundButton = std::make_unique<Button>();
     
-    // 获取窗口尺寸
-    RECT clientRect;
-    GetClientRect(m_hwnd, &clientRect);
-    float windowWidth = (float)(clientRect.right - clientRect.left);
-    float windowHeight = (float)(clientRect.bottom - clientRect.top);
+    // 获取窗口尺寸（headless模式没有窗口，使用离屏目标尺寸）
+    float windowWidth = (float)m_swapchainExtent.width;
+    float windowHeight = (float)m_swapchainExtent.height;
+    if (!m_headless) {
+        VkExtent2D clientExtent = GetWindowClientExtent();
+        windowWidth = (float)clientExtent.width;
+        windowHeight = (float)clientExtent.height;
+    }
     float windowAspect = windowWidth / windowHeight;
     
     // 根据背景模式计算背景按钮的大小（保持纹理宽高比）
@@ -1788,7 +3449,10 @@ bool VulkanRenderer::LoadBackgroundTexture(const std::string& filepath) {
         static_cast<CommandPoolHandle>(m_commandPool),
         static_cast<QueueHandle>(m_graphicsQueue),
         static_cast<RenderPassHandle>(m_renderPass),
-        abstractBgExtent
+        abstractBgExtent,
+        m_memoryAllocator.get(),
+        GetPipelineCache(),
+        m_pipelineRegistry.get()
     ));
     
     if (!renderContext) {
@@ -1,14 +1,19 @@
 #pragma once
 
+#ifdef _WIN32
 #define VK_USE_PLATFORM_WIN32_KHR
 #define WIN32_LEAN_AND_MEAN
 #define NOMINMAX
 #include <windows.h>                  // 2. 系统头文件
+#endif
 
 #include <vulkan/vulkan.h>            // 3. 第三方库头文件
 
+#include <atomic>                     // 2. 系统头文件
+#include <chrono>                     // 2. 系统头文件
 #include <memory>                     // 2. 系统头文件
 #include <string>                     // 2. 系统头文件
+#include <thread>                     // 2. 系统头文件
 #include <vector>                     // 2. 系统头文件
 #include "core/config/constants.h"    // 4. 项目头文件（配置）
 #include "core/config/stretch_params.h"  // 4. 项目头文件（配置）
@@ -16,6 +21,9 @@
 #include "core/interfaces/ipipeline_manager.h"  // 4. 项目头文件（接口）
 #include "core/interfaces/icamera_controller.h"  // 4. 项目头文件（接口）
 #include "core/interfaces/irender_device.h"  // 4. 项目头文件（接口）
+#include "core/interfaces/imemory_allocator.h"  // 4. 项目头文件（接口）
+#include "core/interfaces/ipipeline_registry.h"  // 4. 项目头文件（接口）
+#include "renderer/vulkan/vulkan_retire_queue.h"  // 4. 项目头文件（Vulkan）
 
 // 前向声明
 class LoadingAnimation;
@@ -24,6 +32,17 @@ class ITextRenderer;
 class TextRenderer;
 class Slider;
 class IRenderCommandBuffer;
+class VulkanMemoryAllocator;
+class VulkanPipelineCache;
+class VulkanPipelineRegistry;
+class UIQuadBatch;
+class VulkanSecondaryRecorder;
+class VulkanGpuProfiler;
+class VulkanCubeRasterizer;
+class VulkanResolutionScaler;
+class VulkanComputeScene;
+class VulkanTemporalResolver;
+class DynamicResolutionController;
 
 /**
  * Vulkan渲染器实现 - 实现IRenderer接口，通过组合模式提供IPipelineManager、ICameraController、IRenderDevice子功能
@@ -51,6 +70,24 @@ public:
      */
     void Cleanup() override;
     
+    /**
+     * 以无窗口（headless）模式初始化渲染器
+     * 不创建表面和交换链，改为创建MAX_FRAMES_IN_FLIGHT个自有VkImage作为渲染目标，
+     * 帧间按轮转方式使用，提交后不呈现
+     * 
+     * @param width 离屏渲染目标宽度（像素）
+     * @param height 离屏渲染目标高度（像素）
+     * @return 成功返回 true，失败返回 false
+     */
+    bool InitializeHeadless(uint32_t width, uint32_t height) override;
+    
+    /**
+     * 检查是否运行在无窗口（headless）模式
+     * 
+     * @return headless 模式返回 true，否则返回 false
+     */
+    bool IsHeadless() const override { return m_headless; }
+    
     /**
      * 绘制一帧
      * 执行完整的渲染流程：获取交换链图像、记录命令缓冲区、提交渲染命令、呈现图像
@@ -79,7 +116,12 @@ public:
      * 
      * @param mode 拉伸模式（Disabled/Scaled/Fit）
      */
-    void SetStretchMode(StretchMode mode) override { m_stretchMode = mode; }
+    void SetStretchMode(StretchMode mode) override {
+        if (m_stretchMode != mode) {
+            m_stretchMode = mode;
+            InvalidateRecordedFrames();  // 视口和文本位置随拉伸模式变化
+        }
+    }
     
     /**
      * 设置背景拉伸模式
@@ -89,6 +131,69 @@ public:
      */
     void SetBackgroundStretchMode(BackgroundStretchMode mode) override { m_backgroundStretchMode = mode; }
     
+    /**
+     * 设置帧节奏模式
+     * 创建交换链时据此选择呈现模式（FIFO/MAILBOX/IMMEDIATE），不支持时退回到FIFO
+     * 
+     * @param mode 帧节奏模式
+     */
+    void SetFramePacingMode(FramePacingMode mode) override { m_framePacingMode = mode; }
+    
+    /**
+     * 获取上一帧阻塞等待的时长（帧栅栏、获取交换链图像和呈现）
+     */
+    double GetLastFrameWaitMs() const override { return m_frameWaitMs; }
+    
+    /**
+     * 设置GPU时间戳分析器选项
+     * 在 Initialize()/InitializeHeadless() 时创建分析器，之后调用不生效
+     * 
+     * @param enabled 是否启用（启用后在FPS文本下方显示各阶段GPU耗时）
+     * @param csvPath 每帧结果的CSV输出路径（为空时不输出）
+     */
+    void SetGpuProfilerOptions(bool enabled, const std::string& csvPath) override {
+        m_gpuProfilerEnabled = enabled;
+        m_gpuProfilerCsvPath = csvPath;
+    }
+    
+    /**
+     * 设置动态分辨率选项
+     * 在 Initialize()/InitializeHeadless() 时创建离屏目标和放大管线，之后调用不生效
+     * 
+     * @param enabled 是否启用（需要GPU时间戳，未启用分析器时仍会创建但不显示叠加文本）
+     * @param gpuBudgetMs GPU帧耗时预算（毫秒）
+     */
+    void SetDynamicResolutionOptions(bool enabled, double gpuBudgetMs) override {
+        m_dynamicResolutionEnabled = enabled;
+        m_gpuBudgetMs = gpuBudgetMs;
+    }
+    
+    /**
+     * 设置 loading_cubes 场景的渲染方式
+     * 每帧录制前比较，切换后各图像在下次使用时重新录制
+     * 
+     * @param mode 渲染方式（光栅化不可用时退回到光线投射）
+     */
+    void SetCubeRenderMode(CubeRenderMode mode) override { m_cubeRenderMode = mode; }
+    
+    /**
+     * 获取 loading_cubes 场景当前选择的渲染方式
+     */
+    CubeRenderMode GetCubeRenderMode() const override { return m_cubeRenderMode; }
+    
+    /**
+     * 设置全屏场景的执行路径
+     * 每帧录制前比较，切换后各图像在下次使用时重新录制
+     * 
+     * @param path 执行路径（计算管线不可用时退回到图形管线）
+     */
+    void SetSceneExecutionPath(SceneExecutionPath path) override { m_sceneExecutionPath = path; }
+    
+    /**
+     * 获取全屏场景当前选择的执行路径
+     */
+    SceneExecutionPath GetSceneExecutionPath() const override { return m_sceneExecutionPath; }
+    
     /**
      * 获取UI基准尺寸
      * 返回用于UI坐标计算的基准尺寸，优先使用背景纹理原始尺寸
@@ -210,6 +315,27 @@ public:
      */
     uint32_t GetSwapchainImageCount() const override { return m_swapchainImageCount; }
     
+    /**
+     * 获取共享设备内存分配器
+     * 
+     * @return 分配器接口指针（不拥有所有权，由VulkanRenderer管理生命周期）
+     */
+    IMemoryAllocator* GetMemoryAllocator() const override;
+    
+    /**
+     * 获取共享管线缓存
+     * 
+     * @return 管线缓存句柄（不拥有所有权，创建失败时为 nullptr）
+     */
+    PipelineCacheHandle GetPipelineCache() const override;
+    
+    /**
+     * 获取共享管线注册表
+     * 
+     * @return 注册表接口指针（不拥有所有权，由VulkanRenderer管理生命周期）
+     */
+    IPipelineRegistry* GetPipelineRegistry() const override;
+    
     // ICameraController 接口实现
     /**
      * 设置鼠标输入
@@ -248,24 +374,43 @@ public:
     
     // IPipelineManager 接口实现
     /**
-     * 创建图形管线
-     * 从shader文件创建Vulkan图形管线，支持SPIR-V和GLSL格式
+     * 创建全屏场景的计算管线变体
+     * 在对应场景管线就绪发布之前调用（由 CreateGraphicsPipeline / CreateLoadingCubesPipeline 调用）
      * 
-     * @param vertShaderPath 顶点shader文件路径
-     * @param fragShaderPath 片段shader文件路径
+     * @param type 场景管线类型
+     * @param compShaderPath 计算shader文件路径
      * @return 成功返回 true，失败返回 false
      */
-    bool CreateGraphicsPipeline(const std::string& vertShaderPath, const std::string& fragShaderPath) override;
+    bool CreateComputeScenePipeline(ScenePipelineType type, const std::string& compShaderPath) override;
     
     /**
-     * 创建loading_cubes管线
-     * 创建用于加载动画场景的专用图形管线
+     * 检查全屏场景的计算管线变体是否可用（只能在场景管线就绪发布之后调用）
      * 
-     * @param vertShaderPath 顶点shader文件路径
-     * @param fragShaderPath 片段shader文件路径
-     * @return 成功返回 true，失败返回 false
+     * @param type 场景管线类型
+     * @return 可用返回 true，否则返回 false
      */
-    bool CreateLoadingCubesPipeline(const std::string& vertShaderPath, const std::string& fragShaderPath) override;
+    bool IsComputeScenePipelineAvailable(ScenePipelineType type) const override;
+    
+    /**
+     * 在工作线程上预编译场景管线
+     * 启动后台线程依次创建Shader管线和loading_cubes管线，状态通过原子变量发布给渲染线程
+     * 
+     * @param shaderVertPath Shader 场景顶点shader路径
+     * @param shaderFragPath Shader 场景片段shader路径
+     * @param loadingCubesVertPath LoadingCubes 场景顶点shader路径
+     * @param loadingCubesFragPath LoadingCubes 场景片段shader路径
+     * @return 成功启动（或已启动）返回 true，否则返回 false
+     */
+    bool PrecompileScenePipelines(const std::string& shaderVertPath, const std::string& shaderFragPath,
+                                  const std::string& loadingCubesVertPath, const std::string& loadingCubesFragPath) override;
+    
+    /**
+     * 获取场景管线状态
+     * 
+     * @param type 场景管线类型
+     * @return ScenePipelineState 管线当前状态
+     */
+    ScenePipelineState GetScenePipelineState(ScenePipelineType type) const override;
     
     /**
      * 检查是否支持光线追踪
@@ -288,14 +433,24 @@ public:
      * 记录命令缓冲区
      * 将渲染命令记录到Vulkan命令缓冲区中
      * 
+     * 录制结果不包含逐帧变化的参数（时间、相机通过该图像的统一缓冲区传入），内容不变时可重复提交
+     * 启用GPU分析器时同时录制时间戳，并在FPS文本下方显示分析器的叠加文本
+     * 
      * @param commandBuffer Vulkan命令缓冲区句柄
      * @param imageIndex 交换链图像索引
-     * @param time 当前时间（秒）
      * @param useLoadingCubes 是否使用loading_cubes shader
+     * @param pipelineReady 场景管线是否已就绪（未就绪时只清屏）
+     * @param rasterCubes 是否以实例化光栅化绘制 loading_cubes（调用前已确保光栅化渲染目标存在）
+     * @param renderScale 场景渲染比例（小于 1 时场景渲染到离屏目标再放大，调用前已确保离屏目标存在）
+     * @param computeScene 是否以计算着色器渲染全屏场景（调用前已确保存储图像存在）
+     * @param temporalCubes 是否以时间抗锯齿路径绘制 loading_cubes（调用前已确保时间抗锯齿渲染目标存在）
      * @param textRenderer 文本渲染器指针（可选）
-     * @param fps 当前帧率（可选，用于显示FPS文本）
+     * @param fpsText FPS文本（为空时不显示）
+     * @return 录制成功返回 true，失败返回 false
      */
-    void RecordCommandBuffer(VkCommandBuffer commandBuffer, uint32_t imageIndex, float time, bool useLoadingCubes = false, ITextRenderer* textRenderer = nullptr, float fps = 0.0f);
+    bool RecordCommandBuffer(VkCommandBuffer commandBuffer, uint32_t imageIndex, bool useLoadingCubes, bool pipelineReady,
+                             bool rasterCubes, float renderScale, bool computeScene, bool temporalCubes,
+                             ITextRenderer* textRenderer, const std::string& fpsText);
     
     /**
      * 清理背景纹理
@@ -314,20 +469,90 @@ private:
     // 绘制背景纹理（保持宽高比居中填充窗口）
     void RenderBackgroundTexture(VkCommandBuffer commandBuffer, VkExtent2D extent);
     bool CreateInstance();
-    bool CreateSurface(HWND hwnd, HINSTANCE hInstance);
+    bool CreateSurface(HWND hwnd, HINSTANCE hInstance);  // 只有 Win32 表面实现，其他平台返回 false
+    VkExtent2D GetWindowClientExtent() const;  // 窗口客户区尺寸（没有窗口实现的平台返回当前交换链尺寸）
     bool SelectPhysicalDevice();
     bool CreateLogicalDevice();
-    bool CreateSwapchain();
+    bool CreateSwapchain(VkSwapchainKHR oldSwapchain = VK_NULL_HANDLE);
+    VkPresentModeKHR ChoosePresentMode() const;
     bool CreateImageViews();
     bool CreateRenderPass();
+    bool CreateLoadRenderPass();
     bool CreateFramebuffers();
     bool CreateCommandPool();
     bool CreateCommandBuffers();
     bool CreateSyncObjects();
     
+    bool CreateMemoryAllocator();
+    void CreatePipelineCache();
+    bool CreatePipelineRegistry();
+    void CreateUIQuadBatch();
+    void CreateSecondaryRecorder();
+    void CreateGpuProfiler();
+    void CreateCubeRasterizer();
+    void CreateResolutionScaler();
+    void CreateComputeScene();
+    void CreateTemporalResolver();
+    
+    // 渲染所有按钮和滑块（优先合并为实例化绘制，无法批量渲染的控件逐个渲染；启用GPU分析器时按钮和滑块分别计时）
+    void RenderUIQuads(VkCommandBuffer commandBuffer, uint32_t imageIndex, const std::vector<Button*>& buttons,
+                       const DrawFrameWithLoadingParams& params, Extent2D uiExtent);
+    
+    // 创建headless模式的离屏渲染目标（替代CreateSwapchain，填充m_swapchainImages）
+    bool CreateOffscreenTargets();
+    
+    // 帧提交流程（DrawFrame与DrawFrameWithLoading共用，headless模式下跳过交换链操作）
+    VkResult AcquireFrameImage(uint32_t* imageIndex);
+    bool SubmitFrame(uint32_t imageIndex);
+    VkResult PresentFrame(uint32_t imageIndex);
+    
     void CleanupSwapchain();
     void RecreateSwapchain();
     
+    // 交换链重建辅助（不等待设备空闲：旧资源在使用它们的帧的栅栏触发后才销毁）
+    bool PrepareSwapchainForFrame();  // 每帧获取图像前调用：处理延迟重建（防抖）
+    void MarkSwapchainSuboptimal();   // 交换链仍可呈现但与窗口不匹配，延迟到尺寸稳定后重建
+    void ReleaseRetiredSwapchains(bool waitAll);  // 销毁已不再被任何在途帧使用的旧交换链资源
+    bool EnsureCommandBufferCount(uint32_t count);
+    
+    // 在渲染线程上报告场景管线预编译的失败（工作线程不弹出对话框，错误随 Failed 状态交回）
+    void ReportScenePipelineErrors();
+    
+    // 等待仍在使用该图像命令缓冲区的提交完成（图像获取顺序不一定与帧槽位一致）
+    void WaitForImageInFlight(uint32_t imageIndex);
+    
+    // 场景参数统一缓冲区（每个交换链图像一份，替代推送常量，使录制好的命令缓冲区可以重复提交）
+    bool CreateSceneUniforms();
+    bool EnsureSceneUniformCount(uint32_t count);
+    void CleanupSceneUniforms();
+    void UpdateSceneUniforms(uint32_t imageIndex, float time, bool useLoadingCubes, bool temporalCubes);
+    bool CreateSceneBuffer(VkDeviceSize size, VkBufferUsageFlags usage, MemoryPropertyFlag properties,
+                           VkBuffer& buffer, MemoryAllocation& allocation);
+    
+    // 创建Shader场景的图形管线（只由场景管线预编译线程调用；管线已就绪或已创建时直接返回，不覆盖已有的布局和管线）
+    bool CreateGraphicsPipeline(const std::string& vertShaderPath, const std::string& fragShaderPath);
+    
+    // 创建loading_cubes场景的图形管线及其可选变体（同上，只由场景管线预编译线程调用）
+    bool CreateLoadingCubesPipeline(const std::string& vertShaderPath, const std::string& fragShaderPath);
+    
+    // 创建 loading_cubes 的屏幕分块剔除计算管线（在场景管线预编译线程上调用，失败时片段着色器测试所有立方体）
+    bool CreateLoadingCubesCullPipeline();
+    
+    // 创建 loading_cubes 的实例化光栅化管线（在场景管线预编译线程上调用，失败时只能使用光线投射）
+    bool CreateLoadingCubesRasterPipeline();
+    
+    // 创建 loading_cubes 时间抗锯齿的单采样场景管线（在场景管线预编译线程上调用，失败时只能使用超采样光线投射）
+    bool CreateLoadingCubesTemporalPipeline(const std::string& vertShaderPath);
+    
+    // 以默认计算着色器路径创建场景的计算管线变体（在场景管线预编译线程上调用，失败时只能使用图形管线）
+    bool CreateDefaultComputeScenePipeline(ScenePipelineType type);
+    
+    // 录制分块剔除：清空分块计数并调度剔除计算着色器（必须在渲染通道之外）
+    void RecordLoadingCubesCulling(VkCommandBuffer commandBuffer, uint32_t imageIndex);
+    
+    // 使所有图像已录制的命令缓冲区失效（交换链重建、拉伸模式改变、加载界面录制后调用）
+    void InvalidateRecordedFrames();
+    
     // Vulkan对象
     VkInstance m_instance = VK_NULL_HANDLE;
     VkSurfaceKHR m_surface = VK_NULL_HANDLE;
@@ -344,11 +569,49 @@ private:
     VkExtent2D m_swapchainExtent = {};
     uint32_t m_swapchainImageCount = 0;
     
+    // 已退役的交换链资源（重建时交给新交换链作为 oldSwapchain，之后在栅栏触发后销毁）
+    struct RetiredSwapchain {
+        VkSwapchainKHR swapchain = VK_NULL_HANDLE;
+        std::vector<VkImageView> imageViews;
+        std::vector<VkFramebuffer> framebuffers;
+    };
+    RetireQueue<RetiredSwapchain> m_retiredSwapchains;
+    uint64_t m_submitSerial = 0;      // 已提交帧的递增序号
+    uint64_t m_completedSerial = 0;   // 已确认完成的最大提交序号
+    std::vector<uint64_t> m_frameSubmitSerials;  // 每个帧槽位最后一次提交的序号
+    
+    // 交换链延迟重建（防抖）：SUBOPTIMAL 时继续使用旧交换链，窗口尺寸稳定后再重建
+    bool m_swapchainSuboptimal = false;
+    VkExtent2D m_pendingResizeExtent = {};
+    std::chrono::steady_clock::time_point m_pendingResizeTime;
+    
+    // headless模式的离屏图像内存（图像本身存放在m_swapchainImages中，由渲染器拥有）
+    std::vector<MemoryAllocation> m_offscreenImageAllocations;
+    
+    // 共享设备内存分配器（设备创建后立即创建，设备销毁前清理）
+    std::unique_ptr<VulkanMemoryAllocator> m_memoryAllocator;
+    
+    // 持久化管线缓存（启动时从磁盘加载，设备销毁前保存，所有管线创建共用）
+    std::unique_ptr<VulkanPipelineCache> m_pipelineCache;
+    
+    // 控件管线注册表（相同描述的控件共享管线，在管线缓存之后创建，所有控件清理后销毁）
+    std::unique_ptr<VulkanPipelineRegistry> m_pipelineRegistry;
+    
     VkRenderPass m_renderPass = VK_NULL_HANDLE;
+    VkRenderPass m_renderPassLoad = VK_NULL_HANDLE;  // 与 m_renderPass 兼容，保留已有内容（光栅化立方体之后继续绘制UI）
     VkPipelineLayout m_pipelineLayout = VK_NULL_HANDLE;
     VkPipeline m_graphicsPipeline = VK_NULL_HANDLE;
     VkPipelineLayout m_loadingCubesPipelineLayout = VK_NULL_HANDLE;
     VkPipeline m_loadingCubesPipeline = VK_NULL_HANDLE;
+    VkPipeline m_loadingCubesCullPipeline = VK_NULL_HANDLE;  // 屏幕分块剔除计算管线（使用 loading_cubes 的管线布局）
+    
+    // 场景管线状态（工作线程写入管线句柄后以 release 语义发布 Ready，渲染线程观察到 Ready 后才读取句柄）
+    std::atomic<ScenePipelineState> m_shaderPipelineState{ScenePipelineState::NotStarted};
+    std::atomic<ScenePipelineState> m_loadingCubesPipelineState{ScenePipelineState::NotStarted};
+    std::thread m_scenePipelineThread;  // 场景管线预编译线程（Cleanup 时 join）
+    std::string m_shaderPipelineError;        // 工作线程在发布 Failed 之前写入，渲染线程观察到 Failed 后读取
+    std::string m_loadingCubesPipelineError;
+    bool m_scenePipelineErrorsReported[2] = {false, false};  // 渲染线程只报告一次（按 Shader / LoadingCubes）
     
     VkCommandPool m_commandPool = VK_NULL_HANDLE;
     std::vector<VkCommandBuffer> m_commandBuffers;
@@ -356,15 +619,53 @@ private:
     std::vector<VkSemaphore> m_imageAvailableSemaphores;
     std::vector<VkSemaphore> m_renderFinishedSemaphores;
     std::vector<VkFence> m_inFlightFences;
+    std::vector<VkFence> m_imagesInFlight;  // 每个交换链图像最近一次提交使用的栅栏（[BORROW] 指向 m_inFlightFences）
+    
+    // 场景参数统一缓冲区（每个交换链图像一份，持久映射），以及 loading_cubes 的立方体数据和屏幕分块列表
+    struct SceneUniformBuffer {
+        VkBuffer buffer = VK_NULL_HANDLE;
+        MemoryAllocation allocation;
+        VkBuffer cubeBuffer = VK_NULL_HANDLE;   // 每帧由 CPU 写入的立方体数据（存储缓冲区）
+        MemoryAllocation cubeAllocation;
+        VkBuffer tileBuffer = VK_NULL_HANDLE;   // 剔除计算着色器写入的分块立方体列表（设备本地）
+        MemoryAllocation tileAllocation;
+        VkDescriptorSet descriptorSet = VK_NULL_HANDLE;
+    };
+    void DestroySceneUniformBuffer(SceneUniformBuffer& uniform);
+    VkDescriptorSetLayout m_sceneDescriptorSetLayout = VK_NULL_HANDLE;
+    VkDescriptorPool m_sceneDescriptorPool = VK_NULL_HANDLE;
+    std::vector<SceneUniformBuffer> m_sceneUniforms;
+    
+    // 每个交换链图像命令缓冲区的录制内容（与本帧需要的内容一致时跳过重新录制）
+    struct RecordedFrameState {
+        uint64_t generation = 0;  // 录制时的 m_recordGeneration，0 表示需要重新录制
+        bool useLoadingCubes = false;
+        bool pipelineReady = false;
+        bool rasterCubes = false;
+        float renderScale = 1.0f;
+        bool computeScene = false;
+        bool temporalCubes = false;
+        bool temporalHistoryInit = false;  // 录制了历史图像的布局转换（只能提交一次）
+        ITextRenderer* textRenderer = nullptr;
+    };
+    std::vector<RecordedFrameState> m_recordedFrames;
+    uint64_t m_recordGeneration = 1;  // 脏标志：递增后所有图像在下次使用时重新录制
+    std::string m_recordedFpsText;    // 最近录制的FPS文本（文本顶点写入共享缓冲区，变化时所有图像失效）
+    uint64_t m_recordedOverlayVersion = 0;  // 最近录制的GPU分析器叠加文本版本（同上）
+    uint64_t m_recordedAtlasVersion = 0;    // 最近录制的字形图集版本（同上）
+    uint64_t m_recordedTextVertexVersion = 0;  // 最近录制的文本顶点缓冲区版本（同上）
     
     uint32_t m_graphicsQueueFamily = UINT32_MAX;
     uint32_t m_presentQueueFamily = UINT32_MAX;
     uint32_t m_currentFrame = 0;
     
     bool m_initialized = false;  // 初始化状态标志，防止重复初始化
+    bool m_headless = false;     // 无窗口模式标志（无表面、无交换链、不呈现）
     
     HWND m_hwnd = nullptr;
     StretchMode m_stretchMode = StretchMode::Scaled;
+    FramePacingMode m_framePacingMode = FramePacingMode::VSync;  // 决定交换链呈现模式
+    double m_frameWaitMs = 0.0;  // 当前（或上一）帧阻塞等待的时长，帧节奏器从帧耗时中扣除
     BackgroundStretchMode m_backgroundStretchMode = BackgroundStretchMode::Fit;  // 背景拉伸模式
     
     // 背景纹理原始尺寸（用于计算宽高比）
@@ -377,6 +678,42 @@ private:
     // 背景纹理（使用Button类实现）
     std::unique_ptr<Button> m_backgroundButton;
     
+    // UI四边形批量渲染器（按钮和滑块的实例化绘制，创建失败时为空，退回到逐控件渲染）
+    std::unique_ptr<UIQuadBatch> m_uiQuadBatch;
+    
+    // 二级命令缓冲区并行录制器（加载界面各渲染阶段并行录制，不可用时为空，直接录制主命令缓冲区）
+    std::unique_ptr<VulkanSecondaryRecorder> m_secondaryRecorder;
+    
+    // GPU时间戳分析器（未启用或设备不支持时间戳时为空）
+    std::unique_ptr<VulkanGpuProfiler> m_gpuProfiler;
+    bool m_gpuProfilerEnabled = false;
+    std::string m_gpuProfilerCsvPath;
+    
+    // loading_cubes 的实例化光栅化路径（渲染通道创建失败时为空，只使用光线投射）
+    std::unique_ptr<VulkanCubeRasterizer> m_cubeRasterizer;
+    CubeRenderMode m_cubeRenderMode = CubeRenderMode::RayCast;
+    
+    // 动态分辨率：全屏场景的离屏目标和放大通道，以及按GPU帧耗时选择比例的控制器（未启用或创建失败时为空）
+    std::unique_ptr<VulkanResolutionScaler> m_resolutionScaler;
+    std::unique_ptr<DynamicResolutionController> m_resolutionController;
+    bool m_dynamicResolutionEnabled = false;
+    double m_gpuBudgetMs = 0.0;
+    
+    // 全屏场景的计算着色器执行路径（创建失败时为空，只使用图形管线）
+    std::unique_ptr<VulkanComputeScene> m_computeScene;
+    SceneExecutionPath m_sceneExecutionPath = SceneExecutionPath::Graphics;
+    
+    // loading_cubes 的时间抗锯齿路径（创建失败时为空，只使用超采样光线投射）
+    // 上一帧相机用于重投影历史；上一帧不是时间抗锯齿路径时历史无效
+    std::unique_ptr<VulkanTemporalResolver> m_temporalResolver;
+    uint32_t m_temporalFrameIndex = 0;
+    bool m_temporalHistoryValid = false;
+    float m_prevCameraYaw = 0.0f;
+    float m_prevCameraPitch = 0.0f;
+    float m_prevCameraPosX = 0.0f;
+    float m_prevCameraPosY = 0.0f;
+    float m_prevCameraPosZ = 0.0f;
+    
     // 相机状态（初始值，实际计算在GPU上完成）
     float m_cameraYaw = 0.0f;    // 水平旋转角度（弧度）
     float m_cameraPitch = 0.0f;   // 垂直旋转角度（弧度）
@@ -0,0 +1,562 @@
+#include "renderer/vulkan/vulkan_resolution_scaler.h"  // 1. 对应头文件
+
+#include <algorithm>  // 2. 系统头文件
+#include <cmath>  // 2. 系统头文件
+#include <stdio.h>  // 2. 系统头文件
+
+#include "renderer/vulkan/vulkan_memory_allocator.h"  // 4. 项目头文件（Vulkan）
+#include "shader/shader_loader.h"  // 4. 项目头文件（着色器）
+
+namespace {
+
+// 放大着色器的推送常量（与 upscale.frag 的 UpscaleParams 一致）
+struct UpscalePushConstants {
+    float uvScale[2];    // 场景区域占离屏目标的比例
+    float uvMax[2];      // 采样坐标上限（场景区域最后一个纹素的中心，双线性采样不读到区域之外）
+    float texelSize[2];  // 离屏目标的纹素大小
+    float sharpness;     // 锐化强度（0 表示只做双线性放大）
+    float padding;
+};
+
+} // namespace
+
+VulkanResolutionScaler::VulkanResolutionScaler() {
+}
+
+VulkanResolutionScaler::~VulkanResolutionScaler() {
+    Cleanup();
+}
+
+bool VulkanResolutionScaler::Initialize(VkDevice device, VkPhysicalDevice physicalDevice, IMemoryAllocator* allocator, VkFormat colorFormat,
+                                        VkRenderPass outputRenderPass, VkPipelineCache pipelineCache,
+                                        const std::string& vertShaderPath, const std::string& fragShaderPath) {
+    if (m_initialized) {
+        return true;
+    }
+    
+    if (device == VK_NULL_HANDLE || physicalDevice == VK_NULL_HANDLE || outputRenderPass == VK_NULL_HANDLE) {
+        return false;
+    }
+    
+    m_device = device;
+    m_physicalDevice = physicalDevice;
+    m_allocator = allocator;
+    m_colorFormat = colorFormat;
+    m_initialized = true;
+    
+    // 失败时由 Cleanup 销毁已创建的部分
+    if (!CreateScenePass(colorFormat)) {
+        printf("[DYNAMIC_RES] Failed to create scene render pass\n");
+        Cleanup();
+        return false;
+    }
+    
+    if (!CreateDescriptorResources()) {
+        printf("[DYNAMIC_RES] Failed to create upscale descriptor resources\n");
+        Cleanup();
+        return false;
+    }
+    
+    if (!CreatePipeline(outputRenderPass, pipelineCache, vertShaderPath, fragShaderPath)) {
+        Cleanup();
+        return false;
+    }
+    
+    return true;
+}
+
+void VulkanResolutionScaler::Cleanup() {
+    if (!m_initialized) {
+        return;
+    }
+    
+    DestroyTarget(m_target);
+    m_retiredTargets.ReleaseAll([this](Target& target) { DestroyTarget(target); });
+    
+    if (m_pipeline != VK_NULL_HANDLE) {
+        vkDestroyPipeline(m_device, m_pipeline, nullptr);
+        m_pipeline = VK_NULL_HANDLE;
+    }
+    
+    if (m_pipelineLayout != VK_NULL_HANDLE) {
+        vkDestroyPipelineLayout(m_device, m_pipelineLayout, nullptr);
+        m_pipelineLayout = VK_NULL_HANDLE;
+    }
+    
+    if (m_descriptorPool != VK_NULL_HANDLE) {
+        vkDestroyDescriptorPool(m_device, m_descriptorPool, nullptr);
+        m_descriptorPool = VK_NULL_HANDLE;
+    }
+    
+    if (m_descriptorSetLayout != VK_NULL_HANDLE) {
+        vkDestroyDescriptorSetLayout(m_device, m_descriptorSetLayout, nullptr);
+        m_descriptorSetLayout = VK_NULL_HANDLE;
+    }
+    
+    if (m_sampler != VK_NULL_HANDLE) {
+        vkDestroySampler(m_device, m_sampler, nullptr);
+        m_sampler = VK_NULL_HANDLE;
+    }
+    
+    if (m_scenePass != VK_NULL_HANDLE) {
+        vkDestroyRenderPass(m_device, m_scenePass, nullptr);
+        m_scenePass = VK_NULL_HANDLE;
+    }
+    
+    m_allocator = nullptr;
+    m_device = VK_NULL_HANDLE;
+    m_initialized = false;
+}
+
+bool VulkanResolutionScaler::CreateScenePass(VkFormat colorFormat) {
+    // 与主渲染通道兼容（同一格式、单个颜色附件、无深度），场景管线可以直接在该通道中使用
+    VkAttachmentDescription colorAttachment = {};
+    colorAttachment.format = colorFormat;
+    colorAttachment.samples = VK_SAMPLE_COUNT_1_BIT;
+    colorAttachment.loadOp = VK_ATTACHMENT_LOAD_OP_CLEAR;
+    colorAttachment.storeOp = VK_ATTACHMENT_STORE_OP_STORE;
+    colorAttachment.stencilLoadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
+    colorAttachment.stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
+    colorAttachment.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+    colorAttachment.finalLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+    
+    VkAttachmentReference colorRef = { 0, VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL };
+    
+    VkSubpassDescription subpass = {};
+    subpass.pipelineBindPoint = VK_PIPELINE_BIND_POINT_GRAPHICS;
+    subpass.colorAttachmentCount = 1;
+    subpass.pColorAttachments = &colorRef;
+    
+    VkSubpassDependency dependencies[2] = {};
+    // 离屏目标所有帧共用：等待之前提交的放大通道读取完成后再清除写入
+    dependencies[0].srcSubpass = VK_SUBPASS_EXTERNAL;
+    dependencies[0].dstSubpass = 0;
+    dependencies[0].srcStageMask = VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT | VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
+    dependencies[0].srcAccessMask = VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT;
+    dependencies[0].dstStageMask = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
+    dependencies[0].dstAccessMask = VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT;
+    
+    // 场景写入对随后放大通道的片段着色器采样可见
+    dependencies[1].srcSubpass = 0;
+    dependencies[1].dstSubpass = VK_SUBPASS_EXTERNAL;
+    dependencies[1].srcStageMask = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
+    dependencies[1].srcAccessMask = VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT;
+    dependencies[1].dstStageMask = VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT;
+    dependencies[1].dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
+    
+    VkRenderPassCreateInfo renderPassInfo = {};
+    renderPassInfo.sType = VK_STRUCTURE_TYPE_RENDER_PASS_CREATE_INFO;
+    renderPassInfo.attachmentCount = 1;
+    renderPassInfo.pAttachments = &colorAttachment;
+    renderPassInfo.subpassCount = 1;
+    renderPassInfo.pSubpasses = &subpass;
+    renderPassInfo.dependencyCount = 2;
+    renderPassInfo.pDependencies = dependencies;
+    
+    return vkCreateRenderPass(m_device, &renderPassInfo, nullptr, &m_scenePass) == VK_SUCCESS;
+}
+
+bool VulkanResolutionScaler::CreateDescriptorResources() {
+    // 双线性采样，坐标限制在场景区域内，边缘不会读到区域外的内容
+    VkSamplerCreateInfo samplerInfo = {};
+    samplerInfo.sType = VK_STRUCTURE_TYPE_SAMPLER_CREATE_INFO;
+    samplerInfo.magFilter = VK_FILTER_LINEAR;
+    samplerInfo.minFilter = VK_FILTER_LINEAR;
+    samplerInfo.mipmapMode = VK_SAMPLER_MIPMAP_MODE_NEAREST;
+    samplerInfo.addressModeU = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE;
+    samplerInfo.addressModeV = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE;
+    samplerInfo.addressModeW = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE;
+    samplerInfo.maxLod = 0.0f;
+    samplerInfo.borderColor = VK_BORDER_COLOR_INT_OPAQUE_BLACK;
+    
+    if (vkCreateSampler(m_device, &samplerInfo, nullptr, &m_sampler) != VK_SUCCESS) {
+        m_sampler = VK_NULL_HANDLE;
+        return false;
+    }
+    
+    VkDescriptorSetLayoutBinding binding = {};
+    binding.binding = 0;
+    binding.descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+    binding.descriptorCount = 1;
+    binding.stageFlags = VK_SHADER_STAGE_FRAGMENT_BIT;
+    
+    VkDescriptorSetLayoutCreateInfo layoutInfo = {};
+    layoutInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
+    layoutInfo.bindingCount = 1;
+    layoutInfo.pBindings = &binding;
+    
+    if (vkCreateDescriptorSetLayout(m_device, &layoutInfo, nullptr, &m_descriptorSetLayout) != VK_SUCCESS) {
+        m_descriptorSetLayout = VK_NULL_HANDLE;
+        return false;
+    }
+    
+    // 每个离屏目标一个描述符集，目标销毁时单独释放
+    VkDescriptorPoolSize poolSize = {};
+    poolSize.type = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+    poolSize.descriptorCount = RetireQueue<Target>::MAX_LIVE_RESOURCES;
+    
+    VkDescriptorPoolCreateInfo poolInfo = {};
+    poolInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
+    poolInfo.flags = VK_DESCRIPTOR_POOL_CREATE_FREE_DESCRIPTOR_SET_BIT;
+    poolInfo.maxSets = RetireQueue<Target>::MAX_LIVE_RESOURCES;
+    poolInfo.poolSizeCount = 1;
+    poolInfo.pPoolSizes = &poolSize;
+    
+    if (vkCreateDescriptorPool(m_device, &poolInfo, nullptr, &m_descriptorPool) != VK_SUCCESS) {
+        m_descriptorPool = VK_NULL_HANDLE;
+        return false;
+    }
+    
+    VkPushConstantRange pushConstantRange = {};
+    pushConstantRange.stageFlags = VK_SHADER_STAGE_FRAGMENT_BIT;
+    pushConstantRange.offset = 0;
+    pushConstantRange.size = sizeof(UpscalePushConstants);
+    
+    VkPipelineLayoutCreateInfo pipelineLayoutInfo = {};
+    pipelineLayoutInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
+    pipelineLayoutInfo.setLayoutCount = 1;
+    pipelineLayoutInfo.pSetLayouts = &m_descriptorSetLayout;
+    pipelineLayoutInfo.pushConstantRangeCount = 1;
+    pipelineLayoutInfo.pPushConstantRanges = &pushConstantRange;
+    
+    if (vkCreatePipelineLayout(m_device, &pipelineLayoutInfo, nullptr, &m_pipelineLayout) != VK_SUCCESS) {
+        m_pipelineLayout = VK_NULL_HANDLE;
+        return false;
+    }
+    
+    return true;
+}
+
+bool VulkanResolutionScaler::CreatePipeline(VkRenderPass outputRenderPass, VkPipelineCache pipelineCache,
+                                            const std::string& vertShaderPath, const std::string& fragShaderPath) {
+    std::vector<char> vertShaderCode = renderer::shader::ShaderLoader::LoadShaderCode(vertShaderPath, ShaderStage::Vertex);
+    std::vector<char> fragShaderCode = renderer::shader::ShaderLoader::LoadShaderCode(fragShaderPath, ShaderStage::Fragment);
+    if (vertShaderCode.empty() || fragShaderCode.empty()) {
+        printf("[DYNAMIC_RES] Failed to load shaders: %s, %s\n", vertShaderPath.c_str(), fragShaderPath.c_str());
+        return false;
+    }
+    
+    VkShaderModule vertShaderModule = static_cast<VkShaderModule>(
+        renderer::shader::ShaderLoader::CreateShaderModuleFromSPIRV(static_cast<DeviceHandle>(m_device), vertShaderCode));
+    VkShaderModule fragShaderModule = static_cast<VkShaderModule>(
+        renderer::shader::ShaderLoader::CreateShaderModuleFromSPIRV(static_cast<DeviceHandle>(m_device), fragShaderCode));
+    if (vertShaderModule == VK_NULL_HANDLE || fragShaderModule == VK_NULL_HANDLE) {
+        if (vertShaderModule != VK_NULL_HANDLE) {
+            vkDestroyShaderModule(m_device, vertShaderModule, nullptr);
+        }
+        if (fragShaderModule != VK_NULL_HANDLE) {
+            vkDestroyShaderModule(m_device, fragShaderModule, nullptr);
+        }
+        printf("[DYNAMIC_RES] Failed to create shader modules\n");
+        return false;
+    }
+    
+    VkPipelineShaderStageCreateInfo shaderStages[2] = {};
+    shaderStages[0].sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+    shaderStages[0].stage = VK_SHADER_STAGE_VERTEX_BIT;
+    shaderStages[0].module = vertShaderModule;
+    shaderStages[0].pName = "main";
+    shaderStages[1].sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+    shaderStages[1].stage = VK_SHADER_STAGE_FRAGMENT_BIT;
+    shaderStages[1].module = fragShaderModule;
+    shaderStages[1].pName = "main";
+    
+    // 全屏三角形的顶点由 gl_VertexIndex 生成
+    VkPipelineVertexInputStateCreateInfo vertexInputInfo = {};
+    vertexInputInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO;
+    
+    VkPipelineInputAssemblyStateCreateInfo inputAssembly = {};
+    inputAssembly.sType = VK_STRUCTURE_TYPE_PIPELINE_INPUT_ASSEMBLY_STATE_CREATE_INFO;
+    inputAssembly.topology = VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
+    inputAssembly.primitiveRestartEnable = VK_FALSE;
+    
+    VkPipelineViewportStateCreateInfo viewportState = {};
+    viewportState.sType = VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_STATE_CREATE_INFO;
+    viewportState.viewportCount = 1;
+    viewportState.scissorCount = 1;
+    
+    VkPipelineRasterizationStateCreateInfo rasterizer = {};
+    rasterizer.sType = VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_STATE_CREATE_INFO;
+    rasterizer.depthClampEnable = VK_FALSE;
+    rasterizer.rasterizerDiscardEnable = VK_FALSE;
+    rasterizer.polygonMode = VK_POLYGON_MODE_FILL;
+    rasterizer.lineWidth = 1.0f;
+    rasterizer.cullMode = VK_CULL_MODE_NONE;
+    rasterizer.frontFace = VK_FRONT_FACE_CLOCKWISE;
+    rasterizer.depthBiasEnable = VK_FALSE;
+    
+    VkPipelineMultisampleStateCreateInfo multisampling = {};
+    multisampling.sType = VK_STRUCTURE_TYPE_PIPELINE_MULTISAMPLE_STATE_CREATE_INFO;
+    multisampling.sampleShadingEnable = VK_FALSE;
+    multisampling.rasterizationSamples = VK_SAMPLE_COUNT_1_BIT;
+    
+    // 放大结果覆盖整个输出图像，之后的UI混合在其上
+    VkPipelineColorBlendAttachmentState colorBlendAttachment = {};
+    colorBlendAttachment.colorWriteMask = VK_COLOR_COMPONENT_R_BIT | VK_COLOR_COMPONENT_G_BIT | VK_COLOR_COMPONENT_B_BIT | VK_COLOR_COMPONENT_A_BIT;
+    colorBlendAttachment.blendEnable = VK_FALSE;
+    
+    VkPipelineColorBlendStateCreateInfo colorBlending = {};
+    colorBlending.sType = VK_STRUCTURE_TYPE_PIPELINE_COLOR_BLEND_STATE_CREATE_INFO;
+    colorBlending.logicOpEnable = VK_FALSE;
+    colorBlending.attachmentCount = 1;
+    colorBlending.pAttachments = &colorBlendAttachment;
+    
+    VkDynamicState dynamicStates[] = { VK_DYNAMIC_STATE_VIEWPORT, VK_DYNAMIC_STATE_SCISSOR };
+    VkPipelineDynamicStateCreateInfo dynamicState = {};
+    dynamicState.sType = VK_STRUCTURE_TYPE_PIPELINE_DYNAMIC_STATE_CREATE_INFO;
+    dynamicState.dynamicStateCount = 2;
+    dynamicState.pDynamicStates = dynamicStates;
+    
+    VkGraphicsPipelineCreateInfo pipelineInfo = {};
+    pipelineInfo.sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO;
+    pipelineInfo.stageCount = 2;
+    pipelineInfo.pStages = shaderStages;
+    pipelineInfo.pVertexInputState = &vertexInputInfo;
+    pipelineInfo.pInputAssemblyState = &inputAssembly;
+    pipelineInfo.pViewportState = &viewportState;
+    pipelineInfo.pRasterizationState = &rasterizer;
+    pipelineInfo.pMultisampleState = &multisampling;
+    pipelineInfo.pColorBlendState = &colorBlending;
+    pipelineInfo.pDynamicState = &dynamicState;
+    pipelineInfo.layout = m_pipelineLayout;
+    pipelineInfo.renderPass = outputRenderPass;
+    pipelineInfo.subpass = 0;
+    
+    VkResult result = vkCreateGraphicsPipelines(m_device, pipelineCache, 1, &pipelineInfo, nullptr, &m_pipeline);
+    
+    vkDestroyShaderModule(m_device, fragShaderModule, nullptr);
+    vkDestroyShaderModule(m_device, vertShaderModule, nullptr);
+    
+    if (result != VK_SUCCESS) {
+        m_pipeline = VK_NULL_HANDLE;
+        printf("[DYNAMIC_RES] Failed to create upscale pipeline: %d\n", result);
+        return false;
+    }
+    
+    return true;
+}
+
+bool VulkanResolutionScaler::EnsureTarget(VkExtent2D extent) {
+    if (!m_initialized || m_targetFailed) {
+        return false;
+    }
+    
+    if (m_target.framebuffer != VK_NULL_HANDLE) {
+        return true;
+    }
+    
+    // 离屏目标只在首次降低分辨率时创建（比例为 1 时场景直接渲染到交换链图像）
+    m_target.extent = extent;
+    
+    VkImageCreateInfo imageInfo = {};
+    imageInfo.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
+    imageInfo.imageType = VK_IMAGE_TYPE_2D;
+    imageInfo.format = m_colorFormat;
+    imageInfo.extent.width = extent.width;
+    imageInfo.extent.height = extent.height;
+    imageInfo.extent.depth = 1;
+    imageInfo.mipLevels = 1;
+    imageInfo.arrayLayers = 1;
+    imageInfo.samples = VK_SAMPLE_COUNT_1_BIT;
+    imageInfo.tiling = VK_IMAGE_TILING_OPTIMAL;
+    imageInfo.usage = VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | VK_IMAGE_USAGE_SAMPLED_BIT;
+    imageInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+    imageInfo.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+    
+    bool created = vkCreateImage(m_device, &imageInfo, nullptr, &m_target.image) == VK_SUCCESS;
+    if (!created) {
+        m_target.image = VK_NULL_HANDLE;
+    }
+    
+    if (created) {
+        created = VulkanMemoryAllocator::AllocateImage(m_allocator, m_device, m_physicalDevice, m_target.image,
+                                                       MemoryPropertyFlag::DeviceLocal, m_target.allocation);
+    }
+    
+    if (created) {
+        VkImageViewCreateInfo viewInfo = {};
+        viewInfo.sType = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO;
+        viewInfo.image = m_target.image;
+        viewInfo.viewType = VK_IMAGE_VIEW_TYPE_2D;
+        viewInfo.format = m_colorFormat;
+        viewInfo.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+        viewInfo.subresourceRange.baseMipLevel = 0;
+        viewInfo.subresourceRange.levelCount = 1;
+        viewInfo.subresourceRange.baseArrayLayer = 0;
+        viewInfo.subresourceRange.layerCount = 1;
+        
+        created = vkCreateImageView(m_device, &viewInfo, nullptr, &m_target.view) == VK_SUCCESS;
+        if (!created) {
+            m_target.view = VK_NULL_HANDLE;
+        }
+    }
+    
+    if (created) {
+        VkDescriptorSetAllocateInfo allocInfo = {};
+        allocInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
+        allocInfo.descriptorPool = m_descriptorPool;
+        allocInfo.descriptorSetCount = 1;
+        allocInfo.pSetLayouts = &m_descriptorSetLayout;
+        
+        created = vkAllocateDescriptorSets(m_device, &allocInfo, &m_target.descriptorSet) == VK_SUCCESS;
+        if (!created) {
+            m_target.descriptorSet = VK_NULL_HANDLE;
+        }
+    }
+    
+    if (created) {
+        VkDescriptorImageInfo imageDescriptor = {};
+        imageDescriptor.sampler = m_sampler;
+        imageDescriptor.imageView = m_target.view;
+        imageDescriptor.imageLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+        
+        VkWriteDescriptorSet write = {};
+        write.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+        write.dstSet = m_target.descriptorSet;
+        write.dstBinding = 0;
+        write.descriptorCount = 1;
+        write.descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+        write.pImageInfo = &imageDescriptor;
+        vkUpdateDescriptorSets(m_device, 1, &write, 0, nullptr);
+        
+        VkFramebufferCreateInfo framebufferInfo = {};
+        framebufferInfo.sType = VK_STRUCTURE_TYPE_FRAMEBUFFER_CREATE_INFO;
+        framebufferInfo.renderPass = m_scenePass;
+        framebufferInfo.attachmentCount = 1;
+        framebufferInfo.pAttachments = &m_target.view;
+        framebufferInfo.width = extent.width;
+        framebufferInfo.height = extent.height;
+        framebufferInfo.layers = 1;
+        
+        created = vkCreateFramebuffer(m_device, &framebufferInfo, nullptr, &m_target.framebuffer) == VK_SUCCESS;
+        if (!created) {
+            m_target.framebuffer = VK_NULL_HANDLE;
+        }
+    }
+    
+    if (!created) {
+        printf("[DYNAMIC_RES] Failed to create %ux%u scene target\n", extent.width, extent.height);
+        DestroyTarget(m_target);
+        m_targetFailed = true;
+        return false;
+    }
+    
+    return true;
+}
+
+void VulkanResolutionScaler::RetireTarget(uint64_t lastSubmitSerial) {
+    m_targetFailed = false;
+    if (!m_initialized || m_target.framebuffer == VK_NULL_HANDLE) {
+        return;
+    }
+    
+    m_retiredTargets.Retire(m_target, lastSubmitSerial);
+    m_target = Target();
+}
+
+void VulkanResolutionScaler::ReleaseRetiredTargets(uint64_t completedSerial) {
+    m_retiredTargets.Release(completedSerial, [this](Target& target) { DestroyTarget(target); });
+}
+
+void VulkanResolutionScaler::DestroyTarget(Target& target) {
+    if (target.framebuffer != VK_NULL_HANDLE) {
+        vkDestroyFramebuffer(m_device, target.framebuffer, nullptr);
+        target.framebuffer = VK_NULL_HANDLE;
+    }
+    
+    if (target.descriptorSet != VK_NULL_HANDLE) {
+        vkFreeDescriptorSets(m_device, m_descriptorPool, 1, &target.descriptorSet);
+        target.descriptorSet = VK_NULL_HANDLE;
+    }
+    
+    if (target.view != VK_NULL_HANDLE) {
+        vkDestroyImageView(m_device, target.view, nullptr);
+        target.view = VK_NULL_HANDLE;
+    }
+    
+    if (target.image != VK_NULL_HANDLE) {
+        vkDestroyImage(m_device, target.image, nullptr);
+        target.image = VK_NULL_HANDLE;
+        VulkanMemoryAllocator::Release(m_allocator, m_device, target.allocation);
+    }
+}
+
+VkExtent2D VulkanResolutionScaler::ScaledExtent(float scale) const {
+    VkExtent2D extent;
+    extent.width = std::max(1u, std::min(m_target.extent.width, (uint32_t)std::lround(m_target.extent.width * scale)));
+    extent.height = std::max(1u, std::min(m_target.extent.height, (uint32_t)std::lround(m_target.extent.height * scale)));
+    return extent;
+}
+
+void VulkanResolutionScaler::ScaleViewport(float scale, VkViewport& viewport, VkRect2D& scissor) const {
+    VkExtent2D scaled = ScaledExtent(scale);
+    
+    viewport.x *= scale;
+    viewport.y *= scale;
+    viewport.width *= scale;
+    viewport.height *= scale;
+    
+    // 原生视口可能超出交换链（窗口小于逻辑尺寸时偏移为负），裁剪矩形必须落在渲染区域内
+    int32_t left = std::max(0, (int32_t)std::floor((float)scissor.offset.x * scale));
+    int32_t top = std::max(0, (int32_t)std::floor((float)scissor.offset.y * scale));
+    int32_t right = std::min((int32_t)scaled.width, (int32_t)std::ceil((float)(scissor.offset.x + (int32_t)scissor.extent.width) * scale));
+    int32_t bottom = std::min((int32_t)scaled.height, (int32_t)std::ceil((float)(scissor.offset.y + (int32_t)scissor.extent.height) * scale));
+    
+    scissor.offset.x = left;
+    scissor.offset.y = top;
+    scissor.extent.width = (uint32_t)std::max(0, right - left);
+    scissor.extent.height = (uint32_t)std::max(0, bottom - top);
+}
+
+void VulkanResolutionScaler::BeginScenePass(VkCommandBuffer commandBuffer, float scale, const VkClearValue& clearValue) {
+    VkRenderPassBeginInfo renderPassInfo = {};
+    renderPassInfo.sType = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO;
+    renderPassInfo.renderPass = m_scenePass;
+    renderPassInfo.framebuffer = m_target.framebuffer;
+    renderPassInfo.renderArea.offset = {0, 0};
+    renderPassInfo.renderArea.extent = ScaledExtent(scale);
+    renderPassInfo.clearValueCount = 1;
+    renderPassInfo.pClearValues = &clearValue;
+    
+    vkCmdBeginRenderPass(commandBuffer, &renderPassInfo, VK_SUBPASS_CONTENTS_INLINE);
+}
+
+void VulkanResolutionScaler::RecordUpscale(VkCommandBuffer commandBuffer, float scale) {
+    if (m_pipeline == VK_NULL_HANDLE || m_target.framebuffer == VK_NULL_HANDLE) {
+        return;
+    }
+    
+    VkExtent2D scaled = ScaledExtent(scale);
+    float targetWidth = (float)m_target.extent.width;
+    float targetHeight = (float)m_target.extent.height;
+    
+    UpscalePushConstants constants = {};
+    constants.uvScale[0] = (float)scaled.width / targetWidth;
+    constants.uvScale[1] = (float)scaled.height / targetHeight;
+    constants.uvMax[0] = ((float)scaled.width - 0.5f) / targetWidth;
+    constants.uvMax[1] = ((float)scaled.height - 0.5f) / targetHeight;
+    constants.texelSize[0] = 1.0f / targetWidth;
+    constants.texelSize[1] = 1.0f / targetHeight;
+    // 比例越低细节损失越多，锐化越强（0.5 时达到最大）
+    constants.sharpness = std::min(1.0f, (1.0f - scale) * 2.0f);
+    
+    VkViewport viewport = {};
+    viewport.x = 0.0f;
+    viewport.y = 0.0f;
+    viewport.width = targetWidth;
+    viewport.height = targetHeight;
+    viewport.minDepth = 0.0f;
+    viewport.maxDepth = 1.0f;
+    
+    VkRect2D scissor = {};
+    scissor.offset = {0, 0};
+    scissor.extent = m_target.extent;
+    
+    vkCmdSetViewport(commandBuffer, 0, 1, &viewport);
+    vkCmdSetScissor(commandBuffer, 0, 1, &scissor);
+    
+    vkCmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, m_pipeline);
+    vkCmdBindDescriptorSets(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, m_pipelineLayout, 0, 1, &m_target.descriptorSet, 0, nullptr);
+    vkCmdPushConstants(commandBuffer, m_pipelineLayout, VK_SHADER_STAGE_FRAGMENT_BIT, 0, sizeof(UpscalePushConstants), &constants);
+    vkCmdDraw(commandBuffer, 3, 1, 0, 0);
+}
@@ -0,0 +1,149 @@
+#pragma once
+
+#ifdef _WIN32
+#define VK_USE_PLATFORM_WIN32_KHR
+#endif
+#include <vulkan/vulkan.h>  // 3. 第三方库头文件
+
+#include <string>  // 2. 系统头文件
+#include <vector>  // 2. 系统头文件
+
+#include "core/interfaces/imemory_allocator.h"  // 4. 项目头文件（接口）
+#include "renderer/vulkan/vulkan_retire_queue.h"  // 4. 项目头文件（Vulkan）
+
+/**
+ * Vulkan 分辨率缩放器 - 动态分辨率的离屏场景目标和放大通道
+ * 
+ * 全屏场景着色器（shader.frag、loading_cubes.frag）的开销与像素数成正比。缩放器提供一个与交换链
+ * 同尺寸的离屏颜色目标，场景只渲染到其左上角按比例缩小的区域，随后在主渲染通道开头用一个全屏三角形
+ * 把该区域放大到交换链图像，UI 继续在原生分辨率下绘制。
+ * 
+ * 场景渲染通道与主渲染通道兼容（同一颜色格式、单个颜色附件），现有场景管线无需重新创建；
+ * 结束时离屏目标转换到着色器只读布局供放大通道采样。放大使用双线性采样，
+ * 比例低于 1 时附加一个按邻域对比度自适应的锐化（限制在邻域范围内，不产生过冲）。
+ * 
+ * 离屏目标所有交换链图像共用，首次使用时创建；交换链重建时旧目标随旧交换链一起退役，
+ * 等引用它们的提交完成后再销毁。
+ * 
+ * 使用方式：
+ * 1. 渲染通道创建后调用 Initialize()（创建场景渲染通道、采样器和放大管线）
+ * 2. 每帧录制前调用 EnsureTarget()，成功后用 BeginScenePass() 替代主渲染通道绘制场景，
+ *    结束场景通道、开始主渲染通道后调用 RecordUpscale()
+ * 3. 交换链重建时调用 RetireTarget()，栅栏触发后调用 ReleaseRetiredTargets()
+ * 4. 设备空闲后调用 Cleanup()
+ */
+class VulkanResolutionScaler {
+public:
+    VulkanResolutionScaler();
+    ~VulkanResolutionScaler();
+    
+    /**
+     * 初始化缩放器
+     * 
+     * @param device Vulkan设备句柄
+     * @param physicalDevice 物理设备句柄（用于分配离屏目标内存）
+     * @param allocator 共享内存分配器（可为 nullptr）
+     * @param colorFormat 交换链图像格式
+     * @param outputRenderPass 放大通道所在的主渲染通道
+     * @param pipelineCache 管线缓存（可为 VK_NULL_HANDLE）
+     * @param vertShaderPath 放大顶点着色器路径（.spv 或 GLSL 源文件）
+     * @param fragShaderPath 放大片段着色器路径（.spv 或 GLSL 源文件）
+     * @return 成功返回 true，失败返回 false（调用方应始终以原生分辨率渲染）
+     */
+    bool Initialize(VkDevice device, VkPhysicalDevice physicalDevice, IMemoryAllocator* allocator, VkFormat colorFormat,
+                    VkRenderPass outputRenderPass, VkPipelineCache pipelineCache,
+                    const std::string& vertShaderPath, const std::string& fragShaderPath);
+    
+    /**
+     * 销毁所有资源（调用前 GPU 必须已完成所有使用它们的提交）
+     */
+    void Cleanup();
+    
+    /**
+     * 确保存在与交换链同尺寸的离屏目标（已存在时直接返回）
+     * 
+     * @param extent 交换链尺寸
+     * @return 成功返回 true，失败返回 false（本帧应以原生分辨率渲染）
+     */
+    bool EnsureTarget(VkExtent2D extent);
+    
+    /**
+     * 退役当前离屏目标（交换链重建时调用，下次 EnsureTarget 重新创建）
+     * 
+     * @param lastSubmitSerial 最后一次可能引用该目标的提交序号
+     */
+    void RetireTarget(uint64_t lastSubmitSerial);
+    
+    /**
+     * 销毁已完成提交不再引用的退役目标
+     * 
+     * @param completedSerial 已完成的最大提交序号
+     */
+    void ReleaseRetiredTargets(uint64_t completedSerial);
+    
+    /**
+     * 把视口和裁剪矩形缩放到场景区域（裁剪矩形限制在缩放后的渲染区域内）
+     * 
+     * @param scale 渲染比例
+     * @param viewport 原生分辨率下的视口（原地修改）
+     * @param scissor 原生分辨率下的裁剪矩形（原地修改）
+     */
+    void ScaleViewport(float scale, VkViewport& viewport, VkRect2D& scissor) const;
+    
+    /**
+     * 开始场景渲染通道（渲染区域为离屏目标按比例缩小后的左上角区域）
+     * 
+     * @param commandBuffer 主命令缓冲区
+     * @param scale 渲染比例
+     * @param clearValue 背景颜色
+     */
+    void BeginScenePass(VkCommandBuffer commandBuffer, float scale, const VkClearValue& clearValue);
+    
+    /**
+     * 把场景区域放大到整个输出图像（在主渲染通道内、场景通道结束之后调用，会改变视口和裁剪矩形）
+     * 
+     * @param commandBuffer 主命令缓冲区
+     * @param scale 场景通道使用的渲染比例
+     */
+    void RecordUpscale(VkCommandBuffer commandBuffer, float scale);
+
+private:
+    // 禁止拷贝和赋值
+    VulkanResolutionScaler(const VulkanResolutionScaler&) = delete;
+    VulkanResolutionScaler& operator=(const VulkanResolutionScaler&) = delete;
+    
+    // 一个与交换链尺寸匹配的离屏目标
+    struct Target {
+        VkExtent2D extent = {0, 0};
+        VkImage image = VK_NULL_HANDLE;
+        MemoryAllocation allocation;
+        VkImageView view = VK_NULL_HANDLE;
+        VkFramebuffer framebuffer = VK_NULL_HANDLE;
+        VkDescriptorSet descriptorSet = VK_NULL_HANDLE;
+    };
+    
+    bool CreateScenePass(VkFormat colorFormat);
+    bool CreateDescriptorResources();
+    bool CreatePipeline(VkRenderPass outputRenderPass, VkPipelineCache pipelineCache,
+                        const std::string& vertShaderPath, const std::string& fragShaderPath);
+    VkExtent2D ScaledExtent(float scale) const;
+    void DestroyTarget(Target& target);
+    
+    VkDevice m_device = VK_NULL_HANDLE;
+    VkPhysicalDevice m_physicalDevice = VK_NULL_HANDLE;
+    IMemoryAllocator* m_allocator = nullptr;  // [BORROW] 由渲染器拥有
+    
+    VkFormat m_colorFormat = VK_FORMAT_UNDEFINED;
+    VkRenderPass m_scenePass = VK_NULL_HANDLE;
+    VkSampler m_sampler = VK_NULL_HANDLE;
+    VkDescriptorSetLayout m_descriptorSetLayout = VK_NULL_HANDLE;
+    VkDescriptorPool m_descriptorPool = VK_NULL_HANDLE;
+    VkPipelineLayout m_pipelineLayout = VK_NULL_HANDLE;
+    VkPipeline m_pipeline = VK_NULL_HANDLE;
+    
+    Target m_target;                  // 当前交换链的离屏目标（framebuffer 为空表示尚未创建）
+    bool m_targetFailed = false;      // 当前交换链尺寸下创建失败（不再每帧重试，交换链重建后重置）
+    RetireQueue<Target> m_retiredTargets;
+    
+    bool m_initialized = false;
+};
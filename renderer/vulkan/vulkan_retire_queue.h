@@ -0,0 +1,55 @@
+#pragma once
+
+#include <cstddef>  // 2. 系统头文件
+#include <cstdint>  // 2. 系统头文件
+#include <utility>  // 2. 系统头文件
+#include <vector>   // 2. 系统头文件
+
+// 退役队列 - 暂存仍可能被在途帧引用的资源，提交完成后再交给调用方销毁
+// 交换链重建时按交换链尺寸创建的渲染目标不等待设备空闲，先按最后一次可能引用它的提交序号退役，
+// 渲染器确认该序号之前的提交都已完成（帧栅栏触发）后调用 Release 销毁
+template <typename T>
+class RetireQueue {
+public:
+    // 同时存在的资源数量上限（当前资源加上等待提交完成的退役资源），描述符池按此容量创建
+    static constexpr uint32_t MAX_LIVE_RESOURCES = 8;
+
+    // 退役资源，lastSubmitSerial 为最后一次可能引用该资源的提交序号
+    void Retire(T resource, uint64_t lastSubmitSerial) {
+        m_entries.push_back(Entry{ std::move(resource), lastSubmitSerial });
+    }
+
+    // 销毁提交序号不超过 completedSerial 的退役资源，destroy 以 T& 为参数
+    template <typename Destroy>
+    void Release(uint64_t completedSerial, Destroy&& destroy) {
+        auto it = m_entries.begin();
+        while (it != m_entries.end()) {
+            if (it->lastSubmitSerial > completedSerial) {
+                ++it;
+                continue;
+            }
+            destroy(it->resource);
+            it = m_entries.erase(it);
+        }
+    }
+
+    // 销毁全部退役资源（调用方已等待设备空闲）
+    template <typename Destroy>
+    void ReleaseAll(Destroy&& destroy) {
+        for (Entry& entry : m_entries) {
+            destroy(entry.resource);
+        }
+        m_entries.clear();
+    }
+
+    bool Empty() const { return m_entries.empty(); }
+    size_t Size() const { return m_entries.size(); }
+
+private:
+    struct Entry {
+        T resource;
+        uint64_t lastSubmitSerial;
+    };
+
+    std::vector<Entry> m_entries;
+};
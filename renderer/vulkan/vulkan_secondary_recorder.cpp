@@ -0,0 +1,221 @@
+#include "renderer/vulkan/vulkan_secondary_recorder.h"  // 1. 对应头文件
+
+#include <stdio.h>  // 2. 系统头文件
+#include <string>  // 2. 系统头文件
+
+#include "core/utils/frame_tracer.h"  // 4. 项目头文件（工具）
+
+VulkanSecondaryRecorder::VulkanSecondaryRecorder() {
+}
+
+VulkanSecondaryRecorder::~VulkanSecondaryRecorder() {
+    Cleanup();
+}
+
+bool VulkanSecondaryRecorder::Initialize(VkDevice device, uint32_t queueFamilyIndex, uint32_t framesInFlight, uint32_t workerCount) {
+    if (m_initialized) {
+        return true;
+    }
+    
+    if (device == VK_NULL_HANDLE || framesInFlight == 0) {
+        return false;
+    }
+    
+    m_device = device;
+    m_lanes.resize(workerCount + 1);
+    
+    // 命令池每帧整体重置，不需要单独重置命令缓冲区
+    VkCommandPoolCreateInfo poolInfo = {};
+    poolInfo.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+    poolInfo.flags = VK_COMMAND_POOL_CREATE_TRANSIENT_BIT;
+    poolInfo.queueFamilyIndex = queueFamilyIndex;
+    
+    for (Lane& lane : m_lanes) {
+        lane.pools.resize(framesInFlight, VK_NULL_HANDLE);
+        lane.buffers.resize(framesInFlight);
+        for (VkCommandPool& pool : lane.pools) {
+            if (vkCreateCommandPool(m_device, &poolInfo, nullptr, &pool) != VK_SUCCESS) {
+                printf("[SECONDARY_RECORDER] Failed to create command pool\n");
+                m_initialized = true;  // 让 Cleanup 销毁已创建的命令池
+                Cleanup();
+                return false;
+            }
+        }
+    }
+    
+    m_stopping = false;
+    m_jobGeneration = 0;
+    m_initialized = true;
+    
+    for (uint32_t i = 1; i < (uint32_t)m_lanes.size(); i++) {
+        m_workers.emplace_back(&VulkanSecondaryRecorder::WorkerMain, this, i);
+    }
+    
+    return true;
+}
+
+void VulkanSecondaryRecorder::Cleanup() {
+    if (!m_initialized) {
+        return;
+    }
+    
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stopping = true;
+    }
+    m_workAvailable.notify_all();
+    for (std::thread& worker : m_workers) {
+        if (worker.joinable()) {
+            worker.join();
+        }
+    }
+    m_workers.clear();
+    
+    // 命令缓冲区随命令池一起释放
+    for (Lane& lane : m_lanes) {
+        for (VkCommandPool pool : lane.pools) {
+            if (pool != VK_NULL_HANDLE) {
+                vkDestroyCommandPool(m_device, pool, nullptr);
+            }
+        }
+    }
+    m_lanes.clear();
+    
+    m_device = VK_NULL_HANDLE;
+    m_initialized = false;
+}
+
+bool VulkanSecondaryRecorder::Record(uint32_t frameIndex, VkRenderPass renderPass, VkFramebuffer framebuffer,
+                                     const std::vector<RecordFunc>& passes, std::vector<VkCommandBuffer>& commandBuffers) {
+    commandBuffers.assign(passes.size(), VK_NULL_HANDLE);
+    if (!m_initialized || passes.empty()) {
+        return false;
+    }
+    
+    m_jobFrame = frameIndex % (uint32_t)m_lanes[0].pools.size();
+    
+    // 该帧槽位上一次提交已完成（调用方已等待栅栏），整体重置各通道的命令池
+    for (Lane& lane : m_lanes) {
+        vkResetCommandPool(m_device, lane.pools[m_jobFrame], 0);
+        lane.failed = false;
+    }
+    
+    m_jobInheritance = {};
+    m_jobInheritance.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_INFO;
+    m_jobInheritance.renderPass = renderPass;
+    m_jobInheritance.subpass = 0;
+    m_jobInheritance.framebuffer = framebuffer;
+    m_jobPasses = &passes;
+    m_jobOutput = &commandBuffers;
+    
+    // 阶段数不超过1个时不唤醒工作线程
+    uint32_t workerCount = (uint32_t)m_workers.size();
+    if (passes.size() <= 1) {
+        workerCount = 0;
+    }
+    
+    if (workerCount > 0) {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_pendingWorkers = workerCount;
+            m_jobGeneration++;
+        }
+        m_workAvailable.notify_all();
+    }
+    
+    // 调用线程录制通道 0，然后等待工作线程
+    RecordLane(0);
+    
+    if (workerCount > 0) {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_workDone.wait(lock, [this]() { return m_pendingWorkers == 0; });
+    }
+    
+    m_jobPasses = nullptr;
+    m_jobOutput = nullptr;
+    
+    for (const Lane& lane : m_lanes) {
+        if (lane.failed) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void VulkanSecondaryRecorder::WorkerMain(uint32_t laneIndex) {
+    uint64_t seenGeneration = 0;
+    FrameTracer::SetThreadName("RecordWorker " + std::to_string(laneIndex));
+    
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_workAvailable.wait(lock, [this, seenGeneration]() {
+                return m_stopping || m_jobGeneration != seenGeneration;
+            });
+            if (m_stopping) {
+                return;
+            }
+            seenGeneration = m_jobGeneration;
+        }
+        
+        RecordLane(laneIndex);
+        
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_pendingWorkers--;
+            if (m_pendingWorkers == 0) {
+                m_workDone.notify_one();
+            }
+        }
+    }
+}
+
+void VulkanSecondaryRecorder::RecordLane(uint32_t laneIndex) {
+    TraceScope traceScope("RecordLane");
+    Lane& lane = m_lanes[laneIndex];
+    std::vector<VkCommandBuffer>& frameBuffers = lane.buffers[m_jobFrame];
+    VkCommandPool pool = lane.pools[m_jobFrame];
+    uint32_t laneCount = (uint32_t)m_lanes.size();
+    uint32_t used = 0;
+    
+    // 阶段 i 分配到通道 i % laneCount，每个阶段使用通道内的下一个命令缓冲区
+    for (size_t i = laneIndex; i < m_jobPasses->size(); i += laneCount) {
+        if (used == frameBuffers.size()) {
+            VkCommandBufferAllocateInfo allocInfo = {};
+            allocInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+            allocInfo.commandPool = pool;
+            allocInfo.level = VK_COMMAND_BUFFER_LEVEL_SECONDARY;
+            allocInfo.commandBufferCount = 1;
+            
+            VkCommandBuffer newBuffer = VK_NULL_HANDLE;
+            if (vkAllocateCommandBuffers(m_device, &allocInfo, &newBuffer) != VK_SUCCESS) {
+                printf("[SECONDARY_RECORDER] Failed to allocate secondary command buffer\n");
+                lane.failed = true;
+                return;
+            }
+            frameBuffers.push_back(newBuffer);
+        }
+        VkCommandBuffer commandBuffer = frameBuffers[used++];
+        
+        VkCommandBufferBeginInfo beginInfo = {};
+        beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+        beginInfo.flags = VK_COMMAND_BUFFER_USAGE_RENDER_PASS_CONTINUE_BIT | VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+        beginInfo.pInheritanceInfo = &m_jobInheritance;
+        
+        if (vkBeginCommandBuffer(commandBuffer, &beginInfo) != VK_SUCCESS) {
+            printf("[SECONDARY_RECORDER] Failed to begin secondary command buffer\n");
+            lane.failed = true;
+            return;
+        }
+        
+        (*m_jobPasses)[i](commandBuffer);
+        
+        if (vkEndCommandBuffer(commandBuffer) != VK_SUCCESS) {
+            printf("[SECONDARY_RECORDER] Failed to record secondary command buffer\n");
+            lane.failed = true;
+            return;
+        }
+        
+        (*m_jobOutput)[i] = commandBuffer;
+    }
+}
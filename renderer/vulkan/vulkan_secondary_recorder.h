@@ -0,0 +1,103 @@
+#pragma once
+
+#ifdef _WIN32
+#define VK_USE_PLATFORM_WIN32_KHR
+#endif
+#include <vulkan/vulkan.h>  // 3. 第三方库头文件
+
+#include <condition_variable>  // 2. 系统头文件
+#include <functional>  // 2. 系统头文件
+#include <mutex>  // 2. 系统头文件
+#include <thread>  // 2. 系统头文件
+#include <vector>  // 2. 系统头文件
+
+/**
+ * Vulkan 二级命令缓冲区并行录制器
+ * 
+ * 把一帧的多个渲染阶段（背景、加载动画、按钮和滑块、文本）分配到若干录制通道上并行录制，
+ * 每个阶段录制到独立的二级命令缓冲区，输出顺序与输入顺序一致，调用方按该顺序（即层级顺序）
+ * 在主命令缓冲区中 vkCmdExecuteCommands。
+ * 
+ * 每个录制通道拥有自己的命令池（每个在途帧一个），命令池只被该通道的线程使用，无需加锁。
+ * 通道 0 在调用线程上录制，其余通道由常驻工作线程录制；阶段按 i % 通道数 分配到通道。
+ * 二级命令缓冲区不继承动态状态，每个阶段录制时必须自行设置视口和裁剪区域。
+ * 
+ * 使用方式：
+ * 1. 命令池和渲染通道创建后调用 Initialize()
+ * 2. 每帧等待该帧槽位的栅栏后调用 Record()，再以 VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS 执行输出的命令缓冲区
+ * 3. 设备空闲后调用 Cleanup()（结束工作线程并销毁命令池）
+ */
+class VulkanSecondaryRecorder {
+public:
+    // 录制一个渲染阶段（参数为已开始录制的二级命令缓冲区）
+    using RecordFunc = std::function<void(VkCommandBuffer)>;
+    
+    VulkanSecondaryRecorder();
+    ~VulkanSecondaryRecorder();
+    
+    /**
+     * 初始化录制器（创建命令池并启动工作线程）
+     * 
+     * @param device Vulkan设备句柄
+     * @param queueFamilyIndex 执行主命令缓冲区的队列族
+     * @param framesInFlight 在途帧数量（每个通道每帧一个命令池）
+     * @param workerCount 工作线程数量（录制通道数为 workerCount + 1）
+     * @return 成功返回 true，失败返回 false（调用方应退回到直接录制主命令缓冲区）
+     */
+    bool Initialize(VkDevice device, uint32_t queueFamilyIndex, uint32_t framesInFlight, uint32_t workerCount);
+    
+    /**
+     * 结束工作线程并销毁命令池（调用前 GPU 必须已完成所有使用二级命令缓冲区的提交）
+     */
+    void Cleanup();
+    
+    /**
+     * 并行录制各渲染阶段，阻塞直到全部完成
+     * 
+     * @param frameIndex 帧槽位索引（调用前必须已等待该帧槽位的栅栏，其命令池将被重置）
+     * @param renderPass 二级命令缓冲区所在的渲染通道
+     * @param framebuffer 本帧使用的帧缓冲
+     * @param passes 按层级顺序排列的渲染阶段
+     * @param commandBuffers 输出：与 passes 一一对应的二级命令缓冲区
+     * @return 全部录制成功返回 true，否则返回 false
+     */
+    bool Record(uint32_t frameIndex, VkRenderPass renderPass, VkFramebuffer framebuffer,
+                const std::vector<RecordFunc>& passes, std::vector<VkCommandBuffer>& commandBuffers);
+    
+    uint32_t GetLaneCount() const { return (uint32_t)m_lanes.size(); }
+
+private:
+    // 禁止拷贝和赋值
+    VulkanSecondaryRecorder(const VulkanSecondaryRecorder&) = delete;
+    VulkanSecondaryRecorder& operator=(const VulkanSecondaryRecorder&) = delete;
+    
+    // 录制通道（命令池和二级命令缓冲区只被一个线程使用）
+    struct Lane {
+        std::vector<VkCommandPool> pools;                     // 每个帧槽位一个
+        std::vector<std::vector<VkCommandBuffer>> buffers;    // 每个帧槽位已分配的二级命令缓冲区（按需增长）
+        bool failed = false;                                  // 本次录制是否失败
+    };
+    
+    void WorkerMain(uint32_t laneIndex);
+    void RecordLane(uint32_t laneIndex);
+    
+    VkDevice m_device = VK_NULL_HANDLE;
+    std::vector<Lane> m_lanes;
+    std::vector<std::thread> m_workers;  // m_workers[i] 录制通道 i + 1
+    
+    // 工作线程同步
+    std::mutex m_mutex;
+    std::condition_variable m_workAvailable;
+    std::condition_variable m_workDone;
+    uint64_t m_jobGeneration = 0;  // 每次 Record() 递增，工作线程据此发现新任务
+    uint32_t m_pendingWorkers = 0;
+    bool m_stopping = false;
+    
+    // 当前任务（仅在 Record() 执行期间有效）
+    const std::vector<RecordFunc>* m_jobPasses = nullptr;
+    std::vector<VkCommandBuffer>* m_jobOutput = nullptr;
+    VkCommandBufferInheritanceInfo m_jobInheritance = {};
+    uint32_t m_jobFrame = 0;
+    
+    bool m_initialized = false;
+};
@@ -0,0 +1,734 @@
+#include "renderer/vulkan/vulkan_temporal_resolver.h"  // 1. 对应头文件
+
+#include <stdio.h>  // 2. 系统头文件
+
+#include "core/config/render_constants.h"  // 4. 项目头文件（配置）
+#include "renderer/vulkan/vulkan_memory_allocator.h"  // 4. 项目头文件（Vulkan）
+#include "shader/shader_loader.h"  // 4. 项目头文件（着色器）
+
+namespace {
+
+// 渲染目标格式：命中距离写入 alpha，需要浮点精度；历史以浮点累积避免 8 位量化造成的残留
+const VkFormat TARGET_FORMAT = VK_FORMAT_R16G16B16A16_SFLOAT;
+
+// 合成着色器的推送常量（复用 upscale.frag，与其 UpscaleParams 一致）
+struct CompositePushConstants {
+    float uvScale[2];
+    float uvMax[2];
+    float texelSize[2];
+    float sharpness;
+    float padding;
+};
+
+VkImageMemoryBarrier MakeImageBarrier(VkImage image, VkImageLayout oldLayout, VkImageLayout newLayout,
+                                      VkAccessFlags srcAccess, VkAccessFlags dstAccess) {
+    VkImageMemoryBarrier barrier = {};
+    barrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+    barrier.srcAccessMask = srcAccess;
+    barrier.dstAccessMask = dstAccess;
+    barrier.oldLayout = oldLayout;
+    barrier.newLayout = newLayout;
+    barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    barrier.image = image;
+    barrier.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+    barrier.subresourceRange.baseMipLevel = 0;
+    barrier.subresourceRange.levelCount = 1;
+    barrier.subresourceRange.baseArrayLayer = 0;
+    barrier.subresourceRange.layerCount = 1;
+    return barrier;
+}
+
+} // namespace
+
+VulkanTemporalResolver::VulkanTemporalResolver() {
+}
+
+VulkanTemporalResolver::~VulkanTemporalResolver() {
+    Cleanup();
+}
+
+bool VulkanTemporalResolver::Initialize(VkDevice device, VkPhysicalDevice physicalDevice, IMemoryAllocator* allocator,
+                                        VkDescriptorSetLayout sceneSetLayout, VkRenderPass outputRenderPass, VkPipelineCache pipelineCache,
+                                        const std::string& fullscreenVertPath, const std::string& resolveFragPath,
+                                        const std::string& compositeFragPath) {
+    if (m_initialized) {
+        return true;
+    }
+    
+    if (device == VK_NULL_HANDLE || physicalDevice == VK_NULL_HANDLE ||
+        sceneSetLayout == VK_NULL_HANDLE || outputRenderPass == VK_NULL_HANDLE) {
+        return false;
+    }
+    
+    m_device = device;
+    m_physicalDevice = physicalDevice;
+    m_allocator = allocator;
+    m_initialized = true;
+    
+    // 失败时由 Cleanup 销毁已创建的部分
+    if (!CreateRenderPasses()) {
+        printf("[TAA] Failed to create render passes\n");
+        Cleanup();
+        return false;
+    }
+    
+    if (!CreateDescriptorResources(sceneSetLayout)) {
+        printf("[TAA] Failed to create descriptor resources\n");
+        Cleanup();
+        return false;
+    }
+    
+    m_resolvePipeline = CreateFullscreenPipeline(m_resolveLayout, m_resolvePass, pipelineCache, fullscreenVertPath, resolveFragPath);
+    m_compositePipeline = CreateFullscreenPipeline(m_compositeLayout, outputRenderPass, pipelineCache, fullscreenVertPath, compositeFragPath);
+    if (m_resolvePipeline == VK_NULL_HANDLE || m_compositePipeline == VK_NULL_HANDLE) {
+        Cleanup();
+        return false;
+    }
+    
+    return true;
+}
+
+void VulkanTemporalResolver::Cleanup() {
+    if (!m_initialized) {
+        return;
+    }
+    
+    DestroyTarget(m_target);
+    m_retiredTargets.ReleaseAll([this](Target& target) { DestroyTarget(target); });
+    
+    VkPipeline* pipelines[] = { &m_scenePipeline, &m_resolvePipeline, &m_compositePipeline };
+    for (VkPipeline* pipeline : pipelines) {
+        if (*pipeline != VK_NULL_HANDLE) {
+            vkDestroyPipeline(m_device, *pipeline, nullptr);
+            *pipeline = VK_NULL_HANDLE;
+        }
+    }
+    
+    VkPipelineLayout* layouts[] = { &m_resolveLayout, &m_compositeLayout };
+    for (VkPipelineLayout* layout : layouts) {
+        if (*layout != VK_NULL_HANDLE) {
+            vkDestroyPipelineLayout(m_device, *layout, nullptr);
+            *layout = VK_NULL_HANDLE;
+        }
+    }
+    
+    if (m_descriptorPool != VK_NULL_HANDLE) {
+        vkDestroyDescriptorPool(m_device, m_descriptorPool, nullptr);
+        m_descriptorPool = VK_NULL_HANDLE;
+    }
+    
+    VkDescriptorSetLayout* setLayouts[] = { &m_resolveSetLayout, &m_compositeSetLayout };
+    for (VkDescriptorSetLayout* setLayout : setLayouts) {
+        if (*setLayout != VK_NULL_HANDLE) {
+            vkDestroyDescriptorSetLayout(m_device, *setLayout, nullptr);
+            *setLayout = VK_NULL_HANDLE;
+        }
+    }
+    
+    if (m_sampler != VK_NULL_HANDLE) {
+        vkDestroySampler(m_device, m_sampler, nullptr);
+        m_sampler = VK_NULL_HANDLE;
+    }
+    
+    VkRenderPass* renderPasses[] = { &m_scenePass, &m_resolvePass };
+    for (VkRenderPass* renderPass : renderPasses) {
+        if (*renderPass != VK_NULL_HANDLE) {
+            vkDestroyRenderPass(m_device, *renderPass, nullptr);
+            *renderPass = VK_NULL_HANDLE;
+        }
+    }
+    
+    m_allocator = nullptr;
+    m_device = VK_NULL_HANDLE;
+    m_initialized = false;
+}
+
+bool VulkanTemporalResolver::CreateRenderPasses() {
+    VkAttachmentDescription colorAttachment = {};
+    colorAttachment.format = TARGET_FORMAT;
+    colorAttachment.samples = VK_SAMPLE_COUNT_1_BIT;
+    colorAttachment.loadOp = VK_ATTACHMENT_LOAD_OP_CLEAR;
+    colorAttachment.storeOp = VK_ATTACHMENT_STORE_OP_STORE;
+    colorAttachment.stencilLoadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
+    colorAttachment.stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
+    colorAttachment.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+    colorAttachment.finalLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+    
+    VkAttachmentReference colorRef = { 0, VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL };
+    
+    VkSubpassDescription subpass = {};
+    subpass.pipelineBindPoint = VK_PIPELINE_BIND_POINT_GRAPHICS;
+    subpass.colorAttachmentCount = 1;
+    subpass.pColorAttachments = &colorRef;
+    
+    VkSubpassDependency dependencies[2] = {};
+    // 渲染目标所有帧共用：等待之前提交的解析 / 合成通道读取完成后再写入
+    dependencies[0].srcSubpass = VK_SUBPASS_EXTERNAL;
+    dependencies[0].dstSubpass = 0;
+    dependencies[0].srcStageMask = VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT | VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
+    dependencies[0].srcAccessMask = VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT;
+    dependencies[0].dstStageMask = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
+    dependencies[0].dstAccessMask = VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT;
+    
+    // 场景写入对随后解析通道的片段着色器读取可见
+    dependencies[1].srcSubpass = 0;
+    dependencies[1].dstSubpass = VK_SUBPASS_EXTERNAL;
+    dependencies[1].srcStageMask = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
+    dependencies[1].srcAccessMask = VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT;
+    dependencies[1].dstStageMask = VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT;
+    dependencies[1].dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
+    
+    VkRenderPassCreateInfo renderPassInfo = {};
+    renderPassInfo.sType = VK_STRUCTURE_TYPE_RENDER_PASS_CREATE_INFO;
+    renderPassInfo.attachmentCount = 1;
+    renderPassInfo.pAttachments = &colorAttachment;
+    renderPassInfo.subpassCount = 1;
+    renderPassInfo.pSubpasses = &subpass;
+    renderPassInfo.dependencyCount = 2;
+    renderPassInfo.pDependencies = dependencies;
+    
+    if (vkCreateRenderPass(m_device, &renderPassInfo, nullptr, &m_scenePass) != VK_SUCCESS) {
+        m_scenePass = VK_NULL_HANDLE;
+        return false;
+    }
+    
+    // 解析通道覆盖每个像素，不需要清除；结束后作为复制源更新历史
+    colorAttachment.loadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
+    colorAttachment.finalLayout = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+    dependencies[1].dstStageMask = VK_PIPELINE_STAGE_TRANSFER_BIT;
+    dependencies[1].dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
+    
+    if (vkCreateRenderPass(m_device, &renderPassInfo, nullptr, &m_resolvePass) != VK_SUCCESS) {
+        m_resolvePass = VK_NULL_HANDLE;
+        return false;
+    }
+    
+    return true;
+}
+
+bool VulkanTemporalResolver::CreateDescriptorResources(VkDescriptorSetLayout sceneSetLayout) {
+    // 本帧采样按像素读取（texelFetch），历史在重投影位置双线性采样
+    VkSamplerCreateInfo samplerInfo = {};
+    samplerInfo.sType = VK_STRUCTURE_TYPE_SAMPLER_CREATE_INFO;
+    samplerInfo.magFilter = VK_FILTER_LINEAR;
+    samplerInfo.minFilter = VK_FILTER_LINEAR;
+    samplerInfo.mipmapMode = VK_SAMPLER_MIPMAP_MODE_NEAREST;
+    samplerInfo.addressModeU = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE;
+    samplerInfo.addressModeV = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE;
+    samplerInfo.addressModeW = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE;
+    samplerInfo.maxLod = 0.0f;
+    samplerInfo.borderColor = VK_BORDER_COLOR_INT_OPAQUE_BLACK;
+    
+    if (vkCreateSampler(m_device, &samplerInfo, nullptr, &m_sampler) != VK_SUCCESS) {
+        m_sampler = VK_NULL_HANDLE;
+        return false;
+    }
+    
+    // 解析：binding 0 本帧采样，binding 1 历史；合成：binding 0 解析结果
+    VkDescriptorSetLayoutBinding bindings[2] = {};
+    for (uint32_t i = 0; i < 2; i++) {
+        bindings[i].binding = i;
+        bindings[i].descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+        bindings[i].descriptorCount = 1;
+        bindings[i].stageFlags = VK_SHADER_STAGE_FRAGMENT_BIT;
+    }
+    
+    VkDescriptorSetLayoutCreateInfo layoutInfo = {};
+    layoutInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
+    layoutInfo.bindingCount = 2;
+    layoutInfo.pBindings = bindings;
+    
+    if (vkCreateDescriptorSetLayout(m_device, &layoutInfo, nullptr, &m_resolveSetLayout) != VK_SUCCESS) {
+        m_resolveSetLayout = VK_NULL_HANDLE;
+        return false;
+    }
+    
+    layoutInfo.bindingCount = 1;
+    if (vkCreateDescriptorSetLayout(m_device, &layoutInfo, nullptr, &m_compositeSetLayout) != VK_SUCCESS) {
+        m_compositeSetLayout = VK_NULL_HANDLE;
+        return false;
+    }
+    
+    // 每个渲染目标两个描述符集（共三个采样器描述符），目标销毁时单独释放
+    VkDescriptorPoolSize poolSize = {};
+    poolSize.type = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+    poolSize.descriptorCount = RetireQueue<Target>::MAX_LIVE_RESOURCES * 3;
+    
+    VkDescriptorPoolCreateInfo poolInfo = {};
+    poolInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
+    poolInfo.flags = VK_DESCRIPTOR_POOL_CREATE_FREE_DESCRIPTOR_SET_BIT;
+    poolInfo.maxSets = RetireQueue<Target>::MAX_LIVE_RESOURCES * 2;
+    poolInfo.poolSizeCount = 1;
+    poolInfo.pPoolSizes = &poolSize;
+    
+    if (vkCreateDescriptorPool(m_device, &poolInfo, nullptr, &m_descriptorPool) != VK_SUCCESS) {
+        m_descriptorPool = VK_NULL_HANDLE;
+        return false;
+    }
+    
+    // 解析管线布局：set 0 为场景参数（相机、抖动、历史权重），set 1 为本帧采样和历史
+    VkDescriptorSetLayout resolveSetLayouts[] = { sceneSetLayout, m_resolveSetLayout };
+    
+    VkPipelineLayoutCreateInfo pipelineLayoutInfo = {};
+    pipelineLayoutInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
+    pipelineLayoutInfo.setLayoutCount = 2;
+    pipelineLayoutInfo.pSetLayouts = resolveSetLayouts;
+    
+    if (vkCreatePipelineLayout(m_device, &pipelineLayoutInfo, nullptr, &m_resolveLayout) != VK_SUCCESS) {
+        m_resolveLayout = VK_NULL_HANDLE;
+        return false;
+    }
+    
+    VkPushConstantRange compositeRange = {};
+    compositeRange.stageFlags = VK_SHADER_STAGE_FRAGMENT_BIT;
+    compositeRange.offset = 0;
+    compositeRange.size = sizeof(CompositePushConstants);
+    
+    pipelineLayoutInfo.setLayoutCount = 1;
+    pipelineLayoutInfo.pSetLayouts = &m_compositeSetLayout;
+    pipelineLayoutInfo.pushConstantRangeCount = 1;
+    pipelineLayoutInfo.pPushConstantRanges = &compositeRange;
+    
+    if (vkCreatePipelineLayout(m_device, &pipelineLayoutInfo, nullptr, &m_compositeLayout) != VK_SUCCESS) {
+        m_compositeLayout = VK_NULL_HANDLE;
+        return false;
+    }
+    
+    return true;
+}
+
+VkPipeline VulkanTemporalResolver::CreateFullscreenPipeline(VkPipelineLayout pipelineLayout, VkRenderPass renderPass,
+                                                            VkPipelineCache pipelineCache,
+                                                            const std::string& vertShaderPath, const std::string& fragShaderPath) {
+    std::vector<char> vertShaderCode = renderer::shader::ShaderLoader::LoadShaderCode(vertShaderPath, ShaderStage::Vertex);
+    std::vector<char> fragShaderCode = renderer::shader::ShaderLoader::LoadShaderCode(fragShaderPath, ShaderStage::Fragment);
+    if (vertShaderCode.empty() || fragShaderCode.empty()) {
+        printf("[TAA] Failed to load shaders: %s, %s\n", vertShaderPath.c_str(), fragShaderPath.c_str());
+        return VK_NULL_HANDLE;
+    }
+    
+    VkShaderModule vertShaderModule = static_cast<VkShaderModule>(
+        renderer::shader::ShaderLoader::CreateShaderModuleFromSPIRV(static_cast<DeviceHandle>(m_device), vertShaderCode));
+    VkShaderModule fragShaderModule = static_cast<VkShaderModule>(
+        renderer::shader::ShaderLoader::CreateShaderModuleFromSPIRV(static_cast<DeviceHandle>(m_device), fragShaderCode));
+    if (vertShaderModule == VK_NULL_HANDLE || fragShaderModule == VK_NULL_HANDLE) {
+        if (vertShaderModule != VK_NULL_HANDLE) {
+            vkDestroyShaderModule(m_device, vertShaderModule, nullptr);
+        }
+        if (fragShaderModule != VK_NULL_HANDLE) {
+            vkDestroyShaderModule(m_device, fragShaderModule, nullptr);
+        }
+        printf("[TAA] Failed to create shader modules\n");
+        return VK_NULL_HANDLE;
+    }
+    
+    VkPipelineShaderStageCreateInfo shaderStages[2] = {};
+    shaderStages[0].sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+    shaderStages[0].stage = VK_SHADER_STAGE_VERTEX_BIT;
+    shaderStages[0].module = vertShaderModule;
+    shaderStages[0].pName = "main";
+    shaderStages[1].sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+    shaderStages[1].stage = VK_SHADER_STAGE_FRAGMENT_BIT;
+    shaderStages[1].module = fragShaderModule;
+    shaderStages[1].pName = "main";
+    
+    // 三个通道都是全屏图元，顶点由 gl_VertexIndex 生成
+    VkPipelineVertexInputStateCreateInfo vertexInputInfo = {};
+    vertexInputInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO;
+    
+    VkPipelineInputAssemblyStateCreateInfo inputAssembly = {};
+    inputAssembly.sType = VK_STRUCTURE_TYPE_PIPELINE_INPUT_ASSEMBLY_STATE_CREATE_INFO;
+    inputAssembly.topology = VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
+    inputAssembly.primitiveRestartEnable = VK_FALSE;
+    
+    VkPipelineViewportStateCreateInfo viewportState = {};
+    viewportState.sType = VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_STATE_CREATE_INFO;
+    viewportState.viewportCount = 1;
+    viewportState.scissorCount = 1;
+    
+    VkPipelineRasterizationStateCreateInfo rasterizer = {};
+    rasterizer.sType = VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_STATE_CREATE_INFO;
+    rasterizer.depthClampEnable = VK_FALSE;
+    rasterizer.rasterizerDiscardEnable = VK_FALSE;
+    rasterizer.polygonMode = VK_POLYGON_MODE_FILL;
+    rasterizer.lineWidth = 1.0f;
+    rasterizer.cullMode = VK_CULL_MODE_NONE;
+    rasterizer.frontFace = VK_FRONT_FACE_CLOCKWISE;
+    rasterizer.depthBiasEnable = VK_FALSE;
+    
+    VkPipelineMultisampleStateCreateInfo multisampling = {};
+    multisampling.sType = VK_STRUCTURE_TYPE_PIPELINE_MULTISAMPLE_STATE_CREATE_INFO;
+    multisampling.sampleShadingEnable = VK_FALSE;
+    multisampling.rasterizationSamples = VK_SAMPLE_COUNT_1_BIT;
+    
+    VkPipelineColorBlendAttachmentState colorBlendAttachment = {};
+    colorBlendAttachment.colorWriteMask = VK_COLOR_COMPONENT_R_BIT | VK_COLOR_COMPONENT_G_BIT | VK_COLOR_COMPONENT_B_BIT | VK_COLOR_COMPONENT_A_BIT;
+    colorBlendAttachment.blendEnable = VK_FALSE;
+    
+    VkPipelineColorBlendStateCreateInfo colorBlending = {};
+    colorBlending.sType = VK_STRUCTURE_TYPE_PIPELINE_COLOR_BLEND_STATE_CREATE_INFO;
+    colorBlending.logicOpEnable = VK_FALSE;
+    colorBlending.attachmentCount = 1;
+    colorBlending.pAttachments = &colorBlendAttachment;
+    
+    VkDynamicState dynamicStates[] = { VK_DYNAMIC_STATE_VIEWPORT, VK_DYNAMIC_STATE_SCISSOR };
+    VkPipelineDynamicStateCreateInfo dynamicState = {};
+    dynamicState.sType = VK_STRUCTURE_TYPE_PIPELINE_DYNAMIC_STATE_CREATE_INFO;
+    dynamicState.dynamicStateCount = 2;
+    dynamicState.pDynamicStates = dynamicStates;
+    
+    VkGraphicsPipelineCreateInfo pipelineInfo = {};
+    pipelineInfo.sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO;
+    pipelineInfo.stageCount = 2;
+    pipelineInfo.pStages = shaderStages;
+    pipelineInfo.pVertexInputState = &vertexInputInfo;
+    pipelineInfo.pInputAssemblyState = &inputAssembly;
+    pipelineInfo.pViewportState = &viewportState;
+    pipelineInfo.pRasterizationState = &rasterizer;
+    pipelineInfo.pMultisampleState = &multisampling;
+    pipelineInfo.pColorBlendState = &colorBlending;
+    pipelineInfo.pDynamicState = &dynamicState;
+    pipelineInfo.layout = pipelineLayout;
+    pipelineInfo.renderPass = renderPass;
+    pipelineInfo.subpass = 0;
+    
+    VkPipeline pipeline = VK_NULL_HANDLE;
+    VkResult result = vkCreateGraphicsPipelines(m_device, pipelineCache, 1, &pipelineInfo, nullptr, &pipeline);
+    
+    vkDestroyShaderModule(m_device, fragShaderModule, nullptr);
+    vkDestroyShaderModule(m_device, vertShaderModule, nullptr);
+    
+    if (result != VK_SUCCESS) {
+        printf("[TAA] Failed to create pipeline for %s: %d\n", fragShaderPath.c_str(), result);
+        return VK_NULL_HANDLE;
+    }
+    
+    return pipeline;
+}
+
+bool VulkanTemporalResolver::CreatePipeline(VkPipelineLayout pipelineLayout, VkPipelineCache pipelineCache,
+                                            const std::string& vertShaderPath, const std::string& fragShaderPath) {
+    if (!m_initialized || m_scenePipeline != VK_NULL_HANDLE) {
+        return m_scenePipeline != VK_NULL_HANDLE;
+    }
+    
+    m_scenePipeline = CreateFullscreenPipeline(pipelineLayout, m_scenePass, pipelineCache, vertShaderPath, fragShaderPath);
+    return m_scenePipeline != VK_NULL_HANDLE;
+}
+
+bool VulkanTemporalResolver::CreateAttachment(VkExtent2D extent, VkImageUsageFlags usage, Attachment& attachment) {
+    VkImageCreateInfo imageInfo = {};
+    imageInfo.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
+    imageInfo.imageType = VK_IMAGE_TYPE_2D;
+    imageInfo.format = TARGET_FORMAT;
+    imageInfo.extent.width = extent.width;
+    imageInfo.extent.height = extent.height;
+    imageInfo.extent.depth = 1;
+    imageInfo.mipLevels = 1;
+    imageInfo.arrayLayers = 1;
+    imageInfo.samples = VK_SAMPLE_COUNT_1_BIT;
+    imageInfo.tiling = VK_IMAGE_TILING_OPTIMAL;
+    imageInfo.usage = usage;
+    imageInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+    imageInfo.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+    
+    if (vkCreateImage(m_device, &imageInfo, nullptr, &attachment.image) != VK_SUCCESS) {
+        attachment.image = VK_NULL_HANDLE;
+        return false;
+    }
+    
+    if (!VulkanMemoryAllocator::AllocateImage(m_allocator, m_device, m_physicalDevice, attachment.image,
+                                              MemoryPropertyFlag::DeviceLocal, attachment.allocation)) {
+        return false;
+    }
+    
+    VkImageViewCreateInfo viewInfo = {};
+    viewInfo.sType = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO;
+    viewInfo.image = attachment.image;
+    viewInfo.viewType = VK_IMAGE_VIEW_TYPE_2D;
+    viewInfo.format = TARGET_FORMAT;
+    viewInfo.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+    viewInfo.subresourceRange.baseMipLevel = 0;
+    viewInfo.subresourceRange.levelCount = 1;
+    viewInfo.subresourceRange.baseArrayLayer = 0;
+    viewInfo.subresourceRange.layerCount = 1;
+    
+    if (vkCreateImageView(m_device, &viewInfo, nullptr, &attachment.view) != VK_SUCCESS) {
+        attachment.view = VK_NULL_HANDLE;
+        return false;
+    }
+    
+    return true;
+}
+
+bool VulkanTemporalResolver::EnsureTarget(VkExtent2D extent) {
+    if (!m_initialized || m_targetFailed) {
+        return false;
+    }
+    
+    if (m_target.resolvedFramebuffer != VK_NULL_HANDLE) {
+        return true;
+    }
+    
+    // 渲染目标只在首次使用时间抗锯齿时创建
+    m_target.extent = extent;
+    
+    bool created = CreateAttachment(extent, VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | VK_IMAGE_USAGE_SAMPLED_BIT, m_target.current) &&
+                   CreateAttachment(extent, VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | VK_IMAGE_USAGE_SAMPLED_BIT |
+                                    VK_IMAGE_USAGE_TRANSFER_SRC_BIT, m_target.resolved) &&
+                   CreateAttachment(extent, VK_IMAGE_USAGE_SAMPLED_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT, m_target.history);
+    
+    if (created) {
+        VkFramebufferCreateInfo framebufferInfo = {};
+        framebufferInfo.sType = VK_STRUCTURE_TYPE_FRAMEBUFFER_CREATE_INFO;
+        framebufferInfo.renderPass = m_scenePass;
+        framebufferInfo.attachmentCount = 1;
+        framebufferInfo.pAttachments = &m_target.current.view;
+        framebufferInfo.width = extent.width;
+        framebufferInfo.height = extent.height;
+        framebufferInfo.layers = 1;
+        
+        created = vkCreateFramebuffer(m_device, &framebufferInfo, nullptr, &m_target.sceneFramebuffer) == VK_SUCCESS;
+        if (!created) {
+            m_target.sceneFramebuffer = VK_NULL_HANDLE;
+        }
+        
+        if (created) {
+            framebufferInfo.renderPass = m_resolvePass;
+            framebufferInfo.pAttachments = &m_target.resolved.view;
+            created = vkCreateFramebuffer(m_device, &framebufferInfo, nullptr, &m_target.resolvedFramebuffer) == VK_SUCCESS;
+            if (!created) {
+                m_target.resolvedFramebuffer = VK_NULL_HANDLE;
+            }
+        }
+    }
+    
+    if (created) {
+        VkDescriptorSetLayout setLayouts[] = { m_resolveSetLayout, m_compositeSetLayout };
+        VkDescriptorSet sets[2] = { VK_NULL_HANDLE, VK_NULL_HANDLE };
+        
+        VkDescriptorSetAllocateInfo allocInfo = {};
+        allocInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
+        allocInfo.descriptorPool = m_descriptorPool;
+        allocInfo.descriptorSetCount = 2;
+        allocInfo.pSetLayouts = setLayouts;
+        
+        created = vkAllocateDescriptorSets(m_device, &allocInfo, sets) == VK_SUCCESS;
+        if (created) {
+            m_target.resolveSet = sets[0];
+            m_target.compositeSet = sets[1];
+        }
+    }
+    
+    if (!created) {
+        printf("[TAA] Failed to create %ux%u render targets\n", extent.width, extent.height);
+        DestroyTarget(m_target);
+        m_targetFailed = true;
+        return false;
+    }
+    
+    VkDescriptorImageInfo imageInfos[3] = {};
+    VkImageView views[3] = { m_target.current.view, m_target.history.view, m_target.resolved.view };
+    for (uint32_t i = 0; i < 3; i++) {
+        imageInfos[i].sampler = m_sampler;
+        imageInfos[i].imageView = views[i];
+        imageInfos[i].imageLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+    }
+    
+    VkWriteDescriptorSet writes[3] = {};
+    for (uint32_t i = 0; i < 3; i++) {
+        writes[i].sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+        writes[i].dstSet = (i < 2) ? m_target.resolveSet : m_target.compositeSet;
+        writes[i].dstBinding = (i < 2) ? i : 0;
+        writes[i].descriptorCount = 1;
+        writes[i].descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+        writes[i].pImageInfo = &imageInfos[i];
+    }
+    vkUpdateDescriptorSets(m_device, 3, writes, 0, nullptr);
+    
+    return true;
+}
+
+void VulkanTemporalResolver::RetireTarget(uint64_t lastSubmitSerial) {
+    m_targetFailed = false;
+    if (!m_initialized || m_target.resolvedFramebuffer == VK_NULL_HANDLE) {
+        return;
+    }
+    
+    m_retiredTargets.Retire(m_target, lastSubmitSerial);
+    m_target = Target();
+}
+
+void VulkanTemporalResolver::ReleaseRetiredTargets(uint64_t completedSerial) {
+    m_retiredTargets.Release(completedSerial, [this](Target& target) { DestroyTarget(target); });
+}
+
+void VulkanTemporalResolver::DestroyAttachment(Attachment& attachment) {
+    if (attachment.view != VK_NULL_HANDLE) {
+        vkDestroyImageView(m_device, attachment.view, nullptr);
+        attachment.view = VK_NULL_HANDLE;
+    }
+    
+    if (attachment.image != VK_NULL_HANDLE) {
+        vkDestroyImage(m_device, attachment.image, nullptr);
+        attachment.image = VK_NULL_HANDLE;
+        VulkanMemoryAllocator::Release(m_allocator, m_device, attachment.allocation);
+    }
+}
+
+void VulkanTemporalResolver::DestroyTarget(Target& target) {
+    VkDescriptorSet* sets[] = { &target.resolveSet, &target.compositeSet };
+    for (VkDescriptorSet* set : sets) {
+        if (*set != VK_NULL_HANDLE) {
+            vkFreeDescriptorSets(m_device, m_descriptorPool, 1, set);
+            *set = VK_NULL_HANDLE;
+        }
+    }
+    
+    VkFramebuffer* framebuffers[] = { &target.sceneFramebuffer, &target.resolvedFramebuffer };
+    for (VkFramebuffer* framebuffer : framebuffers) {
+        if (*framebuffer != VK_NULL_HANDLE) {
+            vkDestroyFramebuffer(m_device, *framebuffer, nullptr);
+            *framebuffer = VK_NULL_HANDLE;
+        }
+    }
+    
+    DestroyAttachment(target.current);
+    DestroyAttachment(target.resolved);
+    DestroyAttachment(target.history);
+    target.historyInitialized = false;
+}
+
+void VulkanTemporalResolver::RecordScene(VkCommandBuffer commandBuffer, VkPipelineLayout pipelineLayout,
+                                         VkDescriptorSet sceneDescriptorSet, const VkClearValue& clearValue) {
+    if (m_scenePipeline == VK_NULL_HANDLE || m_target.sceneFramebuffer == VK_NULL_HANDLE) {
+        return;
+    }
+    
+    VkRenderPassBeginInfo renderPassInfo = {};
+    renderPassInfo.sType = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO;
+    renderPassInfo.renderPass = m_scenePass;
+    renderPassInfo.framebuffer = m_target.sceneFramebuffer;
+    renderPassInfo.renderArea.offset = {0, 0};
+    renderPassInfo.renderArea.extent = m_target.extent;
+    renderPassInfo.clearValueCount = 1;
+    renderPassInfo.pClearValues = &clearValue;
+    
+    // loading_cubes 全屏显示，视口覆盖整个目标
+    VkViewport viewport = {};
+    viewport.width = (float)m_target.extent.width;
+    viewport.height = (float)m_target.extent.height;
+    viewport.maxDepth = 1.0f;
+    
+    VkRect2D scissor = {};
+    scissor.extent = m_target.extent;
+    
+    vkCmdBeginRenderPass(commandBuffer, &renderPassInfo, VK_SUBPASS_CONTENTS_INLINE);
+    vkCmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, m_scenePipeline);
+    vkCmdSetViewport(commandBuffer, 0, 1, &viewport);
+    vkCmdSetScissor(commandBuffer, 0, 1, &scissor);
+    vkCmdBindDescriptorSets(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, pipelineLayout, 0, 1, &sceneDescriptorSet, 0, nullptr);
+    vkCmdDraw(commandBuffer, 6, 1, 0, 0);
+    vkCmdEndRenderPass(commandBuffer);
+}
+
+void VulkanTemporalResolver::RecordResolve(VkCommandBuffer commandBuffer, VkDescriptorSet sceneDescriptorSet) {
+    if (m_resolvePipeline == VK_NULL_HANDLE || m_target.resolvedFramebuffer == VK_NULL_HANDLE) {
+        return;
+    }
+    
+    // 新目标的历史尚未写入过：转换到可采样布局（本帧历史权重为 0，解析着色器不读取历史）
+    if (!m_target.historyInitialized) {
+        VkImageMemoryBarrier barrier = MakeImageBarrier(m_target.history.image, VK_IMAGE_LAYOUT_UNDEFINED,
+                                                        VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, 0, VK_ACCESS_SHADER_READ_BIT);
+        vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT,
+                             0, 0, nullptr, 0, nullptr, 1, &barrier);
+    }
+    
+    VkRenderPassBeginInfo renderPassInfo = {};
+    renderPassInfo.sType = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO;
+    renderPassInfo.renderPass = m_resolvePass;
+    renderPassInfo.framebuffer = m_target.resolvedFramebuffer;
+    renderPassInfo.renderArea.offset = {0, 0};
+    renderPassInfo.renderArea.extent = m_target.extent;
+    
+    VkViewport viewport = {};
+    viewport.width = (float)m_target.extent.width;
+    viewport.height = (float)m_target.extent.height;
+    viewport.maxDepth = 1.0f;
+    
+    VkRect2D scissor = {};
+    scissor.extent = m_target.extent;
+    
+    VkDescriptorSet sets[] = { sceneDescriptorSet, m_target.resolveSet };
+    vkCmdBeginRenderPass(commandBuffer, &renderPassInfo, VK_SUBPASS_CONTENTS_INLINE);
+    vkCmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, m_resolvePipeline);
+    vkCmdSetViewport(commandBuffer, 0, 1, &viewport);
+    vkCmdSetScissor(commandBuffer, 0, 1, &scissor);
+    vkCmdBindDescriptorSets(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, m_resolveLayout, 0, 2, sets, 0, nullptr);
+    vkCmdDraw(commandBuffer, 3, 1, 0, 0);
+    vkCmdEndRenderPass(commandBuffer);
+    
+    // 解析结果复制为下一帧的历史（交换链图像不能作为复制源，历史不能与解析目标共用）
+    VkImageMemoryBarrier toTransfer = MakeImageBarrier(m_target.history.image, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
+                                                       VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 0, VK_ACCESS_TRANSFER_WRITE_BIT);
+    vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT,
+                         0, 0, nullptr, 0, nullptr, 1, &toTransfer);
+    
+    VkImageCopy region = {};
+    region.srcSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+    region.srcSubresource.layerCount = 1;
+    region.dstSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+    region.dstSubresource.layerCount = 1;
+    region.extent.width = m_target.extent.width;
+    region.extent.height = m_target.extent.height;
+    region.extent.depth = 1;
+    vkCmdCopyImage(commandBuffer, m_target.resolved.image, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
+                   m_target.history.image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &region);
+    
+    // 解析结果供本帧合成通道采样，历史供下一帧解析通道采样
+    VkImageMemoryBarrier toShaderRead[2] = {
+        MakeImageBarrier(m_target.resolved.image, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
+                         0, VK_ACCESS_SHADER_READ_BIT),
+        MakeImageBarrier(m_target.history.image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
+                         VK_ACCESS_TRANSFER_WRITE_BIT, VK_ACCESS_SHADER_READ_BIT)
+    };
+    vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT,
+                         0, 0, nullptr, 0, nullptr, 2, toShaderRead);
+}
+
+void VulkanTemporalResolver::RecordComposite(VkCommandBuffer commandBuffer) {
+    if (m_compositePipeline == VK_NULL_HANDLE || m_target.compositeSet == VK_NULL_HANDLE) {
+        return;
+    }
+    
+    // 解析目标与输出图像同尺寸，逐像素采样；轻度锐化补偿历史双线性重采样的累积模糊
+    float width = (float)m_target.extent.width;
+    float height = (float)m_target.extent.height;
+    
+    CompositePushConstants constants = {};
+    constants.uvScale[0] = 1.0f;
+    constants.uvScale[1] = 1.0f;
+    constants.uvMax[0] = 1.0f - 0.5f / width;
+    constants.uvMax[1] = 1.0f - 0.5f / height;
+    constants.texelSize[0] = 1.0f / width;
+    constants.texelSize[1] = 1.0f / height;
+    constants.sharpness = config::TEMPORAL_AA_SHARPNESS;
+    
+    VkViewport viewport = {};
+    viewport.width = width;
+    viewport.height = height;
+    viewport.maxDepth = 1.0f;
+    
+    VkRect2D scissor = {};
+    scissor.extent = m_target.extent;
+    
+    vkCmdSetViewport(commandBuffer, 0, 1, &viewport);
+    vkCmdSetScissor(commandBuffer, 0, 1, &scissor);
+    
+    vkCmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, m_compositePipeline);
+    vkCmdBindDescriptorSets(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, m_compositeLayout, 0, 1, &m_target.compositeSet, 0, nullptr);
+    vkCmdPushConstants(commandBuffer, m_compositeLayout, VK_SHADER_STAGE_FRAGMENT_BIT, 0, sizeof(CompositePushConstants), &constants);
+    vkCmdDraw(commandBuffer, 3, 1, 0, 0);
+}
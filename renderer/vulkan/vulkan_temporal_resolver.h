@@ -0,0 +1,197 @@
+#pragma once
+
+#ifdef _WIN32
+#define VK_USE_PLATFORM_WIN32_KHR
+#endif
+#include <vulkan/vulkan.h>  // 3. 第三方库头文件
+
+#include <string>  // 2. 系统头文件
+#include <vector>  // 2. 系统头文件
+
+#include "core/interfaces/imemory_allocator.h"  // 4. 项目头文件（接口）
+#include "renderer/vulkan/vulkan_retire_queue.h"  // 4. 项目头文件（Vulkan）
+
+/**
+ * Vulkan 时间抗锯齿解析器 - loading_cubes 光线投射的时间累积路径
+ * 
+ * loading_cubes.frag 每个像素做 3x3 超采样（9 次光线投射）。时间抗锯齿路径每帧每个像素只做一次
+ * 带子像素抖动的光线投射，再与上一帧的结果混合，多帧累积后等效于超采样：
+ * 1. 场景通道：loading_cubes_taa.frag 写入当前帧目标（颜色 + 命中距离）
+ * 2. 解析通道：taa_resolve.frag 由命中距离重建命中点并按上一帧相机重投影，
+ *    读取历史（限制在本帧邻域颜色范围内）与本帧混合，写入解析目标
+ * 3. 解析目标复制到历史图像，供下一帧重投影
+ * 4. 主渲染通道开头把解析目标合成到交换链图像（复用放大着色器，附加轻度锐化补偿累积模糊）
+ * 
+ * 抖动、上一帧相机和历史权重通过场景统一缓冲区逐帧传入，录制结果可重复提交。
+ * 交换链图像只有颜色附件用途，不能作为复制源，因此历史单独保存，不直接读取上一帧的交换链图像。
+ * 
+ * 渲染目标所有交换链图像共用，首次使用时创建；交换链重建时旧目标随旧交换链一起退役，
+ * 等引用它们的提交完成后再销毁。新目标的历史图像在第一次提交时转换布局（此前历史无效）。
+ * 
+ * 使用方式：
+ * 1. 渲染通道和场景描述符集布局创建后调用 Initialize()（创建渲染通道、解析和合成管线）
+ * 2. 在场景管线预编译线程上调用 CreatePipeline()，在发布 loading_cubes 管线就绪之前完成
+ * 3. 每帧录制前调用 EnsureTarget()，成功后在主渲染通道之前依次调用 RecordScene()、RecordResolve()，
+ *    在主渲染通道内调用 RecordComposite()；提交后调用 MarkHistoryInitialized()
+ * 4. 交换链重建时调用 RetireTarget()，栅栏触发后调用 ReleaseRetiredTargets()
+ * 5. 设备空闲后调用 Cleanup()
+ */
+class VulkanTemporalResolver {
+public:
+    VulkanTemporalResolver();
+    ~VulkanTemporalResolver();
+    
+    /**
+     * 初始化解析器
+     * 
+     * @param device Vulkan设备句柄
+     * @param physicalDevice 物理设备句柄（用于分配渲染目标内存）
+     * @param allocator 共享内存分配器（可为 nullptr）
+     * @param sceneSetLayout 场景描述符集布局（解析通道读取相机和抖动参数）
+     * @param outputRenderPass 合成通道所在的主渲染通道
+     * @param pipelineCache 管线缓存（可为 VK_NULL_HANDLE）
+     * @param fullscreenVertPath 全屏三角形顶点着色器路径（.spv 或 GLSL 源文件）
+     * @param resolveFragPath 解析片段着色器路径
+     * @param compositeFragPath 合成片段着色器路径
+     * @return 成功返回 true，失败返回 false（调用方应只使用超采样光线投射）
+     */
+    bool Initialize(VkDevice device, VkPhysicalDevice physicalDevice, IMemoryAllocator* allocator,
+                    VkDescriptorSetLayout sceneSetLayout, VkRenderPass outputRenderPass, VkPipelineCache pipelineCache,
+                    const std::string& fullscreenVertPath, const std::string& resolveFragPath,
+                    const std::string& compositeFragPath);
+    
+    /**
+     * 销毁所有资源（调用前 GPU 必须已完成所有使用它们的提交）
+     */
+    void Cleanup();
+    
+    /**
+     * 创建单采样抖动光线投射的场景管线
+     * 
+     * @param pipelineLayout loading_cubes 场景管线布局
+     * @param pipelineCache 管线缓存（可为 VK_NULL_HANDLE）
+     * @param vertShaderPath 顶点着色器路径（.spv 或 GLSL 源文件）
+     * @param fragShaderPath 片段着色器路径（.spv 或 GLSL 源文件）
+     * @return 成功返回 true，失败返回 false
+     */
+    bool CreatePipeline(VkPipelineLayout pipelineLayout, VkPipelineCache pipelineCache,
+                        const std::string& vertShaderPath, const std::string& fragShaderPath);
+    
+    /**
+     * 场景管线是否已创建（只能在 loading_cubes 管线就绪发布之后调用）
+     */
+    bool HasPipeline() const { return m_scenePipeline != VK_NULL_HANDLE; }
+    
+    /**
+     * 确保存在与交换链同尺寸的渲染目标（已存在时直接返回）
+     * 
+     * @param extent 交换链尺寸
+     * @return 成功返回 true，失败返回 false（本帧应使用超采样光线投射）
+     */
+    bool EnsureTarget(VkExtent2D extent);
+    
+    /**
+     * 当前目标的历史图像是否已转换到可采样布局（为 false 时 RecordResolve 录制布局转换，本帧历史无效）
+     */
+    bool IsHistoryInitialized() const { return m_target.historyInitialized; }
+    
+    /**
+     * 录制了历史布局转换的命令缓冲区提交后调用
+     */
+    void MarkHistoryInitialized() { m_target.historyInitialized = m_target.resolvedFramebuffer != VK_NULL_HANDLE; }
+    
+    /**
+     * 退役当前渲染目标（交换链重建时调用，下次 EnsureTarget 重新创建）
+     * 
+     * @param lastSubmitSerial 最后一次可能引用该目标的提交序号
+     */
+    void RetireTarget(uint64_t lastSubmitSerial);
+    
+    /**
+     * 销毁已完成提交不再引用的退役目标
+     * 
+     * @param completedSerial 已完成的最大提交序号
+     */
+    void ReleaseRetiredTargets(uint64_t completedSerial);
+    
+    /**
+     * 录制场景通道（必须在渲染通道之外调用）
+     * 
+     * @param commandBuffer 主命令缓冲区
+     * @param pipelineLayout loading_cubes 场景管线布局
+     * @param sceneDescriptorSet 该图像的场景描述符集
+     * @param clearValue 背景颜色
+     */
+    void RecordScene(VkCommandBuffer commandBuffer, VkPipelineLayout pipelineLayout, VkDescriptorSet sceneDescriptorSet,
+                     const VkClearValue& clearValue);
+    
+    /**
+     * 录制解析通道和历史更新（必须在渲染通道之外、RecordScene 之后调用）
+     * 
+     * @param commandBuffer 主命令缓冲区
+     * @param sceneDescriptorSet 该图像的场景描述符集
+     */
+    void RecordResolve(VkCommandBuffer commandBuffer, VkDescriptorSet sceneDescriptorSet);
+    
+    /**
+     * 把解析结果合成到整个输出图像（在主渲染通道内调用，会改变视口和裁剪矩形）
+     * 
+     * @param commandBuffer 主命令缓冲区
+     */
+    void RecordComposite(VkCommandBuffer commandBuffer);
+
+private:
+    // 禁止拷贝和赋值
+    VulkanTemporalResolver(const VulkanTemporalResolver&) = delete;
+    VulkanTemporalResolver& operator=(const VulkanTemporalResolver&) = delete;
+    
+    // 一个渲染目标图像
+    struct Attachment {
+        VkImage image = VK_NULL_HANDLE;
+        MemoryAllocation allocation;
+        VkImageView view = VK_NULL_HANDLE;
+    };
+    
+    // 一组与交换链尺寸匹配的渲染目标
+    struct Target {
+        VkExtent2D extent = {0, 0};
+        Attachment current;                            // 本帧抖动采样（场景通道写入）
+        Attachment resolved;                           // 解析结果（解析通道写入，合成通道读取）
+        Attachment history;                            // 上一帧解析结果的副本（解析通道读取）
+        VkFramebuffer sceneFramebuffer = VK_NULL_HANDLE;
+        VkFramebuffer resolvedFramebuffer = VK_NULL_HANDLE;
+        VkDescriptorSet resolveSet = VK_NULL_HANDLE;   // 当前帧 + 历史
+        VkDescriptorSet compositeSet = VK_NULL_HANDLE; // 解析结果
+        bool historyInitialized = false;
+    };
+    
+    bool CreateRenderPasses();
+    bool CreateDescriptorResources(VkDescriptorSetLayout sceneSetLayout);
+    VkPipeline CreateFullscreenPipeline(VkPipelineLayout pipelineLayout, VkRenderPass renderPass, VkPipelineCache pipelineCache,
+                                        const std::string& vertShaderPath, const std::string& fragShaderPath);
+    bool CreateAttachment(VkExtent2D extent, VkImageUsageFlags usage, Attachment& attachment);
+    void DestroyAttachment(Attachment& attachment);
+    void DestroyTarget(Target& target);
+    
+    VkDevice m_device = VK_NULL_HANDLE;
+    VkPhysicalDevice m_physicalDevice = VK_NULL_HANDLE;
+    IMemoryAllocator* m_allocator = nullptr;  // [BORROW] 由渲染器拥有
+    
+    VkRenderPass m_scenePass = VK_NULL_HANDLE;    // 结束时转换到着色器只读布局
+    VkRenderPass m_resolvePass = VK_NULL_HANDLE;  // 结束时转换到复制源布局
+    VkSampler m_sampler = VK_NULL_HANDLE;
+    VkDescriptorSetLayout m_resolveSetLayout = VK_NULL_HANDLE;
+    VkDescriptorSetLayout m_compositeSetLayout = VK_NULL_HANDLE;
+    VkDescriptorPool m_descriptorPool = VK_NULL_HANDLE;
+    VkPipelineLayout m_resolveLayout = VK_NULL_HANDLE;
+    VkPipelineLayout m_compositeLayout = VK_NULL_HANDLE;
+    VkPipeline m_scenePipeline = VK_NULL_HANDLE;
+    VkPipeline m_resolvePipeline = VK_NULL_HANDLE;
+    VkPipeline m_compositePipeline = VK_NULL_HANDLE;
+    
+    Target m_target;                  // 当前交换链的渲染目标（resolvedFramebuffer 为空表示尚未创建）
+    bool m_targetFailed = false;      // 当前交换链尺寸下创建失败（不再每帧重试，交换链重建后重置）
+    RetireQueue<Target> m_retiredTargets;
+    
+    bool m_initialized = false;
+};
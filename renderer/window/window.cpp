@@ -352,10 +352,6 @@ void Window::Destroy() {
 void Window::ToggleFullscreen() {
 }
 
-void Window::ShowError(const std::string& message) {
-    MessageBoxA(NULL, message.c_str(), "Error", MB_OK | MB_ICONERROR);
-}
-
 void Window::ProcessMessages() {
     MSG msg = {};
     while (PeekMessage(&msg, NULL, 0, 0, PM_REMOVE)) {
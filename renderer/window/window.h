@@ -1,10 +1,13 @@
 #pragma once
 
-#define NOMINMAX  // 禁用Windows.h中的min/max宏，避免与Gdiplus冲突
 #include <string>     // 2. 系统头文件
+
+#ifdef _WIN32
+#define NOMINMAX  // 禁用Windows.h中的min/max宏，避免与Gdiplus冲突
 #include <windows.h>  // 2. 系统头文件
 
 #include "core/interfaces/iwindow.h"  // 4. 项目头文件（接口）
+#endif
 
 // 前向声明
 class IEventBus;
@@ -15,9 +18,63 @@ class IEventBus;
  * 使用实例成员而非静态成员，支持依赖注入和多窗口实例
  * 通过事件总线处理输入事件，实现组件间解耦
  * 实现 IWindow 接口以支持窗口实现的替换和测试
+ * 
+ * 错误报告（ShowError / ErrorCapture）与平台无关，实现在 window_errors.cpp；
+ * 非 Windows 平台只有 headless 模式，没有窗口实现，只声明错误报告部分
  */
+#ifdef _WIN32
 class Window : public IWindow {
+#else
+class Window {
+#endif
 public:
+    /**
+     * 显示错误消息框
+     * 当前线程上存在 ErrorCapture 时只记录消息；对话框被关闭时（headless 模式）写入 stderr
+     * @param message 错误消息
+     */
+    static void ShowError(const std::string& message);
+    
+    /**
+     * 设置是否用模态对话框报告错误（headless 模式关闭，没有用户可以关闭对话框）
+     * @param enabled 为 false 时 ShowError 把错误写入 stderr 并记录，调用方据此以非零代码退出
+     */
+    static void SetErrorDialogsEnabled(bool enabled);
+    
+    /**
+     * 对话框关闭期间是否报告过错误
+     * @return 报告过返回 true
+     */
+    static bool HasReportedErrors();
+    
+    /**
+     * 错误收集作用域 - 在当前线程上收集 ShowError 的消息而不弹出模态对话框
+     * 
+     * 工作线程（如场景管线预编译）不能弹出对话框：在工作线程上创建该对象，
+     * 失败时把收集到的消息作为状态交回主线程，由主线程调用 ShowError 报告
+     * 作用域结束时恢复之前的行为（可嵌套）
+     */
+    class ErrorCapture {
+    public:
+        ErrorCapture();
+        ~ErrorCapture();
+        
+        bool HasErrors() const { return !m_errors.empty(); }
+        
+        // 取出已收集的消息（多条消息以换行分隔），之后重新开始收集
+        std::string TakeErrors();
+        
+    private:
+        friend class Window;
+        
+        ErrorCapture(const ErrorCapture&) = delete;
+        ErrorCapture& operator=(const ErrorCapture&) = delete;
+        
+        std::string m_errors;
+        ErrorCapture* m_previous = nullptr;
+    };
+    
+#ifdef _WIN32
     Window();
     ~Window();
     
@@ -74,12 +131,6 @@ public:
      */
     bool IsKeyPressed(int keyCode) const override;
     
-    /**
-     * 显示错误消息框
-     * @param message 错误消息
-     */
-    static void ShowError(const std::string& message);
-    
     /**
      * 设置事件总线（用于发布输入事件）
      * 通过依赖注入接收事件总线，实现组件间解耦
@@ -107,5 +158,6 @@ private:
     int m_lastMouseY = 0;
     bool m_leftButtonDown = false;
     bool m_keyStates[256] = {false};
+#endif
 };
 
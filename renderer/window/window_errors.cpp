@@ -0,0 +1,56 @@
+#include "window/window.h"
+
+#include <atomic>
+#include <stdio.h>
+
+// 错误报告与窗口实现分开编译：非 Windows 平台的 headless 构建只链接这一部分
+
+namespace {
+    // 当前线程的错误收集作用域（为空时直接报告）
+    thread_local Window::ErrorCapture* t_errorCapture = nullptr;
+    
+    // headless 模式下不弹出对话框，错误写入 stderr
+    std::atomic<bool> g_errorDialogsEnabled{true};
+    std::atomic<bool> g_errorReported{false};
+}
+
+void Window::ShowError(const std::string& message) {
+    if (t_errorCapture) {
+        if (!t_errorCapture->m_errors.empty()) {
+            t_errorCapture->m_errors += "\n";
+        }
+        t_errorCapture->m_errors += message;
+        return;
+    }
+#ifdef _WIN32
+    if (g_errorDialogsEnabled.load()) {
+        MessageBoxA(NULL, message.c_str(), "Error", MB_OK | MB_ICONERROR);
+        return;
+    }
+#endif
+    fprintf(stderr, "[ERROR] %s\n", message.c_str());
+    fflush(stderr);
+    g_errorReported.store(true);
+}
+
+void Window::SetErrorDialogsEnabled(bool enabled) {
+    g_errorDialogsEnabled.store(enabled);
+}
+
+bool Window::HasReportedErrors() {
+    return g_errorReported.load();
+}
+
+Window::ErrorCapture::ErrorCapture() : m_previous(t_errorCapture) {
+    t_errorCapture = this;
+}
+
+Window::ErrorCapture::~ErrorCapture() {
+    t_errorCapture = m_previous;
+}
+
+std::string Window::ErrorCapture::TakeErrors() {
+    std::string errors;
+    errors.swap(m_errors);
+    return errors;
+}
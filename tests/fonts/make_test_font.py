@@ -0,0 +1,111 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+生成文字模块检查使用的最小 TrueType 字体（tests/fonts/test_shapes.ttf）
+字形坐标都是已知的简单形状，检查可以按像素验证光栅化和距离场的结果：
+    U+0041 'A'：实心正方形 (100, 0) - (700, 600)
+    U+0042 'B'：同样的正方形，中间挖去 (300, 200) - (500, 400) 的方孔（内轮廓反向）
+    U+0043 'C'：四个控制点都不在曲线上的圆角形状（控制点为正方形的四角，只用二次曲线）
+字体单位 1000/em，上升高度 800，下降高度 200；修改形状后需要同步更新 tests/text_tests.cpp
+"""
+
+import struct
+from pathlib import Path
+
+UNITS_PER_EM = 1000
+ASCENDER = 800
+DESCENDER = -200
+
+# 每个字形：(前进距离, 轮廓列表)，轮廓为 (x, y, 是否在曲线上) 的列表，外轮廓顺时针
+SQUARE = [(100, 0, True), (100, 600, True), (700, 600, True), (700, 0, True)]
+HOLE = [(300, 200, True), (500, 200, True), (500, 400, True), (300, 400, True)]
+ROUNDED = [(100, 0, False), (100, 600, False), (700, 600, False), (700, 0, False)]
+GLYPHS = [
+    (500, []),                 # .notdef（空白）
+    (800, [SQUARE]),           # 'A'
+    (800, [SQUARE, HOLE]),     # 'B'
+    (800, [ROUNDED]),          # 'C'
+]
+FIRST_CHAR = 0x41
+
+
+def build_glyph(contours):
+    """编码简单字形（坐标一律使用 16 位增量，不使用标志重复）"""
+    if not contours:
+        return b''
+    points = [point for contour in contours for point in contour]
+    xs = [p[0] for p in points]
+    ys = [p[1] for p in points]
+    data = struct.pack('>hhhhh', len(contours), min(xs), min(ys), max(xs), max(ys))
+    end = -1
+    for contour in contours:
+        end += len(contour)
+        data += struct.pack('>H', end)
+    data += struct.pack('>H', 0)  # 没有指令
+    data += bytes(0x01 if p[2] else 0x00 for p in points)
+    for axis in range(2):
+        previous = 0
+        for point in points:
+            data += struct.pack('>h', point[axis] - previous)
+            previous = point[axis]
+    # loca 使用短格式（偏移 / 2），字形数据按 4 字节对齐
+    return data + b'\0' * (-len(data) % 4)
+
+
+def build_cmap():
+    """格式 4：FIRST_CHAR 开始的连续字符映射到字形 1..N，加上结尾的 0xFFFF 区间"""
+    last_char = FIRST_CHAR + len(GLYPHS) - 2
+    ends = [last_char, 0xFFFF]
+    starts = [FIRST_CHAR, 0xFFFF]
+    deltas = [(1 - FIRST_CHAR) & 0xFFFF, 1]
+    seg_count = len(ends)
+    subtable = struct.pack('>HHHHHHH', 4, 16 + seg_count * 8, 0, seg_count * 2, 4, 1, 0)
+    subtable += struct.pack('>%dH' % seg_count, *ends) + struct.pack('>H', 0)
+    subtable += struct.pack('>%dH' % seg_count, *starts)
+    subtable += struct.pack('>%dH' % seg_count, *deltas)
+    subtable += struct.pack('>%dH' % seg_count, *([0] * seg_count))
+    return struct.pack('>HHHHI', 0, 1, 3, 1, 12) + subtable
+
+
+def checksum(data):
+    data += b'\0' * (-len(data) % 4)
+    return sum(struct.unpack('>%dI' % (len(data) // 4), data)) & 0xFFFFFFFF
+
+
+def build_font():
+    glyf = b''
+    loca = [0]
+    for _, contours in GLYPHS:
+        glyf += build_glyph(contours)
+        loca.append(len(glyf))
+    advance_max = max(advance for advance, _ in GLYPHS)
+
+    tables = {
+        'cmap': build_cmap(),
+        'glyf': glyf,
+        'head': struct.pack('>IIIIHHqqhhhhHHhhh', 0x00010000, 0x00010000, 0, 0x5F0F3CF5, 0x000B,
+                            UNITS_PER_EM, 0, 0, 0, DESCENDER, advance_max, ASCENDER, 0, 8, 2, 0, 0),
+        'hhea': struct.pack('>IhhhHhhhhhhhhhhhH', 0x00010000, ASCENDER, DESCENDER, 0, advance_max,
+                            0, 0, advance_max, 1, 0, 0, 0, 0, 0, 0, 0, len(GLYPHS)),
+        'hmtx': b''.join(struct.pack('>Hh', advance, 0) for advance, _ in GLYPHS),
+        'loca': struct.pack('>%dH' % len(loca), *[offset // 2 for offset in loca]),
+        'maxp': struct.pack('>IHHHHHHHHHHHHHH', 0x00010000, len(GLYPHS), 8, 2, 0, 0, 2,
+                            0, 0, 0, 0, 0, 0, 0, 0),
+    }
+
+    tags = sorted(tables)
+    header = struct.pack('>IHHHH', 0x00010000, len(tags), 64, 2, len(tags) * 16 - 64)
+    offset = 12 + len(tags) * 16
+    records = b''
+    body = b''
+    for tag in tags:
+        data = tables[tag]
+        records += struct.pack('>4sIII', tag.encode('ascii'), checksum(data), offset + len(body), len(data))
+        body += data + b'\0' * (-len(data) % 4)
+    return header + records + body
+
+
+if __name__ == '__main__':
+    output = Path(__file__).resolve().parent / 'test_shapes.ttf'
+    output.write_bytes(build_font())
+    print('Wrote ' + str(output))
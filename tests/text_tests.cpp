@@ -0,0 +1,199 @@
+// 文字模块的可移植检查：UTF-8 解码、字形表、TrueType 光栅化和距离场，不依赖 Vulkan 和 Windows API
+// 构建并运行：scons test（或直接编译 tests/text_tests.cpp 和 renderer/text/ 下的 utf8.cpp、
+// truetype_font_rasterizer.cpp、distance_field.cpp），在仓库根目录运行以找到 tests/fonts/test_shapes.ttf
+
+#include <cstdint>  // 2. 系统头文件
+#include <stdio.h>  // 2. 系统头文件
+#include <string>   // 2. 系统头文件
+#include <vector>   // 2. 系统头文件
+
+#include "text/distance_field.h"            // 4. 项目头文件
+#include "text/glyph_table.h"               // 4. 项目头文件
+#include "text/truetype_font_rasterizer.h"  // 4. 项目头文件
+#include "text/utf8.h"                      // 4. 项目头文件
+
+namespace {
+
+int g_failures = 0;
+
+void Check(bool condition, const char* name) {
+    if (!condition) {
+        printf("[TEST] FAILED: %s\n", name);
+        g_failures++;
+    }
+}
+
+void CheckDecode(const std::string& text, const std::vector<uint32_t>& expected, const char* name) {
+    std::vector<uint32_t> decoded = DecodeUtf8(text);
+    bool match = decoded == expected;
+    if (!match) {
+        printf("[TEST] %s decoded to", name);
+        for (uint32_t codePoint : decoded) {
+            printf(" U+%04X", codePoint);
+        }
+        printf("\n");
+    }
+    Check(match, name);
+}
+
+void TestDecodeUtf8() {
+    const uint32_t R = 0xFFFD;
+
+    // 有效序列（含 4 字节序列和各长度的边界值）
+    CheckDecode("A", { 0x41 }, "ascii");
+    CheckDecode("\xC3\xA9", { 0xE9 }, "two-byte");
+    CheckDecode("\xE4\xB8\xAD\xE6\x96\x87", { 0x4E2D, 0x6587 }, "three-byte CJK");
+    CheckDecode("\xF0\x9F\x98\x80", { 0x1F600 }, "four-byte emoji");
+    CheckDecode("\xF0\x90\x80\x80", { 0x10000 }, "four-byte lowest");
+    CheckDecode("\xF4\x8F\xBF\xBF", { 0x10FFFF }, "four-byte highest");
+    CheckDecode("\xEF\xBF\xBF\xED\x9F\xBF\xEE\x80\x80", { 0xFFFF, 0xD7FF, 0xE000 }, "around surrogates");
+    CheckDecode("a\xF0\x9F\x98\x80z", { 0x61, 0x1F600, 0x7A }, "four-byte between ascii");
+
+    // 过长编码
+    CheckDecode("\xC0\xAF", { R, R }, "overlong two-byte");
+    CheckDecode("\xC1\xBF", { R, R }, "overlong two-byte C1");
+    CheckDecode("\xE0\x80\xAF", { R, R, R }, "overlong three-byte");
+    CheckDecode("\xF0\x8F\xBF\xBF", { R, R, R, R }, "overlong four-byte");
+
+    // 代理码位和超出 U+10FFFF 的值
+    CheckDecode("\xED\xA0\x80", { R, R, R }, "high surrogate");
+    CheckDecode("\xED\xBF\xBF", { R, R, R }, "low surrogate");
+    CheckDecode("\xF4\x90\x80\x80", { R, R, R, R }, "above U+10FFFF");
+    CheckDecode("\xF5\x80\x80\x80", { R, R, R, R }, "lead byte F5");
+    CheckDecode("\xFF", { R }, "lead byte FF");
+
+    // 孤立的后续字节和截断序列（之后的有效字符不受影响）
+    CheckDecode("\x80", { R }, "lone continuation");
+    CheckDecode("\xE4\xB8" "a", { R, 0x61 }, "truncated three-byte");
+    CheckDecode("\xF0\x9F\x98", { R }, "truncated four-byte at end");
+    CheckDecode("\xF0\x9F" "\xC3\xA9", { R, 0xE9 }, "truncated four-byte before two-byte");
+}
+
+void TestGlyphTable() {
+    GlyphTable<int> table;
+    Check(table.Find('A') == nullptr, "empty table");
+
+    // Latin-1 直接索引、BMP 和增补平面走开放寻址表
+    const uint32_t codes[] = { 0x41, 0xE9, 0x4E2D, 0x6587, 0x1F600, 0x10FFFF };
+    for (uint32_t code : codes) {
+        table.Insert(code, (int)code);
+    }
+    Check(table.Size() == 6, "size after insert");
+    for (uint32_t code : codes) {
+        int* value = table.Find(code);
+        Check(value != nullptr && *value == (int)code, "find inserted");
+    }
+
+    table.Erase(0x1F600);
+    table.Erase(0x41);
+    Check(table.Find(0x1F600) == nullptr && table.Find(0x41) == nullptr, "erase");
+    Check(table.Find(0x10FFFF) != nullptr, "find after erase");
+    Check(table.Size() == 4, "size after erase");
+
+    // 触发多次重建后所有条目仍可找到
+    for (uint32_t code = 0x4E00; code < 0x4E00 + 4000; code++) {
+        table.Insert(code, (int)code);
+    }
+    bool allFound = true;
+    for (uint32_t code = 0x4E00; code < 0x4E00 + 4000; code++) {
+        int* value = table.Find(code);
+        allFound = allFound && value != nullptr && *value == (int)code;
+    }
+    Check(allFound, "find after rehash");
+    Check(table.Find(0x10FFFF) != nullptr && table.Find(0xE9) != nullptr, "old entries after rehash");
+
+    table.Clear();
+    Check(table.Size() == 0 && table.Find(0x4E2D) == nullptr, "clear");
+}
+
+// 由 tests/fonts/make_test_font.py 生成：1000 单位/em，上升高度 800，下降高度 200
+const char* TEST_FONT_PATH = "tests/fonts/test_shapes.ttf";
+
+uint8_t PixelAt(const GlyphBitmap& bitmap, uint32_t x, uint32_t y) {
+    return x < bitmap.width && y < bitmap.height ? bitmap.pixels[(size_t)y * bitmap.width + x] : 0;
+}
+
+// 覆盖率之和换算为完全覆盖的像素数
+float CoveredPixels(const GlyphBitmap& bitmap) {
+    float sum = 0.0f;
+    for (uint8_t value : bitmap.pixels) {
+        sum += value / 255.0f;
+    }
+    return sum;
+}
+
+bool Near(float value, float expected, float tolerance) {
+    return value >= expected - tolerance && value <= expected + tolerance;
+}
+
+void TestRasterizer() {
+    // 50 像素字号：1 像素 = 20 字体单位，字形轮廓都落在整像素上
+    const uint32_t P = 6;  // 留白（同时作为距离场范围）
+    TrueTypeFontRasterizer rasterizer;
+    GlyphBitmap bitmap;
+    Check(!rasterizer.RasterizeGlyph('A', P, 256, 256, bitmap), "rasterize before load");
+    if (!rasterizer.LoadFont(TEST_FONT_PATH, 50)) {
+        printf("[TEST] Cannot load %s (run from the repository root)\n", TEST_FONT_PATH);
+        Check(false, "load test font");
+        return;
+    }
+    
+    FontMetrics metrics = rasterizer.GetMetrics();
+    Check(Near(metrics.ascent, 40.0f, 0.001f), "metrics ascent");
+    Check(Near(metrics.lineHeight, 50.0f, 0.001f), "metrics line height");
+    
+    // 'A'：正方形 (100, 0) - (700, 600)，即位图中 x [P+5, P+35)、y [P+10, P+40)（基线在 P+40）
+    Check(rasterizer.RasterizeGlyph('A', P, 256, 256, bitmap), "rasterize square");
+    Check(bitmap.charCode == 'A' && Near(bitmap.advanceX, 40.0f, 0.001f), "square advance");
+    Check(bitmap.width == 40 + P * 2 && bitmap.height == 50 + P * 2, "square bitmap size");
+    Check(bitmap.pixels.size() == (size_t)bitmap.width * bitmap.height, "square pixel count");
+    Check(PixelAt(bitmap, P + 5, P + 10) == 255 && PixelAt(bitmap, P + 34, P + 39) == 255, "square corners covered");
+    Check(PixelAt(bitmap, P + 4, P + 25) == 0 && PixelAt(bitmap, P + 35, P + 25) == 0 &&
+          PixelAt(bitmap, P + 20, P + 9) == 0 && PixelAt(bitmap, P + 20, P + 40) == 0, "square outside empty");
+    Check(Near(CoveredPixels(bitmap), 900.0f, 1.0f), "square area");
+    
+    // 距离场：轮廓两侧相邻的像素落在 128 两边，距离超过留白处饱和
+    std::vector<uint8_t> field(bitmap.pixels.size());
+    BuildDistanceField(bitmap.pixels.data(), bitmap.width, bitmap.height, (float)P, field.data());
+    auto fieldAt = [&](uint32_t x, uint32_t y) { return field[(size_t)y * bitmap.width + x]; };
+    Check(fieldAt(P + 20, P + 25) == 255, "field inside saturated");
+    Check(fieldAt(0, 0) == 0 && fieldAt(P + 20, 0) == 0, "field outside saturated");
+    Check(fieldAt(P + 5, P + 25) > 128 && fieldAt(P + 5, P + 25) < 255, "field inner edge");
+    Check(fieldAt(P + 4, P + 25) < 128 && fieldAt(P + 4, P + 25) > 0, "field outer edge");
+    Check(fieldAt(P + 6, P + 25) > fieldAt(P + 5, P + 25) && fieldAt(P + 3, P + 25) < fieldAt(P + 4, P + 25),
+          "field increases inward");
+    
+    // 'B'：同样的正方形中挖去 (300, 200) - (500, 400) 的方孔（内轮廓反向）
+    Check(rasterizer.RasterizeGlyph('B', P, 256, 256, bitmap), "rasterize ring");
+    Check(PixelAt(bitmap, P + 20, P + 25) == 0, "ring hole empty");
+    Check(PixelAt(bitmap, P + 8, P + 25) == 255 && PixelAt(bitmap, P + 20, P + 35) == 255, "ring covered");
+    Check(Near(CoveredPixels(bitmap), 800.0f, 1.0f), "ring area");
+    
+    // 'C'：控制点全部不在曲线上，隐含的曲线上点是各边中点；每段二次曲线在弦外增加三角形面积的 2/3
+    Check(rasterizer.RasterizeGlyph('C', P, 256, 256, bitmap), "rasterize curves");
+    Check(PixelAt(bitmap, P + 20, P + 25) == 255, "curves center covered");
+    Check(PixelAt(bitmap, P + 5, P + 10) == 0 && PixelAt(bitmap, P + 34, P + 39) == 0, "curves corners empty");
+    Check(Near(CoveredPixels(bitmap), 750.0f, 7.5f), "curves area");
+    
+    // 字体中没有的字符使用字形 0（空白），超出最大尺寸的部分裁剪
+    Check(rasterizer.RasterizeGlyph('Z', P, 256, 256, bitmap), "rasterize missing");
+    Check(Near(bitmap.advanceX, 25.0f, 0.001f) && CoveredPixels(bitmap) == 0.0f, "missing glyph blank");
+    Check(rasterizer.RasterizeGlyph('A', P, 20, 30, bitmap), "rasterize clipped");
+    Check(bitmap.width == 20 && bitmap.height == 30 && bitmap.pixels.size() == 600, "clipped size");
+    Check(PixelAt(bitmap, P + 5, P + 10) == 255 && PixelAt(bitmap, 19, 29) == 255, "clipped content");
+}
+
+} // namespace
+
+int main() {
+    TestDecodeUtf8();
+    TestGlyphTable();
+    TestRasterizer();
+
+    if (g_failures > 0) {
+        printf("[TEST] %d check(s) failed\n", g_failures);
+        return 1;
+    }
+    printf("[TEST] All text checks passed\n");
+    return 0;
+}